@@ -255,7 +255,7 @@ namespace components::compute {
     // WARNING: array size, names order, uid and signatures has to be the same as in register_default_functions()
     // TODO: could be constexpr after C++20
     // TODO: initialize DEFAULT_FUNCTIONS with register_default_functions() call
-    static const std::array<std::pair<std::string, registered_func_id>, 5> DEFAULT_FUNCTIONS{
+    static const std::array<std::pair<std::string, registered_func_id>, 9> DEFAULT_FUNCTIONS{
         std::pair<std::string, registered_func_id>{
             "sum",
             {0, {kernel_signature_t{{numeric_types_matcher()}, {output_type::computed(same_type_resolver(0))}}}}},
@@ -272,7 +272,24 @@ namespace components::compute {
               kernel_signature_t{{}, {output_type::fixed(types::logical_type::UBIGINT)}}}}},
         std::pair<std::string, registered_func_id>{
             "avg",
-            {4, {kernel_signature_t{{numeric_types_matcher()}, {output_type::computed(same_type_resolver(0))}}}}}};
+            {4, {kernel_signature_t{{numeric_types_matcher()}, {output_type::computed(same_type_resolver(0))}}}}},
+        std::pair<std::string, registered_func_id>{
+            "approx_count_distinct",
+            {5,
+             {kernel_signature_t{{always_true_type_matcher()}, {output_type::fixed(types::logical_type::UBIGINT)}}}}},
+        std::pair<std::string, registered_func_id>{
+            "approx_quantile",
+            {6,
+             {kernel_signature_t{{numeric_types_matcher(), numeric_types_matcher()},
+                                 {output_type::fixed(types::logical_type::DOUBLE)}}}}},
+        std::pair<std::string, registered_func_id>{
+            "approx_median",
+            {7, {kernel_signature_t{{numeric_types_matcher()}, {output_type::fixed(types::logical_type::DOUBLE)}}}}},
+        std::pair<std::string, registered_func_id>{
+            "approx_top_k",
+            {8,
+             {kernel_signature_t{{always_true_type_matcher(), integer_types_matcher()},
+                                 {output_type::computed(list_type_resolver(0))}}}}}};
 
     void register_default_functions(function_registry_t& registry);
 
@@ -92,6 +92,14 @@ namespace components::compute {
         };
     }
 
+    type_resolver_fn list_type_resolver(size_t input_index) {
+        return [input_index](const std::pmr::vector<fixed_t>& in) -> compute_result<fixed_t> {
+            if (in.size() <= input_index)
+                return compute_status::invalid("No inputs");
+            return types::complex_logical_type::create_list(in[input_index]);
+        };
+    }
+
     /*
     * Deducing conflicts and ambiguity
     * In case we have a conflict, we move to the next check, which can resolve it
@@ -52,6 +52,7 @@ namespace components::compute {
     type_matcher_fn always_true_type_matcher();
 
     type_resolver_fn same_type_resolver(size_t input_index);
+    type_resolver_fn list_type_resolver(size_t input_index);
 
     // Returns true if there are no conflicts
     bool check_signature_conflicts(
@@ -1,5 +1,14 @@
 #include "../function.hpp"
 #include <components/types/logical_value.hpp>
+#include <components/types/operations_helper.hpp>
+#include <components/vector/vector_hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <optional>
+#include <unordered_map>
 
 using namespace components::compute;
 using namespace components::types;
@@ -412,6 +421,405 @@ namespace {
         return compute_status::ok();
     }
 
+    // Approximate aggregates keep a bounded sketch per state: every batch fills its own sketch and
+    // merge combines two of them, so a column can be consumed in any split and in any order.
+
+    // Input column as a flat vector; a constant or dictionary column is flattened into `holder`
+    const vector_t& flat_column(const vector_t& v, size_t count, std::optional<vector_t>& holder) {
+        if (v.get_vector_type() == vector_type::FLAT) {
+            return v;
+        }
+        holder.emplace(v);
+        holder->flatten(count);
+        return *holder;
+    }
+
+    template<typename T = void>
+    struct hash_operator_t;
+
+    template<>
+    struct hash_operator_t<void> {
+        template<typename T>
+        void operator()(const vector_t& v, size_t count, std::vector<uint64_t>& hashes) const {
+            const auto& validity = v.validity();
+            for (size_t i = 0; i < count; i++) {
+                if (!validity.row_is_valid(i)) {
+                    continue;
+                }
+                if constexpr (std::is_arithmetic_v<T>) {
+                    hashes.push_back(hash_value(v.data<T>()[i]));
+                } else {
+                    hashes.push_back(hash_mix(v.value(i).hash()));
+                }
+            }
+        }
+    };
+
+    // Hashes of the non-null rows
+    void hash_rows(const vector_t& v, size_t count, std::vector<uint64_t>& hashes) {
+        hashes.reserve(count);
+        if (is_numeric(v.type().type())) {
+            simple_physical_type_switch<hash_operator_t>(v.type().to_physical_type(), v, count, hashes);
+            return;
+        }
+        if (v.type().type() == logical_type::STRING_LITERAL) {
+            auto data = v.data<string_t>();
+            for (size_t i = 0; i < count; i++) {
+                if (v.validity().row_is_valid(i)) {
+                    hashes.push_back(hash_value(data[i]));
+                }
+            }
+            return;
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (v.validity().row_is_valid(i)) {
+                hashes.push_back(hash_mix(v.value(i).hash()));
+            }
+        }
+    }
+
+    // HyperLogLog with 2^12 one-byte registers: ~1.6% standard error, 4KB per state
+    constexpr size_t hll_precision = 12;
+    constexpr size_t hll_registers = size_t{1} << hll_precision;
+
+    struct approx_count_distinct_kernel_state : kernel_state {
+        std::array<uint8_t, hll_registers> registers{};
+    };
+
+    static compute_result<kernel_state_ptr> approx_count_distinct_init(kernel_context&, kernel_init_args) {
+        return compute_result<kernel_state_ptr>(std::make_unique<approx_count_distinct_kernel_state>());
+    }
+
+    static compute_status
+    approx_count_distinct_consume(kernel_context& ctx, const data_chunk_t& in, size_t exec_length) {
+        auto* acc = static_cast<approx_count_distinct_kernel_state*>(ctx.state());
+        std::optional<vector_t> holder;
+        std::vector<uint64_t> hashes;
+        hash_rows(flat_column(in.data[0], exec_length, holder), exec_length, hashes);
+        for (auto h : hashes) {
+            auto index = static_cast<size_t>(h >> (64 - hll_precision));
+            // the guard bit bounds the rank by 64 - precision + 1
+            auto rest = (h << hll_precision) | (uint64_t{1} << (hll_precision - 1));
+            auto rank = static_cast<uint8_t>(std::countl_zero(rest) + 1);
+            acc->registers[index] = std::max(acc->registers[index], rank);
+        }
+        return compute_status::ok();
+    }
+
+    static compute_status approx_count_distinct_merge(kernel_context&, kernel_state&& from, kernel_state& into) {
+        auto& from_registers = static_cast<approx_count_distinct_kernel_state&>(from).registers;
+        auto& into_registers = static_cast<approx_count_distinct_kernel_state&>(into).registers;
+        for (size_t i = 0; i < hll_registers; i++) {
+            into_registers[i] = std::max(into_registers[i], from_registers[i]);
+        }
+        return compute_status::ok();
+    }
+
+    static compute_status approx_count_distinct_finalize(kernel_context& ctx, std::pmr::vector<logical_value_t>& out) {
+        const auto& registers = static_cast<approx_count_distinct_kernel_state*>(ctx.state())->registers;
+        constexpr auto m = static_cast<double>(hll_registers);
+        double harmonic = 0;
+        size_t zeros = 0;
+        for (auto r : registers) {
+            harmonic += std::ldexp(1.0, -static_cast<int>(r));
+            zeros += r == 0 ? 1 : 0;
+        }
+        double estimate = 0.7213 / (1.0 + 1.079 / m) * m * m / harmonic;
+        if (estimate <= 2.5 * m && zeros > 0) {
+            // linear counting is more accurate while many registers are still empty
+            estimate = m * std::log(m / static_cast<double>(zeros));
+        }
+        out.emplace_back(out.get_allocator().resource(), static_cast<uint64_t>(std::llround(estimate)));
+        return compute_status::ok();
+    }
+
+    // Merging t-digest: centroids are sorted by mean and only the tails are kept small, so extreme
+    // quantiles stay close to exact while the whole digest holds a few hundred centroids at most
+    class t_digest_t {
+    public:
+        void add(double value) {
+            if (std::isnan(value)) {
+                return;
+            }
+            min_ = std::min(min_, value);
+            max_ = std::max(max_, value);
+            buffer_.push_back({value, 1.0});
+            if (buffer_.size() >= buffer_limit) {
+                compress();
+            }
+        }
+
+        void merge(t_digest_t&& other) {
+            other.compress();
+            if (other.centroids_.empty()) {
+                return;
+            }
+            min_ = std::min(min_, other.min_);
+            max_ = std::max(max_, other.max_);
+            buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+            compress();
+        }
+
+        // NaN when nothing was added
+        double quantile(double q) {
+            compress();
+            if (centroids_.empty()) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            // centroid i stands for the weight around its center; interpolate between neighbouring
+            // centers, and between the extreme values and the outer centers
+            double center = centroids_.front().weight / 2;
+            double target = q * total_;
+            if (target <= center) {
+                return interpolate(min_, centroids_.front().mean, center > 0 ? target / center : 1.0);
+            }
+            for (size_t i = 1; i < centroids_.size(); i++) {
+                double next_center = center + (centroids_[i - 1].weight + centroids_[i].weight) / 2;
+                if (target <= next_center) {
+                    return interpolate(centroids_[i - 1].mean,
+                                       centroids_[i].mean,
+                                       (target - center) / (next_center - center));
+                }
+                center = next_center;
+            }
+            double rest = total_ - center;
+            return interpolate(centroids_.back().mean, max_, rest > 0 ? (target - center) / rest : 1.0);
+        }
+
+    private:
+        struct centroid_t {
+            double mean;
+            double weight;
+        };
+
+        static constexpr double compression = 100.0;
+        static constexpr size_t buffer_limit = 500;
+
+        static double interpolate(double from, double to, double t) { return from + (to - from) * t; }
+
+        void compress() {
+            if (buffer_.empty()) {
+                return;
+            }
+            buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+            std::sort(buffer_.begin(), buffer_.end(), [](const centroid_t& lhs, const centroid_t& rhs) {
+                return lhs.mean < rhs.mean;
+            });
+            double total = 0;
+            for (const auto& c : buffer_) {
+                total += c.weight;
+            }
+            centroids_.clear();
+            double before = 0;
+            auto current = buffer_.front();
+            for (size_t i = 1; i < buffer_.size(); i++) {
+                const auto& next = buffer_[i];
+                double weight = current.weight + next.weight;
+                double q_left = before / total;
+                double q_right = (before + weight) / total;
+                double limit = 4 * total * std::min(q_left * (1 - q_left), q_right * (1 - q_right)) / compression;
+                if (weight <= limit) {
+                    current.mean += (next.mean - current.mean) * next.weight / weight;
+                    current.weight = weight;
+                } else {
+                    before += current.weight;
+                    centroids_.push_back(current);
+                    current = next;
+                }
+            }
+            centroids_.push_back(current);
+            buffer_.clear();
+            total_ = total;
+        }
+
+        std::vector<centroid_t> centroids_;
+        std::vector<centroid_t> buffer_;
+        double total_{0};
+        double min_{std::numeric_limits<double>::infinity()};
+        double max_{-std::numeric_limits<double>::infinity()};
+    };
+
+    template<typename T = void>
+    struct digest_add_operator_t;
+
+    template<>
+    struct digest_add_operator_t<void> {
+        template<typename T>
+        void operator()(const vector_t& v, size_t count, double scale, t_digest_t& digest) const {
+            if constexpr (is_numeric_type_v<T>) {
+                const auto& validity = v.validity();
+                for (size_t i = 0; i < count; i++) {
+                    if (validity.row_is_valid(i)) {
+                        digest.add(static_cast<double>(v.data<T>()[i]) / scale);
+                    }
+                }
+            }
+        }
+    };
+
+    struct approx_quantile_kernel_state : kernel_state {
+        t_digest_t digest;
+        double quantile{0.5};
+    };
+
+    static compute_result<kernel_state_ptr> approx_quantile_init(kernel_context&, kernel_init_args) {
+        return compute_result<kernel_state_ptr>(std::make_unique<approx_quantile_kernel_state>());
+    }
+
+    static compute_status approx_quantile_digest(approx_quantile_kernel_state* acc, const vector_t& v, size_t count) {
+        std::optional<vector_t> holder;
+        const auto& column = flat_column(v, count, holder);
+        double scale = 1.0;
+        if (column.type().type() == logical_type::DECIMAL) {
+            scale = std::pow(10.0, static_cast<decimal_logical_type_extension*>(column.type().extension())->scale());
+        }
+        simple_physical_type_switch<digest_add_operator_t>(column.type().to_physical_type(),
+                                                           column,
+                                                           count,
+                                                           scale,
+                                                           acc->digest);
+        return compute_status::ok();
+    }
+
+    static compute_status approx_quantile_consume(kernel_context& ctx, const data_chunk_t& in, size_t exec_length) {
+        auto* acc = static_cast<approx_quantile_kernel_state*>(ctx.state());
+        if (exec_length == 0) {
+            // no row to read the quantile from, and nothing to add
+            return compute_status::ok();
+        }
+        auto q = in.data[1].value(0);
+        if (q.is_null() || !is_numeric(q.type().type())) {
+            return compute_status::invalid("approx_quantile: quantile has to be a number");
+        }
+        acc->quantile = q.cast_as(logical_type::DOUBLE).value<double>();
+        if (!(acc->quantile >= 0.0 && acc->quantile <= 1.0)) {
+            return compute_status::invalid("approx_quantile: quantile has to be within [0, 1]");
+        }
+        return approx_quantile_digest(acc, in.data[0], exec_length);
+    }
+
+    static compute_status approx_median_consume(kernel_context& ctx, const data_chunk_t& in, size_t exec_length) {
+        return approx_quantile_digest(static_cast<approx_quantile_kernel_state*>(ctx.state()), in.data[0], exec_length);
+    }
+
+    static compute_status approx_quantile_merge(kernel_context&, kernel_state&& from, kernel_state& into) {
+        auto& from_state = static_cast<approx_quantile_kernel_state&>(from);
+        auto& into_state = static_cast<approx_quantile_kernel_state&>(into);
+        into_state.quantile = from_state.quantile;
+        into_state.digest.merge(std::move(from_state.digest));
+        return compute_status::ok();
+    }
+
+    static compute_status approx_quantile_finalize(kernel_context& ctx, std::pmr::vector<logical_value_t>& out) {
+        auto* acc = static_cast<approx_quantile_kernel_state*>(ctx.state());
+        auto value = acc->digest.quantile(acc->quantile);
+        if (std::isnan(value)) {
+            out.emplace_back(out.get_allocator().resource(), logical_type::NA);
+        } else {
+            out.emplace_back(out.get_allocator().resource(), value);
+        }
+        return compute_status::ok();
+    }
+
+    struct value_hash_t {
+        size_t operator()(const logical_value_t& value) const noexcept { return value.hash(); }
+    };
+
+    // Frequent items summary: at most `capacity` values with an overestimated count each; any value
+    // left out occurred at most `error` times. Batches count exactly and then truncate, merge adds
+    // counts (an absent value contributes the other side's `error`) and truncates again.
+    struct approx_top_k_kernel_state : kernel_state {
+        std::unordered_map<logical_value_t, uint64_t, value_hash_t> counters;
+        uint64_t error{0};
+        size_t k{0};
+        complex_logical_type type{logical_type::NA};
+
+        size_t capacity() const { return std::max<size_t>(64, 4 * k); }
+
+        std::vector<std::pair<logical_value_t, uint64_t>> ranked() const {
+            std::vector<std::pair<logical_value_t, uint64_t>> entries(counters.begin(), counters.end());
+            std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second != rhs.second ? lhs.second > rhs.second : lhs.first < rhs.first;
+            });
+            return entries;
+        }
+
+        void truncate() {
+            if (counters.size() <= capacity()) {
+                return;
+            }
+            auto entries = ranked();
+            error = std::max(error, entries[capacity()].second);
+            entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(capacity()), entries.end());
+            counters.clear();
+            for (auto& [value, count] : entries) {
+                counters.emplace(std::move(value), count);
+            }
+        }
+    };
+
+    static compute_result<kernel_state_ptr> approx_top_k_init(kernel_context&, kernel_init_args) {
+        return compute_result<kernel_state_ptr>(std::make_unique<approx_top_k_kernel_state>());
+    }
+
+    static compute_status approx_top_k_consume(kernel_context& ctx, const data_chunk_t& in, size_t exec_length) {
+        auto* acc = static_cast<approx_top_k_kernel_state*>(ctx.state());
+        acc->type = in.data[0].type();
+        if (exec_length == 0) {
+            return compute_status::ok();
+        }
+        auto k = in.data[1].value(0);
+        if (k.is_null() || !is_numeric(k.type().type()) || k.cast_as(logical_type::BIGINT).value<int64_t>() < 1) {
+            return compute_status::invalid("approx_top_k: k has to be a positive number");
+        }
+        acc->k = static_cast<size_t>(k.cast_as(logical_type::BIGINT).value<int64_t>());
+        const auto& column = in.data[0];
+        for (size_t i = 0; i < exec_length; i++) {
+            auto value = column.value(i);
+            if (!value.is_null()) {
+                ++acc->counters[std::move(value)];
+            }
+        }
+        acc->truncate();
+        return compute_status::ok();
+    }
+
+    static compute_status approx_top_k_merge(kernel_context&, kernel_state&& from, kernel_state& into) {
+        auto& from_state = static_cast<approx_top_k_kernel_state&>(from);
+        auto& into_state = static_cast<approx_top_k_kernel_state&>(into);
+        into_state.k = std::max(into_state.k, from_state.k);
+        if (from_state.type.type() != logical_type::NA) {
+            into_state.type = from_state.type;
+        }
+        for (auto& [value, count] : into_state.counters) {
+            auto it = from_state.counters.find(value);
+            if (it == from_state.counters.end()) {
+                count += from_state.error;
+            } else {
+                count += it->second;
+                from_state.counters.erase(it);
+            }
+        }
+        for (auto& [value, count] : from_state.counters) {
+            into_state.counters.emplace(value, count + into_state.error);
+        }
+        into_state.error += from_state.error;
+        into_state.truncate();
+        return compute_status::ok();
+    }
+
+    static compute_status approx_top_k_finalize(kernel_context& ctx, std::pmr::vector<logical_value_t>& out) {
+        auto* acc = static_cast<approx_top_k_kernel_state*>(ctx.state());
+        auto entries = acc->ranked();
+        std::vector<logical_value_t> values;
+        values.reserve(std::min(entries.size(), acc->k));
+        for (size_t i = 0; i < entries.size() && i < acc->k; i++) {
+            values.emplace_back(std::move(entries[i].first));
+        }
+        out.emplace_back(logical_value_t::create_list(out.get_allocator().resource(), acc->type, values));
+        return compute_status::ok();
+    }
+
     std::unique_ptr<aggregate_function> make_sum_func(const std::string& name,
                                                       const std::string& short_doc,
                                                       const std::string& full_doc,
@@ -492,6 +900,84 @@ namespace {
         return fn;
     }
 
+    std::unique_ptr<aggregate_function> make_approx_count_distinct_func(const std::string& name,
+                                                                        const std::string& short_doc,
+                                                                        const std::string& full_doc,
+                                                                        size_t available_kernel_slots = 1) {
+        function_doc doc{short_doc, full_doc, {"arg"}, false};
+
+        auto fn = std::make_unique<aggregate_function>(name, arity::unary(), doc, available_kernel_slots);
+
+        kernel_signature_t sig({always_true_type_matcher()}, {output_type::fixed(logical_type::UBIGINT)});
+        aggregate_kernel k{std::move(sig),
+                           approx_count_distinct_init,
+                           approx_count_distinct_consume,
+                           approx_count_distinct_merge,
+                           approx_count_distinct_finalize};
+
+        fn->add_kernel(std::move(k));
+        return fn;
+    }
+
+    std::unique_ptr<aggregate_function> make_approx_quantile_func(const std::string& name,
+                                                                  const std::string& short_doc,
+                                                                  const std::string& full_doc,
+                                                                  size_t available_kernel_slots = 1) {
+        function_doc doc{short_doc, full_doc, {"arg", "quantile"}, false};
+
+        auto fn = std::make_unique<aggregate_function>(name, arity::binary(), doc, available_kernel_slots);
+
+        kernel_signature_t sig({numeric_types_matcher(), numeric_types_matcher()},
+                               {output_type::fixed(logical_type::DOUBLE)});
+        aggregate_kernel k{std::move(sig),
+                           approx_quantile_init,
+                           approx_quantile_consume,
+                           approx_quantile_merge,
+                           approx_quantile_finalize};
+
+        fn->add_kernel(std::move(k));
+        return fn;
+    }
+
+    std::unique_ptr<aggregate_function> make_approx_median_func(const std::string& name,
+                                                                const std::string& short_doc,
+                                                                const std::string& full_doc,
+                                                                size_t available_kernel_slots = 1) {
+        function_doc doc{short_doc, full_doc, {"arg"}, false};
+
+        auto fn = std::make_unique<aggregate_function>(name, arity::unary(), doc, available_kernel_slots);
+
+        kernel_signature_t sig({numeric_types_matcher()}, {output_type::fixed(logical_type::DOUBLE)});
+        aggregate_kernel k{std::move(sig),
+                           approx_quantile_init,
+                           approx_median_consume,
+                           approx_quantile_merge,
+                           approx_quantile_finalize};
+
+        fn->add_kernel(std::move(k));
+        return fn;
+    }
+
+    std::unique_ptr<aggregate_function> make_approx_top_k_func(const std::string& name,
+                                                               const std::string& short_doc,
+                                                               const std::string& full_doc,
+                                                               size_t available_kernel_slots = 1) {
+        function_doc doc{short_doc, full_doc, {"arg", "k"}, false};
+
+        auto fn = std::make_unique<aggregate_function>(name, arity::binary(), doc, available_kernel_slots);
+
+        kernel_signature_t sig({always_true_type_matcher(), integer_types_matcher()},
+                               {output_type::computed(list_type_resolver(0))});
+        aggregate_kernel k{std::move(sig),
+                           approx_top_k_init,
+                           approx_top_k_consume,
+                           approx_top_k_merge,
+                           approx_top_k_finalize};
+
+        fn->add_kernel(std::move(k));
+        return fn;
+    }
+
 } // namespace
 
 namespace components::compute {
@@ -507,6 +993,18 @@ namespace components::compute {
         r.add_function(make_count_func("count", "Return data size", "Results in a single number of uint64"));
         r.add_function(
             make_avg_func("avg", "Return data size", "Results in a single number of the same type as input"));
+        r.add_function(make_approx_count_distinct_func("approx_count_distinct",
+                                                       "Estimates the number of distinct values",
+                                                       "Results in a single number of uint64, HyperLogLog estimate"));
+        r.add_function(make_approx_quantile_func("approx_quantile",
+                                                 "Estimates the given quantile",
+                                                 "Results in a single double, t-digest estimate"));
+        r.add_function(make_approx_median_func("approx_median",
+                                               "Estimates the median",
+                                               "Results in a single double, t-digest estimate"));
+        r.add_function(make_approx_top_k_func("approx_top_k",
+                                              "Estimates the k most frequent values",
+                                              "Results in a list of the input type, most frequent first"));
     }
 
 } // namespace components::compute
@@ -233,3 +233,112 @@ TEST_CASE("components::compute::errors") {
         REQUIRE(status == TEST_ERROR);
     }
 }
+
+TEST_CASE("components::compute::aggregate::approximate") {
+    auto* reg = function_registry_t::get_default();
+    auto find = [reg](const std::string& name) -> const function* {
+        for (const auto& [fn_name, uid] : reg->get_functions()) {
+            if (fn_name == name) {
+                return reg->get_function(uid);
+            }
+        }
+        return nullptr;
+    };
+    auto* resource = std::pmr::get_default_resource();
+
+    // 4 equal batches: 7 in the first 300 rows, then the row number; every 10th row is NULL
+    constexpr size_t batch_size = 1000;
+    auto make_batches = [&](bool with_k) {
+        std::vector<data_chunk_t> batches;
+        for (size_t b = 0; b < 4; b++) {
+            std::pmr::vector<complex_logical_type> types(resource);
+            types.emplace_back(logical_type::BIGINT);
+            if (with_k) {
+                types.emplace_back(logical_type::BIGINT);
+            }
+            data_chunk_t chunk(resource, types, batch_size);
+            chunk.set_cardinality(batch_size);
+            for (size_t i = 0; i < batch_size; i++) {
+                chunk.set_value(0, i, logical_value_t(resource, static_cast<int64_t>(i < 300 ? 7 : i)));
+                if (i % 10 == 9) {
+                    chunk.data[0].validity().set_invalid(i);
+                }
+                if (with_k) {
+                    chunk.set_value(1, i, logical_value_t(resource, int64_t{2}));
+                }
+            }
+            batches.emplace_back(std::move(chunk));
+        }
+        return batches;
+    };
+
+    SECTION("approx_count_distinct") {
+        auto* fn = find("approx_count_distinct");
+        REQUIRE(fn != nullptr);
+        auto batches = make_batches(false);
+        auto res = fn->execute(batches, batch_size);
+        REQUIRE(res);
+        auto estimate = std::get<std::pmr::vector<logical_value_t>>(res.value())[0].value<uint64_t>();
+        // 630 non-null values from 300 to 998 and 7
+        REQUIRE(estimate >= 615);
+        REQUIRE(estimate <= 650);
+
+        // merging equal sketches changes nothing
+        auto single = fn->execute(batches[0], batch_size);
+        REQUIRE(single);
+        REQUIRE(std::get<std::pmr::vector<logical_value_t>>(single.value())[0].value<uint64_t>() == estimate);
+    }
+
+    SECTION("approx_quantile and approx_median") {
+        constexpr size_t count = 10001;
+        data_chunk_t values(resource, {logical_type::DOUBLE, logical_type::DOUBLE}, count);
+        values.set_cardinality(count);
+        for (size_t i = 0; i < count; i++) {
+            values.set_value(0, i, logical_value_t(resource, static_cast<double>((i * 7919) % count)));
+            values.set_value(1, i, logical_value_t(resource, 0.99));
+        }
+
+        auto res = find("approx_quantile")->execute(values, count);
+        REQUIRE(res);
+        REQUIRE(std::get<std::pmr::vector<logical_value_t>>(res.value())[0].value<double>() ==
+                Approx(9900.0).epsilon(0.005));
+
+        data_chunk_t column(resource, {logical_type::DOUBLE}, count);
+        column.set_cardinality(count);
+        column.data[0].reference(values.data[0]);
+        auto median = find("approx_median")->execute(column, count);
+        REQUIRE(median);
+        REQUIRE(std::get<std::pmr::vector<logical_value_t>>(median.value())[0].value<double>() ==
+                Approx(5000.0).epsilon(0.01));
+
+        values.set_value(1, 0, logical_value_t(resource, 1.5));
+        REQUIRE_FALSE(find("approx_quantile")->execute(values, count));
+    }
+
+    SECTION("approx_top_k") {
+        auto* fn = find("approx_top_k");
+        REQUIRE(fn != nullptr);
+        auto res = fn->execute(make_batches(true), batch_size);
+        REQUIRE(res);
+        const auto& top = std::get<std::pmr::vector<logical_value_t>>(res.value())[0];
+        REQUIRE(top.type().type() == logical_type::LIST);
+        REQUIRE(top.children().size() == 2);
+        REQUIRE(top.children()[0].value<int64_t>() == 7);
+        REQUIRE(top.children()[1].value<int64_t>() == 300);
+    }
+
+    SECTION("empty input") {
+        data_chunk_t empty(resource, {logical_type::BIGINT, logical_type::DOUBLE}, 1);
+        empty.set_cardinality(0);
+
+        auto quantile = find("approx_quantile")->execute(empty, 0);
+        REQUIRE(quantile);
+        REQUIRE(std::get<std::pmr::vector<logical_value_t>>(quantile.value())[0].is_null());
+
+        auto top = find("approx_top_k")->execute(empty, 0);
+        REQUIRE(top);
+        const auto& list = std::get<std::pmr::vector<logical_value_t>>(top.value())[0];
+        REQUIRE(list.type().type() == logical_type::LIST);
+        REQUIRE(list.children().empty());
+    }
+}
@@ -23,6 +23,8 @@ TEST_CASE("components::compute::registry::basic") {
             if (name == "count") {
                 REQUIRE(fn->fn_arity().num_args == 0);
                 REQUIRE(fn->fn_arity().varargs == true);
+            } else if (name == "approx_quantile" || name == "approx_top_k") {
+                REQUIRE(fn->fn_arity().num_args == 2);
             } else {
                 REQUIRE(fn->fn_arity().num_args == 1);
             }
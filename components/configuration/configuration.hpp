@@ -28,15 +28,26 @@ namespace configuration {
         std::filesystem::path path{std::filesystem::current_path() / "disk"};
         bool on{true};
         int agent = 2;
+        bool mmap_reads{false}; // serve blocks of reopened table files from a mapping of the file
 
         explicit config_disk(const std::filesystem::path& path = std::filesystem::current_path())
             : path(path / "wal") {}
     };
 
+    struct config_scheduler final {
+        std::size_t worker_threads{0};     // 0 - derive from the cores available to the process
+        std::size_t dispatcher_threads{0}; // 0 - derive from the cores available to the process
+        std::size_t io_threads{0};         // 0 - derive from the cores available to the process
+        std::size_t task_threads{0};       // 0 - half the worker pool
+        std::size_t max_throughput{1000};
+        bool pin_threads{false}; // pin worker and dispatcher pools to disjoint cores
+    };
+
     struct config final {
         config_log log;
         config_wal wal;
         config_disk disk;
+        config_scheduler scheduler;
         std::filesystem::path main_path; // mainly used for checking, because log, wal and disk could be missing
 
         config(const std::filesystem::path& path = std::filesystem::current_path());
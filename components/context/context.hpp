@@ -11,6 +11,10 @@ namespace components::compute {
     class function_registry_t;
 } // namespace components::compute
 
+namespace core::scheduler {
+    class task_pool_t;
+} // namespace core::scheduler
+
 namespace components::pipeline {
 
     class context_t {
@@ -20,6 +24,8 @@ namespace components::pipeline {
         session::session_id_t session;
         actor_zeta::address_t current_message_sender{actor_zeta::address_t::empty_address()};
         const compute::function_registry_t* function_registry = nullptr;
+        // Work-stealing pool for intra-operator parallelism; nullptr runs everything inline.
+        core::scheduler::task_pool_t* task_pool = nullptr;
         logical_plan::storage_parameters parameters;
 
         actor_zeta::address_t disk_address{actor_zeta::address_t::empty_address()};
@@ -1,6 +1,9 @@
 #include "update_expression.hpp"
 
 #include <components/logical_plan/param_storage.hpp>
+#include <components/vector/arithmetic.hpp>
+
+#include <cstring>
 
 namespace components::expressions {
 
@@ -14,6 +17,48 @@ namespace components::expressions {
 
     const types::logical_value_t& update_expr_t::expr_output_t::value() const { return output_; }
 
+    void update_expr_t::batch_output_t::set(const vector::vector_t* column) {
+        column_ = column;
+        owned_.reset();
+        scalar_.reset();
+        values_.clear();
+    }
+
+    void update_expr_t::batch_output_t::set(vector::vector_t column) {
+        column_ = nullptr;
+        owned_.emplace(std::move(column));
+        scalar_.reset();
+        values_.clear();
+    }
+
+    void update_expr_t::batch_output_t::set(types::logical_value_t value) {
+        column_ = nullptr;
+        owned_.reset();
+        scalar_.emplace(std::move(value));
+        values_.clear();
+    }
+
+    void update_expr_t::batch_output_t::set(std::vector<types::logical_value_t> values) {
+        column_ = nullptr;
+        owned_.reset();
+        scalar_.reset();
+        values_ = std::move(values);
+    }
+
+    const vector::vector_t* update_expr_t::batch_output_t::column() const noexcept {
+        return owned_ ? &*owned_ : column_;
+    }
+
+    types::logical_value_t update_expr_t::batch_output_t::value(uint64_t row) const {
+        if (const auto* vec = column()) {
+            return vec->value(row);
+        }
+        if (scalar_) {
+            return *scalar_;
+        }
+        return values_.at(row);
+    }
+
     update_expr_t::update_expr_t(update_expr_type type)
         : type_(type) {}
 
@@ -31,6 +76,21 @@ namespace components::expressions {
         return execute_impl(to, from, row_to, row_from, parameters);
     }
 
+    bool update_expr_t::execute_batch(std::pmr::memory_resource* resource,
+                                      vector::data_chunk_t& to,
+                                      const vector::data_chunk_t& from,
+                                      uint64_t count,
+                                      const logical_plan::storage_parameters* parameters,
+                                      std::vector<bool>& modified) {
+        if (left_) {
+            left_->execute_batch(resource, to, from, count, parameters, modified);
+        }
+        if (right_) {
+            right_->execute_batch(resource, to, from, count, parameters, modified);
+        }
+        return execute_batch_impl(resource, to, from, count, parameters, modified);
+    }
+
     update_expr_type update_expr_t::type() const noexcept { return type_; }
 
     update_expr_ptr& update_expr_t::left() { return left_; }
@@ -45,6 +105,8 @@ namespace components::expressions {
 
     const update_expr_t::expr_output_t& update_expr_t::output() const { return output_; }
 
+    const update_expr_t::batch_output_t& update_expr_t::batch_output() const { return batch_output_; }
+
     bool operator==(const update_expr_ptr& lhs, const update_expr_ptr& rhs) {
         if (lhs.get() == rhs.get()) {
             // same address
@@ -120,6 +182,65 @@ namespace components::expressions {
         return false;
     }
 
+    namespace {
+        // Types whose values are compared and copied as raw bytes of a flat vector
+        bool is_fixed_width(types::logical_type type) {
+            return types::is_numeric(type) && type != types::logical_type::DECIMAL;
+        }
+    } // anonymous namespace
+
+    bool update_expr_set_t::execute_batch_impl(std::pmr::memory_resource*,
+                                               vector::data_chunk_t& to,
+                                               const vector::data_chunk_t&,
+                                               uint64_t count,
+                                               const logical_plan::storage_parameters*,
+                                               std::vector<bool>& modified) {
+        if (!left_) {
+            return false;
+        }
+        assert(key_.path().front() != size_t(-1));
+        auto* target = to.at(key_.path());
+        const auto& result = left_->batch_output();
+        const auto* source = result.column();
+        if (source == target) {
+            return false;
+        }
+        bool any = false;
+        if (source && is_fixed_width(target->type().type()) && source->type().type() == target->type().type() &&
+            source->get_vector_type() == vector::vector_type::FLAT &&
+            target->get_vector_type() == vector::vector_type::FLAT) {
+            auto width = target->type().size();
+            auto* dst = target->data();
+            const auto* src = source->data();
+            for (uint64_t k = 0; k < count; k++) {
+                bool valid = source->validity().row_is_valid(k);
+                if (valid == target->validity().row_is_valid(k) &&
+                    (!valid || std::memcmp(dst + k * width, src + k * width, width) == 0)) {
+                    continue;
+                }
+                modified[k] = true;
+                any = true;
+                if (valid) {
+                    std::memcpy(dst + k * width, src + k * width, width);
+                    target->validity().set_valid(k);
+                } else {
+                    target->validity().set_invalid(k);
+                }
+            }
+            return any;
+        }
+        // Other types (and results of another type, cast on write) go value by value
+        for (uint64_t k = 0; k < count; k++) {
+            auto value = result.value(k);
+            if (to.value(key_.path(), k) != value) {
+                modified[k] = true;
+                any = true;
+            }
+            to.set_value(key_.path(), k, value);
+        }
+        return any;
+    }
+
     update_expr_get_value_t::update_expr_get_value_t(key_t key)
         : update_expr_t(update_expr_type::get_value)
         , key_(std::move(key)) {}
@@ -149,6 +270,18 @@ namespace components::expressions {
         return false;
     }
 
+    bool update_expr_get_value_t::execute_batch_impl(std::pmr::memory_resource*,
+                                                     vector::data_chunk_t& to,
+                                                     const vector::data_chunk_t& from,
+                                                     uint64_t,
+                                                     const logical_plan::storage_parameters*,
+                                                     std::vector<bool>&) {
+        assert(key_.side() != side_t::undefined && "validation must resolve side before execution");
+        assert(key_.path().front() != size_t(-1));
+        batch_output_.set(key_.side() == side_t::right ? from.at(key_.path()) : to.at(key_.path()));
+        return false;
+    }
+
     update_expr_get_const_value_t::update_expr_get_const_value_t(core::parameter_id_t id)
         : update_expr_t(update_expr_type::get_value_params)
         , id_(id) {}
@@ -168,6 +301,16 @@ namespace components::expressions {
         return false;
     }
 
+    bool update_expr_get_const_value_t::execute_batch_impl(std::pmr::memory_resource*,
+                                                           vector::data_chunk_t&,
+                                                           const vector::data_chunk_t&,
+                                                           uint64_t,
+                                                           const logical_plan::storage_parameters* parameters,
+                                                           std::vector<bool>&) {
+        batch_output_.set(parameters->parameters.at(id_));
+        return false;
+    }
+
     update_expr_calculate_t::update_expr_calculate_t(update_expr_type type)
         : update_expr_t(type) {}
 
@@ -232,6 +375,76 @@ namespace components::expressions {
                    type == update_expr_type::factorial || type == update_expr_type::abs ||
                    type == update_expr_type::NOT;
         }
+
+        std::optional<vector::arithmetic_op> arithmetic_op_of(update_expr_type type) {
+            switch (type) {
+                case update_expr_type::add:
+                    return vector::arithmetic_op::add;
+                case update_expr_type::sub:
+                    return vector::arithmetic_op::subtract;
+                case update_expr_type::mult:
+                    return vector::arithmetic_op::multiply;
+                case update_expr_type::div:
+                    return vector::arithmetic_op::divide;
+                case update_expr_type::mod:
+                    return vector::arithmetic_op::mod;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        bool is_kernel_type(types::logical_type type) {
+            switch (type) {
+                case types::logical_type::TINYINT:
+                case types::logical_type::SMALLINT:
+                case types::logical_type::INTEGER:
+                case types::logical_type::BIGINT:
+                case types::logical_type::UTINYINT:
+                case types::logical_type::USMALLINT:
+                case types::logical_type::UINTEGER:
+                case types::logical_type::UBIGINT:
+                case types::logical_type::FLOAT:
+                case types::logical_type::DOUBLE:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // Operands the arithmetic kernels of components/vector take as they are: flat numeric columns
+        // and non-null numeric constants
+        template<typename Output>
+        bool is_kernel_operand(const Output& output) {
+            if (const auto* column = output.column()) {
+                return column->get_vector_type() == vector::vector_type::FLAT && is_kernel_type(column->type().type());
+            }
+            const auto* scalar = output.scalar();
+            return scalar && !scalar->is_null() && is_kernel_type(scalar->type().type());
+        }
+
+        // The kernels leave a row NULL when its divisor is zero; logical_value_t::divide and modulus,
+        // which evaluate the same update row by row, give 0 instead
+        void zero_divided_rows(std::pmr::memory_resource* resource, vector::vector_t& result, uint64_t count) {
+            if (result.validity().all_valid()) {
+                return;
+            }
+            for (uint64_t k = 0; k < count; k++) {
+                if (!result.validity().row_is_valid(k)) {
+                    result.set_value(k, types::logical_value_t{resource, result.type()});
+                }
+            }
+        }
+
+        void propagate_nulls(vector::vector_t& result, const vector::vector_t* operand, uint64_t count) {
+            if (!operand) {
+                return;
+            }
+            for (uint64_t k = 0; k < count; k++) {
+                if (!operand->validity().row_is_valid(k)) {
+                    result.validity().set_invalid(k);
+                }
+            }
+        }
     } // anonymous namespace
 
     bool update_expr_calculate_t::execute_impl(vector::data_chunk_t&,
@@ -247,4 +460,54 @@ namespace components::expressions {
         return false;
     }
 
+    bool update_expr_calculate_t::execute_batch_impl(std::pmr::memory_resource* resource,
+                                                     vector::data_chunk_t&,
+                                                     const vector::data_chunk_t&,
+                                                     uint64_t count,
+                                                     const logical_plan::storage_parameters*,
+                                                     std::vector<bool>&) {
+        const auto& left = left_->batch_output();
+        if (is_unary_update_op(type_)) {
+            if (const auto* scalar = left.scalar()) {
+                batch_output_.set(apply_unary_update_op(type_, *scalar));
+                return false;
+            }
+            std::vector<types::logical_value_t> values;
+            values.reserve(count);
+            for (uint64_t k = 0; k < count; k++) {
+                values.push_back(apply_unary_update_op(type_, left.value(k)));
+            }
+            batch_output_.set(std::move(values));
+            return false;
+        }
+
+        const auto& right = right_->batch_output();
+        if (left.scalar() && right.scalar()) {
+            batch_output_.set(apply_binary_update_op(type_, *left.scalar(), *right.scalar()));
+            return false;
+        }
+        if (auto op = arithmetic_op_of(type_); op && is_kernel_operand(left) && is_kernel_operand(right)) {
+            auto result =
+                left.column() && right.column()
+                    ? vector::compute_binary_arithmetic(resource, *op, *left.column(), *right.column(), count)
+                : left.column()
+                    ? vector::compute_vector_scalar_arithmetic(resource, *op, *left.column(), *right.scalar(), count)
+                    : vector::compute_scalar_vector_arithmetic(resource, *op, *left.scalar(), *right.column(), count);
+            if (*op == vector::arithmetic_op::divide || *op == vector::arithmetic_op::mod) {
+                zero_divided_rows(resource, result, count);
+            }
+            propagate_nulls(result, left.column(), count);
+            propagate_nulls(result, right.column(), count);
+            batch_output_.set(std::move(result));
+            return false;
+        }
+        std::vector<types::logical_value_t> values;
+        values.reserve(count);
+        for (uint64_t k = 0; k < count; k++) {
+            values.push_back(apply_binary_update_op(type_, left.value(k), right.value(k)));
+        }
+        batch_output_.set(std::move(values));
+        return false;
+    }
+
 } // namespace components::expressions
\ No newline at end of file
@@ -5,6 +5,9 @@
 #include <boost/smart_ptr/intrusive_ref_counter.hpp>
 #include <components/vector/data_chunk.hpp>
 
+#include <optional>
+#include <vector>
+
 #include "key.hpp"
 
 namespace components::logical_plan {
@@ -54,6 +57,26 @@ namespace components::expressions {
             types::logical_value_t output_;
         };
 
+        // Output of execute_batch(): a column with a value per row, a single value for all rows,
+        // or values computed row by row when no column kernel applies.
+        class batch_output_t {
+        public:
+            void set(const vector::vector_t* column);
+            void set(vector::vector_t column);
+            void set(types::logical_value_t value);
+            void set(std::vector<types::logical_value_t> values);
+
+            const vector::vector_t* column() const noexcept;
+            const types::logical_value_t* scalar() const noexcept { return scalar_ ? &*scalar_ : nullptr; }
+            types::logical_value_t value(uint64_t row) const;
+
+        private:
+            const vector::vector_t* column_{nullptr};
+            std::optional<vector::vector_t> owned_;
+            std::optional<types::logical_value_t> scalar_;
+            std::vector<types::logical_value_t> values_;
+        };
+
     public:
         explicit update_expr_t(update_expr_type type);
         virtual ~update_expr_t() = default;
@@ -64,6 +87,15 @@ namespace components::expressions {
                      size_t row_from,
                      const logical_plan::storage_parameters* parameters);
 
+        // Column-at-a-time form of execute(): row k of `to` is paired with row k of `from` for
+        // every k < count. Sets modified[k] for the rows whose value changed and returns whether any did.
+        bool execute_batch(std::pmr::memory_resource* resource,
+                           vector::data_chunk_t& to,
+                           const vector::data_chunk_t& from,
+                           uint64_t count,
+                           const logical_plan::storage_parameters* parameters,
+                           std::vector<bool>& modified);
+
         update_expr_type type() const noexcept;
         update_expr_ptr& left();
         const update_expr_ptr& left() const;
@@ -71,6 +103,7 @@ namespace components::expressions {
         const update_expr_ptr& right() const;
         expr_output_t& output();
         const expr_output_t& output() const;
+        const batch_output_t& batch_output() const;
 
     protected:
         virtual bool execute_impl(vector::data_chunk_t& to,
@@ -78,11 +111,18 @@ namespace components::expressions {
                                   size_t row_to,
                                   size_t row_from,
                                   const logical_plan::storage_parameters* parameters) = 0;
+        virtual bool execute_batch_impl(std::pmr::memory_resource* resource,
+                                        vector::data_chunk_t& to,
+                                        const vector::data_chunk_t& from,
+                                        uint64_t count,
+                                        const logical_plan::storage_parameters* parameters,
+                                        std::vector<bool>& modified) = 0;
 
         update_expr_type type_;
         update_expr_ptr left_;
         update_expr_ptr right_;
         expr_output_t output_;
+        batch_output_t batch_output_;
     };
 
     bool operator==(const update_expr_ptr& lhs, const update_expr_ptr& rhs);
@@ -102,6 +142,12 @@ namespace components::expressions {
                           size_t row_to,
                           size_t row_from,
                           const logical_plan::storage_parameters* parameters) override;
+        bool execute_batch_impl(std::pmr::memory_resource* resource,
+                                vector::data_chunk_t& to,
+                                const vector::data_chunk_t& from,
+                                uint64_t count,
+                                const logical_plan::storage_parameters* parameters,
+                                std::vector<bool>& modified) override;
 
     private:
         key_t key_;
@@ -124,6 +170,12 @@ namespace components::expressions {
                           size_t row_to,
                           size_t row_from,
                           const logical_plan::storage_parameters* parameters) override;
+        bool execute_batch_impl(std::pmr::memory_resource* resource,
+                                vector::data_chunk_t& to,
+                                const vector::data_chunk_t& from,
+                                uint64_t count,
+                                const logical_plan::storage_parameters* parameters,
+                                std::vector<bool>& modified) override;
 
     private:
         key_t key_;
@@ -145,6 +197,12 @@ namespace components::expressions {
                           size_t row_to,
                           size_t row_from,
                           const logical_plan::storage_parameters* parameters) override;
+        bool execute_batch_impl(std::pmr::memory_resource* resource,
+                                vector::data_chunk_t& to,
+                                const vector::data_chunk_t& from,
+                                uint64_t count,
+                                const logical_plan::storage_parameters* parameters,
+                                std::vector<bool>& modified) override;
 
     private:
         core::parameter_id_t id_;
@@ -164,6 +222,12 @@ namespace components::expressions {
                           size_t row_to,
                           size_t row_from,
                           const logical_plan::storage_parameters* parameters) override;
+        bool execute_batch_impl(std::pmr::memory_resource* resource,
+                                vector::data_chunk_t& to,
+                                const vector::data_chunk_t& from,
+                                uint64_t count,
+                                const logical_plan::storage_parameters* parameters,
+                                std::vector<bool>& modified) override;
     };
 
     using update_expr_calculate_ptr = boost::intrusive_ptr<update_expr_calculate_t>;
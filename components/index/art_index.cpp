@@ -0,0 +1,1106 @@
+#include "art_index.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace components::index {
+
+    enum class art_node_kind : uint8_t
+    {
+        leaf,
+        node4,
+        node16,
+        node48,
+        node256
+    };
+
+    struct art_index_t::node_t {
+        explicit node_t(art_node_kind kind)
+            : kind(kind) {}
+        art_node_kind kind;
+    };
+
+    struct art_index_t::leaf_t final : art_index_t::node_t {
+        leaf_t(std::pmr::memory_resource* resource, std::string_view bytes, const value_t& key)
+            : node_t(art_node_kind::leaf)
+            , bytes(bytes, resource)
+            , key(key)
+            , entries(resource) {}
+
+        std::pmr::string bytes;
+        value_t key;
+        std::pmr::vector<index_value_t> entries;
+        leaf_t* prev{nullptr};
+        leaf_t* next{nullptr};
+    };
+
+    namespace {
+
+        using node_t = art_index_t::node_t;
+        using leaf_t = art_index_t::leaf_t;
+
+        constexpr uint64_t sign_bit = uint64_t{1} << 63;
+
+        // Inner nodes keep their compressed path in full, so a lookup never has to
+        // consult a leaf to verify skipped bytes.
+        struct inner_t : node_t {
+            inner_t(art_node_kind kind, std::pmr::memory_resource* resource)
+                : node_t(kind)
+                , prefix(resource) {}
+            uint16_t count{0};
+            std::pmr::string prefix;
+        };
+
+        template<art_node_kind Kind, std::size_t Capacity>
+        struct sorted_node_t final : inner_t {
+            static constexpr std::size_t capacity = Capacity;
+            explicit sorted_node_t(std::pmr::memory_resource* resource)
+                : inner_t(Kind, resource) {}
+            std::array<uint8_t, Capacity> keys{};
+            std::array<node_t*, Capacity> children{};
+        };
+
+        using node4_t = sorted_node_t<art_node_kind::node4, 4>;
+        using node16_t = sorted_node_t<art_node_kind::node16, 16>;
+
+        struct node48_t final : inner_t {
+            explicit node48_t(std::pmr::memory_resource* resource)
+                : inner_t(art_node_kind::node48, resource) {}
+            // slot + 1 of the child for every key byte, 0 when absent
+            std::array<uint8_t, 256> index{};
+            std::array<node_t*, 48> children{};
+        };
+
+        struct node256_t final : inner_t {
+            explicit node256_t(std::pmr::memory_resource* resource)
+                : inner_t(art_node_kind::node256, resource) {}
+            std::array<node_t*, 256> children{};
+        };
+
+        template<typename T, typename... Args>
+        T* make_node(std::pmr::memory_resource* resource, Args&&... args) {
+            return new (resource->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        void free_node(std::pmr::memory_resource* resource, T* node) {
+            node->~T();
+            resource->deallocate(node, sizeof(T), alignof(T));
+        }
+
+        void free_any(std::pmr::memory_resource* resource, node_t* node) {
+            switch (node->kind) {
+                case art_node_kind::leaf:
+                    free_node(resource, static_cast<leaf_t*>(node));
+                    break;
+                case art_node_kind::node4:
+                    free_node(resource, static_cast<node4_t*>(node));
+                    break;
+                case art_node_kind::node16:
+                    free_node(resource, static_cast<node16_t*>(node));
+                    break;
+                case art_node_kind::node48:
+                    free_node(resource, static_cast<node48_t*>(node));
+                    break;
+                case art_node_kind::node256:
+                    free_node(resource, static_cast<node256_t*>(node));
+                    break;
+            }
+        }
+
+        uint8_t byte_at(std::string_view key, std::size_t position) { return static_cast<uint8_t>(key[position]); }
+
+        node_t** find_child(node_t* node, uint8_t byte) {
+            auto sorted_find = [byte](auto* n) -> node_t** {
+                for (uint16_t i = 0; i < n->count; ++i) {
+                    if (n->keys[i] == byte) {
+                        return &n->children[i];
+                    }
+                }
+                return nullptr;
+            };
+            switch (node->kind) {
+                case art_node_kind::node4:
+                    return sorted_find(static_cast<node4_t*>(node));
+                case art_node_kind::node16:
+                    return sorted_find(static_cast<node16_t*>(node));
+                case art_node_kind::node48: {
+                    auto* n = static_cast<node48_t*>(node);
+                    auto slot = n->index[byte];
+                    return slot ? &n->children[slot - 1u] : nullptr;
+                }
+                case art_node_kind::node256: {
+                    auto* n = static_cast<node256_t*>(node);
+                    return n->children[byte] ? &n->children[byte] : nullptr;
+                }
+                default:
+                    return nullptr;
+            }
+        }
+
+        // First child whose key byte is >= `from` (from may be 256, meaning none).
+        node_t* first_child_from(node_t* node, unsigned from) {
+            auto sorted_first = [from](auto* n) -> node_t* {
+                for (uint16_t i = 0; i < n->count; ++i) {
+                    if (static_cast<unsigned>(n->keys[i]) >= from) {
+                        return n->children[i];
+                    }
+                }
+                return nullptr;
+            };
+            switch (node->kind) {
+                case art_node_kind::node4:
+                    return sorted_first(static_cast<node4_t*>(node));
+                case art_node_kind::node16:
+                    return sorted_first(static_cast<node16_t*>(node));
+                case art_node_kind::node48: {
+                    auto* n = static_cast<node48_t*>(node);
+                    for (unsigned b = from; b < 256; ++b) {
+                        if (n->index[b]) {
+                            return n->children[n->index[b] - 1u];
+                        }
+                    }
+                    return nullptr;
+                }
+                case art_node_kind::node256: {
+                    auto* n = static_cast<node256_t*>(node);
+                    for (unsigned b = from; b < 256; ++b) {
+                        if (n->children[b]) {
+                            return n->children[b];
+                        }
+                    }
+                    return nullptr;
+                }
+                default:
+                    return nullptr;
+            }
+        }
+
+        node_t* last_child(node_t* node) {
+            switch (node->kind) {
+                case art_node_kind::node4: {
+                    auto* n = static_cast<node4_t*>(node);
+                    return n->children[n->count - 1u];
+                }
+                case art_node_kind::node16: {
+                    auto* n = static_cast<node16_t*>(node);
+                    return n->children[n->count - 1u];
+                }
+                case art_node_kind::node48: {
+                    auto* n = static_cast<node48_t*>(node);
+                    for (auto b = n->index.size(); b-- > 0;) {
+                        if (n->index[b]) {
+                            return n->children[n->index[b] - 1u];
+                        }
+                    }
+                    return nullptr;
+                }
+                case art_node_kind::node256: {
+                    auto* n = static_cast<node256_t*>(node);
+                    for (auto b = n->children.size(); b-- > 0;) {
+                        if (n->children[b]) {
+                            return n->children[b];
+                        }
+                    }
+                    return nullptr;
+                }
+                default:
+                    return nullptr;
+            }
+        }
+
+        leaf_t* min_leaf(node_t* node) {
+            while (node->kind != art_node_kind::leaf) {
+                node = first_child_from(node, 0);
+            }
+            return static_cast<leaf_t*>(node);
+        }
+
+        leaf_t* max_leaf(node_t* node) {
+            while (node->kind != art_node_kind::leaf) {
+                node = last_child(node);
+            }
+            return static_cast<leaf_t*>(node);
+        }
+
+        template<typename From, typename To>
+        To* copy_sorted(std::pmr::memory_resource* resource, From* from) {
+            auto* to = make_node<To>(resource, resource);
+            to->prefix = std::move(from->prefix);
+            to->count = from->count;
+            std::copy_n(from->keys.begin(), from->count, to->keys.begin());
+            std::copy_n(from->children.begin(), from->count, to->children.begin());
+            free_node(resource, from);
+            return to;
+        }
+
+        template<typename Node>
+        void insert_sorted(Node* n, uint8_t byte, node_t* child) {
+            std::size_t position = n->count;
+            while (position > 0 && n->keys[position - 1] > byte) {
+                n->keys[position] = n->keys[position - 1];
+                n->children[position] = n->children[position - 1];
+                --position;
+            }
+            n->keys[position] = byte;
+            n->children[position] = child;
+            ++n->count;
+        }
+
+        template<typename Node>
+        void remove_sorted(Node* n, uint8_t byte) {
+            std::size_t position = 0;
+            while (position < n->count && n->keys[position] != byte) {
+                ++position;
+            }
+            assert(position < n->count);
+            for (; position + 1 < n->count; ++position) {
+                n->keys[position] = n->keys[position + 1];
+                n->children[position] = n->children[position + 1];
+            }
+            --n->count;
+        }
+
+        void add_child(std::pmr::memory_resource* resource, node_t*& ref, uint8_t byte, node_t* child) {
+            switch (ref->kind) {
+                case art_node_kind::node4: {
+                    auto* n = static_cast<node4_t*>(ref);
+                    if (n->count < node4_t::capacity) {
+                        insert_sorted(n, byte, child);
+                        return;
+                    }
+                    auto* grown = copy_sorted<node4_t, node16_t>(resource, n);
+                    insert_sorted(grown, byte, child);
+                    ref = grown;
+                    return;
+                }
+                case art_node_kind::node16: {
+                    auto* n = static_cast<node16_t*>(ref);
+                    if (n->count < node16_t::capacity) {
+                        insert_sorted(n, byte, child);
+                        return;
+                    }
+                    auto* grown = make_node<node48_t>(resource, resource);
+                    grown->prefix = std::move(n->prefix);
+                    for (uint16_t i = 0; i < n->count; ++i) {
+                        grown->index[n->keys[i]] = static_cast<uint8_t>(i + 1);
+                        grown->children[i] = n->children[i];
+                    }
+                    grown->count = n->count;
+                    free_node(resource, n);
+                    ref = grown;
+                    add_child(resource, ref, byte, child);
+                    return;
+                }
+                case art_node_kind::node48: {
+                    auto* n = static_cast<node48_t*>(ref);
+                    if (n->count < n->children.size()) {
+                        std::size_t slot = 0;
+                        while (n->children[slot]) {
+                            ++slot;
+                        }
+                        n->index[byte] = static_cast<uint8_t>(slot + 1);
+                        n->children[slot] = child;
+                        ++n->count;
+                        return;
+                    }
+                    auto* grown = make_node<node256_t>(resource, resource);
+                    grown->prefix = std::move(n->prefix);
+                    for (std::size_t b = 0; b < n->index.size(); ++b) {
+                        if (n->index[b]) {
+                            grown->children[b] = n->children[n->index[b] - 1u];
+                        }
+                    }
+                    grown->count = n->count;
+                    free_node(resource, n);
+                    ref = grown;
+                    add_child(resource, ref, byte, child);
+                    return;
+                }
+                case art_node_kind::node256: {
+                    auto* n = static_cast<node256_t*>(ref);
+                    n->children[byte] = child;
+                    ++n->count;
+                    return;
+                }
+                default:
+                    assert(false && "art: add_child on a leaf");
+            }
+        }
+
+        // Removes the child for `byte`; shrinks the node with some hysteresis and
+        // replaces a node4 left with a single child by that child.
+        void remove_child(std::pmr::memory_resource* resource, node_t*& ref, uint8_t byte) {
+            switch (ref->kind) {
+                case art_node_kind::node4: {
+                    auto* n = static_cast<node4_t*>(ref);
+                    remove_sorted(n, byte);
+                    if (n->count == 1) {
+                        node_t* child = n->children[0];
+                        if (child->kind != art_node_kind::leaf) {
+                            auto* inner = static_cast<inner_t*>(child);
+                            std::pmr::string prefix(n->prefix, resource);
+                            prefix.push_back(static_cast<char>(n->keys[0]));
+                            prefix.append(inner->prefix);
+                            inner->prefix = std::move(prefix);
+                        }
+                        free_node(resource, n);
+                        ref = child;
+                    }
+                    return;
+                }
+                case art_node_kind::node16: {
+                    auto* n = static_cast<node16_t*>(ref);
+                    remove_sorted(n, byte);
+                    if (n->count <= 3) {
+                        ref = copy_sorted<node16_t, node4_t>(resource, n);
+                    }
+                    return;
+                }
+                case art_node_kind::node48: {
+                    auto* n = static_cast<node48_t*>(ref);
+                    n->children[n->index[byte] - 1u] = nullptr;
+                    n->index[byte] = 0;
+                    --n->count;
+                    if (n->count <= 12) {
+                        auto* shrunk = make_node<node16_t>(resource, resource);
+                        shrunk->prefix = std::move(n->prefix);
+                        for (std::size_t b = 0; b < n->index.size(); ++b) {
+                            if (n->index[b]) {
+                                insert_sorted(shrunk, static_cast<uint8_t>(b), n->children[n->index[b] - 1u]);
+                            }
+                        }
+                        free_node(resource, n);
+                        ref = shrunk;
+                    }
+                    return;
+                }
+                case art_node_kind::node256: {
+                    auto* n = static_cast<node256_t*>(ref);
+                    n->children[byte] = nullptr;
+                    --n->count;
+                    if (n->count <= 37) {
+                        auto* shrunk = make_node<node48_t>(resource, resource);
+                        shrunk->prefix = std::move(n->prefix);
+                        for (std::size_t b = 0; b < n->children.size(); ++b) {
+                            if (n->children[b]) {
+                                shrunk->children[shrunk->count] = n->children[b];
+                                shrunk->index[b] = static_cast<uint8_t>(++shrunk->count);
+                            }
+                        }
+                        free_node(resource, n);
+                        ref = shrunk;
+                    }
+                    return;
+                }
+                default:
+                    assert(false && "art: remove_child on a leaf");
+            }
+        }
+
+        template<typename F>
+        void for_each_child(node_t* node, F&& fn) {
+            switch (node->kind) {
+                case art_node_kind::node4: {
+                    auto* n = static_cast<node4_t*>(node);
+                    std::for_each_n(n->children.begin(), n->count, fn);
+                    break;
+                }
+                case art_node_kind::node16: {
+                    auto* n = static_cast<node16_t*>(node);
+                    std::for_each_n(n->children.begin(), n->count, fn);
+                    break;
+                }
+                case art_node_kind::node48:
+                    for (auto* child : static_cast<node48_t*>(node)->children) {
+                        if (child) {
+                            fn(child);
+                        }
+                    }
+                    break;
+                case art_node_kind::node256:
+                    for (auto* child : static_cast<node256_t*>(node)->children) {
+                        if (child) {
+                            fn(child);
+                        }
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        // Keys are prefix-free (fixed-width payloads, terminated strings), so two distinct
+        // keys always diverge before either of them ends.
+        void insert_node(std::pmr::memory_resource* resource, node_t*& ref, leaf_t* leaf, std::size_t depth) {
+            std::string_view key = leaf->bytes;
+            if (!ref) {
+                ref = leaf;
+                return;
+            }
+            if (ref->kind == art_node_kind::leaf) {
+                std::string_view other = static_cast<leaf_t*>(ref)->bytes;
+                auto diverge = depth;
+                while (key[diverge] == other[diverge]) {
+                    ++diverge;
+                }
+                auto* split = make_node<node4_t>(resource, resource);
+                split->prefix.assign(key.substr(depth, diverge - depth));
+                node_t* node = split;
+                add_child(resource, node, byte_at(other, diverge), ref);
+                add_child(resource, node, byte_at(key, diverge), leaf);
+                ref = node;
+                return;
+            }
+            auto* inner = static_cast<inner_t*>(ref);
+            std::string_view prefix = inner->prefix;
+            std::size_t matched = 0;
+            while (matched < prefix.size() && prefix[matched] == key[depth + matched]) {
+                ++matched;
+            }
+            if (matched < prefix.size()) {
+                auto* split = make_node<node4_t>(resource, resource);
+                split->prefix.assign(prefix.substr(0, matched));
+                auto old_byte = byte_at(prefix, matched);
+                inner->prefix.erase(0, matched + 1);
+                node_t* node = split;
+                add_child(resource, node, old_byte, inner);
+                add_child(resource, node, byte_at(key, depth + matched), leaf);
+                ref = node;
+                return;
+            }
+            depth += prefix.size();
+            if (auto** child = find_child(ref, byte_at(key, depth))) {
+                insert_node(resource, *child, leaf, depth + 1);
+                return;
+            }
+            add_child(resource, ref, byte_at(key, depth), leaf);
+        }
+
+        void erase_node(std::pmr::memory_resource* resource, node_t*& ref, std::string_view key, std::size_t depth) {
+            depth += static_cast<inner_t*>(ref)->prefix.size();
+            auto byte = byte_at(key, depth);
+            auto** child = find_child(ref, byte);
+            assert(child != nullptr);
+            if ((*child)->kind == art_node_kind::leaf) {
+                remove_child(resource, ref, byte);
+                return;
+            }
+            erase_node(resource, *child, key, depth + 1);
+        }
+
+        leaf_t* lower_bound_from(node_t* node, std::string_view key, std::size_t depth) {
+            if (node->kind == art_node_kind::leaf) {
+                auto* leaf = static_cast<leaf_t*>(node);
+                return std::string_view(leaf->bytes) >= key ? leaf : leaf->next;
+            }
+            std::string_view prefix = static_cast<inner_t*>(node)->prefix;
+            for (std::size_t i = 0; i < prefix.size(); ++i) {
+                if (depth + i >= key.size() || byte_at(prefix, i) > byte_at(key, depth + i)) {
+                    return min_leaf(node);
+                }
+                if (byte_at(prefix, i) < byte_at(key, depth + i)) {
+                    return max_leaf(node)->next;
+                }
+            }
+            depth += prefix.size();
+            if (depth >= key.size()) {
+                return min_leaf(node);
+            }
+            auto byte = byte_at(key, depth);
+            if (auto** child = find_child(node, byte)) {
+                return lower_bound_from(*child, key, depth + 1);
+            }
+            if (auto* child = first_child_from(node, byte + 1u)) {
+                return min_leaf(child);
+            }
+            return max_leaf(node)->next;
+        }
+
+        void append_u64(std::string& out, uint64_t value) {
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                out.push_back(static_cast<char>(static_cast<uint8_t>(value >> shift)));
+            }
+        }
+
+        void append_signed(std::string& out, int64_t value) {
+            append_u64(out, static_cast<uint64_t>(value) ^ sign_bit);
+        }
+
+        void append_u128(std::string& out, types::uint128_t value) {
+            append_u64(out, absl::Uint128High64(value));
+            append_u64(out, absl::Uint128Low64(value));
+        }
+
+        void append_signed128(std::string& out, types::int128_t value) {
+            auto bits = static_cast<types::uint128_t>(value);
+            append_u64(out, absl::Uint128High64(bits) ^ sign_bit);
+            append_u64(out, absl::Uint128Low64(bits));
+        }
+
+        // Decimals of every scale share one key space: the unscaled value is brought to the
+        // largest scale an int64 decimal can have, which is exact in 128 bits
+        constexpr uint8_t max_decimal_scale = 18;
+
+        types::int128_t normalized_decimal(const value_t& value) {
+            auto scale = static_cast<const types::decimal_logical_type_extension*>(value.type().extension())->scale();
+            if (scale > max_decimal_scale) {
+                throw std::logic_error("art index: decimal scale is out of range");
+            }
+            types::int128_t result = value.value<int64_t>();
+            for (auto i = scale; i < max_decimal_scale; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+
+        void append_double(std::string& out, double value) {
+            if (value == 0.0) {
+                value = 0.0; // -0.0 and 0.0 are the same key
+            }
+            auto bits = std::bit_cast<uint64_t>(value);
+            append_u64(out, (bits & sign_bit) ? ~bits : bits | sign_bit);
+        }
+
+        void append_tag(std::string& out, art_key_class tag) { out.push_back(static_cast<char>(tag)); }
+
+        int64_t signed_of(const value_t& value) {
+            using types::logical_type;
+            switch (value.type().type()) {
+                case logical_type::TINYINT:
+                    return value.value<int8_t>();
+                case logical_type::SMALLINT:
+                    return value.value<int16_t>();
+                case logical_type::INTEGER:
+                    return value.value<int32_t>();
+                case logical_type::TIMESTAMP_SEC:
+                case logical_type::TIMESTAMP_MS:
+                case logical_type::TIMESTAMP_US:
+                case logical_type::TIMESTAMP_NS:
+                    return value.value<std::chrono::nanoseconds>().count();
+                default:
+                    return value.value<int64_t>();
+            }
+        }
+
+        uint64_t unsigned_of(const value_t& value) {
+            using types::logical_type;
+            switch (value.type().type()) {
+                case logical_type::UTINYINT:
+                    return value.value<uint8_t>();
+                case logical_type::USMALLINT:
+                    return value.value<uint16_t>();
+                case logical_type::UINTEGER:
+                    return value.value<uint32_t>();
+                default:
+                    return value.value<uint64_t>();
+            }
+        }
+
+        double floating_of(const value_t& value) {
+            return value.type().type() == types::logical_type::FLOAT ? static_cast<double>(value.value<float>())
+                                                                     : value.value<double>();
+        }
+
+        bool is_numeric_class(art_key_class key_class) {
+            return key_class == art_key_class::signed_integer || key_class == art_key_class::unsigned_integer ||
+                   key_class == art_key_class::floating;
+        }
+
+    } // namespace
+
+    art_key_class art_key_class_of(const value_t& value) {
+        if (value.is_null()) {
+            return art_key_class::null;
+        }
+        return art_key_class_of(value.type().type());
+    }
+
+    art_key_class art_key_class_of(types::logical_type type) {
+        using types::logical_type;
+        switch (type) {
+            case logical_type::BOOLEAN:
+                return art_key_class::boolean;
+            case logical_type::TINYINT:
+            case logical_type::SMALLINT:
+            case logical_type::INTEGER:
+            case logical_type::BIGINT:
+                return art_key_class::signed_integer;
+            case logical_type::UTINYINT:
+            case logical_type::USMALLINT:
+            case logical_type::UINTEGER:
+            case logical_type::UBIGINT:
+                return art_key_class::unsigned_integer;
+            case logical_type::FLOAT:
+            case logical_type::DOUBLE:
+                return art_key_class::floating;
+            case logical_type::TIMESTAMP_SEC:
+            case logical_type::TIMESTAMP_MS:
+            case logical_type::TIMESTAMP_US:
+            case logical_type::TIMESTAMP_NS:
+                return art_key_class::timestamp;
+            case logical_type::HUGEINT:
+                return art_key_class::huge_integer;
+            case logical_type::UHUGEINT:
+                return art_key_class::unsigned_huge_integer;
+            case logical_type::DECIMAL:
+                return art_key_class::decimal;
+            case logical_type::STRING_LITERAL:
+                return art_key_class::string;
+            case logical_type::ENUM:
+                return art_key_class::enumeration;
+            default:
+                return art_key_class::other;
+        }
+    }
+
+    bool art_supports_key_type(types::logical_type type) {
+        return type == types::logical_type::NA || art_key_class_of(type) != art_key_class::other;
+    }
+
+    void art_encode_key(const value_t& value, std::string& out) {
+        auto key_class = art_key_class_of(value);
+        append_tag(out, key_class);
+        switch (key_class) {
+            case art_key_class::boolean:
+                out.push_back(value.value<bool>() ? '\x01' : '\x00');
+                break;
+            case art_key_class::signed_integer:
+            case art_key_class::timestamp:
+                append_signed(out, signed_of(value));
+                break;
+            case art_key_class::unsigned_integer:
+                append_u64(out, unsigned_of(value));
+                break;
+            case art_key_class::floating:
+                append_double(out, floating_of(value));
+                break;
+            case art_key_class::huge_integer:
+                append_signed128(out, value.value<types::int128_t>());
+                break;
+            case art_key_class::unsigned_huge_integer:
+                append_u128(out, value.value<types::uint128_t>());
+                break;
+            case art_key_class::decimal:
+                append_signed128(out, normalized_decimal(value));
+                break;
+            case art_key_class::enumeration:
+                append_signed(out, value.value<int32_t>());
+                break;
+            case art_key_class::string:
+                // 0x00 inside the string is escaped as 0x00 0x01, the key ends with 0x00 0x00
+                for (char c : value.value<std::string_view>()) {
+                    out.push_back(c);
+                    if (c == '\0') {
+                        out.push_back('\x01');
+                    }
+                }
+                out.append(2, '\0');
+                break;
+            case art_key_class::null:
+                break;
+            case art_key_class::other:
+                // keys without a binary-comparable form would all collapse into the tag;
+                // CREATE INDEX rejects such columns before any value gets here
+                throw std::logic_error("art index: unsupported key type");
+        }
+    }
+
+    art_index_t::art_index_t(std::pmr::memory_resource* resource, std::string name, const keys_base_storage_t& keys)
+        : index_t(resource, logical_plan::index_type::art, std::move(name), keys) {}
+
+    art_index_t::~art_index_t() { destroy(root_); }
+
+    art_index_t::impl_t::impl_t(const leaf_t* leaf, std::size_t position)
+        : leaf_(leaf)
+        , position_(position) {}
+
+    index_t::iterator::reference art_index_t::impl_t::value_ref() const { return leaf_->entries[position_]; }
+
+    const value_t& art_index_t::impl_t::key_ref() const { return leaf_->key; }
+
+    index_t::iterator_t::iterator_impl_t* art_index_t::impl_t::next() {
+        if (++position_ >= leaf_->entries.size()) {
+            leaf_ = leaf_->next;
+            position_ = 0;
+        }
+        return this;
+    }
+
+    bool art_index_t::impl_t::equals(const iterator_impl_t* other) const {
+        auto* rhs = dynamic_cast<const impl_t*>(other);
+        return leaf_ == rhs->leaf_ && position_ == rhs->position_;
+    }
+
+    bool art_index_t::impl_t::not_equals(const iterator_impl_t* other) const { return !equals(other); }
+
+    index_t::iterator::iterator_impl_t* art_index_t::impl_t::copy() const { return new impl_t(*this); }
+
+    art_index_t::probe_position
+    art_index_t::make_probe(const value_t& value, probe_kind kind, std::string& out) const {
+        auto probe_class = art_key_class_of(value);
+        if (probe_class == key_class_ || probe_class == art_key_class::null || key_class_ == art_key_class::null) {
+            art_encode_key(value, out);
+            return probe_position::at;
+        }
+        if (!is_numeric_class(probe_class) || !is_numeric_class(key_class_)) {
+            // Keys are encoded under the tag of their class, so 5 finds a DECIMAL 5.00 key only once it is
+            // one. A probe that does not convert keeps its own class (a schemaless index may hold both).
+            auto converted = exact_index_probe(value, key_type_);
+            art_encode_key(converted ? *converted : value, out);
+            return probe_position::at;
+        }
+        auto outside = [kind](probe_position position) {
+            return kind == probe_kind::equal ? probe_position::none : position;
+        };
+
+        append_tag(out, key_class_);
+        if (key_class_ == art_key_class::floating) {
+            append_double(out,
+                          probe_class == art_key_class::signed_integer ? static_cast<double>(signed_of(value))
+                                                                       : static_cast<double>(unsigned_of(value)));
+            return probe_position::at;
+        }
+        if (probe_class == art_key_class::unsigned_integer) {
+            auto probe = unsigned_of(value);
+            if (probe > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                return outside(probe_position::above);
+            }
+            append_signed(out, static_cast<int64_t>(probe));
+            return probe_position::at;
+        }
+        if (probe_class == art_key_class::signed_integer) {
+            auto probe = signed_of(value);
+            if (probe < 0) {
+                return outside(probe_position::below);
+            }
+            append_u64(out, static_cast<uint64_t>(probe));
+            return probe_position::at;
+        }
+
+        // Floating probe against an integer index: keys >= 2.5 are keys >= 3, keys > 2.5 are keys > 2
+        auto probe = floating_of(value);
+        if (std::isnan(probe)) {
+            return outside(probe_position::above);
+        }
+        auto integral = kind == probe_kind::lower ? std::ceil(probe) : std::floor(probe);
+        if (kind == probe_kind::equal && integral != probe) {
+            return probe_position::none;
+        }
+        bool is_signed = key_class_ == art_key_class::signed_integer;
+        double low = is_signed ? -9223372036854775808.0 : 0.0;
+        double high = is_signed ? 9223372036854775808.0 : 18446744073709551616.0;
+        if (integral < low) {
+            return outside(probe_position::below);
+        }
+        if (integral >= high) {
+            return outside(probe_position::above);
+        }
+        if (is_signed) {
+            append_signed(out, static_cast<int64_t>(integral));
+        } else {
+            append_u64(out, static_cast<uint64_t>(integral));
+        }
+        return probe_position::at;
+    }
+
+    art_index_t::leaf_t* art_index_t::find_leaf(std::string_view key) const {
+        node_t* node = root_;
+        std::size_t depth = 0;
+        while (node) {
+            if (node->kind == art_node_kind::leaf) {
+                auto* leaf = static_cast<leaf_t*>(node);
+                return std::string_view(leaf->bytes) == key ? leaf : nullptr;
+            }
+            std::string_view prefix = static_cast<inner_t*>(node)->prefix;
+            if (key.substr(depth, prefix.size()) != prefix) {
+                return nullptr;
+            }
+            depth += prefix.size();
+            if (depth >= key.size()) {
+                return nullptr;
+            }
+            auto** child = find_child(node, byte_at(key, depth));
+            node = child ? *child : nullptr;
+            ++depth;
+        }
+        return nullptr;
+    }
+
+    art_index_t::leaf_t* art_index_t::lower_bound_leaf(std::string_view key) const {
+        return root_ ? lower_bound_from(root_, key, 0) : nullptr;
+    }
+
+    art_index_t::leaf_t* art_index_t::upper_bound_leaf(std::string_view key) const {
+        auto* leaf = lower_bound_leaf(key);
+        return leaf && std::string_view(leaf->bytes) == key ? leaf->next : leaf;
+    }
+
+    art_index_t::leaf_t* art_index_t::probe_bound(const value_t& value, probe_kind kind) const {
+        std::string probe;
+        switch (make_probe(value, kind, probe)) {
+            case probe_position::below:
+                return head_;
+            case probe_position::above:
+                // past every value of the index class, but still before the nulls
+                return lower_bound_leaf(std::string(1, static_cast<char>(art_key_class::null)));
+            case probe_position::at:
+                return kind == probe_kind::lower ? lower_bound_leaf(probe) : upper_bound_leaf(probe);
+            default:
+                return nullptr;
+        }
+    }
+
+    art_index_t::leaf_t* art_index_t::insert_entry(const value_t& key, index_value_t value) {
+        std::string bytes;
+        art_encode_key(key, bytes);
+        if (auto* leaf = find_leaf(bytes)) {
+            leaf->entries.push_back(std::move(value));
+            return leaf;
+        }
+        if (key_class_ == art_key_class::null) {
+            key_class_ = art_key_class_of(key);
+            key_type_ = key.type();
+        }
+
+        auto* leaf = make_node<leaf_t>(resource(), resource(), bytes, key);
+        leaf->entries.push_back(std::move(value));
+        auto* next = lower_bound_leaf(bytes);
+        leaf->next = next;
+        leaf->prev = next ? next->prev : tail_;
+        if (leaf->prev) {
+            leaf->prev->next = leaf;
+        } else {
+            head_ = leaf;
+        }
+        if (next) {
+            next->prev = leaf;
+        } else {
+            tail_ = leaf;
+        }
+        insert_node(resource(), root_, leaf, 0);
+        ++leaf_count_;
+        return leaf;
+    }
+
+    void art_index_t::erase_leaf(leaf_t* leaf) {
+        if (root_ == leaf) {
+            root_ = nullptr;
+        } else {
+            erase_node(resource(), root_, leaf->bytes, 0);
+        }
+        if (leaf->prev) {
+            leaf->prev->next = leaf->next;
+        } else {
+            head_ = leaf->next;
+        }
+        if (leaf->next) {
+            leaf->next->prev = leaf->prev;
+        } else {
+            tail_ = leaf->prev;
+        }
+        free_node(resource(), leaf);
+        --leaf_count_;
+    }
+
+    void art_index_t::destroy(node_t* node) {
+        if (!node) {
+            return;
+        }
+        for_each_child(node, [this](node_t* child) { destroy(child); });
+        free_any(resource(), node);
+    }
+
+    auto art_index_t::insert_impl(value_t key, index_value_t value) -> void { insert_entry(key, std::move(value)); }
+
+    auto art_index_t::remove_impl(value_t key) -> void {
+        std::string bytes;
+        art_encode_key(key, bytes);
+        if (auto* leaf = find_leaf(bytes)) {
+            leaf->entries.erase(leaf->entries.begin());
+            if (leaf->entries.empty()) {
+                erase_leaf(leaf);
+            }
+        }
+    }
+
+    index_t::range art_index_t::find_impl(const value_t& value) const {
+        std::string probe;
+        leaf_t* leaf = nullptr;
+        if (make_probe(value, probe_kind::equal, probe) == probe_position::at) {
+            leaf = find_leaf(probe);
+        }
+        if (!leaf) {
+            return std::make_pair(cend(), cend());
+        }
+        return std::make_pair(iterator(new impl_t(leaf, 0)), iterator(new impl_t(leaf->next, 0)));
+    }
+
+    index_t::range art_index_t::lower_bound_impl(const value_t& value) const {
+        return std::make_pair(cbegin(), iterator(new impl_t(probe_bound(value, probe_kind::lower), 0)));
+    }
+
+    index_t::range art_index_t::upper_bound_impl(const value_t& value) const {
+        return std::make_pair(iterator(new impl_t(probe_bound(value, probe_kind::upper), 0)), cend());
+    }
+
+    index_t::iterator art_index_t::cbegin_impl() const { return iterator(new impl_t(head_, 0)); }
+
+    index_t::iterator art_index_t::cend_impl() const { return iterator(new impl_t(nullptr, 0)); }
+
+    void art_index_t::insert_txn_impl(value_t key, int64_t row_index, uint64_t txn_id) {
+        auto* leaf = insert_entry(key, index_value_t(row_index, txn_id, table::NOT_DELETED_ID));
+        pending_inserts_[txn_id].emplace_back(leaf->bytes, row_index);
+    }
+
+    void art_index_t::mark_delete_impl(value_t key, int64_t row_index, uint64_t txn_id) {
+        std::string bytes;
+        art_encode_key(key, bytes);
+        auto* leaf = find_leaf(bytes);
+        if (!leaf) {
+            return;
+        }
+        for (auto& entry : leaf->entries) {
+            if (entry.row_index == row_index && entry.delete_id == table::NOT_DELETED_ID) {
+                entry.delete_id = txn_id;
+                pending_deletes_[txn_id].emplace_back(std::move(bytes), row_index);
+                return;
+            }
+        }
+    }
+
+    void art_index_t::commit_insert_impl(uint64_t txn_id, uint64_t commit_id) {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* leaf = find_leaf(bytes)) {
+                for (auto& entry : leaf->entries) {
+                    if (entry.row_index == row_index && entry.insert_id == txn_id) {
+                        entry.insert_id = commit_id;
+                        break;
+                    }
+                }
+            }
+        }
+        pending_inserts_.erase(it);
+    }
+
+    void art_index_t::commit_delete_impl(uint64_t txn_id, uint64_t commit_id) {
+        auto it = pending_deletes_.find(txn_id);
+        if (it == pending_deletes_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* leaf = find_leaf(bytes)) {
+                for (auto& entry : leaf->entries) {
+                    if (entry.row_index == row_index && entry.delete_id == txn_id) {
+                        entry.delete_id = commit_id;
+                        break;
+                    }
+                }
+            }
+        }
+        pending_deletes_.erase(it);
+    }
+
+    void art_index_t::revert_insert_impl(uint64_t txn_id) {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            auto* leaf = find_leaf(bytes);
+            if (!leaf) {
+                continue;
+            }
+            auto entry = std::find_if(leaf->entries.begin(), leaf->entries.end(), [&](const index_value_t& e) {
+                return e.row_index == row_index && e.insert_id == txn_id;
+            });
+            if (entry != leaf->entries.end()) {
+                leaf->entries.erase(entry);
+                if (leaf->entries.empty()) {
+                    erase_leaf(leaf);
+                }
+            }
+        }
+        pending_inserts_.erase(it);
+    }
+
+    void art_index_t::cleanup_versions_impl(uint64_t lowest_active) {
+        for (auto* leaf = head_; leaf;) {
+            auto* next = leaf->next;
+            std::erase_if(leaf->entries, [lowest_active](const index_value_t& e) {
+                return e.delete_id < lowest_active && e.delete_id < table::TRANSACTION_ID_START;
+            });
+            if (leaf->entries.empty()) {
+                erase_leaf(leaf);
+            }
+            leaf = next;
+        }
+        // Also clean up any stale pending entries for committed txns
+        for (auto it = pending_deletes_.begin(); it != pending_deletes_.end();) {
+            if (it->first < lowest_active && it->first < table::TRANSACTION_ID_START) {
+                it = pending_deletes_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void art_index_t::remap_rows_impl(const table::row_id_remap_t& remap) {
+        for (auto* leaf = head_; leaf;) {
+            auto* next = leaf->next;
+            for (auto& entry : leaf->entries) {
+                entry.row_index = remap.map(entry.row_index);
+            }
+            std::erase_if(leaf->entries,
+                          [](const index_value_t& e) { return e.row_index == table::row_id_remap_t::DROPPED; });
+            if (leaf->entries.empty()) {
+                erase_leaf(leaf);
+            }
+            leaf = next;
+        }
+        remap_pending_rows(pending_inserts_, remap);
+        remap_pending_rows(pending_deletes_, remap);
+    }
+
+    void art_index_t::for_each_pending_insert_impl(uint64_t txn_id,
+                                                   const std::function<void(const value_t&, int64_t)>& fn) const {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* leaf = find_leaf(bytes)) {
+                fn(leaf->key, row_index);
+            }
+        }
+    }
+
+    void art_index_t::for_each_pending_delete_impl(uint64_t txn_id,
+                                                   const std::function<void(const value_t&, int64_t)>& fn) const {
+        auto it = pending_deletes_.find(txn_id);
+        if (it == pending_deletes_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* leaf = find_leaf(bytes)) {
+                fn(leaf->key, row_index);
+            }
+        }
+    }
+
+    void art_index_t::clean_memory_to_new_elements_impl(std::size_t) {
+        destroy(root_);
+        root_ = nullptr;
+        head_ = nullptr;
+        tail_ = nullptr;
+        leaf_count_ = 0;
+        key_class_ = art_key_class::null;
+        key_type_ = types::complex_logical_type{};
+        pending_inserts_.clear();
+        pending_deletes_.clear();
+    }
+
+} // namespace components::index
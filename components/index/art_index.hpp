@@ -0,0 +1,132 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "forward.hpp"
+#include "index.hpp"
+
+namespace components::index {
+
+    // Binary-comparable form of an index key: a class tag followed by a payload whose
+    // byte-wise order matches the value order (big-endian integers with the sign bit
+    // flipped, IEEE doubles with the usual sign trick, escaped zero-terminated strings).
+    // Nulls get the largest tag so they sort last, as NA does in the btree index.
+    enum class art_key_class : uint8_t
+    {
+        boolean = 0x10,
+        signed_integer = 0x20,
+        unsigned_integer = 0x21,
+        floating = 0x22,
+        huge_integer = 0x23,
+        unsigned_huge_integer = 0x24,
+        decimal = 0x25,
+        timestamp = 0x30,
+        string = 0x40,
+        enumeration = 0x50,
+        other = 0xF0,
+        null = 0xFF
+    };
+
+    art_key_class art_key_class_of(const value_t& value);
+    // Class of the non-null values of a type
+    art_key_class art_key_class_of(types::logical_type type);
+    // Throws for values of a type art_supports_key_type() rejects
+    void art_encode_key(const value_t& value, std::string& out);
+    // Whether keys of the type have a binary-comparable form, i.e. the type can be indexed by
+    // the ART and hash indexes
+    bool art_supports_key_type(types::logical_type type);
+
+    // Adaptive radix tree over normalized keys. Each distinct key owns one leaf holding the
+    // original key and its MVCC entries; leaves are chained in key order for range scans.
+    class art_index_t final : public index_t {
+    public:
+        art_index_t(std::pmr::memory_resource*, std::string name, const keys_base_storage_t&);
+        ~art_index_t() override;
+
+        std::size_t leaf_count() const noexcept { return leaf_count_; }
+
+        struct node_t;
+        struct leaf_t;
+
+    private:
+        class impl_t final : public index_t::iterator::iterator_impl_t {
+        public:
+            impl_t(const leaf_t* leaf, std::size_t position);
+            index_t::iterator::reference value_ref() const final;
+            const value_t& key_ref() const final;
+            iterator_impl_t* next() final;
+            bool equals(const iterator_impl_t* other) const final;
+            bool not_equals(const iterator_impl_t* other) const final;
+            iterator_impl_t* copy() const final;
+
+        private:
+            const leaf_t* leaf_;
+            std::size_t position_;
+        };
+
+        // Where a probe falls relative to the keys of the index class when it cannot be
+        // represented exactly (e.g. 2.5 against an integer index, or -1 against an unsigned one).
+        enum class probe_position
+        {
+            below,
+            at,
+            above,
+            none
+        };
+        enum class probe_kind
+        {
+            equal,
+            lower,
+            upper
+        };
+        probe_position make_probe(const value_t& value, probe_kind kind, std::string& out) const;
+
+        auto insert_impl(value_t, index_value_t value) -> void final;
+        auto remove_impl(value_t key) -> void final;
+        range find_impl(const value_t& value) const final;
+        range lower_bound_impl(const value_t& value) const final;
+        range upper_bound_impl(const value_t& value) const final;
+        iterator cbegin_impl() const final;
+        iterator cend_impl() const final;
+
+        void insert_txn_impl(value_t key, int64_t row_index, uint64_t txn_id) final;
+        void mark_delete_impl(value_t key, int64_t row_index, uint64_t txn_id) final;
+        void commit_insert_impl(uint64_t txn_id, uint64_t commit_id) final;
+        void commit_delete_impl(uint64_t txn_id, uint64_t commit_id) final;
+        void revert_insert_impl(uint64_t txn_id) final;
+        void cleanup_versions_impl(uint64_t lowest_active) final;
+        void remap_rows_impl(const table::row_id_remap_t& remap) final;
+        void for_each_pending_insert_impl(uint64_t txn_id,
+                                          const std::function<void(const value_t&, int64_t)>& fn) const final;
+        void for_each_pending_delete_impl(uint64_t txn_id,
+                                          const std::function<void(const value_t&, int64_t)>& fn) const final;
+
+        void clean_memory_to_new_elements_impl(std::size_t count) final;
+
+        leaf_t* insert_entry(const value_t& key, index_value_t value);
+        leaf_t* find_leaf(std::string_view key) const;
+        leaf_t* lower_bound_leaf(std::string_view key) const;
+        leaf_t* upper_bound_leaf(std::string_view key) const;
+        leaf_t* probe_bound(const value_t& value, probe_kind kind) const;
+        void erase_leaf(leaf_t* leaf);
+        void destroy(node_t* node);
+
+    private:
+        node_t* root_{nullptr};
+        leaf_t* head_{nullptr};
+        leaf_t* tail_{nullptr};
+        std::size_t leaf_count_{0};
+        // Class of the first non-null key; probes of another numeric class are converted to it.
+        art_key_class key_class_{art_key_class::null};
+        // type of the first key; probes of another key class are converted to it
+        types::complex_logical_type key_type_;
+
+        // Pending txn tracking for O(k) commit/revert; keys are kept normalized
+        using pending_entry = std::pair<std::string, int64_t>; // key, row_index
+        std::unordered_map<uint64_t, std::vector<pending_entry>> pending_inserts_;
+        std::unordered_map<uint64_t, std::vector<pending_entry>> pending_deletes_;
+    };
+
+} // namespace components::index
@@ -0,0 +1,431 @@
+#include "hash_index.hpp"
+#include "art_index.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace components::index {
+
+    struct hash_index_t::group_t {
+        group_t(std::pmr::memory_resource* resource, std::string_view bytes, const value_t& key)
+            : bytes(bytes, resource)
+            , key(key)
+            , entries(resource) {}
+
+        std::pmr::string bytes;
+        value_t key;
+        std::pmr::vector<index_value_t> entries;
+    };
+
+    namespace {
+
+        using group_t = hash_index_t::group_t;
+        using slot_t = hash_index_t::slot_t;
+
+        constexpr std::size_t min_capacity = 16;
+
+        std::size_t hash_of(std::string_view key) { return std::hash<std::string_view>{}(key); }
+
+        group_t* make_group(std::pmr::memory_resource* resource, std::string_view bytes, const value_t& key) {
+            return new (resource->allocate(sizeof(group_t), alignof(group_t))) group_t(resource, bytes, key);
+        }
+
+        void free_group(std::pmr::memory_resource* resource, group_t* group) {
+            group->~group_t();
+            resource->deallocate(group, sizeof(group_t), alignof(group_t));
+        }
+
+        void encode_integral(int64_t value, std::string& out) {
+            art_encode_key(value_t(std::pmr::null_memory_resource(), value), out);
+        }
+
+    } // namespace
+
+    void hash_encode_key(const value_t& value, std::string& out) {
+        using types::logical_type;
+        switch (art_key_class_of(value)) {
+            case art_key_class::signed_integer:
+                switch (value.type().type()) {
+                    case logical_type::TINYINT:
+                        return encode_integral(value.value<int8_t>(), out);
+                    case logical_type::SMALLINT:
+                        return encode_integral(value.value<int16_t>(), out);
+                    case logical_type::INTEGER:
+                        return encode_integral(value.value<int32_t>(), out);
+                    default:
+                        return encode_integral(value.value<int64_t>(), out);
+                }
+            case art_key_class::unsigned_integer: {
+                uint64_t unsigned_value;
+                switch (value.type().type()) {
+                    case logical_type::UTINYINT:
+                        unsigned_value = value.value<uint8_t>();
+                        break;
+                    case logical_type::USMALLINT:
+                        unsigned_value = value.value<uint16_t>();
+                        break;
+                    case logical_type::UINTEGER:
+                        unsigned_value = value.value<uint32_t>();
+                        break;
+                    default:
+                        unsigned_value = value.value<uint64_t>();
+                        break;
+                }
+                if (unsigned_value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                    return encode_integral(static_cast<int64_t>(unsigned_value), out);
+                }
+                return art_encode_key(value_t(std::pmr::null_memory_resource(), unsigned_value), out);
+            }
+            case art_key_class::floating: {
+                auto floating = value.type().type() == logical_type::FLOAT ? static_cast<double>(value.value<float>())
+                                                                           : value.value<double>();
+                if (std::trunc(floating) == floating) {
+                    if (floating >= -9223372036854775808.0 && floating < 9223372036854775808.0) {
+                        return encode_integral(static_cast<int64_t>(floating), out);
+                    }
+                    if (floating >= 0.0 && floating < 18446744073709551616.0) {
+                        return art_encode_key(
+                            value_t(std::pmr::null_memory_resource(), static_cast<uint64_t>(floating)),
+                            out);
+                    }
+                }
+                return art_encode_key(value_t(std::pmr::null_memory_resource(), floating), out);
+            }
+            default:
+                return art_encode_key(value, out);
+        }
+    }
+
+    hash_index_t::hash_index_t(std::pmr::memory_resource* resource, std::string name, const keys_base_storage_t& keys)
+        : index_t(resource, logical_plan::index_type::hashed, std::move(name), keys)
+        , slots_(min_capacity, resource) {}
+
+    hash_index_t::~hash_index_t() {
+        for (auto& slot : slots_) {
+            if (slot.group) {
+                free_group(resource(), slot.group);
+            }
+        }
+    }
+
+    hash_index_t::impl_t::impl_t(const slot_t* slot, const slot_t* end, std::size_t position)
+        : slot_(slot)
+        , end_(end)
+        , position_(position) {}
+
+    index_t::iterator::reference hash_index_t::impl_t::value_ref() const { return slot_->group->entries[position_]; }
+
+    const value_t& hash_index_t::impl_t::key_ref() const { return slot_->group->key; }
+
+    index_t::iterator_t::iterator_impl_t* hash_index_t::impl_t::next() {
+        if (++position_ >= slot_->group->entries.size()) {
+            position_ = 0;
+            do {
+                ++slot_;
+            } while (slot_ != end_ && !slot_->group);
+        }
+        return this;
+    }
+
+    bool hash_index_t::impl_t::equals(const iterator_impl_t* other) const {
+        auto* rhs = dynamic_cast<const impl_t*>(other);
+        return slot_ == rhs->slot_ && position_ == rhs->position_;
+    }
+
+    bool hash_index_t::impl_t::not_equals(const iterator_impl_t* other) const { return !equals(other); }
+
+    index_t::iterator::iterator_impl_t* hash_index_t::impl_t::copy() const { return new impl_t(*this); }
+
+    // Index of the slot holding `key`, or of the empty slot that ends its probe sequence.
+    std::size_t hash_index_t::find_slot(std::string_view key, std::size_t hash) const {
+        auto mask = slots_.size() - 1;
+        auto slot = hash & mask;
+        while (slots_[slot].group &&
+               (slots_[slot].hash != hash || std::string_view(slots_[slot].group->bytes) != key)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    hash_index_t::group_t* hash_index_t::find_group(std::string_view key) const {
+        return slots_[find_slot(key, hash_of(key))].group;
+    }
+
+    hash_index_t::group_t* hash_index_t::insert_entry(const value_t& key, index_value_t value) {
+        std::string bytes;
+        hash_encode_key(key, bytes);
+        auto hash = hash_of(bytes);
+        auto slot = find_slot(bytes, hash);
+        if (!slots_[slot].group) {
+            // keep the load factor under 3/4
+            if ((size_ + 1) * 4 > slots_.size() * 3) {
+                rehash(slots_.size() * 2);
+                slot = find_slot(bytes, hash);
+            }
+            slots_[slot] = {hash, make_group(resource(), bytes, key)};
+            ++size_;
+        }
+        slots_[slot].group->entries.push_back(std::move(value));
+        return slots_[slot].group;
+    }
+
+    // Backward-shift deletion keeps probe sequences intact without tombstones.
+    void hash_index_t::erase_slot(std::size_t slot) {
+        free_group(resource(), slots_[slot].group);
+        --size_;
+        auto mask = slots_.size() - 1;
+        auto hole = slot;
+        for (auto next = (hole + 1) & mask; slots_[next].group; next = (next + 1) & mask) {
+            auto home = slots_[next].hash & mask;
+            // `next` may move into the hole only if its home slot is not in (hole, next]
+            bool in_range = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+            if (!in_range) {
+                slots_[hole] = slots_[next];
+                hole = next;
+            }
+        }
+        slots_[hole] = slot_t{};
+    }
+
+    void hash_index_t::erase_group(std::string_view key) {
+        auto slot = find_slot(key, hash_of(key));
+        if (slots_[slot].group) {
+            erase_slot(slot);
+        }
+    }
+
+    void hash_index_t::rehash(std::size_t capacity) {
+        std::pmr::vector<slot_t> slots(capacity, resource());
+        std::swap(slots_, slots);
+        auto mask = capacity - 1;
+        for (const auto& slot : slots) {
+            if (slot.group) {
+                auto position = slot.hash & mask;
+                while (slots_[position].group) {
+                    position = (position + 1) & mask;
+                }
+                slots_[position] = slot;
+            }
+        }
+    }
+
+    const hash_index_t::slot_t* hash_index_t::first_occupied(const slot_t* slot) const {
+        const auto* end = slots_.data() + slots_.size();
+        while (slot != end && !slot->group) {
+            ++slot;
+        }
+        return slot;
+    }
+
+    auto hash_index_t::insert_impl(value_t key, index_value_t value) -> void { insert_entry(key, std::move(value)); }
+
+    auto hash_index_t::remove_impl(value_t key) -> void {
+        std::string bytes;
+        hash_encode_key(key, bytes);
+        auto slot = find_slot(bytes, hash_of(bytes));
+        if (auto* group = slots_[slot].group) {
+            group->entries.erase(group->entries.begin());
+            if (group->entries.empty()) {
+                erase_slot(slot);
+            }
+        }
+    }
+
+    index_t::range hash_index_t::find_impl(const value_t& value) const {
+        std::string bytes;
+        hash_encode_key(value, bytes);
+        auto slot = find_slot(bytes, hash_of(bytes));
+        if (!slots_[slot].group) {
+            return std::make_pair(cend(), cend());
+        }
+        const auto* begin = slots_.data() + slot;
+        const auto* end = slots_.data() + slots_.size();
+        return std::make_pair(iterator(new impl_t(begin, end, 0)),
+                              iterator(new impl_t(first_occupied(begin + 1), end, 0)));
+    }
+
+    index_t::range hash_index_t::lower_bound_impl(const value_t&) const { return std::make_pair(cend(), cend()); }
+
+    index_t::range hash_index_t::upper_bound_impl(const value_t&) const { return std::make_pair(cend(), cend()); }
+
+    index_t::iterator hash_index_t::cbegin_impl() const {
+        const auto* end = slots_.data() + slots_.size();
+        return iterator(new impl_t(first_occupied(slots_.data()), end, 0));
+    }
+
+    index_t::iterator hash_index_t::cend_impl() const {
+        const auto* end = slots_.data() + slots_.size();
+        return iterator(new impl_t(end, end, 0));
+    }
+
+    void hash_index_t::insert_txn_impl(value_t key, int64_t row_index, uint64_t txn_id) {
+        auto* group = insert_entry(key, index_value_t(row_index, txn_id, table::NOT_DELETED_ID));
+        pending_inserts_[txn_id].emplace_back(group->bytes, row_index);
+    }
+
+    void hash_index_t::mark_delete_impl(value_t key, int64_t row_index, uint64_t txn_id) {
+        std::string bytes;
+        hash_encode_key(key, bytes);
+        auto* group = find_group(bytes);
+        if (!group) {
+            return;
+        }
+        for (auto& entry : group->entries) {
+            if (entry.row_index == row_index && entry.delete_id == table::NOT_DELETED_ID) {
+                entry.delete_id = txn_id;
+                pending_deletes_[txn_id].emplace_back(std::move(bytes), row_index);
+                return;
+            }
+        }
+    }
+
+    void hash_index_t::commit_insert_impl(uint64_t txn_id, uint64_t commit_id) {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* group = find_group(bytes)) {
+                for (auto& entry : group->entries) {
+                    if (entry.row_index == row_index && entry.insert_id == txn_id) {
+                        entry.insert_id = commit_id;
+                        break;
+                    }
+                }
+            }
+        }
+        pending_inserts_.erase(it);
+    }
+
+    void hash_index_t::commit_delete_impl(uint64_t txn_id, uint64_t commit_id) {
+        auto it = pending_deletes_.find(txn_id);
+        if (it == pending_deletes_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* group = find_group(bytes)) {
+                for (auto& entry : group->entries) {
+                    if (entry.row_index == row_index && entry.delete_id == txn_id) {
+                        entry.delete_id = commit_id;
+                        break;
+                    }
+                }
+            }
+        }
+        pending_deletes_.erase(it);
+    }
+
+    void hash_index_t::revert_insert_impl(uint64_t txn_id) {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            auto slot = find_slot(bytes, hash_of(bytes));
+            auto* group = slots_[slot].group;
+            if (!group) {
+                continue;
+            }
+            auto entry = std::find_if(group->entries.begin(), group->entries.end(), [&](const index_value_t& e) {
+                return e.row_index == row_index && e.insert_id == txn_id;
+            });
+            if (entry != group->entries.end()) {
+                group->entries.erase(entry);
+                if (group->entries.empty()) {
+                    erase_slot(slot);
+                }
+            }
+        }
+        pending_inserts_.erase(it);
+    }
+
+    void hash_index_t::cleanup_versions_impl(uint64_t lowest_active) {
+        // Slots move on erase, so emptied groups are collected first and erased afterwards
+        std::vector<std::string> emptied;
+        for (auto& slot : slots_) {
+            if (!slot.group) {
+                continue;
+            }
+            std::erase_if(slot.group->entries, [lowest_active](const index_value_t& e) {
+                return e.delete_id < lowest_active && e.delete_id < table::TRANSACTION_ID_START;
+            });
+            if (slot.group->entries.empty()) {
+                emptied.emplace_back(slot.group->bytes);
+            }
+        }
+        for (const auto& bytes : emptied) {
+            erase_group(bytes);
+        }
+        // Also clean up any stale pending entries for committed txns
+        for (auto it = pending_deletes_.begin(); it != pending_deletes_.end();) {
+            if (it->first < lowest_active && it->first < table::TRANSACTION_ID_START) {
+                it = pending_deletes_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void hash_index_t::remap_rows_impl(const table::row_id_remap_t& remap) {
+        std::vector<std::string> emptied;
+        for (auto& slot : slots_) {
+            if (!slot.group) {
+                continue;
+            }
+            for (auto& entry : slot.group->entries) {
+                entry.row_index = remap.map(entry.row_index);
+            }
+            std::erase_if(slot.group->entries,
+                          [](const index_value_t& e) { return e.row_index == table::row_id_remap_t::DROPPED; });
+            if (slot.group->entries.empty()) {
+                emptied.emplace_back(slot.group->bytes);
+            }
+        }
+        for (const auto& bytes : emptied) {
+            erase_group(bytes);
+        }
+        remap_pending_rows(pending_inserts_, remap);
+        remap_pending_rows(pending_deletes_, remap);
+    }
+
+    void hash_index_t::for_each_pending_insert_impl(uint64_t txn_id,
+                                                    const std::function<void(const value_t&, int64_t)>& fn) const {
+        auto it = pending_inserts_.find(txn_id);
+        if (it == pending_inserts_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* group = find_group(bytes)) {
+                fn(group->key, row_index);
+            }
+        }
+    }
+
+    void hash_index_t::for_each_pending_delete_impl(uint64_t txn_id,
+                                                    const std::function<void(const value_t&, int64_t)>& fn) const {
+        auto it = pending_deletes_.find(txn_id);
+        if (it == pending_deletes_.end())
+            return;
+        for (const auto& [bytes, row_index] : it->second) {
+            if (auto* group = find_group(bytes)) {
+                fn(group->key, row_index);
+            }
+        }
+    }
+
+    void hash_index_t::clean_memory_to_new_elements_impl(std::size_t count) {
+        for (auto& slot : slots_) {
+            if (slot.group) {
+                free_group(resource(), slot.group);
+            }
+        }
+        // size for `count` keys at the target load factor
+        std::size_t capacity = min_capacity;
+        while (capacity * 3 < count * 4) {
+            capacity *= 2;
+        }
+        slots_.assign(capacity, slot_t{});
+        size_ = 0;
+        pending_inserts_.clear();
+        pending_deletes_.clear();
+    }
+
+} // namespace components::index
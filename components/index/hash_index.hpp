@@ -0,0 +1,91 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "forward.hpp"
+#include "index.hpp"
+
+namespace components::index {
+
+    // Canonical byte form used for hashing: numerically equal keys of different types
+    // (5, 5u, 5.0) produce the same bytes, everything else reuses the ART key encoding.
+    void hash_encode_key(const value_t& value, std::string& out);
+
+    // Equality-only index: open addressing with linear probing over one group per distinct
+    // key; a group keeps the original key and its MVCC entries. There is no key order, so
+    // lower_bound/upper_bound are empty and range scans fall back to a filtered full pass.
+    class hash_index_t final : public index_t {
+    public:
+        hash_index_t(std::pmr::memory_resource*, std::string name, const keys_base_storage_t&);
+        ~hash_index_t() override;
+
+        std::size_t key_count() const noexcept { return size_; }
+        std::size_t capacity() const noexcept { return slots_.size(); }
+
+        struct group_t;
+        struct slot_t {
+            std::size_t hash{0};
+            group_t* group{nullptr};
+        };
+
+    private:
+        class impl_t final : public index_t::iterator::iterator_impl_t {
+        public:
+            impl_t(const slot_t* slot, const slot_t* end, std::size_t position);
+            index_t::iterator::reference value_ref() const final;
+            const value_t& key_ref() const final;
+            iterator_impl_t* next() final;
+            bool equals(const iterator_impl_t* other) const final;
+            bool not_equals(const iterator_impl_t* other) const final;
+            iterator_impl_t* copy() const final;
+
+        private:
+            const slot_t* slot_;
+            const slot_t* end_;
+            std::size_t position_;
+        };
+
+        auto insert_impl(value_t, index_value_t value) -> void final;
+        auto remove_impl(value_t key) -> void final;
+        range find_impl(const value_t& value) const final;
+        range lower_bound_impl(const value_t& value) const final;
+        range upper_bound_impl(const value_t& value) const final;
+        iterator cbegin_impl() const final;
+        iterator cend_impl() const final;
+
+        void insert_txn_impl(value_t key, int64_t row_index, uint64_t txn_id) final;
+        void mark_delete_impl(value_t key, int64_t row_index, uint64_t txn_id) final;
+        void commit_insert_impl(uint64_t txn_id, uint64_t commit_id) final;
+        void commit_delete_impl(uint64_t txn_id, uint64_t commit_id) final;
+        void revert_insert_impl(uint64_t txn_id) final;
+        void cleanup_versions_impl(uint64_t lowest_active) final;
+        void remap_rows_impl(const table::row_id_remap_t& remap) final;
+        void for_each_pending_insert_impl(uint64_t txn_id,
+                                          const std::function<void(const value_t&, int64_t)>& fn) const final;
+        void for_each_pending_delete_impl(uint64_t txn_id,
+                                          const std::function<void(const value_t&, int64_t)>& fn) const final;
+
+        void clean_memory_to_new_elements_impl(std::size_t count) final;
+        bool supports_range_impl() const noexcept final { return false; }
+
+        std::size_t find_slot(std::string_view key, std::size_t hash) const;
+        group_t* find_group(std::string_view key) const;
+        group_t* insert_entry(const value_t& key, index_value_t value);
+        void erase_slot(std::size_t slot);
+        void erase_group(std::string_view key);
+        void rehash(std::size_t capacity);
+        const slot_t* first_occupied(const slot_t* slot) const;
+
+    private:
+        std::pmr::vector<slot_t> slots_;
+        std::size_t size_{0};
+
+        // Pending txn tracking for O(k) commit/revert; keys are kept normalized
+        using pending_entry = std::pair<std::string, int64_t>; // key, row_index
+        std::unordered_map<uint64_t, std::vector<pending_entry>> pending_inserts_;
+        std::unordered_map<uint64_t, std::vector<pending_entry>> pending_deletes_;
+    };
+
+} // namespace components::index
@@ -1,8 +1,270 @@
 #include "index.hpp"
 #include <components/expressions/forward.hpp>
 
+#include <cmath>
+#include <limits>
+
 namespace components::index {
 
+    namespace {
+
+        using types::int128_t;
+        using types::logical_type;
+
+        bool is_plain_integer(logical_type type) {
+            switch (type) {
+                case logical_type::TINYINT:
+                case logical_type::SMALLINT:
+                case logical_type::INTEGER:
+                case logical_type::BIGINT:
+                case logical_type::UTINYINT:
+                case logical_type::USMALLINT:
+                case logical_type::UINTEGER:
+                case logical_type::UBIGINT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_floating(logical_type type) { return type == logical_type::FLOAT || type == logical_type::DOUBLE; }
+
+        uint8_t decimal_scale(const types::complex_logical_type& type) {
+            auto* extension = static_cast<const types::decimal_logical_type_extension*>(type.extension());
+            return extension ? extension->scale() : 0;
+        }
+
+        int128_t power_of_ten(uint8_t exponent) {
+            int128_t result = 1;
+            for (uint8_t i = 0; i < exponent; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+
+        double as_double(const value_t& value) {
+            return value.type().type() == logical_type::FLOAT ? static_cast<double>(value.value<float>())
+                                                              : value.value<double>();
+        }
+
+        // The value as an integer, when it is a whole number representable in 128 bits
+        std::optional<int128_t> exact_integer(const value_t& value) {
+            auto type = value.type().type();
+            switch (type) {
+                case logical_type::TINYINT:
+                    return value.value<int8_t>();
+                case logical_type::SMALLINT:
+                    return value.value<int16_t>();
+                case logical_type::INTEGER:
+                    return value.value<int32_t>();
+                case logical_type::BIGINT:
+                    return value.value<int64_t>();
+                case logical_type::UTINYINT:
+                    return value.value<uint8_t>();
+                case logical_type::USMALLINT:
+                    return value.value<uint16_t>();
+                case logical_type::UINTEGER:
+                    return value.value<uint32_t>();
+                case logical_type::UBIGINT:
+                    return value.value<uint64_t>();
+                case logical_type::HUGEINT:
+                    return value.value<int128_t>();
+                case logical_type::UHUGEINT: {
+                    auto unsigned_value = value.value<types::uint128_t>();
+                    if (unsigned_value > static_cast<types::uint128_t>(std::numeric_limits<int128_t>::max())) {
+                        return std::nullopt;
+                    }
+                    return static_cast<int128_t>(unsigned_value);
+                }
+                case logical_type::DECIMAL: {
+                    auto factor = power_of_ten(decimal_scale(value.type()));
+                    int128_t unscaled = value.value<int64_t>();
+                    if (unscaled % factor != 0) {
+                        return std::nullopt;
+                    }
+                    return unscaled / factor;
+                }
+                case logical_type::FLOAT:
+                case logical_type::DOUBLE: {
+                    auto number = as_double(value);
+                    // 2^127 is the first double outside the int128 range
+                    if (!std::isfinite(number) || std::trunc(number) != number || std::fabs(number) >= 0x1p127) {
+                        return std::nullopt;
+                    }
+                    return static_cast<int128_t>(number);
+                }
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        template<typename T>
+        std::optional<value_t> integer_as(std::pmr::memory_resource* resource, int128_t number) {
+            if (number < static_cast<int128_t>(std::numeric_limits<T>::min()) ||
+                number > static_cast<int128_t>(std::numeric_limits<T>::max())) {
+                return std::nullopt;
+            }
+            return value_t{resource, static_cast<T>(number)};
+        }
+
+        std::optional<value_t> integer_as(std::pmr::memory_resource* resource, int128_t number, logical_type type) {
+            switch (type) {
+                case logical_type::TINYINT:
+                    return integer_as<int8_t>(resource, number);
+                case logical_type::SMALLINT:
+                    return integer_as<int16_t>(resource, number);
+                case logical_type::INTEGER:
+                    return integer_as<int32_t>(resource, number);
+                case logical_type::BIGINT:
+                    return integer_as<int64_t>(resource, number);
+                case logical_type::UTINYINT:
+                    return integer_as<uint8_t>(resource, number);
+                case logical_type::USMALLINT:
+                    return integer_as<uint16_t>(resource, number);
+                case logical_type::UINTEGER:
+                    return integer_as<uint32_t>(resource, number);
+                case logical_type::UBIGINT:
+                    return integer_as<uint64_t>(resource, number);
+                case logical_type::HUGEINT:
+                    return value_t{resource, number};
+                case logical_type::UHUGEINT:
+                    if (number < 0) {
+                        return std::nullopt;
+                    }
+                    return value_t{resource, static_cast<types::uint128_t>(number)};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        std::optional<value_t> decimal_as(const value_t& probe, const types::complex_logical_type& key_type) {
+            auto* resource = probe.resource();
+            auto* extension = static_cast<const types::decimal_logical_type_extension*>(key_type.extension());
+            auto width = extension ? extension->width() : uint8_t{18};
+            auto scale = extension ? extension->scale() : uint8_t{0};
+            auto factor = power_of_ten(scale);
+            std::optional<int128_t> unscaled;
+            auto probe_type = probe.type().type();
+            if (probe_type == logical_type::DECIMAL) {
+                auto probe_scale = decimal_scale(probe.type());
+                int128_t value = probe.value<int64_t>();
+                if (probe_scale <= scale) {
+                    unscaled = value * power_of_ten(static_cast<uint8_t>(scale - probe_scale));
+                } else if (auto divisor = power_of_ten(static_cast<uint8_t>(probe_scale - scale));
+                           value % divisor == 0) {
+                    unscaled = value / divisor;
+                }
+            } else if (is_floating(probe_type)) {
+                auto number = as_double(probe);
+                auto scaled = std::nearbyint(number * static_cast<double>(factor));
+                if (std::isfinite(scaled) && std::fabs(scaled) < 0x1p63 &&
+                    scaled / static_cast<double>(factor) == number) {
+                    unscaled = static_cast<int128_t>(scaled);
+                }
+            } else if (auto number = exact_integer(probe)) {
+                // a 128-bit probe times 10^scale may overflow; anything past 10^38 is past every decimal anyway
+                if (*number < power_of_ten(38) / factor && *number > -power_of_ten(38) / factor) {
+                    unscaled = *number * factor;
+                }
+            }
+            auto limit = power_of_ten(width);
+            if (!unscaled || *unscaled >= limit || *unscaled <= -limit ||
+                *unscaled > std::numeric_limits<int64_t>::max() || *unscaled < std::numeric_limits<int64_t>::min()) {
+                return std::nullopt;
+            }
+            return value_t::create_decimal(resource, static_cast<int64_t>(*unscaled), width, scale);
+        }
+
+        std::optional<value_t> floating_as(const value_t& probe, logical_type key_type) {
+            auto* resource = probe.resource();
+            auto probe_type = probe.type().type();
+            double number;
+            if (is_floating(probe_type)) {
+                number = as_double(probe);
+            } else if (auto integer = exact_integer(probe);
+                       integer && probe_type != logical_type::DECIMAL &&
+                       static_cast<int128_t>(static_cast<double>(*integer)) == *integer) {
+                number = static_cast<double>(*integer);
+            } else {
+                return std::nullopt;
+            }
+            if (key_type == logical_type::DOUBLE) {
+                return value_t{resource, number};
+            }
+            auto narrow = static_cast<float>(number);
+            if (static_cast<double>(narrow) != number && !std::isnan(number)) {
+                return std::nullopt;
+            }
+            return value_t{resource, narrow};
+        }
+
+        std::optional<value_t> timestamp_as(const value_t& probe, logical_type key_type) {
+            using namespace std::chrono;
+            auto* resource = probe.resource();
+            auto ns = probe.value<nanoseconds>();
+            switch (key_type) {
+                case logical_type::TIMESTAMP_NS:
+                    return value_t{resource, ns};
+                case logical_type::TIMESTAMP_US:
+                    if (ns % microseconds{1} != nanoseconds::zero()) {
+                        return std::nullopt;
+                    }
+                    return value_t{resource, duration_cast<microseconds>(ns)};
+                case logical_type::TIMESTAMP_MS:
+                    if (ns % milliseconds{1} != nanoseconds::zero()) {
+                        return std::nullopt;
+                    }
+                    return value_t{resource, duration_cast<milliseconds>(ns)};
+                case logical_type::TIMESTAMP_SEC:
+                    if (ns % seconds{1} != nanoseconds::zero()) {
+                        return std::nullopt;
+                    }
+                    return value_t{resource, duration_cast<seconds>(ns)};
+                default:
+                    return std::nullopt;
+            }
+        }
+
+    } // namespace
+
+    std::optional<value_t> exact_index_probe(const value_t& probe, const types::complex_logical_type& key_type) {
+        auto type = key_type.type();
+        auto probe_type = probe.type().type();
+        if (type == logical_type::NA || probe.is_null()) {
+            return probe;
+        }
+        if (type == logical_type::DECIMAL) {
+            if (probe_type == logical_type::DECIMAL && decimal_scale(probe.type()) == decimal_scale(key_type)) {
+                return probe;
+            }
+            return decimal_as(probe, key_type);
+        }
+        if (probe_type == type) {
+            return probe;
+        }
+        if (is_plain_integer(type) || type == logical_type::HUGEINT || type == logical_type::UHUGEINT) {
+            auto number = exact_integer(probe);
+            return number ? integer_as(probe.resource(), *number, type) : std::nullopt;
+        }
+        if (is_floating(type)) {
+            return floating_as(probe, type);
+        }
+        if (types::is_duration(type) && types::is_duration(probe_type)) {
+            return timestamp_as(probe, type);
+        }
+        return std::nullopt;
+    }
+
+    bool index_probe_comparable(const value_t& probe, const types::complex_logical_type& key_type) {
+        if (exact_index_probe(probe, key_type)) {
+            return true;
+        }
+        auto type = key_type.type();
+        auto probe_type = probe.type().type();
+        return (is_plain_integer(type) || is_floating(type)) &&
+               (is_plain_integer(probe_type) || is_floating(probe_type));
+    }
+
     std::pmr::vector<int64_t> index_t::search(expressions::compare_type compare, const value_t& value) const {
         std::pmr::vector<int64_t> result(resource_);
 
@@ -119,6 +381,27 @@ namespace components::index {
                                               uint64_t txn_id) const {
         std::pmr::vector<int64_t> result(resource_);
 
+        if (!supports_range() && compare != expressions::compare_type::eq &&
+            compare != expressions::compare_type::ne) {
+            index_range_t range;
+            switch (compare) {
+                case expressions::compare_type::lt:
+                case expressions::compare_type::lte:
+                    range.upper = value;
+                    range.upper_inclusive = compare == expressions::compare_type::lte;
+                    break;
+                case expressions::compare_type::gt:
+                case expressions::compare_type::gte:
+                    range.lower = value;
+                    range.lower_inclusive = compare == expressions::compare_type::gte;
+                    break;
+                default:
+                    return result;
+            }
+            scan_range(range, start_time, txn_id, [&result](const value_t&, int64_t row) { result.push_back(row); });
+            return result;
+        }
+
         auto filter = [&](auto begin, auto end) {
             for (auto iter = begin; iter != end; ++iter) {
                 if (index_entry_visible(*iter, start_time, txn_id)) {
@@ -179,6 +462,53 @@ namespace components::index {
         return result;
     }
 
+    void index_t::scan_range(const index_range_t& range,
+                             uint64_t start_time,
+                             uint64_t txn_id,
+                             const std::function<void(const value_t&, int64_t)>& fn) const {
+        auto in_range = [&range](const value_t& key) {
+            if (range.lower && (range.lower_inclusive ? key < *range.lower : !(*range.lower < key))) {
+                return false;
+            }
+            return !range.upper || (range.upper_inclusive ? !(*range.upper < key) : key < *range.upper);
+        };
+        auto visit = [&](const iterator& begin, const iterator& end, bool filter) {
+            for (auto iter = begin; iter != end; ++iter) {
+                if (iter.key().is_null() || !index_entry_visible(*iter, start_time, txn_id)) {
+                    continue;
+                }
+                if (filter && !in_range(iter.key())) {
+                    continue;
+                }
+                fn(iter.key(), iter->row_index);
+            }
+        };
+        if (range.lower && range.upper) {
+            if (*range.upper < *range.lower) {
+                return;
+            }
+            if (!(*range.lower < *range.upper)) {
+                if (range.lower_inclusive && range.upper_inclusive) {
+                    auto points = find(*range.lower);
+                    visit(points.first, points.second, false);
+                }
+                return;
+            }
+        }
+        if (!supports_range()) {
+            // No key order to bound the pass with; every key is checked against the range
+            visit(cbegin(), cend(), true);
+            return;
+        }
+        auto begin = !range.lower              ? cbegin()
+                     : range.lower_inclusive ? lower_bound(*range.lower).second
+                                             : upper_bound(*range.lower).first;
+        auto end = !range.upper              ? cend()
+                   : range.upper_inclusive ? upper_bound(*range.upper).first
+                                           : lower_bound(*range.upper).second;
+        visit(begin, end, false);
+    }
+
     auto index_t::insert(value_t key, int64_t row_index, uint64_t txn_id) -> void {
         insert_txn_impl(std::move(key), row_index, txn_id);
     }
@@ -195,6 +525,12 @@ namespace components::index {
 
     void index_t::cleanup_versions(uint64_t lowest_active) { cleanup_versions_impl(lowest_active); }
 
+    void index_t::remap_rows(const table::row_id_remap_t& remap) {
+        if (!remap.empty()) {
+            remap_rows_impl(remap);
+        }
+    }
+
     void index_t::for_each_pending_insert(uint64_t txn_id,
                                           const std::function<void(const value_t&, int64_t)>& fn) const {
         for_each_pending_insert_impl(txn_id, fn);
@@ -211,6 +547,8 @@ namespace components::index {
 
     index_t::iterator_t::pointer index_t::iterator_t::operator->() const { return &impl_->value_ref(); }
 
+    const value_t& index_t::iterator_t::key() const { return impl_->key_ref(); }
+
     index_t::iterator_t& index_t::iterator_t::operator++() {
         impl_->next();
         return *this;
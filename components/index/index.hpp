@@ -2,9 +2,11 @@
 
 #include "forward.hpp"
 #include <actor-zeta.hpp>
+#include <components/table/row_id_remap.hpp>
 #include <components/table/row_version_manager.hpp>
 #include <core/pmr.hpp>
 #include <functional>
+#include <optional>
 
 namespace components::index {
 
@@ -37,6 +39,36 @@ namespace components::index {
         return inserted && !deleted;
     }
 
+    /// Key interval for ordered scans; a missing bound leaves that side open.
+    struct index_range_t {
+        std::optional<value_t> lower;
+        std::optional<value_t> upper;
+        bool lower_inclusive{true};
+        bool upper_inclusive{true};
+
+        static index_range_t point(const value_t& value) { return {value, value, true, true}; }
+    };
+
+    /// `probe` as a value of the key type, when one equals it exactly: an ART encodes and a hash index hashes
+    /// keys by type, and DECIMAL, HUGEINT and TIMESTAMP keys only compare correctly with keys of their own
+    /// type. nullopt when there is none. A key type of NA (a table without schema) keeps the probe as is.
+    std::optional<value_t> exact_index_probe(const value_t& probe, const types::complex_logical_type& key_type);
+
+    /// Whether an index over `key_type` can answer a comparison with `probe`: the probe converts exactly, or
+    /// both are plain integer or floating types, which both ordered engines compare across types.
+    bool index_probe_comparable(const value_t& probe, const types::complex_logical_type& key_type);
+
+    /// Row ids in key order; keys are filled only when the caller asks for them (index-only scans).
+    struct index_search_result_t {
+        std::pmr::vector<int64_t> row_ids;
+        std::pmr::vector<value_t> keys;
+
+        index_search_result_t() = default;
+        explicit index_search_result_t(std::pmr::memory_resource* resource)
+            : row_ids(resource)
+            , keys(resource) {}
+    };
+
     class index_t {
     public:
         index_t() = delete;
@@ -64,6 +96,7 @@ namespace components::index {
 
             reference operator*() const;
             pointer operator->() const;
+            const value_t& key() const;
             iterator_t& operator++();
             bool operator==(const iterator_t& other) const;
             bool operator!=(const iterator_t& other) const;
@@ -72,6 +105,7 @@ namespace components::index {
             public:
                 virtual ~iterator_impl_t() = default;
                 virtual reference value_ref() const = 0;
+                virtual const value_t& key_ref() const = 0;
                 virtual iterator_impl_t* next() = 0;
                 virtual bool equals(const iterator_impl_t* other) const = 0;
                 virtual bool not_equals(const iterator_impl_t* other) const = 0;
@@ -97,6 +131,9 @@ namespace components::index {
         std::pmr::memory_resource* resource() const noexcept;
         index_type type() const noexcept;
         const std::string& name() const noexcept;
+        // Whether keys are kept in order, so lower_bound/upper_bound can bound a range scan;
+        // otherwise ranges are answered by checking every key
+        bool supports_range() const noexcept { return supports_range_impl(); }
 
         bool is_disk() const noexcept;
         const actor_zeta::address_t& disk_agent() const noexcept;
@@ -106,6 +143,12 @@ namespace components::index {
         std::pmr::vector<int64_t> search(expressions::compare_type compare, const value_t& value) const;
         std::pmr::vector<int64_t>
         search(expressions::compare_type compare, const value_t& value, uint64_t start_time, uint64_t txn_id) const;
+        // Visits visible non-null entries inside `range` in key order; point ranges go through find(),
+        // so unordered indexes answer them too.
+        void scan_range(const index_range_t& range,
+                        uint64_t start_time,
+                        uint64_t txn_id,
+                        const std::function<void(const value_t&, int64_t)>& fn) const;
 
         void insert(value_t key, int64_t row_index, uint64_t txn_id);
         void mark_delete(value_t key, int64_t row_index, uint64_t txn_id);
@@ -113,6 +156,8 @@ namespace components::index {
         void commit_delete(uint64_t txn_id, uint64_t commit_id);
         void revert_insert(uint64_t txn_id);
         void cleanup_versions(uint64_t lowest_active);
+        // Moves entries to the row ids a vacuum gave their rows and drops the rows it removed
+        void remap_rows(const table::row_id_remap_t& remap);
 
         // Iterate pending entries for disk mirroring (must be called before commit clears them)
         void for_each_pending_insert(uint64_t txn_id, const std::function<void(const value_t&, int64_t)>& fn) const;
@@ -140,12 +185,14 @@ namespace components::index {
         virtual void commit_delete_impl(uint64_t txn_id, uint64_t commit_id) = 0;
         virtual void revert_insert_impl(uint64_t txn_id) = 0;
         virtual void cleanup_versions_impl(uint64_t lowest_active) = 0;
+        virtual void remap_rows_impl(const table::row_id_remap_t& remap) = 0;
         virtual void for_each_pending_insert_impl(uint64_t txn_id,
                                                   const std::function<void(const value_t&, int64_t)>& fn) const = 0;
         virtual void for_each_pending_delete_impl(uint64_t txn_id,
                                                   const std::function<void(const value_t&, int64_t)>& fn) const = 0;
 
         virtual void clean_memory_to_new_elements_impl(std::size_t count) = 0;
+        virtual bool supports_range_impl() const noexcept { return true; }
 
     private:
         std::pmr::memory_resource* resource_;
@@ -160,4 +207,15 @@ namespace components::index {
 
     using index_ptr = core::pmr::unique_ptr<index_t>;
 
+    // remap_rows() for the (key, row_index) lists of pending transactions
+    template<typename PendingMap>
+    void remap_pending_rows(PendingMap& pending, const table::row_id_remap_t& remap) {
+        for (auto& [txn_id, entries] : pending) {
+            for (auto& entry : entries) {
+                entry.second = remap.map(entry.second);
+            }
+            std::erase_if(entries, [](const auto& entry) { return entry.second == table::row_id_remap_t::DROPPED; });
+        }
+    }
+
 } // namespace components::index
@@ -181,6 +181,12 @@ namespace components::index {
         }
     }
 
+    void index_engine_t::remap_rows(const table::row_id_remap_t& remap) {
+        for (auto& index : storage_) {
+            index->remap_rows(remap);
+        }
+    }
+
     auto index_engine_t::indexes() -> std::vector<std::string> {
         std::vector<std::string> res;
         res.reserve(storage_.size());
@@ -226,6 +232,29 @@ namespace components::index {
         }
     }
 
+    void index_engine_t::for_each_disk_move(
+        const table::row_id_remap_t& remap,
+        const std::function<void(const actor_zeta::address_t&, const value_t&, int64_t, int64_t)>& fn) const {
+        if (remap.empty()) {
+            return;
+        }
+        for (const auto& index : storage_) {
+            if (!index->is_disk()) {
+                continue;
+            }
+            for (auto it = index->cbegin(), end = index->cend(); it != end; ++it) {
+                // disk agents hold committed entries until their delete commits
+                if (!index_entry_visible(*it, 0, 0)) {
+                    continue;
+                }
+                auto row_index = remap.map(it->row_index);
+                if (row_index != it->row_index) {
+                    fn(index->disk_agent(), it.key(), it->row_index, row_index);
+                }
+            }
+        }
+    }
+
     void set_disk_agent(const index_engine_ptr& ptr,
                         id_index id,
                         actor_zeta::address_t agent,
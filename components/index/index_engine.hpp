@@ -42,6 +42,7 @@ namespace components::index {
         void commit_delete(uint64_t txn_id, uint64_t commit_id);
         void revert_insert(uint64_t txn_id);
         void cleanup_versions(uint64_t lowest_active);
+        void remap_rows(const table::row_id_remap_t& remap);
 
         auto indexes() -> std::vector<std::string>;
 
@@ -57,6 +58,11 @@ namespace components::index {
         void for_each_pending_disk_delete(
             uint64_t txn_id,
             const std::function<void(const actor_zeta::address_t&, const value_t&, int64_t)>& fn) const;
+        // Call fn(disk_agent_address, key_value, old_row, new_row) for each entry on disk whose row a
+        // vacuum moved (new_row is row_id_remap_t::DROPPED for removed rows); call BEFORE remap_rows
+        void for_each_disk_move(
+            const table::row_id_remap_t& remap,
+            const std::function<void(const actor_zeta::address_t&, const value_t&, int64_t, int64_t)>& fn) const;
 
     private:
         using comparator_t = std::less<keys_base_storage_t>;
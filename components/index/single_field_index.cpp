@@ -11,6 +11,7 @@ namespace components::index {
     single_field_index_t::~single_field_index_t() = default;
 
     index_t::iterator::reference single_field_index_t::impl_t::value_ref() const { return iterator_->second; }
+    const value_t& single_field_index_t::impl_t::key_ref() const { return iterator_->first; }
     index_t::iterator_t::iterator_impl_t* single_field_index_t::impl_t::next() {
         iterator_++;
         return this;
@@ -144,6 +145,20 @@ namespace components::index {
         }
     }
 
+    void single_field_index_t::remap_rows_impl(const table::row_id_remap_t& remap) {
+        for (auto it = storage_.begin(); it != storage_.end();) {
+            auto row_index = remap.map(it->second.row_index);
+            if (row_index == table::row_id_remap_t::DROPPED) {
+                it = storage_.erase(it);
+            } else {
+                it->second.row_index = row_index;
+                ++it;
+            }
+        }
+        remap_pending_rows(pending_inserts_, remap);
+        remap_pending_rows(pending_deletes_, remap);
+    }
+
     void
     single_field_index_t::for_each_pending_insert_impl(uint64_t txn_id,
                                                        const std::function<void(const value_t&, int64_t)>& fn) const {
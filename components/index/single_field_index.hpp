@@ -24,6 +24,7 @@ namespace components::index {
         public:
             explicit impl_t(const_iterator iterator);
             index_t::iterator::reference value_ref() const final;
+            const value_t& key_ref() const final;
             iterator_impl_t* next() final;
             bool equals(const iterator_impl_t* other) const final;
             bool not_equals(const iterator_impl_t* other) const final;
@@ -47,6 +48,7 @@ namespace components::index {
         void commit_delete_impl(uint64_t txn_id, uint64_t commit_id) final;
         void revert_insert_impl(uint64_t txn_id) final;
         void cleanup_versions_impl(uint64_t lowest_active) final;
+        void remap_rows_impl(const table::row_id_remap_t& remap) final;
         void for_each_pending_insert_impl(uint64_t txn_id,
                                           const std::function<void(const value_t&, int64_t)>& fn) const final;
         void for_each_pending_delete_impl(uint64_t txn_id,
@@ -0,0 +1,268 @@
+#include <catch2/catch.hpp>
+
+#include "components/index/art_index.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace components::index;
+using key = components::expressions::key_t;
+using components::types::logical_value_t;
+
+namespace {
+    std::vector<int64_t> row_ids(index_t::iterator begin, index_t::iterator end) {
+        std::vector<int64_t> result;
+        for (auto it = begin; it != end; ++it) {
+            result.push_back(it->row_index);
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("art_index:base") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    art_index_t index(&resource, "art_count", {key(&resource, "count")});
+    REQUIRE(index.type() == components::logical_plan::index_type::art);
+
+    // Values: 0, 1, 10, 5, 6, 2, 8, 13, -4, 5
+    std::vector<std::pair<int64_t, int64_t>> data =
+        {{0, 0}, {1, 1}, {10, 2}, {5, 3}, {6, 4}, {2, 5}, {8, 6}, {13, 7}, {-4, 8}, {5, 9}};
+    for (const auto& [value, row_idx] : data) {
+        index.insert(logical_value_t(&resource, value), row_idx);
+    }
+    REQUIRE(index.leaf_count() == 9);
+
+    SECTION("ordered iteration") {
+        REQUIRE(row_ids(index.cbegin(), index.cend()) == std::vector<int64_t>{8, 0, 1, 5, 3, 9, 4, 6, 2, 7});
+    }
+
+    SECTION("find") {
+        auto range = index.find(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{3, 9});
+        range = index.find(logical_value_t(&resource, int64_t{11}));
+        REQUIRE(range.first == range.second);
+    }
+
+    SECTION("lower_bound and upper_bound") {
+        auto lower = index.lower_bound(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(row_ids(lower.first, lower.second) == std::vector<int64_t>{8, 0, 1, 5});
+        auto upper = index.upper_bound(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(row_ids(upper.first, upper.second) == std::vector<int64_t>{4, 6, 2, 7});
+    }
+
+    SECTION("probes of another numeric type") {
+        // INTEGER and DOUBLE probes against a BIGINT index
+        auto range = index.find(logical_value_t(&resource, 6));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{4});
+        range = index.find(logical_value_t(&resource, 5.5));
+        REQUIRE(range.first == range.second);
+        auto lower = index.lower_bound(logical_value_t(&resource, 5.5));
+        REQUIRE(row_ids(lower.first, lower.second) == std::vector<int64_t>{8, 0, 1, 5, 3, 9});
+        auto upper = index.upper_bound(logical_value_t(&resource, 1.5));
+        REQUIRE(upper.first->row_index == 5);
+        upper = index.upper_bound(logical_value_t(&resource, 1e30));
+        REQUIRE(upper.first == index.cend());
+        lower = index.lower_bound(logical_value_t(&resource, -1e30));
+        REQUIRE(lower.first == lower.second);
+    }
+
+    SECTION("scan_range") {
+        std::vector<int64_t> found;
+        index_range_t range{logical_value_t(&resource, 2), logical_value_t(&resource, 8), false, true};
+        index.scan_range(range, 0, 0, [&](const value_t&, int64_t row) { found.push_back(row); });
+        REQUIRE(found == std::vector<int64_t>{3, 9, 4, 6});
+    }
+
+    SECTION("remove") {
+        index.remove(logical_value_t(&resource, int64_t{5}));
+        index.remove(logical_value_t(&resource, int64_t{5}));
+        index.remove(logical_value_t(&resource, int64_t{-4}));
+        REQUIRE(index.leaf_count() == 7);
+        REQUIRE(row_ids(index.cbegin(), index.cend()) == std::vector<int64_t>{0, 1, 5, 4, 6, 2, 7});
+    }
+}
+
+TEST_CASE("art_index:strings and nulls") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    art_index_t index(&resource, "art_name", {key(&resource, "name")});
+
+    std::vector<std::string> names = {"b", "ab", "", "a", "abc", std::string("a\0b", 3), "ba"};
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.insert(logical_value_t(&resource, std::string_view(names[i])), static_cast<int64_t>(i));
+    }
+    index.insert(logical_value_t(&resource, nullptr), 100);
+
+    std::vector<std::string> keys;
+    for (auto it = index.cbegin(); it != index.cend(); ++it) {
+        if (!it.key().is_null()) {
+            keys.emplace_back(it.key().value<std::string_view>());
+        }
+    }
+    auto expected = names;
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(keys == expected);
+
+    // nulls sort after every value
+    auto upper = index.upper_bound(logical_value_t(&resource, std::string_view("zzz")));
+    REQUIRE(upper.first.key().is_null());
+    REQUIRE(upper.first->row_index == 100);
+
+    auto range = index.find(logical_value_t(&resource, std::string_view("ab")));
+    REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{1});
+}
+
+TEST_CASE("art_index:decimal and huge integer keys") {
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    SECTION("decimals") {
+        art_index_t index(&resource, "art_price", {key(&resource, "price")});
+        // 1.50, 1.5, 2.25, -3.1: scales differ, 1.50 and 1.5 are one key
+        index.insert(logical_value_t::create_decimal(&resource, 150, 10, 2), 0);
+        index.insert(logical_value_t::create_decimal(&resource, 15, 10, 1), 1);
+        index.insert(logical_value_t::create_decimal(&resource, 225, 10, 2), 2);
+        index.insert(logical_value_t::create_decimal(&resource, -31, 10, 1), 3);
+        REQUIRE(index.leaf_count() == 3);
+        REQUIRE(row_ids(index.cbegin(), index.cend()) == std::vector<int64_t>{3, 0, 1, 2});
+
+        auto range = index.find(logical_value_t::create_decimal(&resource, 225, 10, 2));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{2});
+        range = index.find(logical_value_t::create_decimal(&resource, 1500, 10, 3));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{0, 1});
+        range = index.find(logical_value_t::create_decimal(&resource, 226, 10, 2));
+        REQUIRE(range.first == range.second);
+        auto upper = index.upper_bound(logical_value_t::create_decimal(&resource, 2, 10, 0));
+        REQUIRE(row_ids(upper.first, upper.second) == std::vector<int64_t>{2});
+
+        // integer and floating probes are converted to decimals before they are encoded
+        range = index.find(logical_value_t(&resource, 1.5));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{0, 1});
+        range = index.find(logical_value_t(&resource, int64_t{2}));
+        REQUIRE(range.first == range.second);
+        upper = index.upper_bound(logical_value_t(&resource, int64_t{2}));
+        REQUIRE(row_ids(upper.first, upper.second) == std::vector<int64_t>{2});
+        auto lower = index.lower_bound(logical_value_t(&resource, int64_t{2}));
+        REQUIRE(row_ids(lower.first, lower.second) == std::vector<int64_t>{3, 0, 1});
+    }
+
+    SECTION("huge integers") {
+        art_index_t index(&resource, "art_huge", {key(&resource, "huge")});
+        auto high = components::types::int128_t(1) << 100;
+        index.insert(logical_value_t(&resource, high + 1), 0);
+        index.insert(logical_value_t(&resource, components::types::int128_t(1)), 1);
+        index.insert(logical_value_t(&resource, -high), 2);
+        REQUIRE(index.leaf_count() == 3);
+        REQUIRE(row_ids(index.cbegin(), index.cend()) == std::vector<int64_t>{2, 1, 0});
+        auto range = index.find(logical_value_t(&resource, components::types::int128_t(1)));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{1});
+        range = index.find(logical_value_t(&resource, int64_t{1}));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{1});
+        auto upper = index.upper_bound(logical_value_t(&resource, 2));
+        REQUIRE(row_ids(upper.first, upper.second) == std::vector<int64_t>{0});
+    }
+
+    SECTION("unsupported types") {
+        REQUIRE(art_supports_key_type(components::types::logical_type::DECIMAL));
+        REQUIRE_FALSE(art_supports_key_type(components::types::logical_type::INTERVAL));
+        REQUIRE_FALSE(art_supports_key_type(components::types::logical_type::LIST));
+    }
+}
+
+TEST_CASE("art_index:exact_index_probe") {
+    using components::types::complex_logical_type;
+    using components::types::logical_type;
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto decimal = complex_logical_type::create_decimal(10, 2);
+
+    auto probe = exact_index_probe(logical_value_t(&resource, 5), decimal);
+    REQUIRE(probe);
+    REQUIRE(*probe == logical_value_t::create_decimal(&resource, 500, 10, 2));
+    probe = exact_index_probe(logical_value_t(&resource, 2.5), decimal);
+    REQUIRE(probe);
+    REQUIRE(*probe == logical_value_t::create_decimal(&resource, 250, 10, 2));
+    REQUIRE_FALSE(exact_index_probe(logical_value_t(&resource, 2.555), decimal));
+    REQUIRE_FALSE(exact_index_probe(logical_value_t::create_decimal(&resource, 1, 10, 3), decimal));
+
+    probe = exact_index_probe(logical_value_t::create_decimal(&resource, 700, 10, 2), logical_type::BIGINT);
+    REQUIRE(probe);
+    REQUIRE(probe->type().type() == logical_type::BIGINT);
+    REQUIRE(probe->value<int64_t>() == 7);
+    REQUIRE_FALSE(exact_index_probe(logical_value_t(&resource, int64_t{300}), logical_type::TINYINT));
+    REQUIRE_FALSE(exact_index_probe(logical_value_t(&resource, 2.5), logical_type::INTEGER));
+
+    // plain numbers still compare across types in an ordered index, timestamps and decimals do not
+    REQUIRE(index_probe_comparable(logical_value_t(&resource, 2.5), logical_type::INTEGER));
+    REQUIRE_FALSE(index_probe_comparable(logical_value_t(&resource, 2.555), decimal));
+    REQUIRE_FALSE(index_probe_comparable(logical_value_t(&resource, 5), logical_type::TIMESTAMP_US));
+    REQUIRE(index_probe_comparable(logical_value_t(&resource, 5), logical_type::NA));
+}
+
+TEST_CASE("art_index:mvcc") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    art_index_t index(&resource, "art_mvcc", {key(&resource, "count")});
+    constexpr uint64_t txn = components::table::TRANSACTION_ID_START + 1;
+
+    index.insert(logical_value_t(&resource, int64_t{1}), 1, txn);
+    index.insert(logical_value_t(&resource, int64_t{2}), 2, txn);
+    REQUIRE(index.search(components::expressions::compare_type::gte, logical_value_t(&resource, int64_t{0}), 0, 0)
+                .empty());
+    REQUIRE(index.search(components::expressions::compare_type::gte, logical_value_t(&resource, int64_t{0}), 5, txn)
+                .size() == 2);
+
+    SECTION("revert") {
+        index.revert_insert(txn);
+        REQUIRE(index.leaf_count() == 0);
+        REQUIRE(index.cbegin() == index.cend());
+    }
+
+    SECTION("commit, delete and cleanup") {
+        index.commit_insert(txn, 10);
+        REQUIRE(index.search(components::expressions::compare_type::eq, logical_value_t(&resource, int64_t{2}), 0, 0)
+                    .size() == 1);
+        index.mark_delete(logical_value_t(&resource, int64_t{2}), 2, txn + 1);
+        std::vector<int64_t> pending;
+        index.for_each_pending_delete(txn + 1, [&](const value_t&, int64_t row) { pending.push_back(row); });
+        REQUIRE(pending == std::vector<int64_t>{2});
+        index.commit_delete(txn + 1, 11);
+        index.cleanup_versions(12);
+        REQUIRE(index.leaf_count() == 1);
+        REQUIRE(index.cbegin().key().value<int64_t>() == 1);
+    }
+}
+
+TEST_CASE("art_index:random against ordered reference") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    art_index_t index(&resource, "art_random", {key(&resource, "count")});
+    std::multimap<int64_t, int64_t> reference;
+    std::mt19937_64 rng(42);
+
+    for (int64_t row = 0; row < 20000; ++row) {
+        auto value = static_cast<int64_t>(rng() % 4000) - 2000;
+        if (rng() % 4 == 0 && reference.count(value)) {
+            index.remove(logical_value_t(&resource, value));
+            reference.erase(reference.find(value));
+            continue;
+        }
+        index.insert(logical_value_t(&resource, value), row);
+        reference.emplace(value, row);
+    }
+
+    std::vector<int64_t> keys;
+    for (auto it = index.cbegin(); it != index.cend(); ++it) {
+        keys.push_back(it.key().value<int64_t>());
+    }
+    std::vector<int64_t> expected;
+    for (const auto& [value, row] : reference) {
+        expected.push_back(value);
+    }
+    REQUIRE(keys == expected);
+
+    for (int64_t probe = -2100; probe < 2100; probe += 7) {
+        auto lower = index.lower_bound(logical_value_t(&resource, probe)).second;
+        auto expected_lower = reference.lower_bound(probe);
+        REQUIRE((lower == index.cend()) == (expected_lower == reference.end()));
+        if (expected_lower != reference.end()) {
+            REQUIRE(lower.key().value<int64_t>() == expected_lower->first);
+        }
+    }
+}
@@ -5,6 +5,7 @@
 using namespace components::index;
 
 static index_value_t NULL_INDEX_VALUE{};
+static value_t NULL_INDEX_KEY{std::pmr::get_default_resource(), components::types::logical_type::NA};
 
 class dummy final : public index_t {
 public:
@@ -37,6 +38,7 @@ private:
     void commit_delete_impl(uint64_t, uint64_t) override {}
     void revert_insert_impl(uint64_t) override {}
     void cleanup_versions_impl(uint64_t) override {}
+    void remap_rows_impl(const components::table::row_id_remap_t&) override {}
     void for_each_pending_insert_impl(uint64_t, const std::function<void(const value_t&, int64_t)>&) const override {}
     void for_each_pending_delete_impl(uint64_t, const std::function<void(const value_t&, int64_t)>&) const override {}
     void clean_memory_to_new_elements_impl(size_t) override {}
@@ -45,6 +47,7 @@ private:
     public:
         explicit impl_t(const_iterator) {}
         iterator::reference value_ref() const override { return NULL_INDEX_VALUE; }
+        const value_t& key_ref() const override { return NULL_INDEX_KEY; }
         iterator_t::iterator_impl_t* next() override { return nullptr; }
         bool equals(const iterator::iterator_impl_t* other) const override { return this == other; }
         bool not_equals(const iterator::iterator_impl_t* other) const override { return this != other; }
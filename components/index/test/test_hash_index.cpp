@@ -0,0 +1,182 @@
+#include <catch2/catch.hpp>
+
+#include "components/index/hash_index.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+using namespace components::index;
+using key = components::expressions::key_t;
+using components::types::logical_value_t;
+
+namespace {
+    std::vector<int64_t> row_ids(index_t::iterator begin, index_t::iterator end) {
+        std::vector<int64_t> result;
+        for (auto it = begin; it != end; ++it) {
+            result.push_back(it->row_index);
+        }
+        return result;
+    }
+
+    std::vector<int64_t> sorted_row_ids(index_t::range range) {
+        auto result = row_ids(range.first, range.second);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+} // namespace
+
+TEST_CASE("hash_index:base") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_count", {key(&resource, "count")});
+    REQUIRE(index.type() == components::logical_plan::index_type::hashed);
+
+    // Values: 0, 1, 10, 5, 6, 2, 8, 13, -4, 5
+    std::vector<std::pair<int64_t, int64_t>> data =
+        {{0, 0}, {1, 1}, {10, 2}, {5, 3}, {6, 4}, {2, 5}, {8, 6}, {13, 7}, {-4, 8}, {5, 9}};
+    for (const auto& [value, row_idx] : data) {
+        index.insert(logical_value_t(&resource, value), row_idx);
+    }
+    REQUIRE(index.key_count() == 9);
+
+    SECTION("iteration visits every entry") {
+        auto rows = row_ids(index.cbegin(), index.cend());
+        std::sort(rows.begin(), rows.end());
+        REQUIRE(rows == std::vector<int64_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("find") {
+        REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, int64_t{5}))) == std::vector<int64_t>{3, 9});
+        auto range = index.find(logical_value_t(&resource, int64_t{11}));
+        REQUIRE(range.first == range.second);
+    }
+
+    SECTION("probes of another numeric type") {
+        REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, 6))) == std::vector<int64_t>{4});
+        REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, 6.0))) == std::vector<int64_t>{4});
+        REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, uint64_t{13}))) == std::vector<int64_t>{7});
+        auto range = index.find(logical_value_t(&resource, 5.5));
+        REQUIRE(range.first == range.second);
+    }
+
+    SECTION("no key order") {
+        auto lower = index.lower_bound(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(lower.first == lower.second);
+        auto upper = index.upper_bound(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(upper.first == upper.second);
+    }
+
+    SECTION("scan_range") {
+        std::vector<int64_t> found;
+        index_range_t point{logical_value_t(&resource, 5), logical_value_t(&resource, 5), true, true};
+        index.scan_range(point, 0, 0, [&](const value_t&, int64_t row) { found.push_back(row); });
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == std::vector<int64_t>{3, 9});
+
+        found.clear();
+        index_range_t range{logical_value_t(&resource, 2), logical_value_t(&resource, 8), false, true};
+        index.scan_range(range, 0, 0, [&](const value_t&, int64_t row) { found.push_back(row); });
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == std::vector<int64_t>{3, 4, 6, 9});
+    }
+
+    SECTION("remove") {
+        index.remove(logical_value_t(&resource, int64_t{5}));
+        index.remove(logical_value_t(&resource, int64_t{5}));
+        index.remove(logical_value_t(&resource, int64_t{-4}));
+        REQUIRE(index.key_count() == 7);
+        auto range = index.find(logical_value_t(&resource, int64_t{5}));
+        REQUIRE(range.first == range.second);
+        REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, int64_t{13}))) == std::vector<int64_t>{7});
+    }
+}
+
+TEST_CASE("hash_index:strings and nulls") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_name", {key(&resource, "name")});
+
+    std::vector<std::string> names = {"b", "ab", "", "a", "abc", std::string("a\0b", 3), "ba"};
+    for (size_t i = 0; i < names.size(); ++i) {
+        index.insert(logical_value_t(&resource, std::string_view(names[i])), static_cast<int64_t>(i));
+    }
+    index.insert(logical_value_t(&resource, nullptr), 100);
+    REQUIRE(index.key_count() == names.size() + 1);
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        auto range = index.find(logical_value_t(&resource, std::string_view(names[i])));
+        REQUIRE(row_ids(range.first, range.second) == std::vector<int64_t>{static_cast<int64_t>(i)});
+    }
+    REQUIRE(sorted_row_ids(index.find(logical_value_t(&resource, nullptr))) == std::vector<int64_t>{100});
+}
+
+TEST_CASE("hash_index:decimal keys") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_price", {key(&resource, "price")});
+
+    index.insert(logical_value_t::create_decimal(&resource, 150, 10, 2), 0);
+    index.insert(logical_value_t::create_decimal(&resource, 225, 10, 2), 1);
+    index.insert(logical_value_t::create_decimal(&resource, 15, 10, 1), 2);
+    REQUIRE(index.key_count() == 2);
+
+    REQUIRE(sorted_row_ids(index.find(logical_value_t::create_decimal(&resource, 150, 10, 2))) ==
+            std::vector<int64_t>{0, 2});
+    REQUIRE(sorted_row_ids(index.find(logical_value_t::create_decimal(&resource, 225, 10, 2))) ==
+            std::vector<int64_t>{1});
+}
+
+TEST_CASE("hash_index:mvcc") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_mvcc", {key(&resource, "count")});
+    constexpr uint64_t txn = components::table::TRANSACTION_ID_START + 1;
+
+    index.insert(logical_value_t(&resource, int64_t{1}), 1, txn);
+    index.insert(logical_value_t(&resource, int64_t{2}), 2, txn);
+    REQUIRE(index.search(components::expressions::compare_type::eq, logical_value_t(&resource, int64_t{1}), 0, 0)
+                .empty());
+    REQUIRE(index.search(components::expressions::compare_type::gte, logical_value_t(&resource, int64_t{0}), 5, txn)
+                .size() == 2);
+
+    SECTION("revert") {
+        index.revert_insert(txn);
+        REQUIRE(index.key_count() == 0);
+        REQUIRE(index.cbegin() == index.cend());
+    }
+
+    SECTION("commit, delete and cleanup") {
+        index.commit_insert(txn, 10);
+        REQUIRE(index.search(components::expressions::compare_type::eq, logical_value_t(&resource, int64_t{2}), 0, 0)
+                    .size() == 1);
+        index.mark_delete(logical_value_t(&resource, int64_t{2}), 2, txn + 1);
+        std::vector<int64_t> pending;
+        index.for_each_pending_delete(txn + 1, [&](const value_t&, int64_t row) { pending.push_back(row); });
+        REQUIRE(pending == std::vector<int64_t>{2});
+        index.commit_delete(txn + 1, 11);
+        index.cleanup_versions(12);
+        REQUIRE(index.key_count() == 1);
+        REQUIRE(index.cbegin().key().value<int64_t>() == 1);
+    }
+}
+
+TEST_CASE("hash_index:random against reference") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_random", {key(&resource, "count")});
+    std::multimap<int64_t, int64_t> reference;
+    std::mt19937_64 rng(42);
+
+    for (int64_t row = 0; row < 20000; ++row) {
+        auto value = static_cast<int64_t>(rng() % 4000) - 2000;
+        if (rng() % 4 == 0 && reference.count(value)) {
+            index.remove(logical_value_t(&resource, value));
+            reference.erase(reference.find(value));
+            continue;
+        }
+        index.insert(logical_value_t(&resource, value), row);
+        reference.emplace(value, row);
+    }
+    REQUIRE(index.capacity() * 3 >= index.key_count() * 4);
+
+    for (int64_t probe = -2100; probe < 2100; ++probe) {
+        auto range = index.find(logical_value_t(&resource, probe));
+        REQUIRE(row_ids(range.first, range.second).size() == reference.count(probe));
+    }
+}
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include "components/index/art_index.hpp"
+#include "components/index/hash_index.hpp"
 #include "components/index/index_engine.hpp"
 #include "components/index/single_field_index.hpp"
 #include <components/table/row_version_manager.hpp>
@@ -168,6 +170,38 @@ TEST_CASE("single_field_index:full_lifecycle") {
     REQUIRE(result.empty());
 }
 
+TEMPLATE_TEST_CASE("index:remap_rows", "[index]", single_field_index_t, art_index_t, hash_index_t) {
+    auto resource = std::pmr::synchronized_pool_resource();
+    TestType index(&resource, "test_idx", {key(&resource, "val")});
+
+    // rows 0..9 hold 0..9; a vacuum dropped rows 3 and 4 and moved rows 5..9 to 3..7
+    for (int64_t i = 0; i < 10; i++) {
+        index.insert(components::types::logical_value_t(&resource, i), i);
+    }
+    uint64_t txn = TRANSACTION_ID_START + 1;
+    index.insert(components::types::logical_value_t(&resource, int64_t(42)), int64_t(10), txn);
+
+    row_id_remap_t remap;
+    remap.keep(0, 3, 0);
+    remap.keep(5, 6, 3);
+    remap.finish(11, 9);
+    index.remap_rows(remap);
+
+    auto find = [&](int64_t value) {
+        return index.search(compare_type::eq, components::types::logical_value_t(&resource, value));
+    };
+    REQUIRE(find(2) == std::pmr::vector<int64_t>{2});
+    REQUIRE(find(3).empty());
+    REQUIRE(find(4).empty());
+    REQUIRE(find(5) == std::pmr::vector<int64_t>{3});
+    REQUIRE(find(9) == std::pmr::vector<int64_t>{7});
+
+    // pending entries move too, so commit finds them at their new row
+    std::vector<int64_t> pending;
+    index.for_each_pending_insert(txn, [&](const value_t&, int64_t row) { pending.push_back(row); });
+    REQUIRE(pending == std::vector<int64_t>{8});
+}
+
 TEST_CASE("index_engine:txn_methods") {
     auto resource = std::pmr::synchronized_pool_resource();
     auto engine = make_index_engine(&resource);
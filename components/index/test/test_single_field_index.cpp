@@ -81,6 +81,37 @@ TEST_CASE("single_field_index:base") {
         REQUIRE(++find_range.first == find_range.second);
     }
 
+    SECTION("scan_range") {
+        auto scan = [&](const index_range_t& range) {
+            std::vector<int64_t> keys;
+            index.scan_range(range, 0, 0, [&keys](const value_t& key, int64_t) {
+                keys.push_back(key.value<int64_t>());
+            });
+            return keys;
+        };
+        auto bounded = [&](int64_t lower, bool lower_inclusive, int64_t upper, bool upper_inclusive) {
+            index_range_t range;
+            range.lower.emplace(&resource, lower);
+            range.lower_inclusive = lower_inclusive;
+            range.upper.emplace(&resource, upper);
+            range.upper_inclusive = upper_inclusive;
+            return range;
+        };
+        REQUIRE(scan(bounded(2, true, 8, true)) == std::vector<int64_t>{2, 5, 6, 8});
+        REQUIRE(scan(bounded(2, false, 8, false)) == std::vector<int64_t>{5, 6});
+        REQUIRE(scan(bounded(8, true, 8, true)) == std::vector<int64_t>{8});
+        REQUIRE(scan(bounded(8, false, 8, true)).empty());
+        REQUIRE(scan(bounded(9, true, 3, true)).empty());
+        REQUIRE(scan(index_range_t::point(components::types::logical_value_t(&resource, 13))) ==
+                std::vector<int64_t>{13});
+
+        index_range_t open_upper;
+        open_upper.lower.emplace(&resource, int64_t{6});
+        open_upper.lower_inclusive = false;
+        REQUIRE(scan(open_upper) == std::vector<int64_t>{8, 10, 13});
+        REQUIRE(scan(index_range_t{}).size() == data.size());
+    }
+
     SECTION("duplicate values") {
         // Insert duplicate values with different row indices
         for (const auto& [value, row_idx] : data) {
@@ -100,6 +131,61 @@ TEST_CASE("single_field_index:base") {
     }
 }
 
+TEST_CASE("single_field_index:timestamp and decimal keys") {
+    using components::types::logical_value_t;
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    auto scan = [](single_field_index_t& index, const index_range_t& range) {
+        std::vector<int64_t> rows;
+        index.scan_range(range, 0, 0, [&rows](const value_t&, int64_t row) { rows.push_back(row); });
+        return rows;
+    };
+
+    SECTION("timestamp") {
+        single_field_index_t index(&resource, "ts", {key(&resource, "ts")});
+        // keys are 100, 300, ..., 1900 microseconds, inserted out of order
+        for (int64_t row : {4, 1, 8, 0, 9, 3, 6, 2, 7, 5}) {
+            index.insert(logical_value_t(&resource, std::chrono::microseconds{100 + 200 * row}), row);
+        }
+        auto at = [&resource](int64_t us) { return logical_value_t(&resource, std::chrono::microseconds{us}); };
+
+        REQUIRE(scan(index, index_range_t::point(at(700))) == std::vector<int64_t>{3});
+        REQUIRE(scan(index, index_range_t::point(at(701))).empty());
+        index_range_t range;
+        range.lower.emplace(at(500));
+        range.lower_inclusive = false;
+        range.upper.emplace(at(1100));
+        range.upper_inclusive = true;
+        REQUIRE(scan(index, range) == std::vector<int64_t>{3, 4, 5});
+        auto found = index.find(at(1900));
+        REQUIRE(std::distance(found.first, found.second) == 1);
+        REQUIRE(found.first->row_index == 9);
+    }
+
+    SECTION("decimal") {
+        single_field_index_t index(&resource, "price", {key(&resource, "price")});
+        // DECIMAL(10, 2) keys -2.50, -1.25, 0.00, 1.25, ... 8.75, negative ones included
+        for (int64_t row : {5, 0, 9, 2, 7, 1, 8, 3, 6, 4}) {
+            index.insert(logical_value_t::create_decimal(&resource, 125 * row - 250, 10, 2), row);
+        }
+        auto price = [&resource](int64_t unscaled) {
+            return logical_value_t::create_decimal(&resource, unscaled, 10, 2);
+        };
+
+        REQUIRE(scan(index, index_range_t::point(price(-125))) == std::vector<int64_t>{1});
+        REQUIRE(scan(index, index_range_t::point(price(100))).empty());
+        // the same value at another scale is the same key
+        REQUIRE(scan(index, index_range_t::point(logical_value_t::create_decimal(&resource, 25, 10, 1))) ==
+                std::vector<int64_t>{4});
+        index_range_t range;
+        range.lower.emplace(price(-250));
+        range.lower_inclusive = true;
+        range.upper.emplace(price(250));
+        range.upper_inclusive = false;
+        REQUIRE(scan(index, range) == std::vector<int64_t>{0, 1, 2, 3});
+    }
+}
+
 TEST_CASE("single_field_index:engine") {
     auto resource = std::pmr::synchronized_pool_resource();
     auto index_engine = make_index_engine(&resource);
@@ -46,6 +46,8 @@ namespace components::logical_plan {
                 return "hashed";
             case index_type::wildcard:
                 return "wildcard";
+            case index_type::art:
+                return "art";
             case index_type::no_valid:
                 return "no_valid";
         }
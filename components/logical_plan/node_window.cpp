@@ -0,0 +1,190 @@
+#include "node_window.hpp"
+
+#include <sstream>
+
+namespace components::logical_plan {
+
+    namespace {
+
+        bool is_window_integer(types::logical_type type) {
+            switch (type) {
+                case types::logical_type::BOOLEAN:
+                case types::logical_type::TINYINT:
+                case types::logical_type::UTINYINT:
+                case types::logical_type::SMALLINT:
+                case types::logical_type::USMALLINT:
+                case types::logical_type::INTEGER:
+                case types::logical_type::UINTEGER:
+                case types::logical_type::BIGINT:
+                case types::logical_type::UBIGINT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        void print_bound(std::stringstream& stream, const window_bound_t& bound) {
+            switch (bound.type) {
+                case window_bound_type::unbounded_preceding:
+                    stream << "$unbounded_preceding";
+                    break;
+                case window_bound_type::preceding:
+                    stream << "{$preceding: " << bound.offset << "}";
+                    break;
+                case window_bound_type::current_row:
+                    stream << "$current_row";
+                    break;
+                case window_bound_type::following:
+                    stream << "{$following: " << bound.offset << "}";
+                    break;
+                case window_bound_type::unbounded_following:
+                    stream << "$unbounded_following";
+                    break;
+            }
+        }
+
+        // alias: {$function: args, $over: {$partition: [...], $sort: {...}, $rows|$range: [start, end]}}
+        void print_function(std::stringstream& stream,
+                            const expressions::aggregate_expression_t& function,
+                            const window_spec_t& spec) {
+            stream << function.key() << ": {$" << function.function_name();
+            if (function.params().size() == 1) {
+                stream << ": " << function.params().front();
+            } else if (!function.params().empty()) {
+                stream << ": [";
+                bool is_first = true;
+                for (const auto& param : function.params()) {
+                    if (is_first) {
+                        is_first = false;
+                    } else {
+                        stream << ", ";
+                    }
+                    stream << param;
+                }
+                stream << "]";
+            }
+            stream << ", $over: {";
+            if (!spec.partition_by.empty()) {
+                stream << "$partition: [";
+                bool is_first = true;
+                for (const auto& key : spec.partition_by) {
+                    if (is_first) {
+                        is_first = false;
+                    } else {
+                        stream << ", ";
+                    }
+                    stream << key;
+                }
+                stream << "], ";
+            }
+            if (!spec.order_by.empty()) {
+                stream << "$sort: {";
+                bool is_first = true;
+                for (const auto& expr : spec.order_by) {
+                    if (is_first) {
+                        is_first = false;
+                    } else {
+                        stream << ", ";
+                    }
+                    stream << expr->to_string();
+                }
+                stream << "}, ";
+            }
+            stream << (spec.frame.mode == window_frame_mode::rows ? "$rows: [" : "$range: [");
+            print_bound(stream, spec.frame.start);
+            stream << ", ";
+            print_bound(stream, spec.frame.end);
+            stream << "]}}";
+        }
+
+    } // namespace
+
+    std::optional<window_function_type> window_function_from_name(std::string_view name) {
+        if (name == "row_number") {
+            return window_function_type::row_number;
+        } else if (name == "rank") {
+            return window_function_type::rank;
+        } else if (name == "dense_rank") {
+            return window_function_type::dense_rank;
+        } else if (name == "lag") {
+            return window_function_type::lag;
+        } else if (name == "lead") {
+            return window_function_type::lead;
+        } else if (name == "count") {
+            return window_function_type::count;
+        } else if (name == "sum") {
+            return window_function_type::sum;
+        } else if (name == "avg") {
+            return window_function_type::avg;
+        } else if (name == "min") {
+            return window_function_type::min;
+        } else if (name == "max") {
+            return window_function_type::max;
+        }
+        return std::nullopt;
+    }
+
+    types::complex_logical_type window_result_type(window_function_type type,
+                                                   const types::complex_logical_type& argument) {
+        switch (type) {
+            case window_function_type::lag:
+            case window_function_type::lead:
+                return argument;
+            case window_function_type::avg:
+                return types::logical_type::DOUBLE;
+            case window_function_type::sum:
+            case window_function_type::min:
+            case window_function_type::max:
+                return is_window_integer(argument.type()) ? types::logical_type::BIGINT
+                                                          : types::logical_type::DOUBLE;
+            default:
+                return types::logical_type::BIGINT;
+        }
+    }
+
+    node_window_t::node_window_t(std::pmr::memory_resource* resource, const collection_full_name_t& collection)
+        : node_t(resource, node_type::window_t, collection)
+        , windows_(resource) {}
+
+    void node_window_t::append_column(const expressions::expression_ptr& column) { append_expression(column); }
+
+    void node_window_t::append_window_function(const expressions::aggregate_expression_ptr& function,
+                                               window_spec_t spec) {
+        append_expression(function);
+        windows_.emplace_back(std::move(spec));
+    }
+
+    const std::pmr::vector<window_spec_t>& node_window_t::windows() const { return windows_; }
+
+    std::pmr::vector<window_spec_t>& node_window_t::windows() { return windows_; }
+
+    hash_t node_window_t::hash_impl() const { return 0; }
+
+    std::string node_window_t::to_string_impl() const {
+        std::stringstream stream;
+        stream << "$window: {";
+        bool is_first = true;
+        size_t window = 0;
+        for (const auto& expr : expressions_) {
+            if (is_first) {
+                is_first = false;
+            } else {
+                stream << ", ";
+            }
+            if (expr->group() == expressions::expression_group::aggregate) {
+                print_function(stream,
+                               *static_cast<const expressions::aggregate_expression_t*>(expr.get()),
+                               windows_.at(window++));
+            } else {
+                stream << expr->to_string();
+            }
+        }
+        stream << "}";
+        return stream.str();
+    }
+
+    node_window_ptr make_node_window(std::pmr::memory_resource* resource, const collection_full_name_t& collection) {
+        return {new node_window_t{resource, collection}};
+    }
+
+} // namespace components::logical_plan
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "node.hpp"
+
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/sort_expression.hpp>
+
+#include <optional>
+#include <string_view>
+
+namespace components::logical_plan {
+
+    enum class window_frame_mode : uint8_t
+    {
+        rows,
+        range
+    };
+
+    enum class window_bound_type : uint8_t
+    {
+        unbounded_preceding,
+        preceding,
+        current_row,
+        following,
+        unbounded_following
+    };
+
+    struct window_bound_t {
+        window_bound_type type{window_bound_type::current_row};
+        int64_t offset{0}; // preceding/following only
+    };
+
+    // Without an explicit frame clause SQL takes RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW
+    struct window_frame_t {
+        window_frame_mode mode{window_frame_mode::range};
+        window_bound_t start{window_bound_type::unbounded_preceding, 0};
+        window_bound_t end{window_bound_type::current_row, 0};
+    };
+
+    enum class window_function_type : uint8_t
+    {
+        row_number,
+        rank,
+        dense_rank,
+        lag,
+        lead,
+        count,
+        sum,
+        avg,
+        min,
+        max
+    };
+
+    // std::nullopt for names that are not usable with OVER
+    std::optional<window_function_type> window_function_from_name(std::string_view name);
+
+    // BIGINT for ranking functions and COUNT, the argument type for LAG/LEAD, DOUBLE for AVG;
+    // SUM, MIN and MAX give BIGINT over integer arguments and DOUBLE over other numeric ones.
+    // `argument` is ignored by functions that take none.
+    types::complex_logical_type window_result_type(window_function_type type,
+                                                   const types::complex_logical_type& argument);
+
+    struct window_spec_t {
+        explicit window_spec_t(std::pmr::memory_resource* resource)
+            : partition_by(resource)
+            , order_by(resource) {}
+
+        std::pmr::vector<expressions::key_t> partition_by;
+        std::pmr::vector<expressions::sort_expression_ptr> order_by;
+        window_frame_t frame;
+    };
+
+    // SELECT list of a query with window functions. `expressions()` keeps the projection in SELECT
+    // order: get_field scalars for plain columns and aggregate expressions for the functions called
+    // with OVER; the i-th aggregate expression is evaluated over `windows()[i]`.
+    class node_window_t final : public node_t {
+    public:
+        explicit node_window_t(std::pmr::memory_resource* resource, const collection_full_name_t& collection);
+
+        void append_column(const expressions::expression_ptr& column);
+        void append_window_function(const expressions::aggregate_expression_ptr& function, window_spec_t spec);
+
+        const std::pmr::vector<window_spec_t>& windows() const;
+        std::pmr::vector<window_spec_t>& windows();
+
+    private:
+        std::pmr::vector<window_spec_t> windows_;
+
+        hash_t hash_impl() const override;
+        std::string to_string_impl() const override;
+    };
+
+    using node_window_ptr = boost::intrusive_ptr<node_window_t>;
+
+    node_window_ptr make_node_window(std::pmr::memory_resource* resource, const collection_full_name_t& collection);
+
+} // namespace components::logical_plan
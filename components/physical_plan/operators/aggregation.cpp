@@ -10,6 +10,8 @@ namespace components::operators {
 
     void aggregation::set_match(operator_ptr&& match) { match_ = std::move(match); }
 
+    void aggregation::set_window(operator_ptr&& window) { window_ = std::move(window); }
+
     void aggregation::set_group(operator_ptr&& group) { group_ = std::move(group); }
 
     void aggregation::set_sort(operator_ptr&& sort) { sort_ = std::move(sort); }
@@ -33,8 +35,8 @@ namespace components::operators {
 
     void aggregation::on_prepare_impl() {
         operator_ptr executor = nullptr;
-        // When sort is present, scan all rows — limit is applied after sort in on_execute_impl
-        auto scan_limit = sort_ ? logical_plan::limit_t::unlimit() : limit_;
+        // When sort or window is present, scan all rows — limit is applied in on_execute_impl
+        auto scan_limit = sort_ || window_ ? logical_plan::limit_t::unlimit() : limit_;
         if (left_) {
             executor = std::move(left_);
             if (match_) {
@@ -47,6 +49,10 @@ namespace components::operators {
                     ? std::move(match_)
                     : static_cast<operator_ptr>(boost::intrusive_ptr(new transfer_scan(resource_, name_, scan_limit)));
         }
+        if (window_) {
+            window_->set_children(std::move(executor));
+            executor = std::move(window_);
+        }
         if (group_) {
             group_->set_children(std::move(executor));
             executor = std::move(group_);
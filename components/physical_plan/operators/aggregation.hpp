@@ -10,6 +10,7 @@ namespace components::operators {
         aggregation(std::pmr::memory_resource* resource, log_t log, collection_full_name_t name);
 
         void set_match(operator_ptr&& match);
+        void set_window(operator_ptr&& window);
         void set_group(operator_ptr&& group);
         void set_sort(operator_ptr&& sort);
         void set_having(operator_ptr&& having);
@@ -19,6 +20,7 @@ namespace components::operators {
     private:
         collection_full_name_t name_;
         operator_ptr match_{nullptr};
+        operator_ptr window_{nullptr};
         operator_ptr group_{nullptr};
         operator_ptr sort_{nullptr};
         operator_ptr having_{nullptr};
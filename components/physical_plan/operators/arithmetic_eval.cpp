@@ -1,4 +1,14 @@
 #include "arithmetic_eval.hpp"
+#include "expression_program.hpp"
+
+#include <components/types/operations_helper.hpp>
+#include <components/vector/vector_operations.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <numeric>
 
 namespace components::operators {
 
@@ -155,119 +165,466 @@ namespace components::operators {
             }
         }
 
-        types::logical_value_t resolve_row_value(std::pmr::memory_resource* resource,
-                                                 const expressions::param_storage& param,
-                                                 const vector::data_chunk_t& chunk,
-                                                 const logical_plan::storage_parameters& params,
-                                                 size_t row_idx) {
-            if (std::holds_alternative<expressions::key_t>(param)) {
-                auto& key = std::get<expressions::key_t>(param);
-                // Try path-based lookup first (set during plan validation)
-                if (!key.path().empty()) {
-                    auto* vec = chunk.at(key.path());
-                    if (vec)
-                        return vec->value(row_idx);
+        namespace {
+
+            // Types whose values are copied as raw bytes of a flat vector
+            bool is_fixed_width(types::logical_type type) {
+                return types::is_numeric(type) && type != types::logical_type::DECIMAL;
+            }
+
+            // Types compared through their physical representation
+            bool has_typed_compare(const types::complex_logical_type& type) {
+                return is_fixed_width(type.type()) || type.type() == types::logical_type::STRING_LITERAL;
+            }
+
+            bool compare_holds(expressions::compare_type type, types::compare_t result) {
+                switch (type) {
+                    case expressions::compare_type::gt:
+                        return result == types::compare_t::more;
+                    case expressions::compare_type::gte:
+                        return result >= types::compare_t::equals;
+                    case expressions::compare_type::lt:
+                        return result == types::compare_t::less;
+                    case expressions::compare_type::lte:
+                        return result <= types::compare_t::equals;
+                    case expressions::compare_type::eq:
+                        return result == types::compare_t::equals;
+                    case expressions::compare_type::ne:
+                        return result != types::compare_t::equals;
+                    default:
+                        return false;
                 }
-                // This error should be caught during validation; defensive check
-                throw std::logic_error("CASE: column not found: " + key.as_string());
-            } else if (std::holds_alternative<core::parameter_id_t>(param)) {
-                auto id = std::get<core::parameter_id_t>(param);
-                return params.parameters.at(id);
-            } else {
-                auto& expr_ptr = std::get<expressions::expression_ptr>(param);
-                if (expr_ptr->group() == expressions::expression_group::scalar) {
-                    auto* scalar = static_cast<const expressions::scalar_expression_t*>(expr_ptr.get());
-                    if (scalar->type() == expressions::scalar_type::case_expr) {
-                        // Nested CASE — recursive per-row evaluation
-                        auto& ops = scalar->params();
-                        bool has_default = (ops.size() % 2 == 1);
-                        size_t num_whens = ops.size() / 2;
-                        for (size_t w = 0; w < num_whens; w++) {
-                            auto& cond_param = ops[w * 2];
-                            if (std::holds_alternative<expressions::expression_ptr>(cond_param)) {
-                                auto& cond_expr = std::get<expressions::expression_ptr>(cond_param);
-                                if (evaluate_row_condition(resource, cond_expr, chunk, params, row_idx)) {
-                                    return resolve_row_value(resource, ops[w * 2 + 1], chunk, params, row_idx);
-                                }
-                            }
-                        }
-                        if (has_default) {
-                            return resolve_row_value(resource, ops.back(), chunk, params, row_idx);
-                        }
-                        return types::logical_value_t(resource, types::complex_logical_type{types::logical_type::NA});
+            }
+
+            template<typename T, typename Op>
+            void select_typed(const vector::vector_t& left,
+                              const vector::vector_t& right,
+                              bool right_constant,
+                              const std::vector<uint64_t>& rows,
+                              std::vector<uint64_t>& matched,
+                              Op op) {
+                const auto* lhs = left.data<types::physical_storage_t<T>>();
+                const auto* rhs = right.data<types::physical_storage_t<T>>();
+                const auto& left_validity = left.validity();
+                const auto& right_validity = right.validity();
+                for (uint64_t k = 0; k < rows.size(); k++) {
+                    auto r = right_constant ? 0 : k;
+                    if (left_validity.row_is_valid(k) && right_validity.row_is_valid(r) && op(lhs[k], rhs[r])) {
+                        matched.push_back(rows[k]);
                     }
-                    // Unary minus sub-expression
-                    if (scalar->type() == expressions::scalar_type::unary_minus) {
-                        if (scalar->params().empty()) {
-                            throw std::logic_error("CASE: unary minus requires 1 operand");
-                        }
-                        auto inner = resolve_row_value(resource, scalar->params()[0], chunk, params, row_idx);
-                        return types::logical_value_t::subtract(types::logical_value_t(resource, int64_t(0)), inner);
+                }
+            }
+
+            // Both sides flat and of the same type; `right` is one entry when constant
+            template<typename...>
+            struct select_compare_callback {
+                template<typename T>
+                void operator()(const vector::vector_t& left,
+                                const vector::vector_t& right,
+                                bool right_constant,
+                                expressions::compare_type type,
+                                const std::vector<uint64_t>& rows,
+                                std::vector<uint64_t>& matched) const {
+                    switch (type) {
+                        case expressions::compare_type::gt:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::greater<>{});
+                        case expressions::compare_type::gte:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::greater_equal<>{});
+                        case expressions::compare_type::lt:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::less<>{});
+                        case expressions::compare_type::lte:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::less_equal<>{});
+                        case expressions::compare_type::eq:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::equal_to<>{});
+                        case expressions::compare_type::ne:
+                            return select_typed<T>(left, right, right_constant, rows, matched, std::not_equal_to<>{});
+                        default:
+                            return;
                     }
-                    // Arithmetic sub-expression
-                    if (scalar->params().size() < 2) {
-                        throw std::logic_error("CASE: arithmetic sub-expression requires 2 operands");
+                }
+            };
+
+            // Comparison operand over a selection: a flat vector of the selected rows, or one scalar
+            struct row_operand_t {
+                std::optional<vector::vector_t> vec;
+                std::optional<types::logical_value_t> scalar;
+            };
+
+            row_operand_t resolve_row_operand(std::pmr::memory_resource* resource,
+                                              const expressions::param_storage& param,
+                                              vector::data_chunk_t& chunk,
+                                              const logical_plan::storage_parameters& params,
+                                              const std::vector<uint64_t>& rows) {
+                row_operand_t result;
+                if (std::holds_alternative<core::parameter_id_t>(param)) {
+                    result.scalar = params.parameters.at(std::get<core::parameter_id_t>(param));
+                } else {
+                    result.vec = evaluate_on_rows(resource, param, chunk, params, rows);
+                }
+                return result;
+            }
+
+            // Rows where `cmp` holds when compared by `type`; a NULL operand matches nothing
+            void select_compare(std::pmr::memory_resource* resource,
+                                const expressions::compare_expression_t* cmp,
+                                expressions::compare_type type,
+                                vector::data_chunk_t& chunk,
+                                const logical_plan::storage_parameters& params,
+                                const std::vector<uint64_t>& rows,
+                                std::vector<uint64_t>& matched) {
+                auto left = resolve_row_operand(resource, cmp->left(), chunk, params, rows);
+                auto right = resolve_row_operand(resource, cmp->right(), chunk, params, rows);
+                if (!left.vec && !right.vec) {
+                    if (!left.scalar->is_null() && !right.scalar->is_null() &&
+                        compare_holds(type, left.scalar->compare(*right.scalar))) {
+                        matched = rows;
                     }
-                    auto l = resolve_row_value(resource, scalar->params()[0], chunk, params, row_idx);
-                    auto r = resolve_row_value(resource, scalar->params()[1], chunk, params, row_idx);
-                    switch (scalar->type()) {
-                        case expressions::scalar_type::add:
-                            return types::logical_value_t::sum(l, r);
-                        case expressions::scalar_type::subtract:
-                            return types::logical_value_t::subtract(l, r);
-                        case expressions::scalar_type::multiply:
-                            return types::logical_value_t::mult(l, r);
-                        case expressions::scalar_type::divide:
-                            return types::logical_value_t::divide(l, r);
-                        case expressions::scalar_type::mod:
-                            return types::logical_value_t::modulus(l, r);
+                    return;
+                }
+
+                if (!left.vec) {
+                    // Keep the vector on the left: `5 < x` is `x > 5`
+                    std::swap(left, right);
+                    switch (type) {
+                        case expressions::compare_type::gt:
+                            type = expressions::compare_type::lt;
+                            break;
+                        case expressions::compare_type::gte:
+                            type = expressions::compare_type::lte;
+                            break;
+                        case expressions::compare_type::lt:
+                            type = expressions::compare_type::gt;
+                            break;
+                        case expressions::compare_type::lte:
+                            type = expressions::compare_type::gte;
+                            break;
                         default:
                             break;
                     }
                 }
-                throw std::logic_error("CASE: unsupported sub-expression");
+                const auto& column = *left.vec;
+                if (right.scalar) {
+                    if (right.scalar->is_null()) {
+                        return;
+                    }
+                    // A constant of another numeric type is brought to the column type when that is exact
+                    auto constant = *right.scalar;
+                    if (constant.type() != column.type() && types::is_numeric(constant.type().type()) &&
+                        types::is_numeric(column.type().type())) {
+                        auto cast = constant.cast_as(column.type());
+                        if (!cast.is_null() && cast.compare(constant) == types::compare_t::equals) {
+                            constant = std::move(cast);
+                        }
+                    }
+                    if (constant.type() == column.type() && has_typed_compare(column.type())) {
+                        vector::vector_t single(resource, column.type(), 1);
+                        single.set_value(0, constant);
+                        types::simple_physical_type_switch<select_compare_callback>(column.type().to_physical_type(),
+                                                                                    column,
+                                                                                    single,
+                                                                                    true,
+                                                                                    type,
+                                                                                    rows,
+                                                                                    matched);
+                        return;
+                    }
+                    for (uint64_t k = 0; k < rows.size(); k++) {
+                        auto value = column.value(k);
+                        if (!value.is_null() && compare_holds(type, value.compare(*right.scalar))) {
+                            matched.push_back(rows[k]);
+                        }
+                    }
+                    return;
+                }
+
+                const auto& other = *right.vec;
+                if (column.type() == other.type() && has_typed_compare(column.type())) {
+                    types::simple_physical_type_switch<select_compare_callback>(column.type().to_physical_type(),
+                                                                                column,
+                                                                                other,
+                                                                                false,
+                                                                                type,
+                                                                                rows,
+                                                                                matched);
+                    return;
+                }
+                for (uint64_t k = 0; k < rows.size(); k++) {
+                    auto lhs = column.value(k);
+                    auto rhs = other.value(k);
+                    if (!lhs.is_null() && !rhs.is_null() && compare_holds(type, lhs.compare(rhs))) {
+                        matched.push_back(rows[k]);
+                    }
+                }
             }
-        }
 
-        bool evaluate_row_condition(std::pmr::memory_resource* resource,
-                                    const expressions::expression_ptr& condition,
-                                    const vector::data_chunk_t& chunk,
-                                    const logical_plan::storage_parameters& params,
-                                    size_t row_idx) {
-            if (condition->group() != expressions::expression_group::compare)
-                return false;
-            auto* cmp = static_cast<const expressions::compare_expression_t*>(condition.get());
+            void difference(const std::vector<uint64_t>& rows,
+                            const std::vector<uint64_t>& removed,
+                            std::vector<uint64_t>& result) {
+                result.clear();
+                std::set_difference(rows.begin(),
+                                    rows.end(),
+                                    removed.begin(),
+                                    removed.end(),
+                                    std::back_inserter(result));
+            }
 
-            if (cmp->is_union()) {
-                bool is_and = (cmp->type() == expressions::compare_type::union_and);
-                for (auto& child : cmp->children()) {
-                    bool child_result = evaluate_row_condition(resource, child, chunk, params, row_idx);
-                    if (is_and && !child_result)
-                        return false;
-                    if (!is_and && child_result)
-                        return true;
+            expressions::compare_type negated(expressions::compare_type type) {
+                switch (type) {
+                    case expressions::compare_type::gt:
+                        return expressions::compare_type::lte;
+                    case expressions::compare_type::gte:
+                        return expressions::compare_type::lt;
+                    case expressions::compare_type::lt:
+                        return expressions::compare_type::gte;
+                    case expressions::compare_type::lte:
+                        return expressions::compare_type::gt;
+                    case expressions::compare_type::eq:
+                        return expressions::compare_type::ne;
+                    case expressions::compare_type::ne:
+                        return expressions::compare_type::eq;
+                    default:
+                        return type;
                 }
-                return is_and;
             }
 
-            auto left_val = resolve_row_value(resource, cmp->left(), chunk, params, row_idx);
-            auto right_val = resolve_row_value(resource, cmp->right(), chunk, params, row_idx);
-            auto cmp_result = left_val.compare(right_val);
+            // Rows for which `condition` is FALSE rather than NULL: the only rows its negation keeps
+            void select_false_rows(std::pmr::memory_resource* resource,
+                                   const expressions::expression_ptr& condition,
+                                   vector::data_chunk_t& chunk,
+                                   const logical_plan::storage_parameters& params,
+                                   const std::vector<uint64_t>& rows,
+                                   std::vector<uint64_t>& rejected) {
+                rejected.clear();
+                if (rows.empty()) {
+                    return;
+                }
+                if (condition->group() != expressions::expression_group::compare) {
+                    rejected = rows;
+                    return;
+                }
+                auto* cmp = static_cast<const expressions::compare_expression_t*>(condition.get());
+                switch (cmp->type()) {
+                    case expressions::compare_type::union_and: {
+                        // False as soon as one conjunct is
+                        std::vector<uint64_t> rest = rows;
+                        std::vector<uint64_t> child_rejected;
+                        std::vector<uint64_t> next;
+                        for (const auto& child : cmp->children()) {
+                            select_false_rows(resource, child, chunk, params, rest, child_rejected);
+                            rejected.insert(rejected.end(), child_rejected.begin(), child_rejected.end());
+                            difference(rest, child_rejected, next);
+                            std::swap(rest, next);
+                            if (rest.empty()) {
+                                break;
+                            }
+                        }
+                        std::sort(rejected.begin(), rejected.end());
+                        return;
+                    }
+                    case expressions::compare_type::union_or: {
+                        // False only where every disjunct is
+                        rejected = rows;
+                        std::vector<uint64_t> kept;
+                        for (const auto& child : cmp->children()) {
+                            select_false_rows(resource, child, chunk, params, rejected, kept);
+                            std::swap(rejected, kept);
+                            if (rejected.empty()) {
+                                break;
+                            }
+                        }
+                        return;
+                    }
+                    case expressions::compare_type::union_not:
+                        if (!cmp->children().empty()) {
+                            select_rows(resource, cmp->children().front(), chunk, params, rows, rejected);
+                        }
+                        return;
+                    case expressions::compare_type::all_true:
+                        return;
+                    case expressions::compare_type::is_null:
+                    case expressions::compare_type::is_not_null: {
+                        std::vector<uint64_t> matched;
+                        select_rows(resource, condition, chunk, params, rows, matched);
+                        difference(rows, matched, rejected);
+                        return;
+                    }
+                    case expressions::compare_type::gt:
+                    case expressions::compare_type::gte:
+                    case expressions::compare_type::lt:
+                    case expressions::compare_type::lte:
+                    case expressions::compare_type::eq:
+                    case expressions::compare_type::ne:
+                        select_compare(resource, cmp, negated(cmp->type()), chunk, params, rows, rejected);
+                        return;
+                    default:
+                        // select_rows matches none of these, so their negation keeps every row
+                        rejected = rows;
+                        return;
+                }
+            }
+
+        } // namespace
+
+        void select_rows(std::pmr::memory_resource* resource,
+                         const expressions::expression_ptr& condition,
+                         vector::data_chunk_t& chunk,
+                         const logical_plan::storage_parameters& params,
+                         const std::vector<uint64_t>& rows,
+                         std::vector<uint64_t>& matched) {
+            matched.clear();
+            if (rows.empty() || condition->group() != expressions::expression_group::compare) {
+                return;
+            }
+            auto* cmp = static_cast<const expressions::compare_expression_t*>(condition.get());
             switch (cmp->type()) {
+                case expressions::compare_type::union_and: {
+                    // Each conjunct only looks at the rows the previous ones kept
+                    matched = rows;
+                    std::vector<uint64_t> kept;
+                    for (const auto& child : cmp->children()) {
+                        select_rows(resource, child, chunk, params, matched, kept);
+                        std::swap(matched, kept);
+                        if (matched.empty()) {
+                            break;
+                        }
+                    }
+                    return;
+                }
+                case expressions::compare_type::union_or: {
+                    // Each disjunct only looks at the rows no previous one matched
+                    std::vector<uint64_t> rest = rows;
+                    std::vector<uint64_t> child_matched;
+                    std::vector<uint64_t> next;
+                    for (const auto& child : cmp->children()) {
+                        select_rows(resource, child, chunk, params, rest, child_matched);
+                        matched.insert(matched.end(), child_matched.begin(), child_matched.end());
+                        difference(rest, child_matched, next);
+                        std::swap(rest, next);
+                        if (rest.empty()) {
+                            break;
+                        }
+                    }
+                    std::sort(matched.begin(), matched.end());
+                    return;
+                }
+                case expressions::compare_type::union_not:
+                    // A row whose operand is NULL is NULL under NOT too, and is not kept
+                    if (!cmp->children().empty()) {
+                        select_false_rows(resource, cmp->children().front(), chunk, params, rows, matched);
+                    }
+                    return;
+                case expressions::compare_type::all_true:
+                    matched = rows;
+                    return;
+                case expressions::compare_type::is_null:
+                case expressions::compare_type::is_not_null: {
+                    auto values = evaluate_on_rows(resource, cmp->left(), chunk, params, rows);
+                    bool want_null = cmp->type() == expressions::compare_type::is_null;
+                    for (uint64_t k = 0; k < rows.size(); k++) {
+                        bool is_null = !values.validity().row_is_valid(k);
+                        if (is_null == want_null) {
+                            matched.push_back(rows[k]);
+                        }
+                    }
+                    return;
+                }
                 case expressions::compare_type::gt:
-                    return cmp_result == types::compare_t::more;
                 case expressions::compare_type::gte:
-                    return cmp_result >= types::compare_t::equals;
                 case expressions::compare_type::lt:
-                    return cmp_result == types::compare_t::less;
                 case expressions::compare_type::lte:
-                    return cmp_result <= types::compare_t::equals;
                 case expressions::compare_type::eq:
-                    return cmp_result == types::compare_t::equals;
                 case expressions::compare_type::ne:
-                    return cmp_result != types::compare_t::equals;
+                    select_compare(resource, cmp, cmp->type(), chunk, params, rows, matched);
+                    return;
                 default:
-                    return false;
+                    return;
+            }
+        }
+
+        vector::vector_t evaluate_on_rows(std::pmr::memory_resource* resource,
+                                          const expressions::param_storage& param,
+                                          vector::data_chunk_t& chunk,
+                                          const logical_plan::storage_parameters& params,
+                                          const std::vector<uint64_t>& rows) {
+            uint64_t count = rows.size();
+            if (std::holds_alternative<core::parameter_id_t>(param)) {
+                const auto& value = params.parameters.at(std::get<core::parameter_id_t>(param));
+                vector::vector_t result(resource, value.type(), count);
+                if (value.is_null()) {
+                    result.validity().set_all_invalid(count);
+                    return result;
+                }
+                for (uint64_t k = 0; k < count; k++) {
+                    result.set_value(k, value);
+                }
+                return result;
+            }
+
+            vector::indexing_vector_t indexing(resource, count);
+            for (uint64_t k = 0; k < count; k++) {
+                indexing.set_index(k, rows[k]);
+            }
+            if (std::holds_alternative<expressions::key_t>(param)) {
+                const auto& key = std::get<expressions::key_t>(param);
+                auto* column = key.path().empty() ? nullptr : chunk.at(key.path());
+                if (!column) {
+                    throw std::logic_error("CASE: column not found: " + key.as_string());
+                }
+                vector::vector_t result(resource, column->type(), count);
+                vector::vector_ops::copy(*column, result, indexing, count, 0, 0);
+                return result;
+            }
+
+            // Sub-expressions see only the selected rows, so work is proportional to the selection
+            auto compute = [&](vector::data_chunk_t& input) -> vector::vector_t {
+                std::deque<vector::vector_t> temp_vecs;
+                auto [operand, error] = resolve_operand(param, input, params, resource, temp_vecs);
+                if (!error.empty()) {
+                    throw std::logic_error(error);
+                }
+                if (operand.scalar) {
+                    vector::vector_t result(resource, operand.scalar->type(), count);
+                    for (uint64_t k = 0; k < count; k++) {
+                        result.set_value(k, *operand.scalar);
+                    }
+                    return result;
+                }
+                if (!temp_vecs.empty() && operand.vec == &temp_vecs.back()) {
+                    return std::move(temp_vecs.back());
+                }
+                return vector::vector_t(*operand.vec);
+            };
+            if (count == chunk.size()) {
+                return compute(chunk);
+            }
+            if (count == 0) {
+                return vector::vector_t(resource, types::complex_logical_type(types::logical_type::NA), 0);
+            }
+            vector::data_chunk_t selected(resource, chunk.types(), count);
+            selected.slice(chunk, indexing, count);
+            selected.flatten();
+            return compute(selected);
+        }
+
+        void scatter_rows(const vector::vector_t& source, vector::vector_t& target, const std::vector<uint64_t>& rows) {
+            if (is_fixed_width(target.type().type()) && source.type().type() == target.type().type() &&
+                source.get_vector_type() == vector::vector_type::FLAT) {
+                auto width = target.type().size();
+                auto* dst = target.data();
+                const auto* src = source.data();
+                for (uint64_t k = 0; k < rows.size(); k++) {
+                    if (source.validity().row_is_valid(k)) {
+                        std::memcpy(dst + rows[k] * width, src + k * width, width);
+                        target.validity().set_valid(rows[k]);
+                    } else {
+                        target.validity().set_invalid(rows[k]);
+                    }
+                }
+                return;
+            }
+            // Strings own their bytes in the target's heap, other types are cast on write
+            for (uint64_t k = 0; k < rows.size(); k++) {
+                target.set_value(rows[k], source.value(k));
             }
         }
 
@@ -279,34 +636,51 @@ namespace components::operators {
             bool has_default = (operands.size() % 2 == 1);
             size_t num_whens = operands.size() / 2;
 
-            // Determine result type from first matching value for row 0
+            std::vector<uint64_t> remaining(count);
+            std::iota(remaining.begin(), remaining.end(), uint64_t{0});
+            std::vector<uint64_t> matched;
+            std::vector<uint64_t> rest;
+
+            // Rows taken by each branch, with the branch values for them
+            std::vector<std::vector<uint64_t>> branch_rows;
+            std::vector<vector::vector_t> branch_values;
+            branch_rows.reserve(num_whens + 1);
+            branch_values.reserve(num_whens + 1);
+            for (size_t w = 0; w < num_whens; w++) {
+                const auto& cond_param = operands[w * 2];
+                if (!std::holds_alternative<expressions::expression_ptr>(cond_param)) {
+                    continue;
+                }
+                const auto& condition = std::get<expressions::expression_ptr>(cond_param);
+                select_rows(resource, condition, chunk, params, remaining, matched);
+                branch_values.push_back(evaluate_on_rows(resource, operands[w * 2 + 1], chunk, params, matched));
+                difference(remaining, matched, rest);
+                std::swap(remaining, rest);
+                branch_rows.push_back(std::move(matched));
+                matched = {};
+            }
+            if (has_default) {
+                branch_values.push_back(evaluate_on_rows(resource, operands.back(), chunk, params, remaining));
+                branch_rows.push_back(std::move(remaining));
+                remaining = {};
+            }
+
+            // Result type is the first branch that produced a typed value
             types::complex_logical_type result_type(types::logical_type::NA);
-            if (count > 0) {
-                // Try first THEN result
-                auto val = resolve_row_value(resource, operands[1], chunk, params, 0);
-                result_type = val.type();
+            for (const auto& values : branch_values) {
+                if (values.type().type() != types::logical_type::NA) {
+                    result_type = values.type();
+                    break;
+                }
             }
 
             vector::vector_t output(resource, result_type, count);
-
-            for (uint64_t i = 0; i < count; i++) {
-                bool matched = false;
-                for (size_t w = 0; w < num_whens; w++) {
-                    auto& cond_param = operands[w * 2];
-                    if (std::holds_alternative<expressions::expression_ptr>(cond_param)) {
-                        auto& cond_expr = std::get<expressions::expression_ptr>(cond_param);
-                        if (evaluate_row_condition(resource, cond_expr, chunk, params, i)) {
-                            auto val = resolve_row_value(resource, operands[w * 2 + 1], chunk, params, i);
-                            output.set_value(i, val);
-                            matched = true;
-                            break;
-                        }
-                    }
-                }
-                if (!matched && has_default) {
-                    auto val = resolve_row_value(resource, operands.back(), chunk, params, i);
-                    output.set_value(i, val);
-                }
+            for (size_t b = 0; b < branch_values.size(); b++) {
+                scatter_rows(branch_values[b], output, branch_rows[b]);
+            }
+            // No WHEN matched and there is no ELSE
+            for (auto row : remaining) {
+                output.validity().set_invalid(row);
             }
             return output;
         }
@@ -326,6 +700,11 @@ namespace components::operators {
             return {detail::evaluate_case_expr(resource, operands, chunk, params), {}};
         }
 
+        // Numeric trees run as one compiled program; the node-by-node path below handles the rest
+        if (auto program = expression_program_t::compile(resource, op, operands, chunk, params)) {
+            return {program->execute(resource, chunk), {}};
+        }
+
         if (op == expressions::scalar_type::unary_minus) {
             if (operands.empty()) {
                 return {std::move(dummy), "unary minus requires 1 operand"};
@@ -23,21 +23,28 @@ namespace components::operators {
                                                                  std::pmr::memory_resource* resource,
                                                                  std::deque<vector::vector_t>& temp_vecs);
 
-        // Resolve a param_storage to logical_value_t for a specific row
-        types::logical_value_t resolve_row_value(std::pmr::memory_resource* resource,
-                                                 const expressions::param_storage& param,
-                                                 const vector::data_chunk_t& chunk,
-                                                 const logical_plan::storage_parameters& params,
-                                                 size_t row_idx);
-
-        // Evaluate a compare_expression for a specific row
-        bool evaluate_row_condition(std::pmr::memory_resource* resource,
-                                    const expressions::expression_ptr& condition,
-                                    const vector::data_chunk_t& chunk,
-                                    const logical_plan::storage_parameters& params,
-                                    size_t row_idx);
-
-        // Evaluate a CASE expression per-row on a data_chunk
+        // Rows of `rows` (ascending) for which `condition` holds, in the same order.
+        // A comparison with a NULL operand never holds.
+        void select_rows(std::pmr::memory_resource* resource,
+                         const expressions::expression_ptr& condition,
+                         vector::data_chunk_t& chunk,
+                         const logical_plan::storage_parameters& params,
+                         const std::vector<uint64_t>& rows,
+                         std::vector<uint64_t>& matched);
+
+        // Values of `param` at `rows`, packed into a flat vector of rows.size() entries.
+        // Expressions are computed on those rows only.
+        vector::vector_t evaluate_on_rows(std::pmr::memory_resource* resource,
+                                          const expressions::param_storage& param,
+                                          vector::data_chunk_t& chunk,
+                                          const logical_plan::storage_parameters& params,
+                                          const std::vector<uint64_t>& rows);
+
+        // Writes entry k of `source` to row rows[k] of the flat `target`
+        void scatter_rows(const vector::vector_t& source, vector::vector_t& target, const std::vector<uint64_t>& rows);
+
+        // Evaluate a CASE expression on a data_chunk: each WHEN narrows the rows still unmatched
+        // to a selection, and its THEN is computed on that selection only and scattered into the result
         vector::vector_t evaluate_case_expr(std::pmr::memory_resource* resource,
                                             const std::pmr::vector<expressions::param_storage>& operands,
                                             vector::data_chunk_t& chunk,
@@ -0,0 +1,482 @@
+#include "expression_program.hpp"
+
+#include <components/types/operations_helper.hpp>
+#include <components/vector/arithmetic.hpp>
+
+#include <deque>
+#include <type_traits>
+
+namespace components::operators {
+
+    namespace {
+
+        using opcode_t = expression_program_t::opcode_t;
+        using instruction_t = expression_program_t::instruction_t;
+
+        // Column and constant types a program reads; they are converted to the result type on load
+        bool is_loadable(types::logical_type type) {
+            switch (type) {
+                case types::logical_type::TINYINT:
+                case types::logical_type::SMALLINT:
+                case types::logical_type::INTEGER:
+                case types::logical_type::BIGINT:
+                case types::logical_type::UTINYINT:
+                case types::logical_type::USMALLINT:
+                case types::logical_type::UINTEGER:
+                case types::logical_type::UBIGINT:
+                case types::logical_type::FLOAT:
+                case types::logical_type::DOUBLE:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        std::optional<opcode_t> to_opcode(expressions::scalar_type type) {
+            switch (type) {
+                case expressions::scalar_type::add:
+                    return opcode_t::add;
+                case expressions::scalar_type::subtract:
+                    return opcode_t::subtract;
+                case expressions::scalar_type::multiply:
+                    return opcode_t::multiply;
+                case expressions::scalar_type::divide:
+                    return opcode_t::divide;
+                case expressions::scalar_type::mod:
+                    return opcode_t::mod;
+                case expressions::scalar_type::unary_minus:
+                    return opcode_t::negate;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        bool is_leaf(opcode_t code) { return code == opcode_t::column || code == opcode_t::constant; }
+
+        // Emits postfix code for one node; a parameter-only subtree emits nothing and returns its value
+        class compiler_t {
+        public:
+            compiler_t(std::pmr::memory_resource* resource,
+                       const vector::data_chunk_t& chunk,
+                       const logical_plan::storage_parameters& params,
+                       std::vector<instruction_t>& code)
+                : resource_(resource)
+                , chunk_(chunk)
+                , params_(params)
+                , code_(code) {}
+
+            struct node_t {
+                types::logical_type type{types::logical_type::INVALID};
+                std::optional<types::logical_value_t> folded;
+            };
+
+            std::optional<node_t> node(expressions::scalar_type op,
+                                       const std::pmr::vector<expressions::param_storage>& operands) {
+                auto code = to_opcode(op);
+                if (!code) {
+                    return std::nullopt;
+                }
+                if (*code == opcode_t::negate) {
+                    if (operands.empty()) {
+                        return std::nullopt;
+                    }
+                    auto child = operand(operands[0]);
+                    if (!child) {
+                        return std::nullopt;
+                    }
+                    if (child->folded) {
+                        child->folded =
+                            types::logical_value_t::subtract(types::logical_value_t(resource_, int64_t(0)),
+                                                             *child->folded);
+                        child->type = child->folded->type().type();
+                        return is_loadable(child->type) ? child : std::nullopt;
+                    }
+                    code_.push_back(instruction(opcode_t::negate));
+                    node_types_.push_back(child->type);
+                    return child;
+                }
+                if (operands.size() < 2) {
+                    return std::nullopt;
+                }
+
+                auto left_mark = code_.size();
+                auto left = operand(operands[0]);
+                if (!left) {
+                    return std::nullopt;
+                }
+                auto right = operand(operands[1]);
+                if (!right) {
+                    return std::nullopt;
+                }
+                node_t result;
+                result.type = types::promote_type(left->type, right->type);
+                if (result.type == types::logical_type::FLOAT) {
+                    result.type = types::logical_type::DOUBLE;
+                }
+
+                if (left->folded && right->folded) {
+                    // Division by a folded zero keeps its usual error/NULL handling outside the program
+                    if ((*code == opcode_t::divide || *code == opcode_t::mod) &&
+                        *right->folded == types::logical_value_t(resource_, right->folded->type())) {
+                        return std::nullopt;
+                    }
+                    result.folded = fold(*code, *left->folded, *right->folded);
+                    result.type = result.folded->type().type();
+                    return is_loadable(result.type) ? std::optional<node_t>(std::move(result)) : std::nullopt;
+                }
+                if (left->folded) {
+                    code_.insert(code_.begin() + static_cast<std::ptrdiff_t>(left_mark),
+                                 constant(std::move(*left->folded)));
+                } else if (right->folded) {
+                    code_.push_back(constant(std::move(*right->folded)));
+                }
+                code_.push_back(instruction(*code));
+                node_types_.push_back(result.type);
+                return result;
+            }
+
+            // Types of the computed (non-folded) nodes; all must match the result type
+            const std::vector<types::logical_type>& node_types() const noexcept { return node_types_; }
+            bool has_column() const noexcept { return has_column_; }
+
+        private:
+            std::optional<node_t> operand(const expressions::param_storage& param) {
+                if (std::holds_alternative<expressions::key_t>(param)) {
+                    const auto& key = std::get<expressions::key_t>(param);
+                    const auto* column = key.path().empty() ? nullptr : chunk_.at(key.path());
+                    if (!column || column->get_vector_type() != vector::vector_type::FLAT ||
+                        !is_loadable(column->type().type())) {
+                        return std::nullopt;
+                    }
+                    instruction_t load = instruction(opcode_t::column);
+                    load.path.assign(key.path().begin(), key.path().end());
+                    code_.push_back(std::move(load));
+                    has_column_ = true;
+                    return node_t{column->type().type(), std::nullopt};
+                }
+                if (std::holds_alternative<core::parameter_id_t>(param)) {
+                    const auto& value = params_.parameters.at(std::get<core::parameter_id_t>(param));
+                    if (value.is_null() || !is_loadable(value.type().type())) {
+                        return std::nullopt;
+                    }
+                    return node_t{value.type().type(), value};
+                }
+                const auto& expr = std::get<expressions::expression_ptr>(param);
+                if (expr->group() != expressions::expression_group::scalar) {
+                    return std::nullopt;
+                }
+                const auto* scalar = static_cast<const expressions::scalar_expression_t*>(expr.get());
+                return node(scalar->type(), scalar->params());
+            }
+
+            static types::logical_value_t
+            fold(opcode_t code, const types::logical_value_t& l, const types::logical_value_t& r) {
+                switch (code) {
+                    case opcode_t::add:
+                        return types::logical_value_t::sum(l, r);
+                    case opcode_t::subtract:
+                        return types::logical_value_t::subtract(l, r);
+                    case opcode_t::multiply:
+                        return types::logical_value_t::mult(l, r);
+                    case opcode_t::divide:
+                        return types::logical_value_t::divide(l, r);
+                    default:
+                        return types::logical_value_t::modulus(l, r);
+                }
+            }
+
+            instruction_t instruction(opcode_t code) const {
+                types::logical_value_t none(resource_, types::complex_logical_type{types::logical_type::NA});
+                return instruction_t{code, std::pmr::vector<size_t>(resource_), std::move(none)};
+            }
+
+            instruction_t constant(types::logical_value_t value) const {
+                auto result = instruction(opcode_t::constant);
+                result.constant = std::move(value);
+                return result;
+            }
+
+            std::pmr::memory_resource* resource_;
+            const vector::data_chunk_t& chunk_;
+            const logical_plan::storage_parameters& params_;
+            std::vector<instruction_t>& code_;
+            std::vector<types::logical_type> node_types_;
+            bool has_column_{false};
+        };
+
+        // Operators of the program; `failed` is raised on division or modulus by zero
+        template<typename C>
+        struct add_op {
+            C operator()(C a, C b, uint8_t&) const { return static_cast<C>(a + b); }
+        };
+        template<typename C>
+        struct subtract_op {
+            C operator()(C a, C b, uint8_t&) const { return static_cast<C>(a - b); }
+        };
+        template<typename C>
+        struct multiply_op {
+            C operator()(C a, C b, uint8_t&) const { return static_cast<C>(a * b); }
+        };
+        template<typename C>
+        struct divide_op {
+            C operator()(C a, C b, uint8_t& failed) const {
+                if (b == C{0}) {
+                    failed = 1;
+                    return C{0};
+                }
+                return static_cast<C>(vector::checked_divides<void>{}(a, b));
+            }
+        };
+        template<typename C>
+        struct mod_op {
+            C operator()(C a, C b, uint8_t& failed) const {
+                if (b == C{0}) {
+                    failed = 1;
+                    return C{0};
+                }
+                return static_cast<C>(vector::checked_modulus<void>{}(a, b));
+            }
+        };
+
+        template<typename C, typename F>
+        void with_op(opcode_t code, F&& f) {
+            switch (code) {
+                case opcode_t::add:
+                    return f(add_op<C>{});
+                case opcode_t::subtract:
+                    return f(subtract_op<C>{});
+                case opcode_t::multiply:
+                    return f(multiply_op<C>{});
+                case opcode_t::divide:
+                    return f(divide_op<C>{});
+                case opcode_t::mod:
+                    return f(mod_op<C>{});
+                default:
+                    throw std::logic_error("expression_program_t: not a binary opcode");
+            }
+        }
+
+        // A flat input of the program: stride 1 for a column, 0 for a constant
+        template<typename C>
+        struct operand_t {
+            const C* data;
+            uint64_t stride;
+        };
+
+        template<typename C>
+        struct convert_to {
+            template<typename...>
+            struct callback {
+                template<typename T>
+                void operator()(const vector::vector_t& column, C* out, uint64_t count) const {
+                    if constexpr (types::is_numeric_type_v<T>) {
+                        const auto* in = column.data<T>();
+                        for (uint64_t i = 0; i < count; i++) {
+                            out[i] = static_cast<C>(in[i]);
+                        }
+                    } else {
+                        throw std::logic_error("expression_program_t: column is not numeric");
+                    }
+                }
+            };
+        };
+
+        template<typename C, typename Op>
+        void run_binary(operand_t<C> a, operand_t<C> b, C* out, uint8_t* failed, uint64_t count, Op op) {
+            for (uint64_t i = 0; i < count; i++) {
+                out[i] = op(a.data[i * a.stride], b.data[i * b.stride], failed[i]);
+            }
+        }
+
+        // (a op1 b) op2 c, or a op2 (b op1 c) when `Nested`
+        template<bool Nested, typename C, typename Op1, typename Op2>
+        void run_ternary(operand_t<C> a,
+                         operand_t<C> b,
+                         operand_t<C> c,
+                         C* out,
+                         uint8_t* failed,
+                         uint64_t count,
+                         Op1 op1,
+                         Op2 op2) {
+            for (uint64_t i = 0; i < count; i++) {
+                auto& f = failed[i];
+                if constexpr (Nested) {
+                    out[i] = op2(a.data[i * a.stride], op1(b.data[i * b.stride], c.data[i * c.stride], f), f);
+                } else {
+                    out[i] = op2(op1(a.data[i * a.stride], b.data[i * b.stride], f), c.data[i * c.stride], f);
+                }
+            }
+        }
+
+        template<typename C>
+        void run_program(const std::vector<instruction_t>& code,
+                         std::pmr::memory_resource* resource,
+                         vector::data_chunk_t& chunk,
+                         vector::vector_t& output,
+                         uint8_t* failed) {
+            auto count = chunk.size();
+            auto physical = std::is_same_v<C, double> ? types::physical_type::DOUBLE : types::physical_type::INT64;
+            std::deque<std::pmr::vector<C>> buffers;
+            auto load = [&](const instruction_t& instruction) -> operand_t<C> {
+                if (instruction.code == opcode_t::constant) {
+                    auto& buffer = buffers.emplace_back(1, instruction.constant.value<C>(), resource);
+                    return {buffer.data(), 0};
+                }
+                const auto* column = chunk.at(instruction.path);
+                if (column->type().to_physical_type() == physical) {
+                    return {column->data<C>(), 1};
+                }
+                auto& buffer = buffers.emplace_back(count, resource);
+                types::simple_physical_type_switch<convert_to<C>::template callback>(column->type().to_physical_type(),
+                                                                                     *column,
+                                                                                     buffer.data(),
+                                                                                     count);
+                return {buffer.data(), 1};
+            };
+            auto* out = output.data<C>();
+
+            // Fused shapes: one pass, no buffers between the operators
+            if (code.size() == 3 && is_leaf(code[0].code) && is_leaf(code[1].code)) {
+                auto a = load(code[0]);
+                auto b = load(code[1]);
+                with_op<C>(code[2].code, [&](auto op) { run_binary(a, b, out, failed, count, op); });
+                return;
+            }
+            if (code.size() == 5 && is_leaf(code[0].code) && is_leaf(code[1].code) && !is_leaf(code[4].code) &&
+                code[4].code != opcode_t::negate) {
+                if (is_leaf(code[3].code) && code[2].code != opcode_t::negate) {
+                    auto a = load(code[0]);
+                    auto b = load(code[1]);
+                    auto c = load(code[3]);
+                    with_op<C>(code[2].code, [&](auto op1) {
+                        with_op<C>(code[4].code, [&](auto op2) {
+                            run_ternary<false>(a, b, c, out, failed, count, op1, op2);
+                        });
+                    });
+                    return;
+                }
+                if (is_leaf(code[2].code) && code[3].code != opcode_t::negate) {
+                    auto a = load(code[0]);
+                    auto b = load(code[1]);
+                    auto c = load(code[2]);
+                    with_op<C>(code[3].code, [&](auto op1) {
+                        with_op<C>(code[4].code, [&](auto op2) {
+                            run_ternary<true>(a, b, c, out, failed, count, op1, op2);
+                        });
+                    });
+                    return;
+                }
+            }
+
+            // Any other tree: stack machine over raw buffers
+            std::vector<operand_t<C>> stack;
+            stack.reserve(code.size());
+            for (size_t pc = 0; pc < code.size(); pc++) {
+                const auto& instruction = code[pc];
+                bool last = pc + 1 == code.size();
+                if (is_leaf(instruction.code)) {
+                    stack.push_back(load(instruction));
+                    continue;
+                }
+                C* target = last ? out : buffers.emplace_back(count, resource).data();
+                if (instruction.code == opcode_t::negate) {
+                    auto a = stack.back();
+                    for (uint64_t i = 0; i < count; i++) {
+                        target[i] = static_cast<C>(-a.data[i * a.stride]);
+                    }
+                    stack.back() = {target, 1};
+                    continue;
+                }
+                auto b = stack.back();
+                stack.pop_back();
+                auto a = stack.back();
+                with_op<C>(instruction.code, [&](auto op) { run_binary(a, b, target, failed, count, op); });
+                stack.back() = {target, 1};
+            }
+        }
+
+    } // namespace
+
+    expression_program_t::expression_program_t(types::complex_logical_type result_type)
+        : result_type_(std::move(result_type)) {}
+
+    std::optional<expression_program_t>
+    expression_program_t::compile(std::pmr::memory_resource* resource,
+                                  expressions::scalar_type op,
+                                  const std::pmr::vector<expressions::param_storage>& operands,
+                                  const vector::data_chunk_t& chunk,
+                                  const logical_plan::storage_parameters& params) {
+        std::vector<instruction_t> code;
+        compiler_t compiler(resource, chunk, params, code);
+        auto root = compiler.node(op, operands);
+        if (!root || root->folded || !compiler.has_column()) {
+            return std::nullopt;
+        }
+        if (root->type != types::logical_type::BIGINT && root->type != types::logical_type::DOUBLE) {
+            return std::nullopt;
+        }
+        // Every computed node works in the result type: `(a_int / b_int) * 1.5` must divide as integers
+        for (auto type : compiler.node_types()) {
+            if (type != root->type) {
+                return std::nullopt;
+            }
+        }
+        types::complex_logical_type result_type(root->type);
+        for (auto& instruction : code) {
+            if (instruction.code == opcode_t::constant) {
+                instruction.constant = instruction.constant.cast_as(result_type);
+            } else if (instruction.code == opcode_t::column && root->type == types::logical_type::BIGINT &&
+                       chunk.at(instruction.path)->type().type() == types::logical_type::UBIGINT) {
+                return std::nullopt;
+            }
+        }
+        // A division by a constant zero at the top reports an error outside the program
+        if ((op == expressions::scalar_type::divide || op == expressions::scalar_type::mod) && code.size() >= 2 &&
+            code[code.size() - 2].code == opcode_t::constant &&
+            code[code.size() - 2].constant == types::logical_value_t(resource, result_type)) {
+            return std::nullopt;
+        }
+
+        expression_program_t program(std::move(result_type));
+        program.code_ = std::move(code);
+        return program;
+    }
+
+    vector::vector_t expression_program_t::execute(std::pmr::memory_resource* resource,
+                                                   vector::data_chunk_t& chunk) const {
+        auto count = chunk.size();
+        vector::vector_t output(resource, result_type_, count);
+        if (count == 0) {
+            return output;
+        }
+        std::pmr::vector<uint8_t> failed(count, 0, resource);
+        if (result_type_.type() == types::logical_type::BIGINT) {
+            run_program<int64_t>(code_, resource, chunk, output, failed.data());
+        } else {
+            run_program<double>(code_, resource, chunk, output, failed.data());
+        }
+
+        auto& validity = output.validity();
+        for (const auto& instruction : code_) {
+            if (instruction.code != opcode_t::column) {
+                continue;
+            }
+            const auto& input = chunk.at(instruction.path)->validity();
+            if (input.all_valid()) {
+                continue;
+            }
+            for (uint64_t i = 0; i < count; i++) {
+                if (!input.row_is_valid(i)) {
+                    validity.set_invalid(i);
+                }
+            }
+        }
+        for (uint64_t i = 0; i < count; i++) {
+            if (failed[i]) {
+                validity.set_invalid(i);
+            }
+        }
+        return output;
+    }
+
+} // namespace components::operators
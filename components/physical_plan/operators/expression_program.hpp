@@ -0,0 +1,57 @@
+#pragma once
+
+#include <components/expressions/scalar_expression.hpp>
+#include <components/logical_plan/param_storage.hpp>
+#include <components/vector/data_chunk.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace components::operators {
+
+    // Arithmetic expression tree flattened into a postfix program computed in a single numeric
+    // type (BIGINT or DOUBLE). Parameter-only subtrees are folded into constants when compiled;
+    // `a op b`, `(a op b) op c` and `a op (b op c)` run as one fused loop over the input columns,
+    // other trees as a typed stack machine over raw buffers. NULL inputs give NULL, as does
+    // division or modulus by zero.
+    class expression_program_t {
+    public:
+        // std::nullopt when the tree has a node the program does not cover (CASE, non-flat or
+        // non-numeric columns, an intermediate type other than the result type, no columns at all)
+        static std::optional<expression_program_t>
+        compile(std::pmr::memory_resource* resource,
+                expressions::scalar_type op,
+                const std::pmr::vector<expressions::param_storage>& operands,
+                const vector::data_chunk_t& chunk,
+                const logical_plan::storage_parameters& params);
+
+        vector::vector_t execute(std::pmr::memory_resource* resource, vector::data_chunk_t& chunk) const;
+
+        const types::complex_logical_type& result_type() const noexcept { return result_type_; }
+
+        enum class opcode_t : uint8_t
+        {
+            column,
+            constant,
+            add,
+            subtract,
+            multiply,
+            divide,
+            mod,
+            negate
+        };
+
+        struct instruction_t {
+            opcode_t code;
+            std::pmr::vector<size_t> path;  // column
+            types::logical_value_t constant; // constant, already of the result type
+        };
+
+    private:
+        explicit expression_program_t(types::complex_logical_type result_type);
+
+        types::complex_logical_type result_type_;
+        std::vector<instruction_t> code_;
+    };
+
+} // namespace components::operators
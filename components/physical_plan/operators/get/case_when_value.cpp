@@ -1,5 +1,6 @@
 #include "case_when_value.hpp"
 
+#include <components/physical_plan/operators/arithmetic_eval.hpp>
 #include <expressions/compare_expression.hpp>
 
 namespace components::operators::get {
@@ -95,7 +96,8 @@ namespace components::operators::get {
                                                       std::move(clauses),
                                                       e_type,
                                                       e_index,
-                                                      storage_params));
+                                                      storage_params,
+                                                      params));
     }
 
     case_when_value_t::case_when_value_t(std::vector<expressions::key_t> result_keys,
@@ -104,7 +106,8 @@ namespace components::operators::get {
                                          std::vector<when_clause> clauses,
                                          else_kind else_type,
                                          size_t else_index,
-                                         const logical_plan::storage_parameters* storage_params)
+                                         const logical_plan::storage_parameters* storage_params,
+                                         std::pmr::vector<expressions::param_storage> params)
         : operator_get_t()
         , result_keys_(std::move(result_keys))
         , result_constants_(std::move(result_constants))
@@ -112,7 +115,8 @@ namespace components::operators::get {
         , clauses_(std::move(clauses))
         , else_type_(else_type)
         , else_index_(else_index)
-        , storage_params_(storage_params) {}
+        , storage_params_(storage_params)
+        , params_(std::move(params)) {}
 
     types::logical_value_t case_when_value_t::lookup_column(const expressions::key_t& key,
                                                             const std::pmr::vector<types::logical_value_t>& row) const {
@@ -232,4 +236,9 @@ namespace components::operators::get {
         }
     }
 
+    std::optional<vector::vector_t> case_when_value_t::get_column_impl(std::pmr::memory_resource* resource,
+                                                                       vector::data_chunk_t& chunk) {
+        return detail::evaluate_case_expr(resource, params_, chunk, *storage_params_);
+    }
+
 } // namespace components::operators::get
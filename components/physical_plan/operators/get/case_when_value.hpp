@@ -50,6 +50,8 @@ namespace components::operators::get {
         size_t else_index_{0};
 
         const logical_plan::storage_parameters* storage_params_{nullptr};
+        // Original operands, for the column-at-a-time form
+        std::pmr::vector<expressions::param_storage> params_;
 
         case_when_value_t(std::vector<expressions::key_t> result_keys,
                           std::vector<types::logical_value_t> result_constants,
@@ -57,10 +59,13 @@ namespace components::operators::get {
                           std::vector<when_clause> clauses,
                           else_kind else_type,
                           size_t else_index,
-                          const logical_plan::storage_parameters* storage_params);
+                          const logical_plan::storage_parameters* storage_params,
+                          std::pmr::vector<expressions::param_storage> params);
 
         std::vector<types::logical_value_t>
         get_values_impl(const std::pmr::vector<types::logical_value_t>& row) override;
+        std::optional<vector::vector_t> get_column_impl(std::pmr::memory_resource* resource,
+                                                        vector::data_chunk_t& chunk) override;
 
         types::logical_value_t lookup_column(const expressions::key_t& key,
                                              const std::pmr::vector<types::logical_value_t>& row) const;
@@ -1,5 +1,8 @@
 #include "coalesce_value.hpp"
 
+#include <components/physical_plan/operators/arithmetic_eval.hpp>
+
+#include <numeric>
 #include <stdexcept>
 
 namespace components::operators::get {
@@ -65,4 +68,72 @@ namespace components::operators::get {
         return {types::logical_value_t(resource, types::complex_logical_type{types::logical_type::NA})};
     }
 
+    std::optional<vector::vector_t> coalesce_value_t::get_column_impl(std::pmr::memory_resource* resource,
+                                                                      vector::data_chunk_t& chunk) {
+        if (entries_.empty()) {
+            return std::nullopt;
+        }
+        for (const auto& key : keys_) {
+            if (key.path().empty() || !chunk.at(key.path())) {
+                return std::nullopt;
+            }
+        }
+        auto entry_type = [&](const coalesce_entry& entry) -> const types::complex_logical_type& {
+            return entry.type == coalesce_entry::kind::key ? chunk.at(keys_[entry.index].path())->type()
+                                                           : constants_[entry.index].type();
+        };
+        // Result takes the common supertype of all arguments, and each is cast to it on write.
+        // Arguments promote_type can not widen (decimals, mixed kinds) fall back to the row-wise path
+        auto promotable = [](types::logical_type type) { return types::is_signed(type) || types::is_unsigned(type); };
+        types::complex_logical_type result_type;
+        for (const auto& entry : entries_) {
+            const auto& type = entry_type(entry);
+            if (type.type() == types::logical_type::NA || type == result_type) {
+                continue;
+            }
+            if (result_type.type() == types::logical_type::NA) {
+                result_type = type;
+            } else if ((promotable(type.type()) && promotable(result_type.type())) ||
+                       (types::is_duration(type.type()) && types::is_duration(result_type.type()))) {
+                result_type = types::complex_logical_type(types::promote_type(result_type.type(), type.type()));
+            } else {
+                return std::nullopt;
+            }
+        }
+
+        auto count = chunk.size();
+        vector::vector_t output(resource, result_type, count);
+        std::vector<uint64_t> remaining(count);
+        std::iota(remaining.begin(), remaining.end(), uint64_t{0});
+        std::vector<uint64_t> still_null;
+        logical_plan::storage_parameters no_params(resource);
+        for (const auto& entry : entries_) {
+            if (remaining.empty()) {
+                break;
+            }
+            if (entry.type == coalesce_entry::kind::constant) {
+                const auto& value = constants_[entry.index];
+                for (auto row : remaining) {
+                    output.set_value(row, value);
+                }
+                remaining.clear();
+                break;
+            }
+            // Only the rows every previous argument left NULL are read from this column
+            auto values = detail::evaluate_on_rows(resource, keys_[entry.index], chunk, no_params, remaining);
+            detail::scatter_rows(values, output, remaining);
+            still_null.clear();
+            for (uint64_t k = 0; k < remaining.size(); k++) {
+                if (!values.validity().row_is_valid(k)) {
+                    still_null.push_back(remaining[k]);
+                }
+            }
+            std::swap(remaining, still_null);
+        }
+        for (auto row : remaining) {
+            output.validity().set_invalid(row);
+        }
+        return output;
+    }
+
 } // namespace components::operators::get
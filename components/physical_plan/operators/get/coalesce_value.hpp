@@ -33,6 +33,8 @@ namespace components::operators::get {
 
         std::vector<types::logical_value_t>
         get_values_impl(const std::pmr::vector<types::logical_value_t>& row) override;
+        std::optional<vector::vector_t> get_column_impl(std::pmr::memory_resource* resource,
+                                                        vector::data_chunk_t& chunk) override;
     };
 
 } // namespace components::operators::get
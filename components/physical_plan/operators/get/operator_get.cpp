@@ -6,4 +6,13 @@ namespace components::operators::get {
         return get_values_impl(row);
     }
 
+    std::optional<vector::vector_t> operator_get_t::values(std::pmr::memory_resource* resource,
+                                                           vector::data_chunk_t& chunk) {
+        return get_column_impl(resource, chunk);
+    }
+
+    std::optional<vector::vector_t> operator_get_t::get_column_impl(std::pmr::memory_resource*, vector::data_chunk_t&) {
+        return std::nullopt;
+    }
+
 } // namespace components::operators::get
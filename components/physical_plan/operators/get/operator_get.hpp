@@ -2,11 +2,16 @@
 
 #include <components/physical_plan/operators/operator.hpp>
 
+#include <optional>
+
 namespace components::operators::get {
 
     class operator_get_t : public boost::intrusive_ref_counter<operator_get_t> {
     public:
         std::vector<types::logical_value_t> values(const std::pmr::vector<types::logical_value_t>& row);
+        // One value per row of `chunk` computed column-at-a-time, or std::nullopt when
+        // the getter only has the row form
+        std::optional<vector::vector_t> values(std::pmr::memory_resource* resource, vector::data_chunk_t& chunk);
 
         operator_get_t(const operator_get_t&) = delete;
         operator_get_t& operator=(const operator_get_t&) = delete;
@@ -18,6 +23,8 @@ namespace components::operators::get {
     private:
         virtual std::vector<types::logical_value_t>
         get_values_impl(const std::pmr::vector<types::logical_value_t>& row) = 0;
+        virtual std::optional<vector::vector_t> get_column_impl(std::pmr::memory_resource* resource,
+                                                                vector::data_chunk_t& chunk);
     };
 
     using operator_get_ptr = boost::intrusive_ptr<operator_get_t>;
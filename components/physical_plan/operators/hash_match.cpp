@@ -0,0 +1,173 @@
+#include "hash_match.hpp"
+#include "predicates/predicate.hpp"
+
+#include <components/vector/vector_operations.hpp>
+
+#include <unordered_map>
+
+namespace components::operators {
+
+    namespace {
+
+        struct value_hash_t {
+            size_t operator()(const types::logical_value_t& value) const noexcept { return value.hash(); }
+        };
+
+        // Column hashes are already mixed
+        struct identity_hash_t {
+            size_t operator()(uint64_t hash) const noexcept { return static_cast<size_t>(hash); }
+        };
+
+        vector::vector_t
+        column_hashes(std::pmr::memory_resource* resource, const vector::vector_t& column, size_t count) {
+            vector::vector_t input(column);
+            vector::vector_t hashes(resource, types::logical_type::UBIGINT, count);
+            vector::vector_ops::hash(input, hashes, count);
+            hashes.flatten(count);
+            return hashes;
+        }
+
+        // Left and right column of an equi-join condition
+        struct join_keys_t {
+            const expressions::key_t* left{nullptr};
+            const expressions::key_t* right{nullptr};
+        };
+
+        bool find_join_keys(const expressions::compare_expression_t* compare, join_keys_t& keys) {
+            using namespace expressions;
+            if (compare->type() == compare_type::union_and) {
+                for (const auto& child : compare->children()) {
+                    if (child->group() == expression_group::compare &&
+                        find_join_keys(static_cast<const compare_expression_t*>(child.get()), keys)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            if (compare->type() != compare_type::eq || !std::holds_alternative<key_t>(compare->left()) ||
+                !std::holds_alternative<key_t>(compare->right())) {
+                return false;
+            }
+            const auto* left = &std::get<key_t>(compare->left());
+            const auto* right = &std::get<key_t>(compare->right());
+            if (left->side() == side_t::right) {
+                std::swap(left, right);
+            }
+            if (left->side() != side_t::left || right->side() != side_t::right || left->path().empty() ||
+                right->path().empty()) {
+                return false;
+            }
+            keys.left = left;
+            keys.right = right;
+            return true;
+        }
+
+    } // namespace
+
+    void hash_match(std::pmr::memory_resource* resource,
+                    const compute::function_registry_t* function_registry,
+                    const expressions::expression_ptr& expression,
+                    const vector::data_chunk_t& chunk_left,
+                    const vector::data_chunk_t& chunk_right,
+                    const logical_plan::storage_parameters* parameters,
+                    bool first_match_only,
+                    std::vector<uint64_t>& rows_left,
+                    std::vector<uint64_t>& rows_right) {
+        rows_left.clear();
+        rows_right.clear();
+        auto predicate = expression ? predicates::create_predicate(resource,
+                                                                   function_registry,
+                                                                   expression,
+                                                                   chunk_left.types(),
+                                                                   chunk_right.types(),
+                                                                   parameters)
+                                    : predicates::create_all_true_predicate(resource);
+
+        join_keys_t keys;
+        const vector::vector_t* left_column = nullptr;
+        const vector::vector_t* right_column = nullptr;
+        if (expression && expression->group() == expressions::expression_group::compare &&
+            find_join_keys(static_cast<const expressions::compare_expression_t*>(expression.get()), keys)) {
+            left_column = chunk_left.at(keys.left->path());
+            right_column = chunk_right.at(keys.right->path());
+            // Values are hashed in the right column's type; other type pairs keep the pairwise loop
+            if (left_column && right_column && left_column->type().type() != right_column->type().type() &&
+                !(types::is_numeric(left_column->type().type()) && types::is_numeric(right_column->type().type()))) {
+                left_column = nullptr;
+            }
+        }
+
+        if (!left_column || !right_column) {
+            for (size_t i = 0; i < chunk_left.size(); i++) {
+                for (size_t j = 0; j < chunk_right.size(); j++) {
+                    if (predicate->check(chunk_left, chunk_right, i, j)) {
+                        rows_left.emplace_back(i);
+                        rows_right.emplace_back(j);
+                        if (first_match_only) {
+                            break;
+                        }
+                    }
+                }
+            }
+            return;
+        }
+
+        auto probe = [&](size_t i, const std::vector<uint64_t>& candidates) {
+            for (auto j : candidates) {
+                if (predicate->check(chunk_left, chunk_right, i, j)) {
+                    rows_left.emplace_back(i);
+                    rows_right.emplace_back(j);
+                    if (first_match_only) {
+                        break;
+                    }
+                }
+            }
+        };
+
+        // Build over the right rows; null keys never compare equal and stay out of the table
+        if (left_column->type().type() == right_column->type().type()) {
+            // Same key type: bucket by the vectorized column hash, the predicate weeds out collisions
+            auto right_hashes = column_hashes(resource, *right_column, chunk_right.size());
+            auto left_hashes = column_hashes(resource, *left_column, chunk_left.size());
+            std::unordered_map<uint64_t, std::vector<uint64_t>, identity_hash_t> table;
+            table.reserve(chunk_right.size());
+            for (size_t j = 0; j < chunk_right.size(); j++) {
+                if (!right_column->is_null(j)) {
+                    table[right_hashes.data<uint64_t>()[j]].emplace_back(j);
+                }
+            }
+            for (size_t i = 0; i < chunk_left.size(); i++) {
+                if (left_column->is_null(i)) {
+                    continue;
+                }
+                auto it = table.find(left_hashes.data<uint64_t>()[i]);
+                if (it != table.end()) {
+                    probe(i, it->second);
+                }
+            }
+            return;
+        }
+
+        std::unordered_map<types::logical_value_t, std::vector<uint64_t>, value_hash_t> table;
+        table.reserve(chunk_right.size());
+        for (size_t j = 0; j < chunk_right.size(); j++) {
+            auto value = right_column->value(j);
+            if (!value.is_null()) {
+                table[std::move(value)].emplace_back(j);
+            }
+        }
+
+        const auto& key_type = right_column->type();
+        for (size_t i = 0; i < chunk_left.size(); i++) {
+            auto value = left_column->value(i);
+            if (value.is_null()) {
+                continue;
+            }
+            auto it = table.find(value.cast_as(key_type));
+            if (it != table.end()) {
+                probe(i, it->second);
+            }
+        }
+    }
+
+} // namespace components::operators
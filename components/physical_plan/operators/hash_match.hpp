@@ -0,0 +1,28 @@
+#pragma once
+
+#include <components/compute/function.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/param_storage.hpp>
+#include <components/vector/data_chunk.hpp>
+
+#include <vector>
+
+namespace components::operators {
+
+    // Pairs the rows of `chunk_left` and `chunk_right` that satisfy `expression` (all pairs when it is null).
+    // An equality between a left and a right column, alone or as a conjunct of an AND, is answered
+    // through a hash table built over the right rows; only those candidates are checked against the
+    // whole predicate. Other predicates fall back to testing every pair. With `first_match_only` a
+    // left row is paired with its first matching right row at most, as UPDATE ... FROM and
+    // DELETE ... USING need. Pairs come out ordered by left row.
+    void hash_match(std::pmr::memory_resource* resource,
+                    const compute::function_registry_t* function_registry,
+                    const expressions::expression_ptr& expression,
+                    const vector::data_chunk_t& chunk_left,
+                    const vector::data_chunk_t& chunk_right,
+                    const logical_plan::storage_parameters* parameters,
+                    bool first_match_only,
+                    std::vector<uint64_t>& rows_left,
+                    std::vector<uint64_t>& rows_right);
+
+} // namespace components::operators
@@ -1,4 +1,5 @@
 #include "operator_delete.hpp"
+#include "hash_match.hpp"
 #include "predicates/predicate.hpp"
 
 namespace components::operators {
@@ -19,33 +20,26 @@ namespace components::operators {
             auto& chunk_left = left_->output()->data_chunk();
             auto& chunk_right = right_->output()->data_chunk();
             auto types_left = chunk_left.types();
-            auto types_right = chunk_right.types();
-            auto ids_capacity = vector::DEFAULT_VECTOR_CAPACITY;
-            vector::vector_t ids(left_->output()->resource(), types::logical_type::BIGINT, ids_capacity);
-            auto predicate = expression_ ? predicates::create_predicate(left_->output()->resource(),
-                                                                        pipeline_context->function_registry,
-                                                                        expression_,
-                                                                        types_left,
-                                                                        types_right,
-                                                                        &pipeline_context->parameters)
-                                         : predicates::create_all_true_predicate(output_->resource());
 
-            size_t index = 0;
-            for (size_t i = 0; i < chunk_left.size(); i++) {
-                for (size_t j = 0; j < chunk_right.size(); j++) {
-                    if (predicate->check(chunk_left, chunk_right, i, j)) {
-                        ids.data<int64_t>()[index++] = static_cast<int64_t>(i);
-                        if (index >= ids_capacity) {
-                            ids.resize(ids_capacity, ids_capacity * 2);
-                            ids_capacity *= 2;
-                        }
-                    }
-                }
-            }
-            for (size_t i = 0; i < index; i++) {
-                size_t id = static_cast<size_t>(ids.data<int64_t>()[i]);
-                modified_->append(id);
+            // A target row is deleted once, however many source rows it matches
+            std::vector<uint64_t> rows_left;
+            std::vector<uint64_t> rows_right;
+            hash_match(left_->output()->resource(),
+                       pipeline_context->function_registry,
+                       expression_,
+                       chunk_left,
+                       chunk_right,
+                       &pipeline_context->parameters,
+                       true,
+                       rows_left,
+                       rows_right);
+
+            bool dictionary = chunk_left.data.front().get_vector_type() == vector::vector_type::DICTIONARY;
+            for (auto i : rows_left) {
+                modified_->append(dictionary ? chunk_left.data.front().indexing().get_index(i)
+                                             : static_cast<size_t>(chunk_left.row_ids.data<int64_t>()[i]));
             }
+            size_t index = rows_left.size();
             for (const auto& type : types_left) {
                 modified_->updated_types_map()[{std::pmr::string(type.alias(), left_->output()->resource()), type}] +=
                     index;
@@ -1,10 +1,78 @@
 #include "operator_distinct.hpp"
 
-#include <sstream>
-#include <unordered_set>
+#include <components/vector/vector_hash.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
 
 namespace components::operators {
 
+    namespace {
+
+        // Whether vector_ops::hash has a loop for the type and everything nested in it
+        bool vector_hashable(const types::complex_logical_type& type) {
+            return !types::complex_logical_type::contains(type, [](const types::complex_logical_type& t) {
+                switch (t.to_physical_type()) {
+                    case types::physical_type::BOOL:
+                    case types::physical_type::INT8:
+                    case types::physical_type::INT16:
+                    case types::physical_type::INT32:
+                    case types::physical_type::INT64:
+                    case types::physical_type::UINT8:
+                    case types::physical_type::UINT16:
+                    case types::physical_type::UINT32:
+                    case types::physical_type::UINT64:
+                    case types::physical_type::INT128:
+                    case types::physical_type::UINT128:
+                    case types::physical_type::FLOAT:
+                    case types::physical_type::DOUBLE:
+                    case types::physical_type::STRING:
+                    case types::physical_type::STRUCT:
+                    case types::physical_type::LIST:
+                    case types::physical_type::ARRAY:
+                        return false;
+                    default:
+                        return true;
+                }
+            });
+        }
+
+        // Equality that agrees with the hashes: NULLs are equal, every NaN is one value and
+        // -0.0 equals 0.0, also inside nested values
+        bool values_equal(const types::logical_value_t& a, const types::logical_value_t& b) {
+            if (a.is_null() || b.is_null()) {
+                return a.is_null() && b.is_null();
+            }
+            if (a.type().type() != b.type().type()) {
+                return a == b;
+            }
+            switch (a.type().type()) {
+                case types::logical_type::FLOAT: {
+                    auto x = a.value<float>();
+                    auto y = b.value<float>();
+                    return x == y || (std::isnan(x) && std::isnan(y));
+                }
+                case types::logical_type::DOUBLE: {
+                    auto x = a.value<double>();
+                    auto y = b.value<double>();
+                    return x == y || (std::isnan(x) && std::isnan(y));
+                }
+                case types::logical_type::STRUCT:
+                case types::logical_type::LIST:
+                case types::logical_type::ARRAY:
+                case types::logical_type::MAP: {
+                    const auto& lhs = a.children();
+                    const auto& rhs = b.children();
+                    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), values_equal);
+                }
+                default:
+                    return a == b;
+            }
+        }
+
+    } // namespace
+
     operator_distinct_t::operator_distinct_t(std::pmr::memory_resource* resource, log_t log)
         : read_only_operator_t(resource, log, operator_type::match) {}
 
@@ -12,75 +80,56 @@ namespace components::operators {
         if (!left_ || !left_->output()) {
             return;
         }
-        const auto& chunk = left_->output()->data_chunk();
+        auto& chunk = left_->output()->data_chunk();
         auto types = chunk.types();
         output_ = operators::make_operator_data(left_->output()->resource(), types, chunk.size());
         auto& out_chunk = output_->data_chunk();
+        if (chunk.size() == 0 || chunk.column_count() == 0) {
+            return;
+        }
 
-        std::unordered_set<std::string> seen;
-        size_t count = 0;
+        // Rows are bucketed by the hash of all their columns; a row is new unless it equals one
+        // of the rows kept under its hash. NULLs hash alike and count as equal here. Types the
+        // vector hash has no loop for are hashed value by value.
+        std::vector<uint64_t> hash_data(chunk.size());
+        if (std::all_of(types.begin(), types.end(), vector_hashable)) {
+            vector::vector_t hashes(resource_, types::logical_type::UBIGINT, chunk.size());
+            chunk.hash(hashes);
+            hashes.flatten(chunk.size());
+            std::copy_n(hashes.data<uint64_t>(), chunk.size(), hash_data.begin());
+        } else {
+            for (size_t i = 0; i < chunk.size(); i++) {
+                uint64_t h = 0;
+                for (size_t j = 0; j < chunk.column_count(); j++) {
+                    auto value = chunk.data[j].value(i);
+                    h = vector::hash_combine(h, value.is_null() ? vector::NULL_HASH : vector::hash_mix(value.hash()));
+                }
+                hash_data[i] = h;
+            }
+        }
 
-        for (size_t i = 0; i < chunk.size(); i++) {
-            // Build a key from all column values
-            std::ostringstream key;
+        auto rows_equal = [&chunk](size_t a, size_t b) {
             for (size_t j = 0; j < chunk.column_count(); j++) {
-                auto val = chunk.data[j].value(i);
-                if (val.is_null()) {
-                    key << "\0NULL\0";
-                } else {
-                    key << static_cast<int>(val.type().type()) << ":";
-                    // Use comparison-based identity — serialize through the value's type
-                    switch (val.type().to_physical_type()) {
-                        case types::physical_type::INT8:
-                            key << val.value<int8_t>();
-                            break;
-                        case types::physical_type::INT16:
-                            key << val.value<int16_t>();
-                            break;
-                        case types::physical_type::INT32:
-                            key << val.value<int32_t>();
-                            break;
-                        case types::physical_type::INT64:
-                            key << val.value<int64_t>();
-                            break;
-                        case types::physical_type::UINT8:
-                            key << val.value<uint8_t>();
-                            break;
-                        case types::physical_type::UINT16:
-                            key << val.value<uint16_t>();
-                            break;
-                        case types::physical_type::UINT32:
-                            key << val.value<uint32_t>();
-                            break;
-                        case types::physical_type::UINT64:
-                            key << val.value<uint64_t>();
-                            break;
-                        case types::physical_type::FLOAT:
-                            key << val.value<float>();
-                            break;
-                        case types::physical_type::DOUBLE:
-                            key << val.value<double>();
-                            break;
-                        case types::physical_type::BOOL:
-                            key << val.value<bool>();
-                            break;
-                        case types::physical_type::STRING:
-                            key << val.value<std::string_view>();
-                            break;
-                        default:
-                            key << "?";
-                            break;
-                    }
+                if (!values_equal(chunk.data[j].value(a), chunk.data[j].value(b))) {
+                    return false;
                 }
-                key << "|";
             }
+            return true;
+        };
 
-            if (seen.insert(key.str()).second) {
-                for (size_t j = 0; j < chunk.column_count(); j++) {
-                    out_chunk.set_value(j, count, chunk.data[j].value(i));
-                }
-                ++count;
+        std::unordered_map<uint64_t, std::vector<size_t>> seen;
+        seen.reserve(chunk.size());
+        size_t count = 0;
+        for (size_t i = 0; i < chunk.size(); i++) {
+            auto& kept = seen[hash_data[i]];
+            if (std::any_of(kept.begin(), kept.end(), [&](size_t k) { return rows_equal(i, k); })) {
+                continue;
+            }
+            kept.push_back(i);
+            for (size_t j = 0; j < chunk.column_count(); j++) {
+                out_chunk.set_value(j, count, chunk.data[j].value(i));
             }
+            ++count;
         }
         out_chunk.set_cardinality(count);
     }
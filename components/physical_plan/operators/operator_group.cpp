@@ -213,6 +213,18 @@ namespace components::operators {
             }
         } else {
             // Slow path: getter-based key extraction (handles wildcards, nested paths, etc.)
+            // Getters with a column form (CASE, COALESCE) are evaluated once for the whole chunk
+            std::vector<std::optional<vector::vector_t>> key_columns;
+            bool need_rows = false;
+            if (!use_fast_path) {
+                key_columns.reserve(keys_.size());
+                for (const auto& key : keys_) {
+                    key_columns.push_back(key.getter->values(resource_, chunk));
+                    if (!key_columns.back()) {
+                        need_rows = true;
+                    }
+                }
+            }
             for (size_t row_idx = 0; row_idx < num_rows; row_idx++) {
                 std::pmr::vector<types::logical_value_t> key_vals(resource_);
                 bool is_valid = true;
@@ -232,11 +244,20 @@ namespace components::operators {
                     }
                 } else {
                     std::pmr::vector<types::logical_value_t> row(resource_);
-                    row.reserve(chunk.column_count());
-                    for (size_t col_idx = 0; col_idx < chunk.column_count(); col_idx++) {
-                        row.push_back(chunk.value(col_idx, row_idx));
+                    if (need_rows) {
+                        row.reserve(chunk.column_count());
+                        for (size_t col_idx = 0; col_idx < chunk.column_count(); col_idx++) {
+                            row.push_back(chunk.value(col_idx, row_idx));
+                        }
                     }
-                    for (const auto& key : keys_) {
+                    for (size_t key_i = 0; key_i < keys_.size(); key_i++) {
+                        const auto& key = keys_[key_i];
+                        if (key_columns[key_i]) {
+                            auto val = key_columns[key_i]->value(row_idx);
+                            val.set_alias(std::string{key.name});
+                            key_vals.push_back(std::move(val));
+                            continue;
+                        }
                         auto values = key.getter->values(row);
                         if (values.empty()) {
                             is_valid = false;
@@ -1,6 +1,12 @@
 #include "operator_join.hpp"
 
+#include <components/index/index.hpp>
 #include <components/vector/vector_operations.hpp>
+#include <services/disk/manager_disk.hpp>
+#include <services/index/manager_index.hpp>
+
+#include <algorithm>
+#include <map>
 #include <vector>
 
 namespace components::operators {
@@ -13,7 +19,66 @@ namespace components::operators {
         , join_type_(join_type)
         , expression_(expression) {}
 
+    void operator_join_t::set_index_lookup(collection_full_name_t right_name,
+                                           logical_plan::keys_base_storage_t index_keys,
+                                           types::complex_logical_type key_type,
+                                           expressions::key_t left_key) {
+        assert(join_type_ == type::inner && !index_keys.empty());
+        lookup_name_ = std::move(right_name);
+        lookup_keys_ = std::move(index_keys);
+        lookup_key_type_ = std::move(key_type);
+        lookup_left_key_.emplace(std::move(left_key));
+    }
+
+    void operator_join_t::init_indices_(size_t left_columns, size_t right_columns) {
+        indices_left_.clear();
+        indices_right_.clear();
+        indices_left_.reserve(left_columns);
+        indices_right_.reserve(right_columns);
+        for (size_t i = 0; i < left_columns; i++) {
+            indices_left_.emplace_back(i);
+        }
+        for (size_t i = 0; i < right_columns; i++) {
+            indices_right_.emplace_back(left_columns + i);
+        }
+    }
+
+    void operator_join_t::copy_rows_(const vector::data_chunk_t& chunk_left,
+                                     const vector::data_chunk_t& chunk_right,
+                                     std::vector<uint64_t>& rows_left,
+                                     std::vector<uint64_t>& rows_right) {
+        auto& chunk_res = output_->data_chunk();
+        size_t res_count = rows_left.size();
+        vector::validate_chunk_capacity(chunk_res, res_count);
+        vector::indexing_vector_t left_indexing(output_->resource(), rows_left.data());
+        vector::indexing_vector_t right_indexing(output_->resource(), rows_right.data());
+        for (size_t i = 0; i < chunk_left.column_count(); i++) {
+            vector::vector_ops::copy(chunk_left.data[i],
+                                     chunk_res.data[indices_left_.at(i)],
+                                     left_indexing,
+                                     res_count,
+                                     0,
+                                     0);
+        }
+        for (size_t i = 0; i < chunk_right.column_count(); i++) {
+            vector::vector_ops::copy(chunk_right.data[i],
+                                     chunk_res.data[indices_right_.at(i)],
+                                     right_indexing,
+                                     res_count,
+                                     0,
+                                     0);
+        }
+        chunk_res.set_cardinality(res_count);
+    }
+
     void operator_join_t::on_execute_impl(pipeline::context_t* context) {
+        if (is_index_lookup()) {
+            // The right side is read in await_async_and_resume, once the left keys are known
+            if (left_ && left_->output() && !lookup_name_.empty()) {
+                async_wait();
+            }
+            return;
+        }
         if (!left_ || !right_) {
             return;
         }
@@ -32,16 +97,7 @@ namespace components::operators {
                 trace(log(), "operator_join::right_size(): {}", chunk_right.size());
             }
 
-            indices_left_.clear();
-            indices_right_.clear();
-            indices_left_.reserve(chunk_left.column_count());
-            indices_right_.reserve(chunk_right.column_count());
-            for (size_t i = 0; i < chunk_left.column_count(); i++) {
-                indices_left_.emplace_back(i);
-            }
-            for (size_t i = 0; i < chunk_right.column_count(); i++) {
-                indices_right_.emplace_back(chunk_left.column_count() + i);
-            }
+            init_indices_(chunk_left.column_count(), chunk_right.column_count());
 
             auto predicate = expression_ ? predicates::create_predicate(left_->output()->resource(),
                                                                         context->function_registry,
@@ -80,42 +136,147 @@ namespace components::operators {
     void operator_join_t::inner_join_(const predicates::predicate_ptr& predicate, pipeline::context_t*) {
         const auto& chunk_left = left_->output()->data_chunk();
         const auto& chunk_right = right_->output()->data_chunk();
-        auto& chunk_res = output_->data_chunk();
 
         std::vector<uint64_t> copy_indices_left;
         std::vector<uint64_t> copy_indices_right;
 
-        size_t res_count = 0;
         for (size_t i = 0; i < chunk_left.size(); i++) {
             for (size_t j = 0; j < chunk_right.size(); j++) {
                 if (predicate->check(chunk_left, chunk_right, i, j)) {
                     copy_indices_left.emplace_back(i);
                     copy_indices_right.emplace_back(j);
-                    ++res_count;
                 }
             }
         }
+        copy_rows_(chunk_left, chunk_right, copy_indices_left, copy_indices_right);
+    }
 
-        vector::validate_chunk_capacity(chunk_res, res_count);
-        vector::indexing_vector_t left_indexing(output_->resource(), copy_indices_left.data());
-        vector::indexing_vector_t right_indexing(output_->resource(), copy_indices_right.data());
-        for (size_t i = 0; i < chunk_left.column_count(); i++) {
-            vector::vector_ops::copy(chunk_left.data[i],
-                                     chunk_res.data[indices_left_.at(i)],
-                                     left_indexing,
-                                     res_count,
-                                     0,
-                                     0);
+    actor_zeta::unique_future<void> operator_join_t::await_async_and_resume(pipeline::context_t* ctx) {
+        const auto& chunk_left = left_->output()->data_chunk();
+        const auto* left_column = chunk_left.at(lookup_left_key_->path());
+
+        auto [_t, tf] = actor_zeta::send(ctx->disk_address,
+                                         &services::disk::manager_disk_t::storage_types,
+                                         ctx->session,
+                                         lookup_name_);
+        auto right_types = co_await std::move(tf);
+        auto res_types = chunk_left.types();
+        res_types.insert(res_types.end(), right_types.begin(), right_types.end());
+        output_ = operators::make_operator_data(resource_, res_types);
+        init_indices_(chunk_left.column_count(), right_types.size());
+
+        // One point per distinct non-null left key; nulls never match an equality
+        std::pmr::vector<types::logical_value_t> points(resource_);
+        points.reserve(chunk_left.size());
+        for (size_t i = 0; i < chunk_left.size(); i++) {
+            auto value = left_column->value(i);
+            if (value.is_null()) {
+                continue;
+            }
+            if (auto point = index::exact_index_probe(value, lookup_key_type_)) {
+                points.emplace_back(std::move(*point));
+            }
         }
-        for (size_t i = 0; i < chunk_right.column_count(); i++) {
-            vector::vector_ops::copy(chunk_right.data[i],
-                                     chunk_res.data[indices_right_.at(i)],
-                                     right_indexing,
-                                     res_count,
-                                     0,
-                                     0);
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+
+        if (points.empty() || ctx->index_address == actor_zeta::address_t::empty_address()) {
+            mark_executed();
+            co_return;
         }
-        chunk_res.set_cardinality(res_count);
+
+        std::pmr::vector<index::index_range_t> ranges(resource_);
+        ranges.reserve(points.size());
+        for (const auto& point : points) {
+            ranges.push_back(index::index_range_t::point(point));
+        }
+        bool in_txn = ctx->txn.transaction_id != 0;
+        auto [_s, sf] = actor_zeta::send(ctx->index_address,
+                                         &services::index::manager_index_t::search_ranges,
+                                         ctx->session,
+                                         lookup_name_,
+                                         lookup_keys_,
+                                         std::move(ranges),
+                                         true,
+                                         in_txn ? ctx->txn.start_time : uint64_t{0},
+                                         ctx->txn.transaction_id);
+        auto found = co_await std::move(sf);
+        if (log_.is_valid()) {
+            trace(log(), "operator_join: {} keys matched {} rows by index", points.size(), found.row_ids.size());
+        }
+        if (found.row_ids.empty()) {
+            mark_executed();
+            co_return;
+        }
+
+        vector::vector_t row_ids(resource_, types::logical_type::BIGINT, found.row_ids.size());
+        for (size_t i = 0; i < found.row_ids.size(); i++) {
+            row_ids.set_value(i, types::logical_value_t{resource_, found.row_ids[i]});
+        }
+        auto [_f, ff] = actor_zeta::send(ctx->disk_address,
+                                         &services::disk::manager_disk_t::storage_fetch,
+                                         ctx->session,
+                                         lookup_name_,
+                                         std::move(row_ids),
+                                         found.row_ids.size());
+        auto data = co_await std::move(ff);
+        if (!data) {
+            mark_executed();
+            co_return;
+        }
+        const auto& chunk_right = *data;
+
+        // Fetched rows line up with the index hits, each carrying the key it was found by; the
+        // join predicate still decides, the key map only narrows the candidates. Should storage
+        // drop a row the map is useless and every fetched row is a candidate.
+        std::map<types::logical_value_t, std::vector<uint64_t>> by_key;
+        std::vector<uint64_t> all_rows;
+        bool aligned = chunk_right.size() == found.keys.size();
+        for (size_t j = 0; j < chunk_right.size(); j++) {
+            if (aligned) {
+                by_key[found.keys[j]].push_back(j);
+            } else {
+                all_rows.push_back(j);
+            }
+        }
+        auto predicate = predicates::create_predicate(resource_,
+                                                      ctx->function_registry,
+                                                      expression_,
+                                                      chunk_left.types(),
+                                                      chunk_right.types(),
+                                                      &ctx->parameters);
+
+        std::vector<uint64_t> copy_indices_left;
+        std::vector<uint64_t> copy_indices_right;
+        for (size_t i = 0; i < chunk_left.size(); i++) {
+            auto value = left_column->value(i);
+            if (value.is_null()) {
+                continue;
+            }
+            const std::vector<uint64_t>* candidates = &all_rows;
+            if (aligned) {
+                // a schemaless collection leaves the key type to the keys found
+                const auto& key_type = lookup_key_type_.type() == types::logical_type::NA
+                                           ? by_key.begin()->first.type()
+                                           : lookup_key_type_;
+                auto probe = index::exact_index_probe(value, key_type);
+                auto it = probe ? by_key.find(*probe) : by_key.end();
+                if (it == by_key.end()) {
+                    continue;
+                }
+                candidates = &it->second;
+            }
+            for (auto j : *candidates) {
+                if (predicate->check(chunk_left, chunk_right, i, j)) {
+                    copy_indices_left.emplace_back(i);
+                    copy_indices_right.emplace_back(j);
+                }
+            }
+        }
+        copy_rows_(chunk_left, chunk_right, copy_indices_left, copy_indices_right);
+
+        mark_executed();
+        co_return;
     }
 
     void operator_join_t::outer_full_join_(const predicates::predicate_ptr& predicate, pipeline::context_t*) {
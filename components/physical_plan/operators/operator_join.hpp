@@ -1,10 +1,13 @@
 #pragma once
 
 #include "predicates/predicate.hpp"
+#include <components/logical_plan/node_create_index.hpp>
 #include <components/logical_plan/node_join.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 #include <expressions/compare_expression.hpp>
 
+#include <optional>
+
 namespace components::operators {
 
     class operator_join_t final : public read_only_operator_t {
@@ -16,13 +19,35 @@ namespace components::operators {
                         type join_type,
                         const expressions::expression_ptr& expression);
 
+        // Index nested-loop mode for an inner equi-join: the join has only a left child, every
+        // distinct value of `left_key` is probed in the index `index_keys` of `right_name` and
+        // only the matching right rows are fetched from storage. Left values are probed as values
+        // of `key_type`, the type of the indexed column; values with no exact counterpart match nothing.
+        void set_index_lookup(collection_full_name_t right_name,
+                              logical_plan::keys_base_storage_t index_keys,
+                              types::complex_logical_type key_type,
+                              expressions::key_t left_key);
+        bool is_index_lookup() const noexcept { return lookup_left_key_.has_value(); }
+
+        actor_zeta::unique_future<void> await_async_and_resume(pipeline::context_t* ctx) override;
+
     private:
         type join_type_;
         expressions::expression_ptr expression_;
         std::vector<size_t> indices_left_;
         std::vector<size_t> indices_right_;
 
+        collection_full_name_t lookup_name_;
+        logical_plan::keys_base_storage_t lookup_keys_;
+        types::complex_logical_type lookup_key_type_;
+        std::optional<expressions::key_t> lookup_left_key_;
+
         void on_execute_impl(pipeline::context_t* context) override;
+        void init_indices_(size_t left_columns, size_t right_columns);
+        void copy_rows_(const vector::data_chunk_t& chunk_left,
+                        const vector::data_chunk_t& chunk_right,
+                        std::vector<uint64_t>& rows_left,
+                        std::vector<uint64_t>& rows_right);
         void inner_join_(const predicates::predicate_ptr&, pipeline::context_t* context);
         void outer_full_join_(const predicates::predicate_ptr&, pipeline::context_t* context);
         void outer_left_join_(const predicates::predicate_ptr&, pipeline::context_t* context);
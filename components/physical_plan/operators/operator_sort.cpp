@@ -1,5 +1,9 @@
 #include "operator_sort.hpp"
 
+#include <components/physical_plan/operators/sort/normalized_sort.hpp>
+
+#include <core/scheduler/task_pool.hpp>
+
 namespace components::operators {
 
     operator_sort_t::operator_sort_t(std::pmr::memory_resource* resource, log_t log)
@@ -9,7 +13,7 @@ namespace components::operators {
 
     void operator_sort_t::add(const std::pmr::vector<size_t>& col_path, order order_) { sorter_.add(col_path, order_); }
 
-    void operator_sort_t::on_execute_impl(pipeline::context_t*) {
+    void operator_sort_t::on_execute_impl(pipeline::context_t* pipeline_context) {
         if (left_ && left_->output()) {
             auto& chunk = left_->output()->data_chunk();
             auto num_rows = chunk.size();
@@ -23,7 +27,19 @@ namespace components::operators {
             // 1. Create index array [0, 1, 2, ..., N-1] and sort
             vector::indexing_vector_t indexing(resource_, uint64_t(0), num_rows);
             sorter_.set_chunk(chunk);
-            std::sort(indexing.data(), indexing.data() + num_rows, std::ref(sorter_));
+            auto* task_pool = pipeline_context ? pipeline_context->task_pool : nullptr;
+            sort::normalized_sorter_t normalized(resource_, sorter_);
+            if (normalized.is_supported()) {
+                normalized.sort(num_rows, indexing.data(), task_pool, parallel_sort_min_run);
+            } else if (task_pool && sorter_.is_concurrent_safe()) {
+                core::scheduler::parallel_sort(task_pool,
+                                               indexing.data(),
+                                               indexing.data() + num_rows,
+                                               std::cref(sorter_),
+                                               parallel_sort_min_run);
+            } else {
+                std::sort(indexing.data(), indexing.data() + num_rows, std::ref(sorter_));
+            }
 
             // 4. Create result via copy with indexing (no transpose needed)
             vector::data_chunk_t result(resource_, chunk.types(), num_rows);
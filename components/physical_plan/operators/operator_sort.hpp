@@ -15,6 +15,9 @@ namespace components::operators {
         void add(const std::pmr::vector<size_t>& col_path, order order_ = order::ascending);
 
     private:
+        // Below two runs of this size the sort stays on the executor thread.
+        static constexpr size_t parallel_sort_min_run = 16384;
+
         sort::columnar_sorter_t sorter_;
 
         void on_execute_impl(pipeline::context_t* pipeline_context) override;
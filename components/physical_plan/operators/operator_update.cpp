@@ -1,4 +1,5 @@
 #include "operator_update.hpp"
+#include "hash_match.hpp"
 #include "predicates/predicate.hpp"
 #include <components/vector/vector_operations.hpp>
 
@@ -16,8 +17,38 @@ namespace components::operators {
         , expr_(std::move(expr))
         , upsert_(upsert) {}
 
+    void operator_update::gather_(const vector::data_chunk_t& chunk,
+                                  std::vector<uint64_t>& rows,
+                                  vector::data_chunk_t& target) const {
+        vector::validate_chunk_capacity(target, rows.size());
+        vector::indexing_vector_t indexing(target.resource(), rows.data());
+        for (size_t k = 0; k < chunk.column_count(); k++) {
+            vector::vector_ops::copy(chunk.data[k], target.data[k], indexing, rows.size(), 0, 0);
+        }
+        target.set_cardinality(rows.size());
+    }
+
+    void operator_update::apply_updates_(vector::data_chunk_t& out_chunk,
+                                         const vector::data_chunk_t& source,
+                                         pipeline::context_t* pipeline_context) {
+        auto count = out_chunk.size();
+        std::vector<bool> modified(count, false);
+        for (const auto& expr : updates_) {
+            expr->execute_batch(resource(), out_chunk, source, count, &pipeline_context->parameters, modified);
+        }
+        for (size_t k = 0; k < count; k++) {
+            if (modified[k]) {
+                modified_->append(k);
+            } else {
+                no_modified_->append(k);
+            }
+        }
+    }
+
     void operator_update::on_execute_impl(pipeline::context_t* pipeline_context) {
         // Predicate matching + data prep only — storage I/O is handled by await_async_and_resume.
+        // Matched rows are gathered into the output first and every SET is then evaluated
+        // column-at-a-time over them; the executor hands the whole chunk to storage_update at once.
         if (left_ && left_->output() && right_ && right_->output()) {
             auto& chunk_left = left_->output()->data_chunk();
             auto& chunk_right = right_->output()->data_chunk();
@@ -36,37 +67,27 @@ namespace components::operators {
                 no_modified_ = operators::make_operator_write_data(resource());
                 output_ = operators::make_operator_data(left_->output()->resource(), types_left);
                 auto& out_chunk = output_->data_chunk();
-                auto predicate = expr_ ? predicates::create_predicate(left_->output()->resource(),
-                                                                      pipeline_context->function_registry,
-                                                                      expr_,
-                                                                      types_left,
-                                                                      types_right,
-                                                                      &pipeline_context->parameters)
-                                       : predicates::create_all_true_predicate(left_->output()->resource());
-                size_t index = 0;
-                for (size_t i = 0; i < chunk_left.size(); i++) {
-                    for (size_t j = 0; j < chunk_right.size(); j++) {
-                        if (predicate->check(chunk_left, chunk_right, i, j)) {
-                            out_chunk.row_ids.data<int64_t>()[index] = chunk_left.row_ids.data<int64_t>()[i];
-                            // Copy original values to output first (preserves scan data for executor)
-                            for (size_t k = 0; k < chunk_left.column_count(); k++) {
-                                vector::vector_ops::copy(chunk_left.data[k], out_chunk.data[k], i + 1, i, index);
-                            }
-                            bool modified = false;
-                            for (const auto& expr : updates_) {
-                                modified |=
-                                    expr->execute(out_chunk, chunk_right, index, j, &pipeline_context->parameters);
-                            }
-                            if (modified) {
-                                modified_->append(index);
-                            } else {
-                                no_modified_->append(index);
-                            }
-                            vector::validate_chunk_capacity(out_chunk, ++index);
-                        }
-                    }
+
+                // A target row is updated once, from its first matching source row
+                std::vector<uint64_t> rows_left;
+                std::vector<uint64_t> rows_right;
+                hash_match(left_->output()->resource(),
+                           pipeline_context->function_registry,
+                           expr_,
+                           chunk_left,
+                           chunk_right,
+                           &pipeline_context->parameters,
+                           true,
+                           rows_left,
+                           rows_right);
+
+                gather_(chunk_left, rows_left, out_chunk);
+                for (size_t k = 0; k < rows_left.size(); k++) {
+                    out_chunk.row_ids.data<int64_t>()[k] = chunk_left.row_ids.data<int64_t>()[rows_left[k]];
                 }
-                out_chunk.set_cardinality(index);
+                vector::data_chunk_t source(left_->output()->resource(), types_right, rows_right.size());
+                gather_(chunk_right, rows_right, source);
+                apply_updates_(out_chunk, source, pipeline_context);
             }
         } else if (left_ && left_->output()) {
             if (left_->output()->size() == 0) {
@@ -87,34 +108,22 @@ namespace components::operators {
                                                                       types,
                                                                       &pipeline_context->parameters)
                                        : predicates::create_all_true_predicate(left_->output()->resource());
-                size_t index = 0;
+                std::vector<uint64_t> selection;
+                selection.reserve(chunk.size());
                 for (size_t i = 0; i < chunk.size(); i++) {
                     if (predicate->check(chunk, i)) {
-                        if (chunk.data.front().get_vector_type() == vector::vector_type::DICTIONARY) {
-                            out_chunk.row_ids.data<int64_t>()[index] =
-                                static_cast<int64_t>(chunk.data.front().indexing().get_index(i));
-                        } else {
-                            out_chunk.row_ids.data<int64_t>()[index] = chunk.row_ids.data<int64_t>()[i];
-                        }
-
-                        // Copy original values to output first (preserves scan data for executor)
-                        for (size_t j = 0; j < chunk.column_count(); j++) {
-                            vector::vector_ops::copy(chunk.data[j], out_chunk.data[j], i + 1, i, index);
-                        }
-                        bool modified = false;
-                        for (const auto& expr : updates_) {
-                            modified |=
-                                expr->execute(out_chunk, out_chunk, index, index, &pipeline_context->parameters);
-                        }
-                        if (modified) {
-                            modified_->append(index);
-                        } else {
-                            no_modified_->append(index);
-                        }
-                        vector::validate_chunk_capacity(out_chunk, ++index);
+                        selection.emplace_back(i);
                     }
                 }
-                out_chunk.set_cardinality(index);
+
+                gather_(chunk, selection, out_chunk);
+                bool dictionary = chunk.data.front().get_vector_type() == vector::vector_type::DICTIONARY;
+                for (size_t k = 0; k < selection.size(); k++) {
+                    out_chunk.row_ids.data<int64_t>()[k] =
+                        dictionary ? static_cast<int64_t>(chunk.data.front().indexing().get_index(selection[k]))
+                                   : chunk.row_ids.data<int64_t>()[selection[k]];
+                }
+                apply_updates_(out_chunk, out_chunk, pipeline_context);
             }
         }
 
@@ -20,6 +20,13 @@ namespace components::operators {
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) override;
+        // Copies `rows` of `chunk` into `target`, column by column
+        void gather_(const vector::data_chunk_t& chunk,
+                     std::vector<uint64_t>& rows,
+                     vector::data_chunk_t& target) const;
+        void apply_updates_(vector::data_chunk_t& out_chunk,
+                            const vector::data_chunk_t& source,
+                            pipeline::context_t* pipeline_context);
 
         collection_full_name_t name_;
         std::pmr::vector<expressions::update_expr_ptr> updates_;
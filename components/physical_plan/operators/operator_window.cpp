@@ -0,0 +1,490 @@
+#include "operator_window.hpp"
+
+#include <components/physical_plan/operators/operator_data.hpp>
+#include <components/vector/vector_operations.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace components::operators {
+
+    namespace {
+
+        using logical_plan::window_bound_type;
+        using logical_plan::window_function_type;
+
+        // Rows of the input regrouped by partition and sorted inside each one by the window order.
+        // Positions index `rows`; peers are neighbouring positions equal on every ORDER BY key.
+        struct window_layout_t {
+            std::vector<size_t> rows;
+            std::vector<std::pair<size_t, size_t>> partitions; // [begin, end) positions
+            std::vector<size_t> peer_start;
+            std::vector<size_t> peer_end;
+        };
+
+        bool same_key_values(const vector::data_chunk_t& chunk,
+                             const std::pmr::vector<std::pmr::vector<size_t>>& paths,
+                             size_t row_a,
+                             size_t row_b) {
+            for (const auto& path : paths) {
+                const auto* column = chunk.at(path);
+                bool null_a = column->is_null(row_a);
+                bool null_b = column->is_null(row_b);
+                if (null_a || null_b) {
+                    if (null_a != null_b) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (column->value(row_a) != column->value(row_b)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Partitions in order of first appearance; NULL keys form a partition of their own
+        std::vector<std::vector<size_t>> partition_rows(std::pmr::memory_resource* resource,
+                                                        vector::data_chunk_t& chunk,
+                                                        const std::pmr::vector<std::pmr::vector<size_t>>& paths) {
+            auto count = chunk.size();
+            std::vector<std::vector<size_t>> partitions;
+            if (paths.empty()) {
+                auto& rows = partitions.emplace_back(count);
+                for (size_t row = 0; row < count; row++) {
+                    rows[row] = row;
+                }
+                return partitions;
+            }
+
+            std::vector<uint64_t> hashes(count, 0);
+            bool top_level = std::all_of(paths.begin(), paths.end(), [](const auto& path) { return path.size() == 1; });
+            if (top_level) {
+                vector::vector_t hash_vec(resource, types::logical_type::UBIGINT, count);
+                std::vector<uint64_t> col_ids;
+                col_ids.reserve(paths.size());
+                for (const auto& path : paths) {
+                    col_ids.push_back(path.front());
+                }
+                chunk.hash(col_ids, hash_vec);
+                const auto* data = hash_vec.data<uint64_t>();
+                std::copy(data, data + count, hashes.begin());
+            } else {
+                for (size_t row = 0; row < count; row++) {
+                    for (const auto& path : paths) {
+                        hashes[row] = hashes[row] * 31 + chunk.value(path, row).hash();
+                    }
+                }
+            }
+
+            std::unordered_map<uint64_t, std::vector<size_t>> index;
+            for (size_t row = 0; row < count; row++) {
+                auto& candidates = index[hashes[row]];
+                auto it = std::find_if(candidates.begin(), candidates.end(), [&](size_t partition) {
+                    return same_key_values(chunk, paths, partitions[partition].front(), row);
+                });
+                if (it == candidates.end()) {
+                    candidates.push_back(partitions.size());
+                    partitions.emplace_back().push_back(row);
+                } else {
+                    partitions[*it].push_back(row);
+                }
+            }
+            return partitions;
+        }
+
+        window_layout_t make_layout(std::pmr::memory_resource* resource,
+                                    vector::data_chunk_t& chunk,
+                                    const window_function_t& function) {
+            window_layout_t layout;
+            auto count = chunk.size();
+            layout.rows.reserve(count);
+            layout.peer_start.resize(count);
+            layout.peer_end.resize(count);
+
+            sort::columnar_sorter_t sorter;
+            for (const auto& [path, order] : function.order_by) {
+                sorter.add(path, order);
+            }
+            sorter.set_chunk(chunk);
+
+            for (auto& rows : partition_rows(resource, chunk, function.partition_by)) {
+                if (!function.order_by.empty()) {
+                    std::stable_sort(rows.begin(), rows.end(), std::cref(sorter));
+                }
+                auto begin = layout.rows.size();
+                layout.rows.insert(layout.rows.end(), rows.begin(), rows.end());
+                auto end = layout.rows.size();
+                layout.partitions.emplace_back(begin, end);
+
+                // without ORDER BY the whole partition is one peer group
+                size_t peer_begin = begin;
+                for (size_t pos = begin; pos < end; pos++) {
+                    if (pos > begin && !function.order_by.empty() && sorter(layout.rows[pos - 1], layout.rows[pos])) {
+                        for (size_t peer = peer_begin; peer < pos; peer++) {
+                            layout.peer_end[peer] = pos;
+                        }
+                        peer_begin = pos;
+                    }
+                    layout.peer_start[pos] = peer_begin;
+                }
+                for (size_t peer = peer_begin; peer < end; peer++) {
+                    layout.peer_end[peer] = end;
+                }
+            }
+            return layout;
+        }
+
+        // Frame of position `pos` inside partition [begin, end) as a [first, last) range of positions
+        std::pair<size_t, size_t> frame_bounds(const logical_plan::window_frame_t& frame,
+                                               const window_layout_t& layout,
+                                               size_t begin,
+                                               size_t end,
+                                               size_t pos) {
+            auto rows_mode = frame.mode == logical_plan::window_frame_mode::rows;
+            auto back = [&](int64_t offset) {
+                auto step = static_cast<size_t>(offset);
+                return pos - begin >= step ? pos - step : begin;
+            };
+            auto ahead = [&](int64_t offset) { return std::min(end, pos + static_cast<size_t>(offset)); };
+
+            size_t first = begin;
+            switch (frame.start.type) {
+                case window_bound_type::unbounded_preceding:
+                    first = begin;
+                    break;
+                case window_bound_type::preceding:
+                    first = back(frame.start.offset);
+                    break;
+                case window_bound_type::current_row:
+                    first = rows_mode ? pos : layout.peer_start[pos];
+                    break;
+                case window_bound_type::following:
+                    first = ahead(frame.start.offset);
+                    break;
+                case window_bound_type::unbounded_following:
+                    first = end;
+                    break;
+            }
+
+            size_t last = end;
+            switch (frame.end.type) {
+                case window_bound_type::unbounded_preceding:
+                    last = begin;
+                    break;
+                case window_bound_type::preceding:
+                    last = pos - begin >= static_cast<size_t>(frame.end.offset) ? back(frame.end.offset) + 1 : begin;
+                    break;
+                case window_bound_type::current_row:
+                    last = rows_mode ? pos + 1 : layout.peer_end[pos];
+                    break;
+                case window_bound_type::following:
+                    last = std::min(end, ahead(frame.end.offset) + 1);
+                    break;
+                case window_bound_type::unbounded_following:
+                    last = end;
+                    break;
+            }
+            return {first, std::max(first, last)};
+        }
+
+        // Sum, minimum, maximum and count of the non-null values below every node. Leaves are
+        // stored at [size, 2 * size) and a range is folded bottom-up, which is enough since all
+        // four operations are commutative.
+        template<typename T>
+        class segment_tree_t {
+        public:
+            struct node_t {
+                T sum{};
+                T min{};
+                T max{};
+                int64_t count{0};
+            };
+
+            segment_tree_t(const std::vector<T>& values, const std::vector<bool>& valid)
+                : size_(values.size())
+                , nodes_(2 * values.size()) {
+                for (size_t i = 0; i < size_; i++) {
+                    if (valid[i]) {
+                        nodes_[size_ + i] = node_t{values[i], values[i], values[i], 1};
+                    }
+                }
+                for (size_t i = size_; i-- > 1;) {
+                    nodes_[i] = combine(nodes_[2 * i], nodes_[2 * i + 1]);
+                }
+            }
+
+            node_t query(size_t first, size_t last) const {
+                node_t result;
+                for (first += size_, last += size_; first < last; first /= 2, last /= 2) {
+                    if (first & 1) {
+                        result = combine(result, nodes_[first++]);
+                    }
+                    if (last & 1) {
+                        result = combine(result, nodes_[--last]);
+                    }
+                }
+                return result;
+            }
+
+        private:
+            static node_t combine(const node_t& lhs, const node_t& rhs) {
+                if (lhs.count == 0) {
+                    return rhs;
+                }
+                if (rhs.count == 0) {
+                    return lhs;
+                }
+                return node_t{lhs.sum + rhs.sum,
+                              std::min(lhs.min, rhs.min),
+                              std::max(lhs.max, rhs.max),
+                              lhs.count + rhs.count};
+            }
+
+            size_t size_;
+            std::vector<node_t> nodes_;
+        };
+
+        template<typename T>
+        T numeric_value(const vector::vector_t& column, size_t row) {
+            switch (column.type().type()) {
+                case types::logical_type::BOOLEAN:
+                    return static_cast<T>(column.data<bool>()[row]);
+                case types::logical_type::TINYINT:
+                    return static_cast<T>(column.data<int8_t>()[row]);
+                case types::logical_type::UTINYINT:
+                    return static_cast<T>(column.data<uint8_t>()[row]);
+                case types::logical_type::SMALLINT:
+                    return static_cast<T>(column.data<int16_t>()[row]);
+                case types::logical_type::USMALLINT:
+                    return static_cast<T>(column.data<uint16_t>()[row]);
+                case types::logical_type::INTEGER:
+                    return static_cast<T>(column.data<int32_t>()[row]);
+                case types::logical_type::UINTEGER:
+                    return static_cast<T>(column.data<uint32_t>()[row]);
+                case types::logical_type::BIGINT:
+                    return static_cast<T>(column.data<int64_t>()[row]);
+                case types::logical_type::UBIGINT:
+                    return static_cast<T>(column.data<uint64_t>()[row]);
+                case types::logical_type::FLOAT:
+                    return static_cast<T>(column.data<float>()[row]);
+                case types::logical_type::DOUBLE:
+                    return static_cast<T>(column.data<double>()[row]);
+                default: {
+                    auto value = column.value(row).cast_as(types::complex_logical_type(types::logical_type::DOUBLE));
+                    return static_cast<T>(value.value<double>());
+                }
+            }
+        }
+
+        void evaluate_ranking(const window_function_t& function, const window_layout_t& layout, vector::vector_t& out) {
+            auto* data = out.data<int64_t>();
+            for (const auto& [begin, end] : layout.partitions) {
+                int64_t dense_rank = 0;
+                for (size_t pos = begin; pos < end; pos++) {
+                    if (layout.peer_start[pos] == pos) {
+                        dense_rank++;
+                    }
+                    auto row = layout.rows[pos];
+                    switch (function.type) {
+                        case window_function_type::row_number:
+                            data[row] = static_cast<int64_t>(pos - begin + 1);
+                            break;
+                        case window_function_type::rank:
+                            data[row] = static_cast<int64_t>(layout.peer_start[pos] - begin + 1);
+                            break;
+                        default:
+                            data[row] = dense_rank;
+                            break;
+                    }
+                }
+            }
+        }
+
+        void evaluate_offset(const window_function_t& function,
+                             const window_layout_t& layout,
+                             const vector::vector_t& argument,
+                             vector::data_chunk_t& result,
+                             size_t column) {
+            auto shift = function.type == window_function_type::lag ? -function.offset : function.offset;
+            std::optional<types::logical_value_t> default_value;
+            if (function.default_value && !function.default_value->is_null()) {
+                default_value = function.default_value->cast_as(argument.type());
+            }
+            for (const auto& [begin, end] : layout.partitions) {
+                for (size_t pos = begin; pos < end; pos++) {
+                    auto row = layout.rows[pos];
+                    auto target = static_cast<int64_t>(pos) + shift;
+                    if (target >= static_cast<int64_t>(begin) && target < static_cast<int64_t>(end)) {
+                        auto source = layout.rows[static_cast<size_t>(target)];
+                        if (argument.is_null(source)) {
+                            result.data[column].set_null(row, true);
+                        } else {
+                            result.set_value(column, row, argument.value(source));
+                        }
+                    } else if (default_value) {
+                        result.set_value(column, row, *default_value);
+                    } else {
+                        result.data[column].set_null(row, true);
+                    }
+                }
+            }
+        }
+
+        template<typename T>
+        void evaluate_frames(const window_function_t& function,
+                             const window_layout_t& layout,
+                             const vector::vector_t* argument,
+                             vector::vector_t& out) {
+            auto count = layout.rows.size();
+            std::vector<T> values(count);
+            std::vector<bool> valid(count, true);
+            for (size_t pos = 0; pos < count; pos++) {
+                auto row = layout.rows[pos];
+                if (argument) {
+                    valid[pos] = !argument->is_null(row);
+                    if (valid[pos] && function.type != window_function_type::count) {
+                        values[pos] = numeric_value<T>(*argument, row);
+                    }
+                }
+            }
+            segment_tree_t<T> tree(values, valid);
+
+            for (const auto& [begin, end] : layout.partitions) {
+                for (size_t pos = begin; pos < end; pos++) {
+                    auto row = layout.rows[pos];
+                    auto [first, last] = frame_bounds(function.frame, layout, begin, end, pos);
+                    auto frame = tree.query(first, last);
+                    if (function.type == window_function_type::count) {
+                        out.data<int64_t>()[row] = frame.count;
+                        continue;
+                    }
+                    if (frame.count == 0) {
+                        out.set_null(row, true);
+                        continue;
+                    }
+                    switch (function.type) {
+                        case window_function_type::sum:
+                            out.data<T>()[row] = frame.sum;
+                            break;
+                        case window_function_type::avg:
+                            out.data<double>()[row] = static_cast<double>(frame.sum) / static_cast<double>(frame.count);
+                            break;
+                        case window_function_type::min:
+                            out.data<T>()[row] = frame.min;
+                            break;
+                        default:
+                            out.data<T>()[row] = frame.max;
+                            break;
+                    }
+                }
+            }
+        }
+
+    } // namespace
+
+    operator_window_t::operator_window_t(std::pmr::memory_resource* resource, log_t log)
+        : read_only_operator_t(resource, log, operator_type::window)
+        , columns_(resource)
+        , functions_(resource)
+        , outputs_(resource) {}
+
+    void operator_window_t::add_column(const std::pmr::string& name, std::pmr::vector<size_t> col_path) {
+        outputs_.push_back({false, columns_.size()});
+        columns_.push_back({name, std::move(col_path)});
+    }
+
+    void operator_window_t::add_function(window_function_t&& function) {
+        outputs_.push_back({true, functions_.size()});
+        functions_.push_back(std::move(function));
+    }
+
+    void operator_window_t::on_execute_impl(pipeline::context_t* /*pipeline_context*/) {
+        if (!left_ || !left_->output()) {
+            return;
+        }
+        auto& chunk = left_->output()->data_chunk();
+        auto count = chunk.size();
+
+        std::vector<std::optional<vector::vector_t>> arguments(functions_.size());
+        std::pmr::vector<types::complex_logical_type> result_types(resource_);
+        result_types.reserve(outputs_.size());
+        for (const auto& output : outputs_) {
+            if (!output.is_function) {
+                const auto& column = columns_[output.index];
+                auto type = chunk.at(column.col_path)->type();
+                type.set_alias(std::string(std::string_view(column.name)));
+                result_types.push_back(std::move(type));
+                continue;
+            }
+            const auto& function = functions_[output.index];
+            types::complex_logical_type argument_type;
+            if (!function.argument.empty()) {
+                auto& argument = arguments[output.index].emplace(*chunk.at(function.argument));
+                argument.flatten(count);
+                argument_type = argument.type();
+            }
+            auto type = logical_plan::window_result_type(function.type, argument_type);
+            type.set_alias(std::string(std::string_view(function.name)));
+            result_types.push_back(std::move(type));
+        }
+
+        vector::data_chunk_t result(resource_, result_types, count);
+        result.set_cardinality(count);
+        // functions over the same PARTITION BY and ORDER BY share one layout
+        std::vector<std::pair<size_t, window_layout_t>> layouts;
+        for (size_t i = 0; i < outputs_.size(); i++) {
+            const auto& output = outputs_[i];
+            if (!output.is_function) {
+                vector::vector_ops::copy(*chunk.at(columns_[output.index].col_path), result.data[i], count, 0, 0);
+                continue;
+            }
+            const auto& function = functions_[output.index];
+            auto it = std::find_if(layouts.begin(), layouts.end(), [&](const auto& layout) {
+                const auto& other = functions_[layout.first];
+                return other.partition_by == function.partition_by && other.order_by == function.order_by;
+            });
+            if (it == layouts.end()) {
+                layouts.emplace_back(output.index, make_layout(resource_, chunk, function));
+                it = std::prev(layouts.end());
+            }
+            const auto& layout = it->second;
+            const auto* argument = arguments[output.index] ? &*arguments[output.index] : nullptr;
+
+            switch (function.type) {
+                case window_function_type::row_number:
+                case window_function_type::rank:
+                case window_function_type::dense_rank:
+                    evaluate_ranking(function, layout, result.data[i]);
+                    break;
+                case window_function_type::lag:
+                case window_function_type::lead:
+                    if (!argument) {
+                        throw std::logic_error("window function " + std::string(std::string_view(function.name)) +
+                                               " requires an argument");
+                    }
+                    evaluate_offset(function, layout, *argument, result, i);
+                    break;
+                case window_function_type::count:
+                    evaluate_frames<int64_t>(function, layout, argument, result.data[i]);
+                    break;
+                default: {
+                    if (!argument) {
+                        throw std::logic_error("window function " + std::string(std::string_view(function.name)) +
+                                               " requires an argument");
+                    }
+                    auto sum_type = logical_plan::window_result_type(window_function_type::sum, argument->type());
+                    if (sum_type.type() == types::logical_type::BIGINT) {
+                        evaluate_frames<int64_t>(function, layout, argument, result.data[i]);
+                    } else {
+                        evaluate_frames<double>(function, layout, argument, result.data[i]);
+                    }
+                    break;
+                }
+            }
+        }
+
+        output_ = operators::make_operator_data(left_->output()->resource(), std::move(result));
+    }
+
+} // namespace components::operators
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <components/logical_plan/node_window.hpp>
+#include <components/physical_plan/operators/operator.hpp>
+#include <components/physical_plan/operators/sort/sort.hpp>
+
+#include <optional>
+
+namespace components::operators {
+
+    struct window_function_t {
+        explicit window_function_t(std::pmr::memory_resource* resource)
+            : name(resource)
+            , argument(resource)
+            , partition_by(resource)
+            , order_by(resource) {}
+
+        std::pmr::string name;
+        logical_plan::window_function_type type{logical_plan::window_function_type::row_number};
+        std::pmr::vector<size_t> argument; // empty for ranking functions and COUNT(*)
+        int64_t offset{1};                 // LAG/LEAD
+        std::optional<types::logical_value_t> default_value; // LAG/LEAD
+        std::pmr::vector<std::pmr::vector<size_t>> partition_by;
+        std::pmr::vector<std::pair<std::pmr::vector<size_t>, sort::order>> order_by;
+        logical_plan::window_frame_t frame;
+    };
+
+    // Projects the input through plain columns and window functions, keeping the input row order.
+    // Rows are hash-partitioned on the PARTITION BY columns and every partition is sorted on the
+    // window ORDER BY; functions sharing both reuse that layout. Frame aggregates (COUNT, SUM, AVG,
+    // MIN, MAX) are answered by a segment tree over the sorted rows, so any frame costs O(log n)
+    // per row however wide it slides.
+    class operator_window_t final : public read_only_operator_t {
+    public:
+        operator_window_t(std::pmr::memory_resource* resource, log_t log);
+
+        void add_column(const std::pmr::string& name, std::pmr::vector<size_t> col_path);
+        void add_function(window_function_t&& function);
+
+    private:
+        struct column_t {
+            std::pmr::string name;
+            std::pmr::vector<size_t> col_path;
+        };
+
+        // Output columns in projection order: an index into columns_ or into functions_
+        struct output_t {
+            bool is_function;
+            size_t index;
+        };
+
+        std::pmr::vector<column_t> columns_;
+        std::pmr::vector<window_function_t> functions_;
+        std::pmr::vector<output_t> outputs_;
+
+        void on_execute_impl(pipeline::context_t* pipeline_context) override;
+    };
+
+} // namespace components::operators
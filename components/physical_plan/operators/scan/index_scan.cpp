@@ -3,25 +3,74 @@
 #include <services/disk/manager_disk.hpp>
 #include <services/index/manager_index.hpp>
 
+#include <algorithm>
+
 namespace components::operators {
 
+    std::pmr::vector<index::index_range_t> resolve_index_ranges(std::pmr::memory_resource* resource,
+                                                                const index_scan_spec_t& spec,
+                                                                const logical_plan::storage_parameters& parameters) {
+        std::pmr::vector<index::index_range_t> ranges(resource);
+        if (!spec.points.empty()) {
+            std::pmr::vector<types::logical_value_t> points(resource);
+            points.reserve(spec.points.size());
+            for (auto id : spec.points) {
+                const auto& value = parameters.parameters.at(id);
+                if (value.is_null()) {
+                    continue;
+                }
+                if (auto point = index::exact_index_probe(value, spec.key_type)) {
+                    points.emplace_back(resource, *point);
+                }
+            }
+            // Sorted, distinct points keep the output in key order and free of duplicates
+            std::sort(points.begin(), points.end());
+            points.erase(std::unique(points.begin(), points.end()), points.end());
+            ranges.reserve(points.size());
+            for (const auto& point : points) {
+                ranges.push_back(index::index_range_t::point(point));
+            }
+            return ranges;
+        }
+
+        index::index_range_t range;
+        if (spec.lower) {
+            const auto& value = parameters.parameters.at(spec.lower->id);
+            if (value.is_null()) {
+                return ranges;
+            }
+            range.lower.emplace(resource, index::exact_index_probe(value, spec.key_type).value_or(value));
+            range.lower_inclusive = spec.lower->inclusive;
+        }
+        if (spec.upper) {
+            const auto& value = parameters.parameters.at(spec.upper->id);
+            if (value.is_null()) {
+                return ranges;
+            }
+            range.upper.emplace(resource, index::exact_index_probe(value, spec.key_type).value_or(value));
+            range.upper_inclusive = spec.upper->inclusive;
+        }
+        ranges.push_back(std::move(range));
+        return ranges;
+    }
+
     index_scan::index_scan(std::pmr::memory_resource* resource,
                            log_t log,
                            collection_full_name_t name,
-                           const expressions::key_t& key,
-                           const types::logical_value_t& value,
-                           expressions::compare_type compare_type,
+                           logical_plan::keys_base_storage_t index_keys,
+                           index_scan_spec_t spec,
                            logical_plan::limit_t limit)
         : read_only_operator_t(resource, log, operator_type::index_scan)
         , name_(std::move(name))
-        , key_(key)
-        , value_(value)
-        , compare_type_(compare_type)
-        , limit_(limit) {}
+        , index_keys_(std::move(index_keys))
+        , spec_(std::move(spec))
+        , limit_(limit) {
+        assert(!index_keys_.empty());
+    }
 
     void index_scan::on_execute_impl(pipeline::context_t* /*pipeline_context*/) {
         if (log_.is_valid()) {
-            trace(log(), "index_scan by field \"{}\"", key_.as_string());
+            trace(log(), "index_scan by field \"{}\"", key().as_string());
         }
         if (name_.empty())
             return;
@@ -33,54 +82,74 @@ namespace components::operators {
             trace(log(), "index_scan::await_async_and_resume on {}", name_.to_string());
         }
 
+        auto [_t, tf] =
+            actor_zeta::send(ctx->disk_address, &services::disk::manager_disk_t::storage_types, ctx->session, name_);
+        auto column_types = co_await std::move(tf);
+
         if (ctx->index_address == actor_zeta::address_t::empty_address()) {
             // No index service — return empty result
-            auto [_t, tf] = actor_zeta::send(ctx->disk_address,
-                                             &services::disk::manager_disk_t::storage_types,
-                                             ctx->session,
-                                             name_);
-            auto types = co_await std::move(tf);
-            output_ = make_operator_data(resource_, types);
+            output_ = make_operator_data(resource_, column_types);
             mark_executed();
             co_return;
         }
 
-        // Search index for matching row IDs (txn-aware visibility)
-        std::pmr::vector<int64_t> row_ids_vec(resource_);
-        if (ctx->txn.transaction_id != 0) {
-            auto [_s, sf] = actor_zeta::send(ctx->index_address,
-                                             &services::index::manager_index_t::search_txn,
-                                             ctx->session,
-                                             name_,
-                                             index::keys_base_storage_t{{key_}},
-                                             types::logical_value_t{resource_, value_},
-                                             compare_type_,
-                                             ctx->txn.start_time,
-                                             ctx->txn.transaction_id);
-            row_ids_vec = co_await std::move(sf);
-        } else {
-            auto [_s, sf] = actor_zeta::send(ctx->index_address,
-                                             &services::index::manager_index_t::search,
-                                             ctx->session,
-                                             name_,
-                                             index::keys_base_storage_t{{key_}},
-                                             types::logical_value_t{resource_, value_},
-                                             compare_type_);
-            row_ids_vec = co_await std::move(sf);
+        // The scan is index-only when every column read above it is the index key
+        std::optional<size_t> key_column;
+        for (size_t i = 0; i < column_types.size(); ++i) {
+            if (column_types[i].alias() == key().as_string()) {
+                key_column = i;
+                break;
+            }
         }
+        bool index_only = key_column && required_columns_ &&
+                          std::all_of(required_columns_->begin(), required_columns_->end(), [&](size_t column) {
+                              return column == *key_column;
+                          });
+
+        // Search index for matching row IDs (txn-aware visibility), in key order
+        bool in_txn = ctx->txn.transaction_id != 0;
+        auto [_s, sf] = actor_zeta::send(ctx->index_address,
+                                         &services::index::manager_index_t::search_ranges,
+                                         ctx->session,
+                                         name_,
+                                         index_keys_,
+                                         resolve_index_ranges(resource_, spec_, ctx->parameters),
+                                         index_only,
+                                         in_txn ? ctx->txn.start_time : uint64_t{0},
+                                         ctx->txn.transaction_id);
+        auto found = co_await std::move(sf);
 
         // Apply limit
-        size_t count = row_ids_vec.size();
+        size_t count = found.row_ids.size();
         int limit_val = limit_.limit();
         if (limit_val >= 0) {
             count = std::min(count, static_cast<size_t>(limit_val));
         }
 
-        if (count > 0) {
+        if (count == 0) {
+            output_ = make_operator_data(resource_, column_types);
+        } else if (index_only) {
+            if (log_.is_valid()) {
+                trace(log(), "index_scan: index-only, {} rows", count);
+            }
+            vector::data_chunk_t chunk(resource_, column_types, count);
+            for (size_t column = 0; column < chunk.column_count(); ++column) {
+                if (column != *key_column) {
+                    chunk.data[column].set_vector_type(vector::vector_type::CONSTANT);
+                    chunk.data[column].set_null(true);
+                }
+            }
+            for (size_t i = 0; i < count; i++) {
+                chunk.set_value(*key_column, i, found.keys[i]);
+                chunk.row_ids.data<int64_t>()[i] = found.row_ids[i];
+            }
+            chunk.set_cardinality(count);
+            output_ = make_operator_data(resource_, std::move(chunk));
+        } else {
             // Build row_ids vector for fetch
             vector::vector_t row_ids(resource_, types::logical_type::BIGINT, count);
             for (size_t i = 0; i < count; i++) {
-                row_ids.set_value(i, types::logical_value_t{resource_, row_ids_vec[i]});
+                row_ids.set_value(i, types::logical_value_t{resource_, found.row_ids[i]});
             }
 
             // Fetch from storage
@@ -95,20 +164,8 @@ namespace components::operators {
             if (data) {
                 output_ = make_operator_data(resource_, std::move(*data));
             } else {
-                auto [_t2, tf2] = actor_zeta::send(ctx->disk_address,
-                                                   &services::disk::manager_disk_t::storage_types,
-                                                   ctx->session,
-                                                   name_);
-                auto types = co_await std::move(tf2);
-                output_ = make_operator_data(resource_, types);
+                output_ = make_operator_data(resource_, column_types);
             }
-        } else {
-            auto [_t3, tf3] = actor_zeta::send(ctx->disk_address,
-                                               &services::disk::manager_disk_t::storage_types,
-                                               ctx->session,
-                                               name_);
-            auto types = co_await std::move(tf3);
-            output_ = make_operator_data(resource_, types);
         }
 
         mark_executed();
@@ -1,38 +1,67 @@
 #pragma once
 
 #include <components/expressions/compare_expression.hpp>
+#include <components/index/index.hpp>
 
+#include <components/logical_plan/node_create_index.hpp>
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 
+#include <optional>
+
 namespace components::operators {
 
+    // Bound of an index interval; the value is a query parameter resolved at execution time.
+    struct index_scan_bound_t {
+        core::parameter_id_t id;
+        bool inclusive{true};
+    };
+
+    // Access path over the leading key of an index: either a set of points (= / IN)
+    // or a single interval. Rows are produced in key order in both cases.
+    struct index_scan_spec_t {
+        std::vector<core::parameter_id_t> points;
+        std::optional<index_scan_bound_t> lower;
+        std::optional<index_scan_bound_t> upper;
+        // Type of the leading key; NA when the table has no schema
+        types::complex_logical_type key_type;
+    };
+
+    // Turns the spec into index ranges with the parameters of the query, converted to the key type.
+    // Points are sorted and distinct; a null bound or point matches nothing and is dropped, and so is
+    // a point no key can equal.
+    std::pmr::vector<index::index_range_t> resolve_index_ranges(std::pmr::memory_resource* resource,
+                                                                const index_scan_spec_t& spec,
+                                                                const logical_plan::storage_parameters& parameters);
+
     class index_scan final : public read_only_operator_t {
     public:
         index_scan(std::pmr::memory_resource* resource,
                    log_t log,
                    collection_full_name_t name,
-                   const expressions::key_t& key,
-                   const types::logical_value_t& value,
-                   expressions::compare_type compare_type,
+                   logical_plan::keys_base_storage_t index_keys,
+                   index_scan_spec_t spec,
                    logical_plan::limit_t limit);
 
         const collection_full_name_t& collection_name() const noexcept { return name_; }
-        const expressions::key_t& key() const { return key_; }
-        const types::logical_value_t& value() const { return value_; }
-        expressions::compare_type compare_type() const { return compare_type_; }
+        const expressions::key_t& key() const { return index_keys_.front(); }
+        const index_scan_spec_t& spec() const noexcept { return spec_; }
         const logical_plan::limit_t& limit() const { return limit_; }
 
+        // Top-level columns read by the operators above the scan. When all of them are covered
+        // by the index key the rows are built from the index alone and storage is not touched.
+        void set_required_columns(std::vector<size_t> columns) { required_columns_ = std::move(columns); }
+
         actor_zeta::unique_future<void> await_async_and_resume(pipeline::context_t* ctx) override;
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) override;
 
         collection_full_name_t name_;
-        const expressions::key_t key_;
-        const types::logical_value_t value_;
-        const expressions::compare_type compare_type_;
+        const logical_plan::keys_base_storage_t index_keys_;
+        const index_scan_spec_t spec_;
         const logical_plan::limit_t limit_;
+        std::optional<std::vector<size_t>> required_columns_;
     };
 
 } // namespace components::operators
@@ -1,25 +1,77 @@
 #include "primary_key_scan.hpp"
+#include "index_scan.hpp"
 
 #include <services/disk/manager_disk.hpp>
+#include <services/index/manager_index.hpp>
+
+#include <algorithm>
 
 namespace components::operators {
 
     primary_key_scan::primary_key_scan(std::pmr::memory_resource* resource, collection_full_name_t name)
         : read_only_operator_t(resource, log_t{}, operator_type::primary_key_scan)
         , name_(std::move(name))
-        , rows_(resource, types::logical_type::BIGINT) {}
+        , rows_(resource, types::logical_type::BIGINT)
+        , index_keys_(resource) {}
+
+    primary_key_scan::primary_key_scan(std::pmr::memory_resource* resource,
+                                       log_t log,
+                                       collection_full_name_t name,
+                                       logical_plan::keys_base_storage_t index_keys,
+                                       std::vector<core::parameter_id_t> points,
+                                       types::complex_logical_type key_type,
+                                       logical_plan::limit_t limit)
+        : read_only_operator_t(resource, log, operator_type::primary_key_scan)
+        , name_(std::move(name))
+        , rows_(resource, types::logical_type::BIGINT)
+        , index_keys_(std::move(index_keys))
+        , points_(std::move(points))
+        , key_type_(std::move(key_type))
+        , limit_(limit) {
+        assert(!index_keys_.empty());
+    }
 
     void primary_key_scan::append(size_t id) {
         rows_.set_value(size_++, types::logical_value_t(resource(), static_cast<int64_t>(id)));
     }
 
     void primary_key_scan::on_execute_impl(pipeline::context_t* /*pipeline_context*/) {
-        if (name_.empty() || size_ == 0)
+        if (name_.empty() || (size_ == 0 && !lookup()))
             return;
         async_wait();
     }
 
     actor_zeta::unique_future<void> primary_key_scan::await_async_and_resume(pipeline::context_t* ctx) {
+        if (lookup() && ctx->index_address != actor_zeta::address_t::empty_address()) {
+            if (log_.is_valid()) {
+                trace(log(), "primary_key_scan: lookup by \"{}\"", index_keys_.front().as_string());
+            }
+            // Equality probes only: the index answers each point with find(), hashed or ordered
+            index_scan_spec_t spec;
+            spec.points = points_;
+            spec.key_type = key_type_;
+            bool in_txn = ctx->txn.transaction_id != 0;
+            auto [_s, sf] = actor_zeta::send(ctx->index_address,
+                                             &services::index::manager_index_t::search_ranges,
+                                             ctx->session,
+                                             name_,
+                                             index_keys_,
+                                             resolve_index_ranges(resource_, spec, ctx->parameters),
+                                             false,
+                                             in_txn ? ctx->txn.start_time : uint64_t{0},
+                                             ctx->txn.transaction_id);
+            auto found = co_await std::move(sf);
+
+            size_t count = found.row_ids.size();
+            int limit_val = limit_.limit();
+            if (limit_val >= 0) {
+                count = std::min(count, static_cast<size_t>(limit_val));
+            }
+            for (size_t i = 0; i < count; i++) {
+                append(static_cast<size_t>(found.row_ids[i]));
+            }
+        }
+
         if (size_ > 0) {
             // Copy rows vector for send
             vector::vector_t row_ids_copy(resource_, types::logical_type::BIGINT, size_);
@@ -1,18 +1,31 @@
 #pragma once
 
+#include <components/logical_plan/node_create_index.hpp>
+#include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/operators/operator.hpp>
 
 namespace components::operators {
 
+    // Fetches rows by id. The ids are either appended up front or, in lookup mode, found by
+    // probing an index with equality points (the access path for hash indexes).
     class primary_key_scan final : public read_only_operator_t {
     public:
         explicit primary_key_scan(std::pmr::memory_resource* resource, collection_full_name_t name = {});
+        primary_key_scan(std::pmr::memory_resource* resource,
+                         log_t log,
+                         collection_full_name_t name,
+                         logical_plan::keys_base_storage_t index_keys,
+                         std::vector<core::parameter_id_t> points,
+                         types::complex_logical_type key_type,
+                         logical_plan::limit_t limit);
 
         void append(size_t id);
 
         const collection_full_name_t& collection_name() const noexcept { return name_; }
         const vector::vector_t& rows() const { return rows_; }
         size_t row_count() const { return size_; }
+        const logical_plan::keys_base_storage_t& index_keys() const noexcept { return index_keys_; }
+        const std::vector<core::parameter_id_t>& points() const noexcept { return points_; }
 
         actor_zeta::unique_future<void> await_async_and_resume(pipeline::context_t* ctx) override;
 
@@ -20,7 +33,12 @@ namespace components::operators {
         collection_full_name_t name_;
         vector::vector_t rows_;
         size_t size_{0};
+        logical_plan::keys_base_storage_t index_keys_;
+        std::vector<core::parameter_id_t> points_;
+        types::complex_logical_type key_type_;
+        logical_plan::limit_t limit_;
 
+        bool lookup() const noexcept { return !points_.empty(); }
         void on_execute_impl(pipeline::context_t* pipeline_context) override;
     };
 
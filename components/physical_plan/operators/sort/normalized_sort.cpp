@@ -0,0 +1,419 @@
+#include "normalized_sort.hpp"
+
+#include <absl/numeric/int128.h>
+
+#include <bit>
+#include <cstring>
+
+namespace components::sort {
+
+    namespace {
+
+        // Below this many rows a bucket is finished with insertion sort
+        constexpr size_t insertion_sort_threshold = 24;
+
+        // Length byte of a string longer than the prefix
+        constexpr auto truncated_length = static_cast<uint8_t>(normalized_sorter_t::string_prefix + 1);
+
+        template<typename T>
+        void store_big_endian(uint8_t* dst, T value) {
+            for (size_t i = 0; i < sizeof(T); i++) {
+                dst[i] = static_cast<uint8_t>(value >> (8 * (sizeof(T) - 1 - i)));
+            }
+        }
+
+        // Two's complement with the sign bit flipped orders like the unsigned bytes
+        template<typename T>
+        void encode_signed(uint8_t* dst, T value) {
+            using unsigned_t = std::make_unsigned_t<T>;
+            constexpr auto sign = static_cast<unsigned_t>(unsigned_t{1} << (8 * sizeof(T) - 1));
+            store_big_endian(dst, static_cast<unsigned_t>(static_cast<unsigned_t>(value) ^ sign));
+        }
+
+        // IEEE 754: flip every bit of negatives and only the sign bit of positives
+        template<typename T, typename Bits>
+        void encode_floating(uint8_t* dst, T value) {
+            constexpr auto sign = static_cast<Bits>(Bits{1} << (8 * sizeof(Bits) - 1));
+            if (value == T(0)) {
+                value = T(0); // -0.0 == 0.0
+            }
+            auto bits = std::bit_cast<Bits>(value);
+            bits = (bits & sign) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign);
+            store_big_endian(dst, bits);
+        }
+
+        void encode_string(uint8_t* dst, std::string_view value) {
+            constexpr auto prefix = normalized_sorter_t::string_prefix;
+            auto length = std::min(value.size(), prefix);
+            std::memcpy(dst, value.data(), length);
+            std::memset(dst + length, 0, prefix - length);
+            // shorter strings sort first among equal prefixes; prefix + 1 marks a truncated string
+            dst[prefix] = value.size() > prefix ? truncated_length : static_cast<uint8_t>(value.size());
+        }
+
+        size_t encoded_width(types::physical_type type) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                case types::physical_type::UINT8:
+                    return 1;
+                case types::physical_type::INT16:
+                case types::physical_type::UINT16:
+                    return 2;
+                case types::physical_type::INT32:
+                case types::physical_type::UINT32:
+                case types::physical_type::FLOAT:
+                    return 4;
+                case types::physical_type::INT64:
+                case types::physical_type::UINT64:
+                case types::physical_type::DOUBLE:
+                    return 8;
+                case types::physical_type::INT128:
+                case types::physical_type::UINT128:
+                    return 16;
+                case types::physical_type::STRING:
+                    return normalized_sorter_t::string_prefix + 1;
+                default:
+                    return 0;
+            }
+        }
+
+        void encode_value(uint8_t* dst, const vector::vector_t& vec, types::physical_type type, size_t row) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                    encode_signed(dst, vec.data<int8_t>()[row]);
+                    break;
+                case types::physical_type::INT16:
+                    encode_signed(dst, vec.data<int16_t>()[row]);
+                    break;
+                case types::physical_type::INT32:
+                    encode_signed(dst, vec.data<int32_t>()[row]);
+                    break;
+                case types::physical_type::INT64:
+                    encode_signed(dst, vec.data<int64_t>()[row]);
+                    break;
+                case types::physical_type::UINT8:
+                    store_big_endian(dst, vec.data<uint8_t>()[row]);
+                    break;
+                case types::physical_type::UINT16:
+                    store_big_endian(dst, vec.data<uint16_t>()[row]);
+                    break;
+                case types::physical_type::UINT32:
+                    store_big_endian(dst, vec.data<uint32_t>()[row]);
+                    break;
+                case types::physical_type::UINT64:
+                    store_big_endian(dst, vec.data<uint64_t>()[row]);
+                    break;
+                case types::physical_type::INT128: {
+                    auto value = vec.data<types::int128_t>()[row];
+                    encode_signed(dst, absl::Int128High64(value));
+                    store_big_endian(dst + 8, absl::Int128Low64(value));
+                    break;
+                }
+                case types::physical_type::UINT128: {
+                    auto value = vec.data<types::uint128_t>()[row];
+                    store_big_endian(dst, absl::Uint128High64(value));
+                    store_big_endian(dst + 8, absl::Uint128Low64(value));
+                    break;
+                }
+                case types::physical_type::FLOAT:
+                    encode_floating<float, uint32_t>(dst, vec.data<float>()[row]);
+                    break;
+                case types::physical_type::DOUBLE:
+                    encode_floating<double, uint64_t>(dst, vec.data<double>()[row]);
+                    break;
+                case types::physical_type::STRING:
+                    encode_string(dst, vec.data<types::string_t>()[row]);
+                    break;
+                default:
+                    assert(false && "type without normalized key");
+            }
+        }
+
+    } // anonymous namespace
+
+    normalized_sorter_t::normalized_sorter_t(std::pmr::memory_resource* resource, const columnar_sorter_t& sorter)
+        : sorter_(sorter)
+        , rows_(resource)
+        , scratch_(resource) {
+        for (size_t i = 0; i < sorter.key_count(); i++) {
+            const auto* vec = sorter.key_vector(i);
+            if (!vec) {
+                continue;
+            }
+            auto type = vec->type().to_physical_type();
+            auto width = encoded_width(type);
+            if (width == 0) {
+                supported_ = false;
+                return;
+            }
+            bool descending = sorter.key_order(i) == order::descending;
+            bool is_string = type == types::physical_type::STRING;
+            auto marker = descending ? static_cast<uint8_t>(~truncated_length) : truncated_length;
+            keys_.push_back({vec, type, key_width_, width + 1, descending, is_string, marker});
+            key_width_ += width + 1;
+            has_strings_ |= is_string;
+        }
+        row_width_ = key_width_ + sizeof(uint64_t);
+        truncated_markers_.assign(key_width_, -1);
+        for (const auto& key : keys_) {
+            if (key.is_string) {
+                truncated_markers_[key.offset + key.width - 1] = key.truncated_marker;
+            }
+        }
+    }
+
+    void normalized_sorter_t::sort(size_t count, uint64_t* out, core::scheduler::task_pool_t* pool, size_t min_run) {
+        assert(supported_);
+        rows_.resize(count * row_width_);
+        scratch_.resize(count * row_width_);
+
+        min_run = std::max<size_t>(2, min_run);
+        size_t runs = 1;
+        if (pool && pool->size() > 0 && count >= 2 * min_run) {
+            runs = std::min(pool->size() + 1, count / min_run);
+        }
+        auto run_size = (count + runs - 1) / runs;
+        std::vector<size_t> bounds;
+        for (size_t begin = 0; begin < count; begin += run_size) {
+            bounds.push_back(begin);
+        }
+        bounds.push_back(count);
+
+        core::scheduler::parallel_for(pool, bounds.size() - 1, 1, [&](size_t begin, size_t end) {
+            for (auto run = begin; run < end; run++) {
+                encode(bounds[run], bounds[run + 1]);
+                radix_sort(rows_.data() + bounds[run] * row_width_,
+                           scratch_.data() + bounds[run] * row_width_,
+                           bounds[run + 1] - bounds[run],
+                           0);
+            }
+        });
+        merge_runs(bounds, out, pool);
+    }
+
+    void normalized_sorter_t::encode(size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            auto* row = rows_.data() + i * row_width_;
+            for (const auto& key : keys_) {
+                auto* dst = row + key.offset;
+                // NULL is the largest value: last when ascending, first when descending
+                if (key.vec->is_null(i)) {
+                    dst[0] = 1;
+                    std::memset(dst + 1, 0, key.width - 1);
+                } else {
+                    dst[0] = 0;
+                    encode_value(dst + 1, *key.vec, key.type, i);
+                }
+                if (key.descending) {
+                    for (size_t b = 0; b < key.width; b++) {
+                        dst[b] = static_cast<uint8_t>(~dst[b]);
+                    }
+                }
+            }
+            uint64_t index = i;
+            std::memcpy(row + key_width_, &index, sizeof(index));
+        }
+    }
+
+    // MSD radix sort of `count` key rows on the bytes from `depth` on; `scratch` is a buffer of the
+    // same size. Buckets whose rows share a truncated string prefix cannot be ordered by the bytes
+    // that follow it and go to the comparison sort instead.
+    void normalized_sorter_t::radix_sort(uint8_t* rows, uint8_t* scratch, size_t count, size_t depth) const {
+        while (depth < key_width_) {
+            if (count <= insertion_sort_threshold) {
+                insertion_sort(rows, scratch, count);
+                return;
+            }
+            size_t counts[256] = {};
+            for (size_t i = 0; i < count; i++) {
+                counts[rows[i * row_width_ + depth]]++;
+            }
+            auto marker = truncated_markers_[depth];
+            // every row has the same byte here: nothing to move, look at the next one
+            if (counts[rows[depth]] == count) {
+                if (marker == rows[depth]) {
+                    comparison_sort(rows, scratch, count);
+                    return;
+                }
+                depth++;
+                continue;
+            }
+            size_t offsets[256];
+            size_t offset = 0;
+            for (size_t b = 0; b < 256; b++) {
+                offsets[b] = offset;
+                offset += counts[b];
+            }
+            // scattering walks the rows in order, so equal keys keep their input order
+            for (size_t i = 0; i < count; i++) {
+                const auto* row = rows + i * row_width_;
+                std::memcpy(scratch + offsets[row[depth]]++ * row_width_, row, row_width_);
+            }
+            std::memcpy(rows, scratch, count * row_width_);
+
+            size_t begin = 0;
+            for (size_t b = 0; b < 256; b++) {
+                auto* bucket = rows + begin * row_width_;
+                auto* bucket_scratch = scratch + begin * row_width_;
+                if (counts[b] > 1 && marker == static_cast<int>(b)) {
+                    comparison_sort(bucket, bucket_scratch, counts[b]);
+                } else if (counts[b] > 1) {
+                    radix_sort(bucket, bucket_scratch, counts[b], depth + 1);
+                }
+                begin += counts[b];
+            }
+            return;
+        }
+    }
+
+    void normalized_sorter_t::insertion_sort(uint8_t* rows, uint8_t* temp, size_t count) const {
+        for (size_t i = 1; i < count; i++) {
+            std::memcpy(temp, rows + i * row_width_, row_width_);
+            size_t j = i;
+            while (j > 0 && less(temp, rows + (j - 1) * row_width_)) {
+                std::memcpy(rows + j * row_width_, rows + (j - 1) * row_width_, row_width_);
+                j--;
+            }
+            if (j != i) {
+                std::memcpy(rows + j * row_width_, temp, row_width_);
+            }
+        }
+    }
+
+    void normalized_sorter_t::comparison_sort(uint8_t* rows, uint8_t* scratch, size_t count) const {
+        std::vector<const uint8_t*> order(count);
+        for (size_t i = 0; i < count; i++) {
+            order[i] = rows + i * row_width_;
+        }
+        std::sort(order.begin(), order.end(), [this](const uint8_t* a, const uint8_t* b) { return less(a, b); });
+        for (size_t i = 0; i < count; i++) {
+            std::memcpy(scratch + i * row_width_, order[i], row_width_);
+        }
+        std::memcpy(rows, scratch, count * row_width_);
+    }
+
+    void normalized_sorter_t::merge_runs(const std::vector<size_t>& bounds,
+                                         uint64_t* out,
+                                         core::scheduler::task_pool_t* pool) {
+        auto runs = bounds.size() - 1;
+        if (runs == 1) {
+            for (size_t pos = 0; pos < bounds.back(); pos++) {
+                out[pos] = row_of(row_at(pos));
+            }
+            return;
+        }
+
+        // Splitters from an even sample of every run cut each run into `runs` slices; slice j of all
+        // runs merges into its own range of the output, independently of the others.
+        auto partitions = runs;
+        std::vector<const uint8_t*> samples;
+        for (size_t run = 0; run < runs; run++) {
+            auto length = bounds[run + 1] - bounds[run];
+            for (size_t s = 1; s <= partitions; s++) {
+                samples.push_back(row_at(bounds[run] + (length * s) / (partitions + 1)));
+            }
+        }
+        std::sort(samples.begin(), samples.end(), [this](const uint8_t* a, const uint8_t* b) { return less(a, b); });
+
+        // cuts[run * (partitions + 1) + j] is the first position of slice j in that run
+        std::vector<size_t> cuts((partitions + 1) * runs);
+        for (size_t run = 0; run < runs; run++) {
+            auto* run_cuts = cuts.data() + run * (partitions + 1);
+            run_cuts[0] = bounds[run];
+            run_cuts[partitions] = bounds[run + 1];
+            for (size_t j = 1; j < partitions; j++) {
+                const auto* splitter = samples[(j * samples.size()) / partitions];
+                size_t low = run_cuts[j - 1];
+                size_t high = bounds[run + 1];
+                while (low < high) {
+                    auto mid = low + (high - low) / 2;
+                    if (less(row_at(mid), splitter)) {
+                        low = mid + 1;
+                    } else {
+                        high = mid;
+                    }
+                }
+                run_cuts[j] = low;
+            }
+        }
+
+        std::vector<size_t> starts(partitions + 1, 0);
+        for (size_t j = 0; j < partitions; j++) {
+            starts[j + 1] = starts[j];
+            for (size_t run = 0; run < runs; run++) {
+                const auto* run_cuts = cuts.data() + run * (partitions + 1);
+                starts[j + 1] += run_cuts[j + 1] - run_cuts[j];
+            }
+        }
+
+        core::scheduler::parallel_for(pool, partitions, 1, [&](size_t begin, size_t end) {
+            struct cursor_t {
+                size_t pos;
+                size_t end;
+            };
+            auto heap_less = [this](const cursor_t& a, const cursor_t& b) {
+                return less(row_at(b.pos), row_at(a.pos));
+            };
+            std::vector<cursor_t> heap;
+            for (auto j = begin; j < end; j++) {
+                heap.clear();
+                for (size_t run = 0; run < runs; run++) {
+                    const auto* run_cuts = cuts.data() + run * (partitions + 1);
+                    if (run_cuts[j] < run_cuts[j + 1]) {
+                        heap.push_back({run_cuts[j], run_cuts[j + 1]});
+                    }
+                }
+                std::make_heap(heap.begin(), heap.end(), heap_less);
+                auto target = starts[j];
+                while (!heap.empty()) {
+                    std::pop_heap(heap.begin(), heap.end(), heap_less);
+                    auto& cursor = heap.back();
+                    out[target++] = row_of(row_at(cursor.pos));
+                    if (++cursor.pos < cursor.end) {
+                        std::push_heap(heap.begin(), heap.end(), heap_less);
+                    } else {
+                        heap.pop_back();
+                    }
+                }
+            }
+        });
+    }
+
+    bool normalized_sorter_t::less(const uint8_t* a, const uint8_t* b) const {
+        if (!has_strings_) {
+            auto cmp = std::memcmp(a, b, key_width_);
+            if (cmp != 0) {
+                return cmp < 0;
+            }
+            return row_of(a) < row_of(b);
+        }
+        for (const auto& key : keys_) {
+            auto cmp = std::memcmp(a + key.offset, b + key.offset, key.width);
+            if (cmp != 0) {
+                return cmp < 0;
+            }
+            // equal truncated prefixes: the bytes of the later keys do not decide anything yet
+            if (key.is_string && a[key.offset + key.width - 1] == key.truncated_marker) {
+                auto row_a = row_of(a);
+                auto row_b = row_of(b);
+                if (sorter_(row_a, row_b)) {
+                    return true;
+                }
+                if (sorter_(row_b, row_a)) {
+                    return false;
+                }
+                return row_a < row_b;
+            }
+        }
+        return row_of(a) < row_of(b);
+    }
+
+    uint64_t normalized_sorter_t::row_of(const uint8_t* row) const {
+        uint64_t index;
+        std::memcpy(&index, row + key_width_, sizeof(index));
+        return index;
+    }
+
+} // namespace components::sort
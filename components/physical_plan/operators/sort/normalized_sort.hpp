@@ -0,0 +1,66 @@
+#pragma once
+
+#include "sort.hpp"
+
+#include <core/scheduler/task_pool.hpp>
+
+namespace components::sort {
+
+    // Sorts the rows of the chunk bound to a columnar_sorter_t on normalized keys: every ORDER BY
+    // key is encoded into a fixed-width byte string that compares with memcmp, NULL placement and
+    // DESC included, so the hot loop never branches on the key type. Strings keep a prefix of
+    // `string_prefix` bytes; rows whose truncated prefixes tie are ordered by the columnar comparator.
+    //
+    // The key rows are cut into runs that are MSD-radix-sorted on separate threads and then
+    // k-way merged into disjoint ranges of the output picked by sampled splitters. The result is
+    // stable: rows that compare equal keep their input order.
+    class normalized_sorter_t {
+    public:
+        static constexpr size_t string_prefix = 12;
+
+        // `sorter` must be bound to the chunk with set_chunk()
+        normalized_sorter_t(std::pmr::memory_resource* resource, const columnar_sorter_t& sorter);
+
+        // False when a key has no fixed-width encoding (STRUCT, LIST, ...); sort such chunks with the
+        // columnar comparator instead.
+        bool is_supported() const noexcept { return supported_; }
+
+        // Writes the sorted permutation of rows [0, count) into `out`. Runs are at least `min_run`
+        // rows long; without a pool everything happens on the calling thread.
+        void sort(size_t count, uint64_t* out, core::scheduler::task_pool_t* pool, size_t min_run);
+
+    private:
+        struct encoded_key_t {
+            const vector::vector_t* vec;
+            types::physical_type type;
+            size_t offset; // of the NULL marker inside a key row
+            size_t width;  // marker included
+            bool descending;
+            bool is_string;
+            uint8_t truncated_marker; // length byte of a string longer than the prefix, as stored
+        };
+
+        void encode(size_t begin, size_t end);
+        void radix_sort(uint8_t* rows, uint8_t* scratch, size_t count, size_t depth) const;
+        void insertion_sort(uint8_t* rows, uint8_t* temp, size_t count) const;
+        void comparison_sort(uint8_t* rows, uint8_t* scratch, size_t count) const;
+        void merge_runs(const std::vector<size_t>& bounds, uint64_t* out, core::scheduler::task_pool_t* pool);
+
+        // Total order over key rows: key bytes up to the first truncated string prefix, then the
+        // columnar comparator, then the row index
+        bool less(const uint8_t* a, const uint8_t* b) const;
+        uint64_t row_of(const uint8_t* row) const;
+        const uint8_t* row_at(size_t position) const { return rows_.data() + position * row_width_; }
+
+        const columnar_sorter_t& sorter_;
+        std::vector<encoded_key_t> keys_;
+        size_t key_width_{0};
+        size_t row_width_{0};
+        bool has_strings_{false};
+        bool supported_{true};
+        std::vector<int> truncated_markers_; // per key byte: the marker when it is a string length byte, else -1
+        std::pmr::vector<uint8_t> rows_;
+        std::pmr::vector<uint8_t> scratch_;
+    };
+
+} // namespace components::sort
@@ -23,6 +23,34 @@ namespace components::sort {
         }
     }
 
+    bool columnar_sorter_t::is_concurrent_safe() const {
+        for (const auto& k : keys_) {
+            if (!k.vec) {
+                continue;
+            }
+            switch (k.vec->type().to_physical_type()) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                case types::physical_type::INT16:
+                case types::physical_type::INT32:
+                case types::physical_type::INT64:
+                case types::physical_type::UINT8:
+                case types::physical_type::UINT16:
+                case types::physical_type::UINT32:
+                case types::physical_type::UINT64:
+                case types::physical_type::INT128:
+                case types::physical_type::UINT128:
+                case types::physical_type::FLOAT:
+                case types::physical_type::DOUBLE:
+                case types::physical_type::STRING:
+                    break;
+                default:
+                    return false;
+            }
+        }
+        return true;
+    }
+
     namespace {
 
         template<typename T>
@@ -71,7 +99,7 @@ namespace components::sort {
             case types::physical_type::DOUBLE:
                 return compare_typed<double>(vec, a, b);
             case types::physical_type::STRING:
-                return compare_typed<std::string_view>(vec, a, b);
+                return compare_typed<types::string_t>(vec, a, b);
             default: {
                 // Fallback for composite types (STRUCT, LIST, etc.) — use logical_value_t
                 if (!vec.resource())
@@ -29,6 +29,14 @@ namespace components::sort {
 
         void set_chunk(const vector::data_chunk_t& chunk);
 
+        // True when every key compares raw buffers only (no logical_value_t fallback that
+        // allocates), so that the comparator may be called from several threads at once.
+        bool is_concurrent_safe() const;
+
+        size_t key_count() const noexcept { return keys_.size(); }
+        const vector::vector_t* key_vector(size_t i) const noexcept { return keys_[i].vec; }
+        order key_order(size_t i) const noexcept { return keys_[i].order_; }
+
         bool operator()(size_t row_a, size_t row_b) const {
             for (const auto& k : keys_) {
                 if (!k.vec)
@@ -9,6 +9,7 @@
 #include "impl/create_plan_match.hpp"
 #include "impl/create_plan_sort.hpp"
 #include "impl/create_plan_update.hpp"
+#include "impl/create_plan_window.hpp"
 
 namespace services::planner {
 
@@ -25,11 +26,11 @@ namespace services::planner {
             case node_type::data_t:
                 return impl::create_plan_data(node);
             case node_type::delete_t:
-                return impl::create_plan_delete(context, node);
+                return impl::create_plan_delete(context, node, params);
             case node_type::insert_t:
                 return impl::create_plan_insert(context, function_registry, node, std::move(limit), params);
             case node_type::match_t:
-                return impl::create_plan_match(context, node, std::move(limit));
+                return impl::create_plan_match(context, node, std::move(limit), params);
             case node_type::having_t:
                 return impl::create_plan_having(context, node, std::move(limit));
             case node_type::group_t:
@@ -37,9 +38,11 @@ namespace services::planner {
             case node_type::sort_t:
                 return impl::create_plan_sort(context, node);
             case node_type::update_t:
-                return impl::create_plan_update(context, node);
+                return impl::create_plan_update(context, node, params);
             case node_type::join_t:
                 return impl::create_plan_join(context, function_registry, node, std::move(limit), params);
+            case node_type::window_t:
+                return impl::create_plan_window(context, node, params);
             default:
                 break;
         }
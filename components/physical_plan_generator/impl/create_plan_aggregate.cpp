@@ -1,15 +1,138 @@
 #include "create_plan_aggregate.hpp"
+#include "create_plan_match.hpp"
 
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/expressions/scalar_expression.hpp>
+#include <components/expressions/sort_expression.hpp>
 #include <components/logical_plan/node_aggregate.hpp>
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/operators/aggregation.hpp>
 #include <components/physical_plan/operators/operator_distinct.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
 
+#include <algorithm>
+
 namespace services::planner::impl {
 
     using components::logical_plan::node_type;
 
+    namespace {
+
+        using components::expressions::expression_group;
+
+        // Collects the top-level input columns referenced by `params`; false when that cannot be
+        // determined at plan time (unresolved keys, expressions evaluated elsewhere).
+        bool collect_columns(const std::pmr::vector<components::expressions::param_storage>& params,
+                             const std::vector<std::string>& aggregate_aliases,
+                             std::vector<size_t>& columns);
+
+        bool collect_columns(const components::expressions::expression_ptr& expr,
+                             const std::vector<std::string>& aggregate_aliases,
+                             std::vector<size_t>& columns) {
+            using namespace components::expressions;
+            switch (expr->group()) {
+                case expression_group::scalar: {
+                    const auto* scalar = static_cast<const scalar_expression_t*>(expr.get());
+                    if (scalar->params().empty()) {
+                        const auto& path = scalar->key().path();
+                        if (path.empty()) {
+                            return false;
+                        }
+                        columns.push_back(path.front());
+                        return true;
+                    }
+                    return collect_columns(scalar->params(), aggregate_aliases, columns);
+                }
+                case expression_group::aggregate:
+                    return collect_columns(static_cast<const aggregate_expression_t*>(expr.get())->params(),
+                                           aggregate_aliases,
+                                           columns);
+                case expression_group::compare: {
+                    const auto* compare = static_cast<const compare_expression_t*>(expr.get());
+                    std::pmr::vector<param_storage> params(std::pmr::get_default_resource());
+                    params.push_back(compare->left());
+                    params.push_back(compare->right());
+                    for (const auto& child : compare->children()) {
+                        params.emplace_back(child);
+                    }
+                    return collect_columns(params, aggregate_aliases, columns);
+                }
+                default:
+                    return false;
+            }
+        }
+
+        bool collect_columns(const std::pmr::vector<components::expressions::param_storage>& params,
+                             const std::vector<std::string>& aggregate_aliases,
+                             std::vector<size_t>& columns) {
+            using namespace components::expressions;
+            for (const auto& param : params) {
+                if (std::holds_alternative<components::expressions::key_t>(param)) {
+                    const auto& key = std::get<components::expressions::key_t>(param);
+                    if (!key.path().empty()) {
+                        columns.push_back(key.path().front());
+                    } else if (key.storage().empty() ||
+                               std::find(aggregate_aliases.begin(),
+                                         aggregate_aliases.end(),
+                                         std::string(key.storage().back())) == aggregate_aliases.end()) {
+                        return false;
+                    }
+                } else if (std::holds_alternative<expression_ptr>(param)) {
+                    if (!collect_columns(std::get<expression_ptr>(param), aggregate_aliases, columns)) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        // Input columns of the group (and the filter below it); the scan only has to produce these.
+        std::optional<std::vector<size_t>> required_columns(const components::logical_plan::node_ptr& group,
+                                                            const components::logical_plan::node_ptr& match) {
+            std::vector<std::string> aggregate_aliases;
+            for (const auto& expr : group->expressions()) {
+                if (expr->group() == expression_group::aggregate) {
+                    aggregate_aliases.push_back(
+                        static_cast<const components::expressions::aggregate_expression_t*>(expr.get())
+                            ->key()
+                            .as_string());
+                }
+            }
+            std::vector<size_t> columns;
+            for (const auto* node : {&group, &match}) {
+                if (!*node) {
+                    continue;
+                }
+                for (const auto& expr : (*node)->expressions()) {
+                    if (!collect_columns(expr, aggregate_aliases, columns)) {
+                        return std::nullopt;
+                    }
+                }
+            }
+            return columns;
+        }
+
+        // ORDER BY the scan could satisfy by itself: a single ascending top-level column, with no
+        // grouping in between that would reorder or reshape the rows.
+        std::string scan_order_by(const components::logical_plan::node_ptr& sort,
+                                  const components::logical_plan::node_ptr& group,
+                                  const components::logical_plan::node_ptr& having) {
+            if (!sort || group || having || sort->expressions().size() != 1) {
+                return {};
+            }
+            const auto* sort_expr =
+                static_cast<const components::expressions::sort_expression_t*>(sort->expressions().front().get());
+            const auto& key = sort_expr->key();
+            if (sort_expr->order() != components::expressions::sort_order::asc || key.path().size() != 1 ||
+                key.storage().empty()) {
+                return {};
+            }
+            return std::string(key.storage().back());
+        }
+
+    } // namespace
+
     components::operators::operator_ptr
     create_plan_aggregate(const context_storage_t& context,
                           const components::compute::function_registry_t& function_registry,
@@ -32,27 +155,66 @@ namespace services::planner::impl {
                       new components::operators::aggregation(context.resource, context.log.clone(), coll_name))
                 : boost::intrusive_ptr(new components::operators::aggregation(node->resource(), log_t{}, coll_name));
         op->set_limit(limit);
+
+        components::logical_plan::node_ptr match, group, sort, having, window;
+        for (const components::logical_plan::node_ptr& child : node->children()) {
+            switch (child->type()) {
+                case node_type::match_t:
+                    match = child;
+                    break;
+                case node_type::group_t:
+                    group = child;
+                    break;
+                case node_type::sort_t:
+                    sort = child;
+                    break;
+                case node_type::having_t:
+                    having = child;
+                    break;
+                case node_type::window_t:
+                    window = child;
+                    break;
+                default:
+                    break;
+            }
+        }
+        scan_hints_t hints;
+        // window functions see every row and project them, so neither the limit nor the order
+        // can be pushed into the scan
+        auto match_limit = window ? components::logical_plan::limit_t::unlimit() : limit;
+        if (!window) {
+            hints.order_by = scan_order_by(sort, group, having);
+        }
+        if (group) {
+            hints.required_columns = required_columns(group, match);
+        }
+
         for (const components::logical_plan::node_ptr& child : node->children()) {
             switch (child->type()) {
                 case node_type::limit_t:
                     break; // already handled above
                 case node_type::match_t:
-                    op->set_match(create_plan(context, function_registry, child, limit, params));
+                    op->set_match(create_plan_match(context, child, match_limit, params, &hints));
                     break;
                 case node_type::group_t:
                     op->set_group(create_plan(context, function_registry, child, limit, params));
                     break;
                 case node_type::sort_t:
-                    op->set_sort(create_plan(context, function_registry, child, limit, params));
-                    break;
+                    break; // planned after the match, which may already deliver the order
                 case node_type::having_t:
                     op->set_having(create_plan(context, function_registry, child, limit, params));
                     break;
+                case node_type::window_t:
+                    op->set_window(create_plan(context, function_registry, child, limit, params));
+                    break;
                 default:
                     op->set_children(create_plan(context, function_registry, child, limit, params));
                     break;
             }
         }
+        if (sort && !hints.ordered) {
+            op->set_sort(create_plan(context, function_registry, sort, limit, params));
+        }
         // Check if DISTINCT flag is set on the aggregate node
         const auto* agg_node = static_cast<const components::logical_plan::node_aggregate_t*>(node.get());
         if (agg_node->is_distinct()) {
@@ -11,7 +11,8 @@
 namespace services::planner::impl {
 
     components::operators::operator_ptr create_plan_delete(const context_storage_t& context,
-                                                           const components::logical_plan::node_ptr& node) {
+                                                           const components::logical_plan::node_ptr& node,
+                                                           const components::logical_plan::storage_parameters* params) {
         const auto* node_delete = static_cast<const components::logical_plan::node_delete_t*>(node.get());
 
         components::logical_plan::node_ptr node_match = nullptr;
@@ -31,7 +32,7 @@ namespace services::planner::impl {
         if (node_delete->collection_from().empty() && !node_raw_data) {
             auto plan = boost::intrusive_ptr(
                 new components::operators::operator_delete(context.resource, context.log.clone(), coll_name));
-            plan->set_children(create_plan_match(context, node_match, limit));
+            plan->set_children(create_plan_match(context, node_match, limit, params));
 
             return plan;
         } else {
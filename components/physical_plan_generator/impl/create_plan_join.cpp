@@ -5,8 +5,76 @@
 #include <components/physical_plan/operators/operator_join.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
 
+#include <optional>
+
 namespace services::planner::impl {
 
+    namespace {
+
+        // An inner equi-join whose right side is a whole table with an index on the join column is
+        // run as an index nested-loop join: the right table is never scanned, its rows are fetched
+        // by probing the index with the left keys. Hash indexes are preferred for the probes.
+        struct index_lookup_t {
+            const index_definition_t* index{nullptr};
+            components::expressions::key_t left_key;
+        };
+
+        std::optional<index_lookup_t> choose_index_lookup(const context_storage_t& context,
+                                                          const components::logical_plan::node_join_t* join_node) {
+            using namespace components::expressions;
+            using components::logical_plan::index_type;
+            const auto& right = join_node->children().back();
+            if (join_node->type() != components::logical_plan::join_type::inner || join_node->expressions().empty() ||
+                join_node->children().size() != 2 || !right ||
+                right->type() != components::logical_plan::node_type::aggregate_t || !right->children().empty() ||
+                !right->expressions().empty() || !context.has_collection(right->collection_full_name())) {
+                return std::nullopt;
+            }
+            const auto& expr = join_node->expressions().front();
+            if (expr->group() != expression_group::compare) {
+                return std::nullopt;
+            }
+            const auto* compare = static_cast<const compare_expression_t*>(expr.get());
+            if (compare->type() != compare_type::eq ||
+                !std::holds_alternative<components::expressions::key_t>(compare->left()) ||
+                !std::holds_alternative<components::expressions::key_t>(compare->right())) {
+                return std::nullopt;
+            }
+            const auto* left_key = &std::get<components::expressions::key_t>(compare->left());
+            const auto* right_key = &std::get<components::expressions::key_t>(compare->right());
+            if (left_key->side() == side_t::right) {
+                std::swap(left_key, right_key);
+            }
+            if (left_key->side() != side_t::left || right_key->side() != side_t::right || left_key->path().empty() ||
+                right_key->path().size() != 1 || right_key->storage().empty()) {
+                return std::nullopt;
+            }
+            const auto* indexes = context.indexes_of(right->collection_full_name());
+            if (!indexes) {
+                return std::nullopt;
+            }
+            auto column = std::string(right_key->storage().back());
+            const index_definition_t* best = nullptr;
+            for (const auto& index : *indexes) {
+                if (index.keys.size() != 1 || index.keys.front().as_string() != column) {
+                    continue;
+                }
+                if (index.type == index_type::hashed) {
+                    best = &index;
+                    break;
+                }
+                if (!best && (index.type == index_type::single || index.type == index_type::art)) {
+                    best = &index;
+                }
+            }
+            if (!best) {
+                return std::nullopt;
+            }
+            return index_lookup_t{best, *left_key};
+        }
+
+    } // namespace
+
     components::operators::operator_ptr
     create_plan_join(const context_storage_t& context,
                      const components::compute::function_registry_t& function_registry,
@@ -33,6 +101,14 @@ namespace services::planner::impl {
         if (node->children().front()) {
             left = create_plan(context, function_registry, node->children().front(), limit, params);
         }
+        if (auto lookup = choose_index_lookup(context, join_node); lookup && left) {
+            join->set_index_lookup(right_name,
+                                   lookup->index->keys,
+                                   lookup->index->key_type,
+                                   std::move(lookup->left_key));
+            join->set_children(std::move(left));
+            return join;
+        }
         if (node->children().back()) {
             right = create_plan(context, function_registry, node->children().back(), limit, params);
         }
@@ -4,16 +4,223 @@
 #include <components/expressions/function_expression.hpp>
 #include <components/physical_plan/operators/operator_match.hpp>
 #include <components/physical_plan/operators/scan/full_scan.hpp>
+#include <components/physical_plan/operators/scan/index_scan.hpp>
+#include <components/physical_plan/operators/scan/primary_key_scan.hpp>
 #include <components/physical_plan/operators/scan/transfer_scan.hpp>
 
 namespace services::planner::impl {
 
-    // Note: Index selection is handled at execution time by the executor
-    // (via intercept_scan_/index_engine), not during plan generation.
-    // Plan always creates full_scan/transfer_scan; executor may optimize
-    // to index_scan based on available indexes.
+    // Index selection: a pure compare predicate is split into conjuncts and every index of the
+    // collection is matched against them by its leading key. Equality / IN lookups beat two-sided
+    // ranges, which beat one-sided ones. Conjuncts the index does not answer are re-checked by an
+    // operator_match_t over the index_scan; rows come out in key order either way. A hash index
+    // answers equality / IN only and is read through a primary_key_scan, without key order. A conjunct
+    // whose parameters do not convert to the key type is left to the filter.
     namespace {
 
+        using components::expressions::compare_type;
+
+        // Restriction a single conjunct puts on one column: a comparison with a parameter or an IN list.
+        struct index_term_t {
+            std::string column;
+            compare_type type;
+            std::vector<core::parameter_id_t> params;
+        };
+
+        struct index_access_t {
+            const index_definition_t* index{nullptr};
+            components::operators::index_scan_spec_t spec;
+            int rank{0};
+            // Every conjunct is answered by the index, no residual filter is needed
+            bool exact{false};
+        };
+
+        std::optional<index_term_t> make_index_term(const components::expressions::compare_expression_ptr& expr) {
+            using namespace components::expressions;
+            switch (expr->type()) {
+                case compare_type::eq:
+                case compare_type::gt:
+                case compare_type::gte:
+                case compare_type::lt:
+                case compare_type::lte: {
+                    if (!std::holds_alternative<components::expressions::key_t>(expr->left()) ||
+                        !std::holds_alternative<core::parameter_id_t>(expr->right())) {
+                        return std::nullopt;
+                    }
+                    const auto& key = std::get<components::expressions::key_t>(expr->left());
+                    if (key.path().size() != 1 || key.storage().empty()) {
+                        return std::nullopt;
+                    }
+                    return index_term_t{std::string(key.storage().back()),
+                                        expr->type(),
+                                        {std::get<core::parameter_id_t>(expr->right())}};
+                }
+                case compare_type::union_or: {
+                    // IN (...) arrives as a disjunction of equalities on the same column
+                    index_term_t in{{}, compare_type::eq, {}};
+                    for (const auto& child : expr->children()) {
+                        auto term = make_index_term(reinterpret_cast<const compare_expression_ptr&>(child));
+                        if (!term || term->type != compare_type::eq ||
+                            (!in.column.empty() && term->column != in.column)) {
+                            return std::nullopt;
+                        }
+                        in.column = term->column;
+                        in.params.insert(in.params.end(), term->params.begin(), term->params.end());
+                    }
+                    if (in.params.empty()) {
+                        return std::nullopt;
+                    }
+                    return in;
+                }
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        bool term_fits_index(const index_term_t& term,
+                             const index_definition_t& index,
+                             const components::logical_plan::storage_parameters* params) {
+            if (!params) {
+                return true;
+            }
+            return std::all_of(term.params.begin(), term.params.end(), [&](core::parameter_id_t id) {
+                const auto& value = params->parameters.at(id);
+                return value.is_null() || components::index::index_probe_comparable(value, index.key_type);
+            });
+        }
+
+        index_access_t choose_index(const context_storage_t& context,
+                                    const collection_full_name_t& coll_name,
+                                    const components::expressions::compare_expression_ptr& expr,
+                                    const components::logical_plan::storage_parameters* params,
+                                    const scan_hints_t* hints) {
+            index_access_t best;
+            const auto* indexes = context.indexes_of(coll_name);
+            if (!indexes || indexes->empty()) {
+                return best;
+            }
+
+            std::vector<std::optional<index_term_t>> terms;
+            if (expr->type() == compare_type::union_and) {
+                for (const auto& child : expr->children()) {
+                    using components::expressions::compare_expression_ptr;
+                    terms.push_back(make_index_term(reinterpret_cast<const compare_expression_ptr&>(child)));
+                }
+            } else {
+                terms.push_back(make_index_term(expr));
+            }
+
+            bool best_ordered = false;
+            bool best_hashed = false;
+            for (const auto& index : *indexes) {
+                // Only the ordered engines (btree and ART) are able to answer range lookups; a multi-column
+                // index is searched by its leading key
+                bool hashed = index.type == components::logical_plan::index_type::hashed;
+                if ((index.type != components::logical_plan::index_type::single &&
+                     index.type != components::logical_plan::index_type::art && !hashed) ||
+                    index.keys.empty()) {
+                    continue;
+                }
+                auto column = index.keys.front().as_string();
+                index_access_t access;
+                access.index = &index;
+                size_t used = 0;
+                for (const auto& term : terms) {
+                    if (term && term->column == column && term->type == compare_type::eq &&
+                        term_fits_index(*term, index, params)) {
+                        access.spec.points = term->params;
+                        access.rank = 3;
+                        used = 1;
+                        break;
+                    }
+                }
+                if (access.spec.points.empty() && !hashed) {
+                    for (const auto& term : terms) {
+                        if (!term || term->column != column || !term_fits_index(*term, index, params)) {
+                            continue;
+                        }
+                        components::operators::index_scan_bound_t bound{term->params.front()};
+                        if ((term->type == compare_type::gt || term->type == compare_type::gte) && !access.spec.lower) {
+                            bound.inclusive = term->type == compare_type::gte;
+                            access.spec.lower = bound;
+                            ++used;
+                        } else if ((term->type == compare_type::lt || term->type == compare_type::lte) &&
+                                   !access.spec.upper) {
+                            bound.inclusive = term->type == compare_type::lte;
+                            access.spec.upper = bound;
+                            ++used;
+                        }
+                    }
+                    access.rank = static_cast<int>(access.spec.lower.has_value()) +
+                                  static_cast<int>(access.spec.upper.has_value());
+                }
+                if (access.rank == 0) {
+                    continue;
+                }
+                access.spec.key_type = index.key_type;
+                access.exact = used == terms.size();
+                // Between equal candidates an ordered index wins when it saves a sort, a hash index otherwise
+                bool ordered = !hashed && hints && hints->order_by == column;
+                if (std::tie(access.rank, access.exact, ordered, hashed) >
+                    std::tie(best.rank, best.exact, best_ordered, best_hashed)) {
+                    best = std::move(access);
+                    best_ordered = ordered;
+                    best_hashed = hashed;
+                }
+            }
+            return best;
+        }
+
+        components::operators::operator_ptr create_index_scan(const context_storage_t& context,
+                                                              const collection_full_name_t& coll_name,
+                                                              const components::expressions::expression_ptr& expr,
+                                                              index_access_t access,
+                                                              components::logical_plan::limit_t limit,
+                                                              scan_hints_t* hints) {
+            auto column = access.index->keys.front().as_string();
+            if (access.index->type == components::logical_plan::index_type::hashed) {
+                auto lookup = boost::intrusive_ptr(new components::operators::primary_key_scan(
+                    context.resource,
+                    context.log.clone(),
+                    coll_name,
+                    access.index->keys,
+                    std::move(access.spec.points),
+                    std::move(access.spec.key_type),
+                    access.exact ? limit : components::logical_plan::limit_t::unlimit()));
+                if (hints) {
+                    hints->ordered = false;
+                }
+                if (access.exact) {
+                    return lookup;
+                }
+                auto match_operator = boost::intrusive_ptr(
+                    new components::operators::operator_match_t(context.resource, context.log.clone(), expr, limit));
+                match_operator->set_children(std::move(lookup));
+                return match_operator;
+            }
+            auto scan = boost::intrusive_ptr(
+                new components::operators::index_scan(context.resource,
+                                                      context.log.clone(),
+                                                      coll_name,
+                                                      access.index->keys,
+                                                      std::move(access.spec),
+                                                      access.exact ? limit
+                                                                   : components::logical_plan::limit_t::unlimit()));
+            if (hints) {
+                if (hints->required_columns) {
+                    scan->set_required_columns(*hints->required_columns);
+                }
+                hints->ordered = hints->order_by == column;
+            }
+            if (access.exact) {
+                return scan;
+            }
+            auto match_operator = boost::intrusive_ptr(
+                new components::operators::operator_match_t(context.resource, context.log.clone(), expr, limit));
+            match_operator->set_children(std::move(scan));
+            return match_operator;
+        }
+
         bool is_pure_compare(const components::expressions::expression_ptr& expr) {
             using namespace components::expressions;
             if (expr->group() != expression_group::compare) {
@@ -33,14 +240,20 @@ namespace services::planner::impl {
             return true;
         }
 
-        components::operators::operator_ptr create_plan_match_(const context_storage_t& context,
-                                                               const collection_full_name_t& coll_name,
-                                                               const components::expressions::expression_ptr& expr,
-                                                               components::logical_plan::limit_t limit) {
+        components::operators::operator_ptr
+        create_plan_match_(const context_storage_t& context,
+                           const collection_full_name_t& coll_name,
+                           const components::expressions::expression_ptr& expr,
+                           components::logical_plan::limit_t limit,
+                           const components::logical_plan::storage_parameters* params,
+                           scan_hints_t* hints) {
             if (context.has_collection(coll_name)) {
                 // TODO: function_expr in scans
                 if (is_pure_compare(expr)) {
                     auto comp_expr = reinterpret_cast<const components::expressions::compare_expression_ptr&>(expr);
+                    if (auto access = choose_index(context, coll_name, comp_expr, params, hints); access.index) {
+                        return create_index_scan(context, coll_name, expr, std::move(access), limit, hints);
+                    }
                     return boost::intrusive_ptr(new components::operators::full_scan(context.resource,
                                                                                      context.log.clone(),
                                                                                      coll_name,
@@ -69,7 +282,9 @@ namespace services::planner::impl {
 
     components::operators::operator_ptr create_plan_match(const context_storage_t& context,
                                                           const components::logical_plan::node_ptr& node,
-                                                          components::logical_plan::limit_t limit) {
+                                                          components::logical_plan::limit_t limit,
+                                                          const components::logical_plan::storage_parameters* params,
+                                                          scan_hints_t* hints) {
         if (node->expressions().empty()) {
             if (context.has_collection(node->collection_full_name())) {
                 return boost::intrusive_ptr(
@@ -79,7 +294,12 @@ namespace services::planner::impl {
                     new components::operators::transfer_scan(nullptr, node->collection_full_name(), limit));
             }
         } else {
-            return create_plan_match_(context, node->collection_full_name(), node->expressions()[0], limit);
+            return create_plan_match_(context,
+                                      node->collection_full_name(),
+                                      node->expressions()[0],
+                                      limit,
+                                      params,
+                                      hints);
         }
     }
 
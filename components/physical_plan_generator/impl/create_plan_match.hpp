@@ -5,14 +5,28 @@
 #include <components/physical_plan/operators/operator.hpp>
 #include <services/collection/context_storage.hpp>
 
+#include <optional>
+
 namespace services::planner::impl {
 
+    // What the operators above a scan need from it; lets create_plan_match pick an index access path.
+    struct scan_hints_t {
+        // Column the consumer wants ascending rows of; empty when no order is requested.
+        std::string order_by;
+        // Top-level columns read above the scan; nullopt when any column may be read.
+        std::optional<std::vector<size_t>> required_columns;
+        // Set by create_plan_match when the chosen scan already yields rows ordered by `order_by`.
+        bool ordered{false};
+    };
+
     components::operators::operator_ptr create_plan_match(const context_storage_t& context,
                                                           const components::logical_plan::node_ptr& node,
-                                                          components::logical_plan::limit_t limit);
+                                                          components::logical_plan::limit_t limit,
+                                                          const components::logical_plan::storage_parameters* params,
+                                                          scan_hints_t* hints = nullptr);
 
     components::operators::operator_ptr create_plan_having(const context_storage_t& context,
                                                            const components::logical_plan::node_ptr& node,
                                                            components::logical_plan::limit_t limit);
 
-} // namespace services::planner::impl
\ No newline at end of file
+} // namespace services::planner::impl
@@ -10,7 +10,8 @@
 namespace services::planner::impl {
 
     components::operators::operator_ptr create_plan_update(const context_storage_t& context,
-                                                           const components::logical_plan::node_ptr& node) {
+                                                           const components::logical_plan::node_ptr& node,
+                                                           const components::logical_plan::storage_parameters* params) {
         const auto* node_update = static_cast<const components::logical_plan::node_update_t*>(node.get());
 
         components::logical_plan::node_ptr node_match = nullptr;
@@ -33,7 +34,7 @@ namespace services::planner::impl {
                                                                                         coll_name,
                                                                                         node_update->updates(),
                                                                                         node_update->upsert()));
-            plan->set_children(create_plan_match(context, node_match, limit));
+            plan->set_children(create_plan_match(context, node_match, limit, params));
 
             return plan;
         } else {
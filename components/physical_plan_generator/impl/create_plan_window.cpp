@@ -0,0 +1,94 @@
+#include "create_plan_window.hpp"
+
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/scalar_expression.hpp>
+#include <components/logical_plan/node_window.hpp>
+#include <components/physical_plan/operators/operator_window.hpp>
+
+namespace services::planner::impl {
+
+    namespace {
+
+        const std::pmr::vector<size_t>& resolved_path(const components::expressions::key_t& key) {
+            if (key.path().empty()) {
+                throw std::logic_error("Window key has unresolved path: " + key.as_string());
+            }
+            return key.path();
+        }
+
+        const components::types::logical_value_t&
+        parameter_value(const components::expressions::param_storage& param,
+                        const components::logical_plan::storage_parameters* params) {
+            if (!std::holds_alternative<core::parameter_id_t>(param) || !params) {
+                throw std::logic_error("Window function expects a constant argument");
+            }
+            return params->parameters.at(std::get<core::parameter_id_t>(param));
+        }
+
+    } // namespace
+
+    components::operators::operator_ptr create_plan_window(const context_storage_t& context,
+                                                           const components::logical_plan::node_ptr& node,
+                                                           const components::logical_plan::storage_parameters* params) {
+        using namespace components::expressions;
+        using components::logical_plan::window_function_type;
+
+        const auto* window_node = static_cast<const components::logical_plan::node_window_t*>(node.get());
+        auto coll_name = node->collection_full_name();
+        auto* resource = context.has_collection(coll_name) ? context.resource : node->resource();
+        auto window =
+            context.has_collection(coll_name)
+                ? boost::intrusive_ptr(
+                      new components::operators::operator_window_t(context.resource, context.log.clone()))
+                : boost::intrusive_ptr(new components::operators::operator_window_t(node->resource(), log_t{}));
+
+        size_t window_index = 0;
+        for (const auto& expr : node->expressions()) {
+            if (expr->group() == expression_group::scalar) {
+                const auto* column = static_cast<const scalar_expression_t*>(expr.get());
+                const auto& key = column->params().empty()
+                                      ? column->key()
+                                      : std::get<components::expressions::key_t>(column->params().front());
+                window->add_column(std::pmr::string(column->key().as_string(), resource), resolved_path(key));
+                continue;
+            }
+
+            const auto* aggregate = static_cast<const aggregate_expression_t*>(expr.get());
+            const auto& spec = window_node->windows().at(window_index++);
+            auto type = components::logical_plan::window_function_from_name(aggregate->function_name());
+            if (!type) {
+                throw std::logic_error("Unknown window function: " + aggregate->function_name());
+            }
+
+            components::operators::window_function_t function(resource);
+            function.name = aggregate->key().as_string();
+            function.type = *type;
+            const auto& args = aggregate->params();
+            if (!args.empty() && std::holds_alternative<components::expressions::key_t>(args.front())) {
+                function.argument = resolved_path(std::get<components::expressions::key_t>(args.front()));
+            }
+            if (*type == window_function_type::lag || *type == window_function_type::lead) {
+                if (args.size() > 1) {
+                    function.offset =
+                        parameter_value(args[1], params)
+                            .cast_as(components::types::complex_logical_type(components::types::logical_type::BIGINT))
+                            .value<int64_t>();
+                }
+                if (args.size() > 2) {
+                    function.default_value = parameter_value(args[2], params);
+                }
+            }
+            for (const auto& key : spec.partition_by) {
+                function.partition_by.push_back(resolved_path(key));
+            }
+            for (const auto& order : spec.order_by) {
+                function.order_by.emplace_back(resolved_path(order->key()),
+                                               components::sort::order(order->order()));
+            }
+            function.frame = spec.frame;
+            window->add_function(std::move(function));
+        }
+        return window;
+    }
+
+} // namespace services::planner::impl
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <components/logical_plan/node.hpp>
+#include <components/logical_plan/param_storage.hpp>
+#include <components/physical_plan/operators/operator.hpp>
+#include <services/collection/context_storage.hpp>
+
+namespace services::planner::impl {
+
+    components::operators::operator_ptr
+    create_plan_window(const context_storage_t& context,
+                       const components::logical_plan::node_ptr& node,
+                       const components::logical_plan::storage_parameters* params = nullptr);
+
+}
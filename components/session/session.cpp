@@ -25,8 +25,7 @@ namespace components::session {
     session_id_t::session_id_t()
         : data_(0)
         , counter_(0) {
-        uniq_counter.fetch_add(1);
-        counter_ = static_cast<uint64_t>(uniq_counter);
+        counter_ = static_cast<uint64_t>(uniq_counter.fetch_add(1) + 1);
         data_ = static_cast<uint64_t>(std::time(nullptr)); //todo recanting
     }
 
@@ -226,6 +226,18 @@ TEST_CASE("components::sql::index") {
     TEST_TRANSFORMER_OK("CREATE INDEX some_idx ON db.table (field);",
                         R"_($create_index: db.table name:some_idx[ field ] type:single)_");
 
+    TEST_TRANSFORMER_OK("CREATE INDEX some_idx ON db.table USING btree (field);",
+                        R"_($create_index: db.table name:some_idx[ field ] type:single)_");
+
+    TEST_TRANSFORMER_OK("CREATE INDEX some_idx ON db.table USING ART (field);",
+                        R"_($create_index: db.table name:some_idx[ field ] type:art)_");
+
+    TEST_TRANSFORMER_OK("CREATE INDEX some_idx ON db.table USING hash (field);",
+                        R"_($create_index: db.table name:some_idx[ field ] type:hashed)_");
+
+    TEST_TRANSFORMER_ERROR("CREATE INDEX some_idx ON db.table USING gist (field);",
+                           R"_(unsupported index access method: gist)_");
+
     SECTION("drop with uuid") {
         auto drop = raw_parser(&arena_resource, "DROP INDEX uuid.db.schema.table.some_idx")->lst.front().data;
         auto result = std::get<result_view>(transformer.transform(pg_cell_to_node_cast(drop)).finalize());
@@ -253,6 +253,31 @@ TEST_CASE("components::sql::group_by") {
                        vec({v(&resource, 9.99)}));
 }
 
+TEST_CASE("components::sql::window_functions") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    std::pmr::monotonic_buffer_resource arena_resource(&resource);
+    transform::transformer transformer(&resource);
+
+    TEST_SIMPLE_SELECT(
+        R"_(SELECT id, row_number() OVER (PARTITION BY grp ORDER BY id) AS rn FROM TestCollection;)_",
+        R"_($aggregate: {$window: {id, rn: {$row_number, $over: {$partition: [grp], $sort: {id: 1}, )_"
+        R"_($range: [$unbounded_preceding, $current_row]}}}})_",
+        vec());
+
+    TEST_SIMPLE_SELECT(
+        R"_(SELECT id, sum(amount) OVER (ORDER BY id ROWS BETWEEN 2 PRECEDING AND 1 FOLLOWING) AS s )_"
+        R"_(FROM TestCollection WHERE id > 10 ORDER BY s DESC;)_",
+        R"_($aggregate: {$match: {"id": {$gt: #0}}, $window: {id, s: {$sum: "amount", $over: {$sort: {id: 1}, )_"
+        R"_($rows: [{$preceding: 2}, {$following: 1}]}}}, $sort: {s: -1}})_",
+        vec({v(&resource, 10l)}));
+
+    TEST_SIMPLE_SELECT(
+        R"_(SELECT lag(price, 1, 0) OVER (PARTITION BY grp ORDER BY id DESC) AS prev FROM TestCollection;)_",
+        R"_($aggregate: {$window: {prev: {$lag: ["price", #0, #1], $over: {$partition: [grp], $sort: {id: -1}, )_"
+        R"_($range: [$unbounded_preceding, $current_row]}}}})_",
+        vec({v(&resource, 1l), v(&resource, 0l)}));
+}
+
 TEST_CASE("components::sql::select_from_fields") {
     auto resource = std::pmr::synchronized_pool_resource();
     std::pmr::monotonic_buffer_resource arena_resource(&resource);
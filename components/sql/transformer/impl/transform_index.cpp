@@ -6,13 +6,31 @@
 using namespace components::expressions;
 
 namespace components::sql::transform {
+    namespace {
+        logical_plan::index_type index_type_of(const char* access_method) {
+            std::string_view method = access_method ? access_method : DEFAULT_INDEX_TYPE;
+            if (method == DEFAULT_INDEX_TYPE) {
+                return logical_plan::index_type::single;
+            }
+            if (method == "art") {
+                return logical_plan::index_type::art;
+            }
+            if (method == "hash") {
+                return logical_plan::index_type::hashed;
+            }
+            throw parser_exception_t{"unsupported index access method: " + std::string(method), ""};
+        }
+    } // namespace
+
     logical_plan::node_ptr transformer::transform_create_index(IndexStmt& node) {
         if (!(node.relation->relname && node.relation->catalogname && node.idxname)) {
             throw parser_exception_t{"incorrect create index arguments", ""};
         }
 
-        auto create_index =
-            logical_plan::make_node_create_index(resource_, rangevar_to_collection(node.relation), node.idxname);
+        auto create_index = logical_plan::make_node_create_index(resource_,
+                                                                 rangevar_to_collection(node.relation),
+                                                                 node.idxname,
+                                                                 index_type_of(node.accessMethod));
         for (auto key : node.indexParams->lst) {
             create_index->keys().emplace_back(resource_, pg_ptr_cast<IndexElem>(key.data)->name);
         }
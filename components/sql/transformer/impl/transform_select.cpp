@@ -122,8 +122,19 @@ namespace components::sql::transform {
         }
 
         auto group = logical_plan::make_node_group(resource_, agg->collection_full_name());
-        // fields — collect expressions into group
-        {
+        // window functions — the whole SELECT list is projected by a window node instead of the group
+        logical_plan::node_ptr window;
+        bool has_window = std::any_of(node.targetList->lst.begin(), node.targetList->lst.end(), [](const auto& target) {
+            auto res = pg_ptr_cast<ResTarget>(target.data);
+            return nodeTag(res->val) == T_FuncCall && pg_ptr_cast<FuncCall>(res->val)->over;
+        });
+        if (has_window) {
+            if (node.havingClause || (node.groupClause && !node.groupClause->lst.empty())) {
+                throw std::runtime_error("GROUP BY and HAVING can not be combined with window functions");
+            }
+            window = transform_select_window(*node.targetList, agg->collection_full_name(), names, params);
+        } else {
+            // fields — collect expressions into group
             for (auto target : node.targetList->lst) {
                 auto res = pg_ptr_cast<ResTarget>(target.data);
                 switch (nodeTag(res->val)) {
@@ -314,6 +325,10 @@ namespace components::sql::transform {
             }
         }
 
+        if (window) {
+            agg->append_child(window);
+        }
+
         // having (parse before GROUP BY so the group node is created only once)
         expression_ptr having_expr;
         if (node.havingClause) {
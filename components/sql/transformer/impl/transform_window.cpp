@@ -0,0 +1,161 @@
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/scalar_expression.hpp>
+#include <components/expressions/sort_expression.hpp>
+#include <components/logical_plan/node_window.hpp>
+#include <components/sql/parser/pg_functions.h>
+#include <components/sql/transformer/transformer.hpp>
+#include <components/sql/transformer/utils.hpp>
+
+using namespace components::expressions;
+
+namespace components::sql::transform {
+
+    namespace {
+
+        int64_t frame_offset(Node* offset) {
+            if (!offset || nodeTag(offset) != T_A_Const) {
+                throw std::runtime_error("Window frame offset must be an integer constant");
+            }
+            auto* value = &(pg_ptr_cast<A_Const>(offset)->val);
+            if (nodeTag(value) != T_Integer || intVal(value) < 0) {
+                throw std::runtime_error("Window frame offset must be a non-negative integer");
+            }
+            return intVal(value);
+        }
+
+        // START_* and END_* frame options are adjacent bits: END_x == START_x << 1
+        logical_plan::window_bound_t frame_bound(int options, int shift, Node* offset) {
+            using logical_plan::window_bound_type;
+            if (options & (FRAMEOPTION_START_UNBOUNDED_PRECEDING << shift)) {
+                return {window_bound_type::unbounded_preceding, 0};
+            }
+            if (options & (FRAMEOPTION_START_UNBOUNDED_FOLLOWING << shift)) {
+                return {window_bound_type::unbounded_following, 0};
+            }
+            if (options & (FRAMEOPTION_START_VALUE_PRECEDING << shift)) {
+                return {window_bound_type::preceding, frame_offset(offset)};
+            }
+            if (options & (FRAMEOPTION_START_VALUE_FOLLOWING << shift)) {
+                return {window_bound_type::following, frame_offset(offset)};
+            }
+            return {window_bound_type::current_row, 0};
+        }
+
+        logical_plan::window_frame_t frame_from_options(const WindowDef& window) {
+            logical_plan::window_frame_t frame;
+            if (!(window.frameOptions & FRAMEOPTION_NONDEFAULT)) {
+                return frame;
+            }
+            frame.mode = (window.frameOptions & FRAMEOPTION_ROWS) ? logical_plan::window_frame_mode::rows
+                                                                  : logical_plan::window_frame_mode::range;
+            frame.start = frame_bound(window.frameOptions, 0, window.startOffset);
+            if (window.frameOptions & FRAMEOPTION_BETWEEN) {
+                frame.end = frame_bound(window.frameOptions, 1, window.endOffset);
+            } else {
+                frame.end = {logical_plan::window_bound_type::current_row, 0};
+            }
+            if (frame.mode == logical_plan::window_frame_mode::range &&
+                (frame.start.type == logical_plan::window_bound_type::preceding ||
+                 frame.start.type == logical_plan::window_bound_type::following ||
+                 frame.end.type == logical_plan::window_bound_type::preceding ||
+                 frame.end.type == logical_plan::window_bound_type::following)) {
+                throw std::runtime_error("RANGE frames with offsets are not supported, use ROWS");
+            }
+            return frame;
+        }
+
+    } // namespace
+
+    logical_plan::node_ptr transformer::transform_select_window(List& targets,
+                                                                const collection_full_name_t& collection,
+                                                                const name_collection_t& names,
+                                                                logical_plan::parameter_node_t* params) {
+        auto window = logical_plan::make_node_window(resource_, collection);
+        for (auto target : targets.lst) {
+            auto res = pg_ptr_cast<ResTarget>(target.data);
+            switch (nodeTag(res->val)) {
+                case T_ColumnRef: {
+                    auto ref = pg_ptr_cast<ColumnRef>(res->val);
+                    if (nodeTag(ref->fields->lst.front().data) == T_A_Star) {
+                        // expanded into the incoming columns during validation
+                        window->append_column(make_scalar_expression(resource_,
+                                                                     scalar_type::get_field,
+                                                                     expressions::key_t{resource_, "*"}));
+                    } else if (res->name) {
+                        window->append_column(make_scalar_expression(resource_,
+                                                                     scalar_type::get_field,
+                                                                     expressions::key_t{resource_, res->name},
+                                                                     columnref_to_field(resource_, ref, names).field));
+                    } else {
+                        window->append_column(make_scalar_expression(resource_,
+                                                                     scalar_type::get_field,
+                                                                     columnref_to_field(resource_, ref, names).field));
+                    }
+                    break;
+                }
+                case T_FuncCall: {
+                    auto func = pg_ptr_cast<FuncCall>(res->val);
+                    if (!func->over) {
+                        throw std::runtime_error("Aggregates can not be mixed with window functions");
+                    }
+                    if (func->over->name || func->over->refname) {
+                        throw std::runtime_error("Named windows are not supported");
+                    }
+                    auto funcname = std::string{strVal(linitial(func->funcname))};
+                    auto expr = make_aggregate_expression(
+                        resource_,
+                        funcname,
+                        expressions::key_t{resource_, res->name ? std::string{res->name} : funcname});
+                    if (func->args) {
+                        for (const auto& arg : func->args->lst) {
+                            auto arg_value = pg_ptr_cast<Node>(arg.data);
+                            if (nodeTag(arg_value) == T_ColumnRef) {
+                                auto key = columnref_to_field(resource_, pg_ptr_cast<ColumnRef>(arg_value), names);
+                                key.deduce_side(names);
+                                expr->append_param(std::move(key.field));
+                            } else {
+                                expr->append_param(add_param_value(arg_value, params));
+                            }
+                        }
+                    }
+
+                    logical_plan::window_spec_t spec(resource_);
+                    if (func->over->partitionClause) {
+                        for (auto item : func->over->partitionClause->lst) {
+                            auto partition = pg_ptr_cast<Node>(item.data);
+                            if (nodeTag(partition) == T_SortBy) {
+                                partition = pg_ptr_cast<SortBy>(partition)->node;
+                            }
+                            if (nodeTag(partition) != T_ColumnRef) {
+                                throw std::runtime_error("Unknown node type in PARTITION BY: " +
+                                                         node_tag_to_string(nodeTag(partition)));
+                            }
+                            spec.partition_by.emplace_back(
+                                columnref_to_field(resource_, pg_ptr_cast<ColumnRef>(partition), names).field);
+                        }
+                    }
+                    if (func->over->orderClause) {
+                        for (auto item : func->over->orderClause->lst) {
+                            auto sortby = pg_ptr_cast<SortBy>(item.data);
+                            if (nodeTag(sortby->node) != T_ColumnRef) {
+                                throw std::runtime_error("Unknown node type in window ORDER BY: " +
+                                                         node_tag_to_string(nodeTag(sortby->node)));
+                            }
+                            spec.order_by.emplace_back(make_sort_expression(
+                                columnref_to_field(resource_, pg_ptr_cast<ColumnRef>(sortby->node), names).field,
+                                sortby->sortby_dir == SORTBY_DESC ? sort_order::desc : sort_order::asc));
+                        }
+                    }
+                    spec.frame = frame_from_options(*func->over);
+                    window->append_window_function(expr, std::move(spec));
+                    break;
+                }
+                default:
+                    throw std::runtime_error("Unknown node type in field clause with window functions: " +
+                                             node_tag_to_string(nodeTag(res->val)));
+            }
+        }
+        return window;
+    }
+
+} // namespace components::sql::transform
@@ -83,6 +83,13 @@ namespace components::sql::transform {
                                         logical_plan::parameter_node_t* params,
                                         logical_plan::node_ptr& group);
 
+        // SELECT list with window functions (calls with OVER): columns and window functions become
+        // the projection of a node_window_t
+        logical_plan::node_ptr transform_select_window(List& targets,
+                                                       const collection_full_name_t& collection,
+                                                       const name_collection_t& names,
+                                                       logical_plan::parameter_node_t* params);
+
         // Resolve a HAVING operand: FuncCall → aggregate alias key
         expressions::param_storage resolve_having_operand(Node* node,
                                                           const name_collection_t& names,
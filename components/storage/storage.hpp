@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <memory_resource>
 #include <vector>
@@ -65,6 +66,12 @@ namespace components::storage {
         virtual void revert_append(int64_t /*row_start*/, uint64_t /*count*/) {}
         virtual void commit_all_deletes(uint64_t /*txn_id*/, uint64_t /*commit_id*/) {}
 
+        // Start and row count of the row group holding `row_id`. Deletes and updates of rows in different
+        // row groups share no state and may run concurrently; the default treats the table as one group.
+        virtual std::pair<int64_t, uint64_t> row_group_range(int64_t /*row_id*/) {
+            return {0, std::numeric_limits<uint64_t>::max()};
+        }
+
         virtual std::pmr::memory_resource* resource() const = 0;
     };
 
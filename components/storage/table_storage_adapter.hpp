@@ -2,6 +2,7 @@
 
 #include "storage.hpp"
 #include <components/table/data_table.hpp>
+#include <components/table/row_group.hpp>
 #include <components/table/table_state.hpp>
 
 namespace components::storage {
@@ -144,6 +145,14 @@ namespace components::storage {
             return {start_row, count};
         }
 
+        std::pair<int64_t, uint64_t> row_group_range(int64_t row_id) override {
+            if (row_id < 0 || static_cast<uint64_t>(row_id) >= total_rows()) {
+                return storage_t::row_group_range(row_id);
+            }
+            auto* row_group = table_.row_group()->row_group_tree()->get_segment(row_id);
+            return {row_group->start, row_group->count};
+        }
+
         uint64_t delete_rows(vector::vector_t& row_ids, uint64_t count) override {
             auto delete_state = table_.initialize_delete({});
             return table_.delete_rows(*delete_state, row_ids, count, 0);
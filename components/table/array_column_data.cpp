@@ -263,6 +263,11 @@ namespace components::table {
         child_column->get_column_segment_info(row_group_index, col_path, result);
     }
 
+    void array_column_data_t::collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        validity.collect_unloaded_blocks(blocks);
+        child_column->collect_unloaded_blocks(blocks);
+    }
+
     size_t array_column_data_t::array_size() const {
         return static_cast<const types::array_logical_type_extension*>(type_.extension())->size();
     }
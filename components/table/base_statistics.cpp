@@ -73,11 +73,12 @@ namespace components::table {
                                  std::pmr::memory_resource* resource,
                                  const vector::vector_t& vec,
                                  uint64_t count) {
-            auto data = vec.data<std::string_view>();
+            auto data = vec.data<types::string_t>();
             const auto& validity = vec.validity();
             bool found_valid = false;
-            std::string local_min;
-            std::string local_max;
+            // entries of `vec`: the prefix decides most comparisons without reading the strings
+            types::string_t local_min;
+            types::string_t local_max;
             uint64_t null_count = 0;
 
             if (vec.get_vector_type() == vector::vector_type::CONSTANT) {
@@ -85,9 +86,8 @@ namespace components::table {
                 if (!validity.row_is_valid(0)) {
                     null_count = count;
                 } else {
-                    std::string val(data[0]);
-                    local_min = val;
-                    local_max = val;
+                    local_min = data[0];
+                    local_max = data[0];
                     found_valid = true;
                 }
             } else {
@@ -96,7 +96,7 @@ namespace components::table {
                         null_count++;
                         continue;
                     }
-                    std::string val(data[i]);
+                    const auto& val = data[i];
                     if (!found_valid) {
                         local_min = val;
                         local_max = val;
@@ -112,8 +112,8 @@ namespace components::table {
 
             stats.set_null_count(stats.null_count() + null_count);
             if (found_valid) {
-                types::logical_value_t batch_min(resource, local_min);
-                types::logical_value_t batch_max(resource, local_max);
+                types::logical_value_t batch_min(resource, std::string(local_min.view()));
+                types::logical_value_t batch_max(resource, std::string(local_max.view()));
                 if (!stats.has_stats()) {
                     stats.set_min(std::move(batch_min));
                     stats.set_max(std::move(batch_max));
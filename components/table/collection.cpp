@@ -73,9 +73,12 @@ namespace components::table {
         state.row_groups = row_groups_.get();
         state.max_row = row_start_ + static_cast<int64_t>(total_rows_.load());
         state.initialize(types_);
+        state.read_ahead_end = 0;
+        state.read_ahead_blocks = 0;
         while (row_group && !row_group->initialize_scan(state)) {
             row_group = row_groups_->next_segment(row_group);
         }
+        state.read_ahead();
     }
 
     void collection_t::initialize_create_index_scan(create_index_scan_state& state) {
@@ -95,6 +98,9 @@ namespace components::table {
         if (!row_group->initialize_scan_with_offset(state, start_vector)) {
             throw std::logic_error("Failed to initialize row group scan with offset");
         }
+        state.read_ahead_end = 0;
+        state.read_ahead_blocks = 0;
+        state.read_ahead();
     }
 
     bool collection_t::initialize_scan_in_row_group(collection_scan_state& state,
@@ -431,6 +437,64 @@ namespace components::table {
         return result;
     }
 
+    std::shared_ptr<collection_t> collection_t::vacuum(double threshold, row_id_remap_t& remap) {
+        auto result =
+            std::make_shared<collection_t>(resource_, block_manager_, types_, row_start_, 0, row_group_size_);
+        auto segments = row_groups_->move_segments();
+        auto old_end = row_start_ + static_cast<int64_t>(total_rows_.load());
+        total_rows_ = 0;
+
+        std::vector<storage_index_t> column_ids;
+        for (uint64_t i = 0; i < types_.size(); i++) {
+            column_ids.emplace_back(i);
+        }
+        table_scan_state scan_state(resource_);
+        scan_state.initialize(column_ids, nullptr);
+        vector::data_chunk_t chunk(resource_, types_, vector::DEFAULT_VECTOR_CAPACITY);
+
+        auto new_start = row_start_;
+        for (auto& entry : segments) {
+            auto& row_group = entry.node;
+            auto count = row_group->count.load();
+            auto deleted = count - row_group->committed_row_count();
+            if (static_cast<double>(deleted) <= threshold * static_cast<double>(count)) {
+                if (count == 0) {
+                    continue;
+                }
+                remap.keep(row_group->start, count, new_start);
+                row_group->move_to_collection(result.get(), new_start);
+                new_start += static_cast<int64_t>(count);
+                result->total_rows_ += count;
+                result->allocation_size_ += row_group->allocation_size();
+                result->row_groups_->append_segment(std::move(row_group));
+                continue;
+            }
+
+            // live rows go to the end of the result, filling up the previous rewritten row group
+            auto& state = scan_state.table_state;
+            initialize_scan_in_row_group(state, *this, *row_group, 0, row_group->start + static_cast<int64_t>(count));
+            table_append_state append_state(resource_);
+            result->initialize_append(append_state);
+            while (true) {
+                chunk.reset();
+                row_group->scan_committed(state, chunk, table_scan_type::COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+                if (chunk.size() == 0) {
+                    break;
+                }
+                // row_ids of a committed scan are offsets inside the row group
+                auto offsets = chunk.row_ids.data<int64_t>();
+                for (uint64_t i = 0; i < chunk.size(); i++) {
+                    remap.keep(row_group->start + offsets[i], 1, new_start + static_cast<int64_t>(i));
+                }
+                new_start += static_cast<int64_t>(chunk.size());
+                result->append(chunk, append_state);
+            }
+            result->finalize_append(append_state, transaction_data{0, 0});
+        }
+        remap.finish(old_end, new_start);
+        return result;
+    }
+
     std::vector<storage::row_group_pointer_t>
     collection_t::checkpoint(storage::partial_block_manager_t& partial_block_manager) {
         std::vector<storage::row_group_pointer_t> pointers;
@@ -5,6 +5,7 @@
 #include <functional>
 
 #include "column_data.hpp"
+#include "row_id_remap.hpp"
 #include "row_version_manager.hpp"
 #include "table_state.hpp"
 
@@ -92,6 +93,10 @@ namespace components::table {
 
         std::shared_ptr<collection_t> add_column(column_definition_t& new_column);
         std::shared_ptr<collection_t> remove_column(uint64_t col_idx);
+        // Copy without the permanently deleted rows of the row groups where they make up more than
+        // `threshold` of the rows; the other row groups move over untouched. The row groups are taken
+        // out of this collection, and `remap` receives how row ids moved.
+        std::shared_ptr<collection_t> vacuum(double threshold, row_id_remap_t& remap);
         // TODO: type casting
         // std::shared_ptr<collection_t> alter_type(uint64_t changed_idx, const types::complex_logical_type &target_type,
         // std::vector<storage_index_t> bound_columns);
@@ -33,138 +33,109 @@ namespace components::table {
         , resource_(resource) {}
 
     filter_propagate_result_t column_data_t::check_zonemap(column_scan_state&, table_filter_t& filter) {
-        if (!statistics_.has_stats()) {
+        // Stats may be stale after updates — skip pruning if column has updates
+        if (has_updates()) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
-        if (statistics_.min_value().is_null() || statistics_.max_value().is_null()) {
+        return check_statistics(statistics_, filter);
+    }
+
+    filter_propagate_result_t column_data_t::check_segment_zonemap(column_scan_state& state, table_filter_t& filter) {
+        if (!state.current) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
-        // Stats may be stale after updates — skip pruning if column has updates
-        if (has_updates()) {
+        return check_statistics(state.current->segment_statistics(), filter);
+    }
+
+    filter_propagate_result_t
+    column_data_t::check_zonemap_range(int64_t row, uint64_t count, const table_filter_t& filter) {
+        if (count == 0 || has_updates()) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
-
-        if (filter.filter_type == expressions::compare_type::eq ||
-            filter.filter_type == expressions::compare_type::gt ||
-            filter.filter_type == expressions::compare_type::gte ||
-            filter.filter_type == expressions::compare_type::lt ||
-            filter.filter_type == expressions::compare_type::lte) {
-            auto& constant_filter = filter.cast<constant_filter_t>();
-            const auto& constant = constant_filter.constant;
-            const auto& min = statistics_.min_value();
-            const auto& max = statistics_.max_value();
-
-            switch (filter.filter_type) {
-                case expressions::compare_type::eq:
-                    // eq is impossible if constant < min or constant > max
-                    if (constant < min || constant > max) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    break;
-                case expressions::compare_type::gt:
-                    // value > constant: impossible if max <= constant
-                    if (max <= constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    // always true if min > constant
-                    if (min > constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::gte:
-                    // value >= constant: impossible if max < constant
-                    if (max < constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (min >= constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::lt:
-                    // value < constant: impossible if min >= constant
-                    if (min >= constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (max < constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::lte:
-                    // value <= constant: impossible if min > constant
-                    if (min > constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (max <= constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                default:
-                    break;
+        auto end = row + static_cast<int64_t>(count);
+        auto* segment = data_.get_segment(row);
+        auto result = check_statistics(segment->segment_statistics(), filter);
+        // a range spanning several segments is decided only when all of them agree
+        for (segment = data_.next_segment(segment);
+             segment && segment->start < end && result != filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+             segment = data_.next_segment(segment)) {
+            if (check_statistics(segment->segment_statistics(), filter) != result) {
+                result = filter_propagate_result_t::NO_PRUNING_POSSIBLE;
             }
         }
-        return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        return result;
     }
 
-    filter_propagate_result_t column_data_t::check_segment_zonemap(column_scan_state& state, table_filter_t& filter) {
-        if (!state.current || !state.current->segment_statistics().has_stats()) {
+    filter_propagate_result_t column_data_t::check_statistics(const base_statistics_t& stats,
+                                                              const table_filter_t& filter) {
+        // A row passes a comparison only when it is not NULL, so ALWAYS_TRUE needs a NULL-free range
+        // and IS [NOT] NULL is decided by the null count alone. The null count may overestimate
+        // after a reverted append; it is never compared against the row count.
+        if (filter.filter_type == expressions::compare_type::is_null ||
+            filter.filter_type == expressions::compare_type::is_not_null) {
+            if (!stats.has_stats() || stats.null_count() != 0) {
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
+            return filter.filter_type == expressions::compare_type::is_null ? filter_propagate_result_t::ALWAYS_FALSE
+                                                                            : filter_propagate_result_t::ALWAYS_TRUE;
+        }
+        if (!stats.has_stats() || stats.min_value().is_null() || stats.max_value().is_null()) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
-        auto& seg_stats = state.current->segment_statistics();
-        if (!seg_stats.has_stats() || seg_stats.min_value().is_null() || seg_stats.max_value().is_null()) {
+        switch (filter.filter_type) {
+            case expressions::compare_type::eq:
+            case expressions::compare_type::ne:
+            case expressions::compare_type::gt:
+            case expressions::compare_type::gte:
+            case expressions::compare_type::lt:
+            case expressions::compare_type::lte:
+                break;
+            default:
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        const auto& constant = filter.cast<constant_filter_t>().constant;
+        if (constant.is_null()) {
             return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
         }
-
-        if (filter.filter_type == expressions::compare_type::eq ||
-            filter.filter_type == expressions::compare_type::gt ||
-            filter.filter_type == expressions::compare_type::gte ||
-            filter.filter_type == expressions::compare_type::lt ||
-            filter.filter_type == expressions::compare_type::lte) {
-            auto& constant_filter = filter.cast<constant_filter_t>();
-            const auto& constant = constant_filter.constant;
-            const auto& min = seg_stats.min_value();
-            const auto& max = seg_stats.max_value();
-
-            switch (filter.filter_type) {
-                case expressions::compare_type::eq:
-                    if (constant < min || constant > max) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    break;
-                case expressions::compare_type::gt:
-                    if (max <= constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (min > constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::gte:
-                    if (max < constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (min >= constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::lt:
-                    if (min >= constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (max < constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                case expressions::compare_type::lte:
-                    if (min > constant) {
-                        return filter_propagate_result_t::ALWAYS_FALSE;
-                    }
-                    if (max <= constant) {
-                        return filter_propagate_result_t::ALWAYS_TRUE;
-                    }
-                    break;
-                default:
-                    break;
-            }
+        const auto& min = stats.min_value();
+        const auto& max = stats.max_value();
+        bool always_false = false;
+        bool always_true = false;
+        switch (filter.filter_type) {
+            case expressions::compare_type::eq:
+                // eq is impossible if constant < min or constant > max
+                always_false = constant < min || constant > max;
+                always_true = min == constant && max == constant;
+                break;
+            case expressions::compare_type::ne:
+                always_false = min == constant && max == constant;
+                always_true = constant < min || constant > max;
+                break;
+            case expressions::compare_type::gt:
+                // value > constant: impossible if max <= constant, always true if min > constant
+                always_false = max <= constant;
+                always_true = min > constant;
+                break;
+            case expressions::compare_type::gte:
+                always_false = max < constant;
+                always_true = min >= constant;
+                break;
+            case expressions::compare_type::lt:
+                always_false = min >= constant;
+                always_true = max < constant;
+                break;
+            case expressions::compare_type::lte:
+                always_false = min > constant;
+                always_true = max <= constant;
+                break;
+            default:
+                break;
+        }
+        if (always_false) {
+            return filter_propagate_result_t::ALWAYS_FALSE;
+        }
+        if (always_true && stats.null_count() == 0) {
+            return filter_propagate_result_t::ALWAYS_TRUE;
         }
         return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
     }
@@ -331,7 +302,38 @@ namespace components::table {
         result.slice(indexing, count);
     }
 
-    void column_data_t::skip(column_scan_state& state, uint64_t count) { state.next(count); }
+    void column_data_t::skip(column_scan_state& state, uint64_t count) {
+        if (!state.current) {
+            return;
+        }
+        // the segment catches up with row_index on the next scan
+        state.row_index += static_cast<int64_t>(count);
+        while (state.row_index >= state.current->start + static_cast<int64_t>(state.current->count)) {
+            auto next = data_.next_segment(state.current);
+            if (!next) {
+                break;
+            }
+            state.current = next;
+            state.initialized = false;
+            state.segment_checked = false;
+        }
+    }
+
+    bool column_data_t::filter_compressed(uint64_t vector_index,
+                                          uint64_t count,
+                                          const table_filter_t& filter,
+                                          vector::indexing_vector_t& indexing,
+                                          uint64_t& approved_tuple_count) {
+        if (count == 0 || has_updates()) {
+            return false;
+        }
+        auto row = start_ + static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+        auto* segment = data_.get_segment(row);
+        if (segment->start + static_cast<int64_t>(segment->count) < row + static_cast<int64_t>(count)) {
+            return false;
+        }
+        return segment->filter_compressed(row, count, filter, indexing, approved_tuple_count);
+    }
 
     void column_data_t::initialize_append(column_append_state& state) {
         auto l = data_.lock();
@@ -345,21 +347,33 @@ namespace components::table {
 
     void column_data_t::append(column_append_state& state, vector::vector_t& vector, uint64_t count) {
         statistics_.update(vector, count);
-        // Update per-segment statistics (conservative: full vector stats go to current segment)
-        if (state.current) {
-            base_statistics_t batch_stats(resource_, type_.type());
-            batch_stats.update(vector, count);
-            if (state.current->segment_statistics().has_stats()) {
-                auto merged = state.current->segment_statistics();
+        // Update per-segment statistics (conservative: every segment the vector lands in gets the stats
+        // of the whole vector)
+        base_statistics_t batch_stats(resource_, type_.type());
+        batch_stats.update(vector, count);
+        auto merge_stats = [&batch_stats](column_segment_t* segment) {
+            if (segment->segment_statistics().has_stats()) {
+                auto merged = segment->segment_statistics();
                 merged.merge(batch_stats);
-                state.current->set_segment_statistics(std::move(merged));
+                segment->set_segment_statistics(std::move(merged));
             } else {
-                state.current->set_segment_statistics(std::move(batch_stats));
+                segment->set_segment_statistics(batch_stats);
             }
+        };
+        auto* first_segment = state.current;
+        if (first_segment) {
+            merge_stats(first_segment);
         }
         vector::unified_vector_format uvf(vector.resource(), count);
         vector.to_unified_format(count, uvf);
         append_data(state, uvf, count);
+        // segments started by this append were empty until now
+        for (auto* segment = first_segment; segment && segment != state.current;) {
+            segment = data_.next_segment(segment);
+            if (segment) {
+                merge_stats(segment);
+            }
+        }
     }
 
     void
@@ -497,6 +511,7 @@ namespace components::table {
             column_info.segment_idx = segment_idx;
             column_info.segment_start = segment->start;
             column_info.segment_count = segment->count;
+            column_info.compression = segment->compression();
             column_info.has_updates = has_updates();
             auto segment_state = segment->segment_state();
             if (segment_state) {
@@ -510,6 +525,19 @@ namespace components::table {
         }
     }
 
+    void column_data_t::collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        for (auto segment = data_.root_segment(); segment; segment = data_.next_segment(segment)) {
+            auto& block = segment->block;
+            if (!block || block->block_id() >= storage::MAXIMUM_BLOCK ||
+                block->state() == storage::block_state::LOADED) {
+                continue;
+            }
+            if (blocks.empty() || blocks.back() != block) {
+                blocks.push_back(block);
+            }
+        }
+    }
+
     std::unique_ptr<column_data_t> column_data_t::create_column(std::pmr::memory_resource* resource,
                                                                 storage::block_manager_t& block_manager,
                                                                 uint64_t column_index,
@@ -41,6 +41,10 @@ namespace components::table {
 
         virtual filter_propagate_result_t check_zonemap(column_scan_state& state, table_filter_t& filter);
         filter_propagate_result_t check_segment_zonemap(column_scan_state& state, table_filter_t& filter);
+        // Decides a constant or IS [NOT] NULL filter for rows [row, row + count) from the statistics of
+        // the segments holding them
+        filter_propagate_result_t check_zonemap_range(int64_t row, uint64_t count, const table_filter_t& filter);
+        static filter_propagate_result_t check_statistics(const base_statistics_t& stats, const table_filter_t& filter);
 
         storage::block_manager_t& block_manager() { return block_manager_; }
         virtual uint64_t max_entry();
@@ -101,6 +105,15 @@ namespace components::table {
                                            uint64_t count,
                                            bool allow_updates);
 
+        // Evaluates a constant comparison for rows of vector `vector_index` on the compressed segment
+        // holding them, without decompressing it. Returns false when the rows are not in a single
+        // compressed segment or have updates; the caller then filters the scanned vector.
+        virtual bool filter_compressed(uint64_t vector_index,
+                                       uint64_t count,
+                                       const table_filter_t& filter,
+                                       vector::indexing_vector_t& indexing,
+                                       uint64_t& approved_tuple_count);
+
         virtual void skip(column_scan_state& state, uint64_t count = vector::DEFAULT_VECTOR_CAPACITY);
 
         virtual void initialize_append(column_append_state& state);
@@ -125,6 +138,8 @@ namespace components::table {
         virtual void get_column_segment_info(uint64_t row_group_index,
                                              std::vector<uint64_t> col_path,
                                              std::vector<column_segment_info>& result);
+        // Appends the on-disk blocks of the column that are not in memory, in segment order
+        virtual void collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks);
 
         static std::unique_ptr<column_data_t> create_column(std::pmr::memory_resource* resource,
                                                             storage::block_manager_t& block_manager,
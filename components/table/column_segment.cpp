@@ -219,7 +219,7 @@ namespace components::table {
             auto baseptr = handle.ptr() + segment.block_offset();
             auto dict = dictionary(segment, handle);
             auto base_data = reinterpret_cast<int32_t*>(baseptr + DICTIONARY_HEADER_SIZE);
-            auto result_data = result.data<std::string_view>();
+            auto result_data = result.data<types::string_t>();
 
             auto dict_offset = base_data[row_id];
             uint32_t string_length;
@@ -380,7 +380,7 @@ namespace components::table {
             auto handle = buffer_manager.pin(segment.block);
             assert(segment.block_offset() == 0);
             auto handle_ptr = handle.ptr();
-            auto source_data = data.get_data<std::string_view>();
+            auto source_data = data.get_data<types::string_t>();
             auto result_data = reinterpret_cast<int32_t*>(handle_ptr + DICTIONARY_HEADER_SIZE);
             auto dictionary_size = reinterpret_cast<uint32_t*>(handle_ptr);
             auto dictionary_end = reinterpret_cast<uint32_t*>(handle_ptr + sizeof(uint32_t));
@@ -730,6 +730,156 @@ namespace components::table {
             std::memcpy(result.data() + result_idx * ts, dict_values + dict_idx * ts, ts);
         }
 
+        // --- Filters on compressed data ---
+        // `sel` holds ascending positions relative to `offset`; the comparison runs once per RLE run
+        // or dictionary entry and the selection keeps the positions whose value passed
+
+        template<typename T>
+        bool compare_value(T value, T constant, expressions::compare_type type) {
+            switch (type) {
+                case expressions::compare_type::eq:
+                    return value == constant;
+                case expressions::compare_type::ne:
+                    return value != constant;
+                case expressions::compare_type::gt:
+                    return value > constant;
+                case expressions::compare_type::gte:
+                    return value >= constant;
+                case expressions::compare_type::lt:
+                    return value < constant;
+                case expressions::compare_type::lte:
+                    return value <= constant;
+                default:
+                    throw std::logic_error("Unknown comparison type for filter");
+            }
+        }
+
+        template<typename T>
+        T load_value(const std::byte* ptr) {
+            T value;
+            std::memcpy(&value, ptr, sizeof(T));
+            return value;
+        }
+
+        template<typename T>
+        uint64_t constant_filter(const std::byte* base,
+                                 T constant,
+                                 expressions::compare_type type,
+                                 uint64_t approved_tuple_count) {
+            return compare_value(load_value<T>(base), constant, type) ? approved_tuple_count : 0;
+        }
+
+        template<typename T>
+        uint64_t rle_filter(const std::byte* base,
+                            uint64_t offset,
+                            T constant,
+                            expressions::compare_type type,
+                            vector::indexing_vector_t& sel,
+                            uint64_t approved_tuple_count,
+                            vector::indexing_vector_t& result_sel) {
+            uint32_t num_runs;
+            std::memcpy(&num_runs, base, sizeof(uint32_t));
+            auto* ptr = base + sizeof(uint32_t);
+            auto entry_size = sizeof(T) + sizeof(uint32_t);
+
+            uint64_t run_end = 0; // relative to the segment
+            uint32_t run_idx = 0;
+            bool run_passes = false;
+            uint64_t result_count = 0;
+            for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                auto idx = sel.get_index(i);
+                while (offset + idx >= run_end && run_idx < num_runs) {
+                    auto* entry = ptr + run_idx * entry_size;
+                    uint32_t run_len;
+                    std::memcpy(&run_len, entry + sizeof(T), sizeof(uint32_t));
+                    run_end += run_len;
+                    run_passes = compare_value(load_value<T>(entry), constant, type);
+                    run_idx++;
+                }
+                result_sel.set_index(result_count, idx);
+                result_count += run_passes;
+            }
+            return result_count;
+        }
+
+        template<typename T>
+        uint64_t dict_filter(const std::byte* base,
+                             uint64_t offset,
+                             T constant,
+                             expressions::compare_type type,
+                             vector::indexing_vector_t& sel,
+                             uint64_t approved_tuple_count,
+                             vector::indexing_vector_t& result_sel) {
+            uint16_t num_unique;
+            std::memcpy(&num_unique, base, sizeof(uint16_t));
+            auto* dict_values = base + sizeof(uint16_t);
+            auto* indices = dict_values + num_unique * sizeof(T);
+
+            std::vector<uint8_t> passes(num_unique);
+            for (uint16_t k = 0; k < num_unique; k++) {
+                passes[k] = compare_value(load_value<T>(dict_values + k * sizeof(T)), constant, type);
+            }
+            uint64_t result_count = 0;
+            if (num_unique <= 256) {
+                auto* codes = reinterpret_cast<const uint8_t*>(indices) + offset;
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    auto idx = sel.get_index(i);
+                    result_sel.set_index(result_count, idx);
+                    result_count += passes[codes[idx]];
+                }
+            } else {
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    auto idx = sel.get_index(i);
+                    uint16_t code;
+                    std::memcpy(&code, indices + (offset + idx) * sizeof(uint16_t), sizeof(uint16_t));
+                    result_sel.set_index(result_count, idx);
+                    result_count += passes[code];
+                }
+            }
+            return result_count;
+        }
+
+        template<typename T>
+        void compressed_filter(column_segment_t& segment,
+                               uint64_t offset,
+                               const constant_filter_t& filter,
+                               vector::indexing_vector_t& indexing,
+                               uint64_t& approved_tuple_count) {
+            auto& buffer_manager = segment.block->block_manager.buffer_manager;
+            auto handle = buffer_manager.pin(segment.block);
+            const auto* base = handle.ptr() + segment.block_offset();
+            auto constant = filter.constant.value<T>();
+            switch (segment.compression()) {
+                case compression::compression_type::CONSTANT:
+                    approved_tuple_count = constant_filter<T>(base, constant, filter.filter_type, approved_tuple_count);
+                    return;
+                case compression::compression_type::RLE: {
+                    vector::indexing_vector_t result(indexing.resource(), approved_tuple_count);
+                    approved_tuple_count = rle_filter<T>(base,
+                                                         offset,
+                                                         constant,
+                                                         filter.filter_type,
+                                                         indexing,
+                                                         approved_tuple_count,
+                                                         result);
+                    indexing = result;
+                    return;
+                }
+                default: {
+                    vector::indexing_vector_t result(indexing.resource(), approved_tuple_count);
+                    approved_tuple_count = dict_filter<T>(base,
+                                                          offset,
+                                                          constant,
+                                                          filter.filter_type,
+                                                          indexing,
+                                                          approved_tuple_count,
+                                                          result);
+                    indexing = result;
+                    return;
+                }
+            }
+        }
+
         void validity_scan_partial(column_segment_t& segment,
                                    column_scan_state& state,
                                    uint64_t scan_count,
@@ -840,7 +990,7 @@ namespace components::table {
             auto baseptr = state.scan_state->ptr() + segment.block_offset();
             auto dict = dictionary(segment, *state.scan_state);
             auto base_data = reinterpret_cast<int32_t*>(baseptr + DICTIONARY_HEADER_SIZE);
-            auto result_data = result.data<std::string_view>();
+            auto result_data = result.data<types::string_t>();
 
             int32_t previous_offset = start > 0 ? base_data[start - 1] : 0;
 
@@ -945,17 +1095,20 @@ namespace components::table {
         switch (type.to_physical_type()) {
             case types::physical_type::BIT: {
                 auto& buffer_manager = block->block_manager.buffer_manager;
-                state.scan_state = std::make_unique<storage::buffer_handle_t>(buffer_manager.pin(block));
+                state.scan_state = std::make_unique<storage::buffer_handle_t>(
+                    buffer_manager.pin(block, storage::buffer_access_hint::SEQUENTIAL_SCAN));
                 break;
             }
             case types::physical_type::STRING: {
                 auto& buffer_manager = block->block_manager.buffer_manager;
-                state.scan_state = std::make_unique<storage::buffer_handle_t>(buffer_manager.pin(block));
+                state.scan_state = std::make_unique<storage::buffer_handle_t>(
+                    buffer_manager.pin(block, storage::buffer_access_hint::SEQUENTIAL_SCAN));
                 break;
             }
             default: {
                 auto& buffer_manager = block->block_manager.buffer_manager;
-                state.scan_state = std::make_unique<storage::buffer_handle_t>(buffer_manager.pin(block));
+                state.scan_state = std::make_unique<storage::buffer_handle_t>(
+                    buffer_manager.pin(block, storage::buffer_access_hint::SEQUENTIAL_SCAN));
             }
         }
     }
@@ -982,9 +1135,12 @@ namespace components::table {
         }
         if (compression_ == compression::compression_type::RLE ||
             compression_ == compression::compression_type::DICTIONARY) {
-            // For compressed segments, per-row predicate check on raw block data doesn't work.
-            // Return true (accept the row) — correctness is maintained by the filter
-            // evaluating on the fully scanned/decompressed data.
+            vector::indexing_vector_t indexing(std::pmr::get_default_resource());
+            uint64_t approved_tuple_count = 1;
+            if (filter_compressed(row_id, 1, *filter, indexing, approved_tuple_count)) {
+                return approved_tuple_count == 1;
+            }
+            // a comparison with a constant of another type
             return true;
         }
         switch (type.to_physical_type()) {
@@ -1148,10 +1304,19 @@ namespace components::table {
         auto& mask = uvf.validity;
         auto vec = uvf.get_data<T>();
         uint64_t result_count = 0;
+        COMP comparator{};
+        if (!sel.is_set() && (!uvf.referenced_indexing || !uvf.referenced_indexing->is_set())) {
+            // whole flat vector: a branch-free loop straight over the buffer
+            for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                bool comparison_result = (!HAS_NULL || mask.row_is_valid(i)) && comparator(vec[i], predicate);
+                result_sel.set_index(result_count, i);
+                result_count += comparison_result;
+            }
+            return result_count;
+        }
         for (uint64_t i = 0; i < approved_tuple_count; i++) {
             auto idx = sel.get_index(i);
             auto vector_idx = uvf.referenced_indexing->get_index(idx);
-            COMP comparator{};
             bool comparison_result =
                 (!HAS_NULL || mask.row_is_valid(vector_idx)) && comparator(vec[vector_idx], predicate);
             result_sel.set_index(result_count, idx);
@@ -1349,12 +1514,12 @@ namespace components::table {
                 break;
             }
             case types::physical_type::STRING: {
-                auto predicate = constant_filter.constant.value<std::string_view>();
-                filter_selection_switch<std::string_view>(uvf,
-                                                          predicate,
-                                                          indexing,
-                                                          approved_tuple_count,
-                                                          filter.filter_type);
+                types::string_t predicate = constant_filter.constant.value<std::string_view>();
+                filter_selection_switch<types::string_t>(uvf,
+                                                         predicate,
+                                                         indexing,
+                                                         approved_tuple_count,
+                                                         filter.filter_type);
                 break;
             }
             case types::physical_type::BOOL: {
@@ -1368,6 +1533,89 @@ namespace components::table {
         return approved_tuple_count;
     }
 
+    bool column_segment_t::filter_compressed(int64_t row_index,
+                                             [[maybe_unused]] uint64_t count,
+                                             const table_filter_t& filter,
+                                             vector::indexing_vector_t& indexing,
+                                             uint64_t& approved_tuple_count) {
+        if (compression_ != compression::compression_type::CONSTANT &&
+            compression_ != compression::compression_type::RLE &&
+            compression_ != compression::compression_type::DICTIONARY) {
+            return false;
+        }
+        switch (filter.filter_type) {
+            case expressions::compare_type::eq:
+            case expressions::compare_type::ne:
+            case expressions::compare_type::gt:
+            case expressions::compare_type::gte:
+            case expressions::compare_type::lt:
+            case expressions::compare_type::lte:
+                break;
+            default:
+                return false;
+        }
+        const auto& constant_filter = filter.cast<constant_filter_t>();
+        if (constant_filter.constant.is_null() ||
+            constant_filter.constant.type().to_physical_type() != type.to_physical_type()) {
+            return false;
+        }
+        assert(row_index >= start);
+        assert(row_index + static_cast<int64_t>(count) <= start + static_cast<int64_t>(this->count));
+        auto offset = static_cast<uint64_t>(row_index - start);
+        switch (type.to_physical_type()) {
+            case types::physical_type::BOOL:
+                impl::compressed_filter<bool>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::INT8:
+                impl::compressed_filter<int8_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::INT16:
+                impl::compressed_filter<int16_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::INT32:
+                impl::compressed_filter<int32_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::INT64:
+                impl::compressed_filter<int64_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::INT128:
+                impl::compressed_filter<types::int128_t>(*this,
+                                                         offset,
+                                                         constant_filter,
+                                                         indexing,
+                                                         approved_tuple_count);
+                break;
+            case types::physical_type::UINT8:
+                impl::compressed_filter<uint8_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::UINT16:
+                impl::compressed_filter<uint16_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::UINT32:
+                impl::compressed_filter<uint32_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::UINT64:
+                impl::compressed_filter<uint64_t>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::UINT128:
+                impl::compressed_filter<types::uint128_t>(*this,
+                                                          offset,
+                                                          constant_filter,
+                                                          indexing,
+                                                          approved_tuple_count);
+                break;
+            case types::physical_type::FLOAT:
+                impl::compressed_filter<float>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            case types::physical_type::DOUBLE:
+                impl::compressed_filter<double>(*this, offset, constant_filter, indexing, approved_tuple_count);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+
     void column_segment_t::skip(column_scan_state& state) { state.internal_index = state.row_index; }
 
     void column_segment_t::resize(uint64_t new_size) {
@@ -69,6 +69,16 @@ namespace components::table {
                                         uint64_t scan_count,
                                         uint64_t& approved_tuple_count);
 
+        // Narrows `indexing`, ascending positions relative to `row_index`, to the rows whose stored value
+        // passes the constant comparison `filter`, evaluated once per run of an RLE segment, once per
+        // entry of a dictionary and once for a CONSTANT segment. NULLs are not checked. Returns false,
+        // leaving `indexing` alone, for uncompressed segments and constants of another physical type.
+        bool filter_compressed(int64_t row_index,
+                               uint64_t count,
+                               const table_filter_t& filter,
+                               vector::indexing_vector_t& indexing,
+                               uint64_t& approved_tuple_count);
+
         void skip(column_scan_state& state);
 
         uint64_t segment_size() const;
@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <components/table/compression/compression_type.hpp>
 #include <components/table/storage/buffer_handle.hpp>
 
 #include <expressions/forward.hpp>
@@ -261,6 +262,7 @@ namespace components::table {
         std::string column_path;
         uint64_t segment_idx;
         std::string segment_type;
+        compression::compression_type compression;
         int64_t segment_start;
         uint64_t segment_count;
         bool has_updates;
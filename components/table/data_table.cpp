@@ -129,49 +129,13 @@ namespace components::table {
         row_groups_->cleanup_versions(lowest_active_start_time);
     }
 
-    void data_table_t::compact() {
-        auto total = row_groups_->total_rows();
-        if (total == 0) {
-            return;
+    row_id_remap_t data_table_t::compact(double threshold) {
+        row_id_remap_t remap;
+        if (row_groups_->total_rows() == 0) {
+            return remap;
         }
-
-        auto types = row_groups_->types();
-        auto new_collection = std::make_shared<collection_t>(
-            resource_,
-            row_groups_->block_manager(),
-            std::pmr::vector<types::complex_logical_type>(types.begin(), types.end(), resource_),
-            0);
-
-        {
-            table_append_state append_state(resource_);
-            new_collection->initialize_append(append_state);
-
-            // Scan committed non-deleted rows from old collection
-            std::vector<storage_index_t> column_ids;
-            for (uint64_t i = 0; i < column_definitions_.size(); i++) {
-                column_ids.emplace_back(i);
-            }
-
-            table_scan_state state(resource_);
-            initialize_scan_with_offset(state, column_ids, 0, static_cast<int64_t>(total));
-
-            auto scan_types = copy_types();
-            vector::data_chunk_t chunk(resource_, scan_types, vector::DEFAULT_VECTOR_CAPACITY);
-            while (true) {
-                state.table_state.scan_committed(chunk, table_scan_type::COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
-                if (chunk.size() == 0) {
-                    break;
-                }
-                new_collection->append(chunk, append_state);
-                chunk.reset();
-            }
-
-            new_collection->finalize_append(append_state, transaction_data{0, 0});
-        }
-        // scan state and buffer handles destroyed before swapping collection
-
-        // Swap old collection with compacted one
-        row_groups_ = std::move(new_collection);
+        row_groups_ = row_groups_->vacuum(threshold, remap);
+        return remap;
     }
 
     void data_table_t::scan(vector::data_chunk_t& result, table_scan_state& state) { state.table_state.scan(result); }
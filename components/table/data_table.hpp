@@ -86,7 +86,9 @@ namespace components::table {
 
         uint64_t calculate_size();
         void cleanup_versions(uint64_t lowest_active_start_time);
-        void compact();
+        // Drops the permanently deleted rows of every row group where they make up more than
+        // `threshold` of the rows and closes the gaps; returns how row ids moved
+        row_id_remap_t compact(double threshold = 0.0);
 
         std::shared_ptr<parallel_table_scan_state_t>
         create_parallel_scan_state(const std::vector<storage_index_t>& column_ids,
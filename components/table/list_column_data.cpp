@@ -288,4 +288,10 @@ namespace components::table {
         col_path.back() = 1;
         child_column->get_column_segment_info(row_group_index, col_path, result);
     }
+
+    void list_column_data_t::collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        column_data_t::collect_unloaded_blocks(blocks);
+        validity.collect_unloaded_blocks(blocks);
+        child_column->collect_unloaded_blocks(blocks);
+    }
 } // namespace components::table
\ No newline at end of file
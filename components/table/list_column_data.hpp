@@ -52,6 +52,7 @@ namespace components::table {
         void get_column_segment_info(uint64_t row_group_index,
                                      std::vector<uint64_t> col_path,
                                      std::vector<column_segment_info>& result) override;
+        void collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) override;
 
     private:
         uint64_t fetch_list_offset(int64_t row_idx);
@@ -10,8 +10,59 @@
 #include "struct_column_data.hpp"
 #include <components/vector/vector_operations.hpp>
 
+#include <optional>
+
 namespace components::table {
 
+    namespace {
+
+        // A projected column is fetched row by row when at most one row in this many qualifies
+        constexpr uint64_t SPARSE_SELECTION_RATIO = 16;
+
+        bool has_flat_storage(const types::complex_logical_type& type) {
+            switch (type.to_physical_type()) {
+                case types::physical_type::STRUCT:
+                case types::physical_type::LIST:
+                case types::physical_type::ARRAY:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        bool is_comparison(expressions::compare_type type) {
+            switch (type) {
+                case expressions::compare_type::eq:
+                case expressions::compare_type::ne:
+                case expressions::compare_type::gt:
+                case expressions::compare_type::gte:
+                case expressions::compare_type::lt:
+                case expressions::compare_type::lte:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_negative(const types::logical_value_t& value) {
+            return !types::is_unsigned(value.type().type()) &&
+                   value.cast_as(types::logical_type::DOUBLE).value<double>() < 0;
+        }
+
+        // The numeric constant converted to `type`, or nothing when the conversion loses its value. Casting
+        // back catches truncation and narrowing; a sign flip survives the round trip (-1 becomes UINT64_MAX
+        // and then -1 again), so the signs are compared as well
+        std::optional<types::logical_value_t> lossless_cast(const types::logical_value_t& constant,
+                                                            const types::complex_logical_type& type) {
+            auto cast = constant.cast_as(type);
+            if (is_negative(cast) != is_negative(constant) || !(cast.cast_as(constant.type()) == constant)) {
+                return std::nullopt;
+            }
+            return cast;
+        }
+
+    } // namespace
+
     row_group_t::row_group_t(collection_t* collection, int64_t start, uint64_t count)
         : segment_base_t(start, count)
         , collection_(collection)
@@ -76,6 +127,8 @@ namespace components::table {
         state.vector_index = vector_offset;
         state.max_row_group_row =
             start > state.max_row ? 0 : std::min(static_cast<int64_t>(count.load()), state.max_row - start);
+        // after the count: version info is in place before rows are counted, so the snapshot covers them
+        state.versions = version_snapshot();
         auto row_number = start + static_cast<int64_t>(vector_offset * vector::DEFAULT_VECTOR_CAPACITY);
         if (state.max_row_group_row == 0) {
             return false;
@@ -98,6 +151,8 @@ namespace components::table {
         state.row_group = this;
         state.max_row_group_row +=
             start > state.max_row ? 0 : std::min(static_cast<int64_t>(count.load()), state.max_row - start);
+        // after the count: version info is in place before rows are counted, so the snapshot covers them
+        state.versions = version_snapshot();
         if (state.max_row_group_row == 0) {
             return false;
         }
@@ -228,47 +283,268 @@ namespace components::table {
         }
     }
 
-    bool row_group_t::check_zonemap_segments(collection_scan_state& state) {
-        auto* f = state.filter();
-        if (!f) {
-            return true;
-        }
-        // For constant comparison filters, check if any column's zonemap prunes this segment
-        if (f->filter_type == expressions::compare_type::eq || f->filter_type == expressions::compare_type::gt ||
-            f->filter_type == expressions::compare_type::gte || f->filter_type == expressions::compare_type::lt ||
-            f->filter_type == expressions::compare_type::lte) {
-            auto& cf = f->cast<constant_filter_t>();
-            if (!cf.table_indices.empty()) {
-                auto col_idx = cf.table_indices.front();
-                if (col_idx < get_column_count()) {
-                    auto& col = get_column(col_idx);
-                    column_scan_state dummy;
-                    auto result = col.check_zonemap(dummy, const_cast<table_filter_t&>(*f));
-                    if (result == filter_propagate_result_t::ALWAYS_FALSE) {
-                        next_vector(state);
-                        return false;
+    filter_propagate_result_t
+    row_group_t::check_zonemap(const table_filter_t& filter, uint64_t vector_index, uint64_t max_count) {
+        switch (filter.filter_type) {
+            case expressions::compare_type::union_and: {
+                auto result = filter_propagate_result_t::ALWAYS_TRUE;
+                for (const auto& child : filter.cast<conjunction_and_filter_t>().child_filters) {
+                    auto child_result = check_zonemap(*child, vector_index, max_count);
+                    if (child_result == filter_propagate_result_t::ALWAYS_FALSE) {
+                        return child_result;
+                    }
+                    if (child_result != filter_propagate_result_t::ALWAYS_TRUE) {
+                        result = filter_propagate_result_t::NO_PRUNING_POSSIBLE;
                     }
                 }
+                return result;
+            }
+            case expressions::compare_type::union_or:
+            case expressions::compare_type::union_not: {
+                // NOT negates the disjunction of its children, as in filter_indexing
+                auto result = filter_propagate_result_t::ALWAYS_FALSE;
+                for (const auto& child : filter.cast<conjunction_filter_t>().child_filters) {
+                    auto child_result = check_zonemap(*child, vector_index, max_count);
+                    if (child_result == filter_propagate_result_t::ALWAYS_TRUE) {
+                        result = child_result;
+                        break;
+                    }
+                    if (child_result != filter_propagate_result_t::ALWAYS_FALSE) {
+                        result = filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+                    }
+                }
+                if (filter.filter_type == expressions::compare_type::union_or) {
+                    return result;
+                }
+                switch (result) {
+                    case filter_propagate_result_t::ALWAYS_TRUE:
+                        return filter_propagate_result_t::ALWAYS_FALSE;
+                    case filter_propagate_result_t::ALWAYS_FALSE:
+                        return filter_propagate_result_t::ALWAYS_TRUE;
+                    default:
+                        return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+                }
+            }
+            case expressions::compare_type::is_null:
+            case expressions::compare_type::is_not_null: {
+                const auto& indices = filter.cast<is_null_filter_t>().table_indices;
+                return check_column_zonemap(filter, indices, vector_index, max_count);
+            }
+            case expressions::compare_type::invalid:
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            default: {
+                const auto& indices = filter.cast<constant_filter_t>().table_indices;
+                return check_column_zonemap(filter, indices, vector_index, max_count);
             }
         }
-        return true;
     }
 
-    void row_group_t::filter_indexing(std::pmr::memory_resource* resource,
-                                      uint64_t vector_index,
+    filter_propagate_result_t row_group_t::check_column_zonemap(const table_filter_t& filter,
+                                                                const std::pmr::vector<uint64_t>& table_indices,
+                                                                uint64_t vector_index,
+                                                                uint64_t max_count) {
+        // nested fields keep no statistics of their own
+        if (table_indices.size() != 1 || table_indices.front() >= get_column_count()) {
+            return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        auto& column = get_column(table_indices.front());
+        if (!has_flat_storage(column.type()) || column.count() == 0) {
+            return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        auto row = start + static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+        return column.check_zonemap_range(row, max_count, filter);
+    }
+
+    vector::vector_t& row_group_t::filter_column(filter_columns_t& filter_columns,
+                                                 uint64_t column_index,
+                                                 uint64_t vector_index) {
+        auto it = filter_columns.find(column_index);
+        if (it != filter_columns.end()) {
+            return it->second;
+        }
+        auto& column = get_column(column_index);
+        column_scan_state scan_state;
+        scan_state.initialize(column.type());
+        auto first_row = start + static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+        column.initialize_scan_with_offset(scan_state, first_row);
+        vector::vector_t result(collection_->resource(), column.type(), vector::DEFAULT_VECTOR_CAPACITY);
+        column.scan(vector_index, scan_state, result);
+        return filter_columns.emplace(column_index, std::move(result)).first->second;
+    }
+
+    void row_group_t::filter_indexing(uint64_t vector_index,
+                                      uint64_t max_count,
                                       vector::indexing_vector_t& indexing,
                                       const table_filter_t* filter,
-                                      uint64_t& approved_tuple_count) {
-        vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
-        uint64_t result_count = 0;
-        for (uint64_t i = 0; i < approved_tuple_count; i++) {
-            auto idx = indexing.get_index(i);
-            new_indexing.set_index(result_count, idx);
-            result_count +=
-                check_predicate(static_cast<int64_t>(idx + vector_index * vector::DEFAULT_VECTOR_CAPACITY), filter);
+                                      uint64_t& approved_tuple_count,
+                                      filter_columns_t& filter_columns) {
+        auto* resource = collection_->resource();
+        // keeps the approved rows for which `pass(idx)` holds, in their order
+        auto retain = [&](auto&& pass) {
+            vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
+            uint64_t result_count = 0;
+            for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                auto idx = indexing.get_index(i);
+                new_indexing.set_index(result_count, idx);
+                result_count += pass(idx);
+            }
+            indexing = new_indexing;
+            approved_tuple_count = result_count;
+        };
+        // Moves the rows of the current selection passing any of the children into `matched`; the
+        // selection keeps the others. Every child tests only the rows no earlier child took, and
+        // since all selections are ascending both sides are combined by a merge.
+        auto split_by_children = [&](const std::vector<std::unique_ptr<table_filter_t>>& children,
+                                     vector::indexing_vector_t& matched,
+                                     uint64_t& matched_count) {
+            matched_count = 0;
+            for (const auto& child : children) {
+                if (approved_tuple_count == 0) {
+                    break;
+                }
+                auto child_indexing = indexing;
+                auto child_count = approved_tuple_count;
+                filter_indexing(vector_index, max_count, child_indexing, child.get(), child_count, filter_columns);
+                if (child_count == 0) {
+                    continue;
+                }
+                vector::indexing_vector_t merged(resource, matched_count + child_count);
+                uint64_t left = 0;
+                uint64_t right = 0;
+                while (left < matched_count || right < child_count) {
+                    if (right == child_count ||
+                        (left < matched_count && matched.get_index(left) < child_indexing.get_index(right))) {
+                        merged.set_index(left + right, matched.get_index(left));
+                        left++;
+                    } else {
+                        merged.set_index(left + right, child_indexing.get_index(right));
+                        right++;
+                    }
+                }
+                vector::indexing_vector_t rest(resource, approved_tuple_count - child_count);
+                uint64_t rest_count = 0;
+                right = 0;
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    auto idx = indexing.get_index(i);
+                    if (right < child_count && child_indexing.get_index(right) == idx) {
+                        right++;
+                    } else {
+                        rest.set_index(rest_count++, idx);
+                    }
+                }
+                matched = merged;
+                matched_count += child_count;
+                indexing = rest;
+                approved_tuple_count = rest_count;
+            }
+        };
+        auto row_id = [&](uint64_t idx) {
+            return static_cast<int64_t>(idx + vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+        };
+
+        switch (filter->filter_type) {
+            case expressions::compare_type::union_and: {
+                for (const auto& child : filter->cast<conjunction_and_filter_t>().child_filters) {
+                    filter_indexing(vector_index,
+                                    max_count,
+                                    indexing,
+                                    child.get(),
+                                    approved_tuple_count,
+                                    filter_columns);
+                    if (approved_tuple_count == 0) {
+                        break;
+                    }
+                }
+                return;
+            }
+            case expressions::compare_type::union_or: {
+                vector::indexing_vector_t matched(resource, approved_tuple_count);
+                uint64_t matched_count;
+                split_by_children(filter->cast<conjunction_or_filter_t>().child_filters, matched, matched_count);
+                indexing = matched;
+                approved_tuple_count = matched_count;
+                return;
+            }
+            case expressions::compare_type::union_not: {
+                // the rows no child matched are what is left of the selection
+                vector::indexing_vector_t matched(resource, approved_tuple_count);
+                uint64_t matched_count;
+                split_by_children(filter->cast<conjunction_not_filter_t>().child_filters, matched, matched_count);
+                return;
+            }
+            case expressions::compare_type::invalid:
+                throw std::logic_error("invalid type for filter selection");
+            case expressions::compare_type::is_null:
+            case expressions::compare_type::is_not_null: {
+                const auto& null_filter = filter->cast<is_null_filter_t>();
+                if (null_filter.table_indices.size() != 1) {
+                    retain([&](uint64_t idx) { return check_predicate(row_id(idx), filter); });
+                    return;
+                }
+                auto& column = filter_column(filter_columns, null_filter.table_indices.front(), vector_index);
+                bool want_null = filter->filter_type == expressions::compare_type::is_null;
+                if (column.get_vector_type() == vector::vector_type::FLAT && column.validity().all_valid()) {
+                    if (want_null) {
+                        approved_tuple_count = 0;
+                    }
+                    return;
+                }
+                retain([&](uint64_t idx) { return column.is_null(idx) == want_null; });
+                return;
+            }
+            default: {
+                const auto& constant_filter = filter->cast<constant_filter_t>();
+                if (constant_filter.table_indices.size() != 1) {
+                    retain([&](uint64_t idx) { return check_predicate(row_id(idx), filter); });
+                    return;
+                }
+                auto column_index = constant_filter.table_indices.front();
+                auto& column_data = get_column(column_index);
+                // Comparisons run as typed loops over the raw vector once the constant has the physical
+                // type of the column; a numeric constant of another width is converted when no value is
+                // lost, anything else is compared value by value
+                const table_filter_t* typed_filter = nullptr;
+                std::optional<constant_filter_t> cast_filter;
+                if (is_comparison(filter->filter_type) && !constant_filter.constant.is_null()) {
+                    const auto& constant = constant_filter.constant;
+                    const auto& type = column_data.type();
+                    if (constant.type().to_physical_type() == type.to_physical_type()) {
+                        typed_filter = filter;
+                    } else if (types::is_numeric(constant.type().type()) && types::is_numeric(type.type())) {
+                        if (auto cast = lossless_cast(constant, type)) {
+                            cast_filter.emplace(filter->filter_type, std::move(*cast), constant_filter.table_indices);
+                            typed_filter = &*cast_filter;
+                        }
+                    }
+                }
+                // a compressed segment answers without being decompressed, unless the column has been
+                // scanned for another filter already
+                if (typed_filter && !filter_columns.contains(column_index) &&
+                    column_data.filter_compressed(vector_index,
+                                                  max_count,
+                                                  *typed_filter,
+                                                  indexing,
+                                                  approved_tuple_count)) {
+                    return;
+                }
+                auto& column = filter_column(filter_columns, column_index, vector_index);
+                if (typed_filter) {
+                    vector::unified_vector_format uvf(resource, max_count);
+                    column.to_unified_format(max_count, uvf);
+                    column_segment_t::filter_indexing(indexing,
+                                                      column,
+                                                      uvf,
+                                                      *typed_filter,
+                                                      max_count,
+                                                      approved_tuple_count);
+                } else {
+                    retain([&](uint64_t idx) {
+                        return !column.is_null(idx) && constant_filter.compare(column.value(idx));
+                    });
+                }
+                return;
+            }
         }
-        indexing = new_indexing;
-        approved_tuple_count = result_count;
     }
 
     template<table_scan_type TYPE>
@@ -289,24 +565,40 @@ namespace components::table {
             auto max_count =
                 std::min(vector::DEFAULT_VECTOR_CAPACITY, static_cast<size_t>(state.max_row_group_row - current_row));
 
-            if (!check_zonemap_segments(state)) {
-                continue;
+            // the filter is dropped for vectors the segment statistics prove it holds for entirely
+            const table_filter_t* vector_filter = filter;
+            if (filter) {
+                auto zonemap = check_zonemap(*filter, state.vector_index, max_count);
+                if (zonemap == filter_propagate_result_t::ALWAYS_FALSE) {
+                    next_vector(state);
+                    continue;
+                }
+                if (zonemap == filter_propagate_result_t::ALWAYS_TRUE) {
+                    vector_filter = nullptr;
+                }
             }
 
+            // visibility comes from the snapshot taken when the scan entered the row group, so writers
+            // deleting or committing meanwhile never wait for the scan nor the scan for them
             uint64_t count;
             if (TYPE == table_scan_type::REGULAR) {
-                count = (state.txn.transaction_id != 0 || state.txn.start_time != 0)
-                            ? state.row_group->indexing_vector(state.txn,
-                                                               state.vector_index,
-                                                               state.valid_indexing,
-                                                               max_count)
-                            : state.row_group->indexing_vector(state.vector_index, state.valid_indexing, max_count);
+                auto txn = (state.txn.transaction_id != 0 || state.txn.start_time != 0)
+                               ? state.txn
+                               : transaction_data{current_version_, current_version_};
+                count = state.versions
+                            ? state.versions->indexing_vector(txn, state.vector_index, state.valid_indexing, max_count)
+                            : max_count;
                 if (count == 0) {
                     next_vector(state);
                     continue;
                 }
             } else if (TYPE == table_scan_type::COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED) {
-                count = state.row_group->commited_indexing_vector(state.vector_index, state.valid_indexing, max_count);
+                count = state.versions ? state.versions->commited_indexing_vector(current_version_,
+                                                                                   current_version_,
+                                                                                   state.vector_index,
+                                                                                   state.valid_indexing,
+                                                                                   max_count)
+                                       : max_count;
                 if (count == 0) {
                     next_vector(state);
                     continue;
@@ -316,7 +608,7 @@ namespace components::table {
             }
             validate_chunk_capacity(result, result.size() + count);
 
-            if (count == max_count && !filter) {
+            if (count == max_count && !vector_filter) {
                 for (uint64_t i = 0; i < column_ids.size(); i++) {
                     const auto& column = column_ids[i];
                     if (column.is_row_id_column()) {
@@ -343,13 +635,17 @@ namespace components::table {
                 } else {
                     indexing.reset(nullptr);
                 }
-                if (filter) {
+                // Filter columns are scanned first; the projected ones are only read once the
+                // selection is known, and not at all when nothing in the vector qualifies
+                filter_columns_t filter_columns;
+                if (vector_filter) {
                     assert(ALLOW_UPDATES);
-                    filter_indexing(collection_->resource(),
-                                    state.vector_index,
+                    filter_indexing(state.vector_index,
+                                    max_count,
                                     indexing,
-                                    filter,
-                                    approved_tuple_count);
+                                    vector_filter,
+                                    approved_tuple_count,
+                                    filter_columns);
                 }
                 if (approved_tuple_count == 0) {
                     for (uint64_t i = 0; i < column_ids.size(); i++) {
@@ -358,7 +654,7 @@ namespace components::table {
                             continue;
                         }
                         auto& col_data = get_column(col_idx);
-                        col_data.skip(state.column_scans[i]);
+                        col_data.skip(state.column_scans[i], max_count);
                     }
                     state.vector_index++;
                     continue;
@@ -375,7 +671,34 @@ namespace components::table {
                         }
                     } else {
                         auto& col_data = get_column(column);
-                        if (TYPE == table_scan_type::REGULAR) {
+                        auto filtered = column.has_children() ? filter_columns.end()
+                                                              : filter_columns.find(column.primary_index());
+                        if (TYPE == table_scan_type::REGULAR && filtered != filter_columns.end()) {
+                            // already read to evaluate the filter
+                            col_data.skip(state.column_scans[i], max_count);
+                            vector::vector_t select_vector(filtered->second);
+                            select_vector.slice(indexing, approved_tuple_count);
+                            vector::vector_ops::copy(select_vector,
+                                                     result.data[i],
+                                                     approved_tuple_count,
+                                                     0,
+                                                     state.column_scans[i].result_offset);
+                        } else if (TYPE == table_scan_type::REGULAR && !column.has_children() &&
+                                   approved_tuple_count * SPARSE_SELECTION_RATIO <= max_count &&
+                                   has_flat_storage(col_data.type())) {
+                            // a handful of rows: fetch them one by one rather than decode the vector
+                            col_data.skip(state.column_scans[i], max_count);
+                            auto& target = result.data[i];
+                            auto offset = state.column_scans[i].result_offset;
+                            column_fetch_state fetch_state;
+                            for (uint64_t k = 0; k < approved_tuple_count; k++) {
+                                target.validity().set_valid(offset + k);
+                                col_data.fetch_row(fetch_state,
+                                                   start + current_row + static_cast<int64_t>(indexing.get_index(k)),
+                                                   target,
+                                                   offset + k);
+                            }
+                        } else if (TYPE == table_scan_type::REGULAR) {
                             vector::vector_t select_vector(result.resource(), result.data[i].type(), max_count);
                             auto prev_offset = state.column_scans[i].result_offset;
                             state.column_scans[i].result_offset = 0;
@@ -469,8 +792,9 @@ namespace components::table {
         if (row_group_end > row_group_size()) {
             row_group_end = row_group_size();
         }
-        this->count = row_group_end;
+        // rows are counted only once they carry version info, so a scan never takes them as committed
         get_or_create_version_info().append_version_info(txn, count, row_group_start, row_group_end);
+        this->count = row_group_end;
     }
 
     void row_group_t::commit_append(uint64_t commit_id, uint64_t row_group_start, uint64_t count) {
@@ -570,6 +894,15 @@ namespace components::table {
         }
     }
 
+    void row_group_t::collect_unloaded_blocks(const std::vector<storage_index_t>& column_ids,
+                                              std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        for (const auto& column : column_ids) {
+            if (!column.is_row_id_column()) {
+                get_column(column).collect_unloaded_blocks(blocks);
+            }
+        }
+    }
+
     class version_delete_state {
     public:
         version_delete_state(row_group_t& info,
@@ -666,29 +999,12 @@ namespace components::table {
         return vinfo->indexing_vector({current_version_, current_version_}, vector_idx, indexing_vector, max_count);
     }
 
-    uint64_t row_group_t::indexing_vector(transaction_data txn,
-                                          uint64_t vector_idx,
-                                          vector::indexing_vector_t& indexing_vector,
-                                          uint64_t max_count) {
+    std::shared_ptr<const row_version_snapshot_t> row_group_t::version_snapshot() {
         auto vinfo = version_info();
         if (!vinfo) {
-            return max_count;
-        }
-        return vinfo->indexing_vector(txn, vector_idx, indexing_vector, max_count);
-    }
-
-    uint64_t row_group_t::commited_indexing_vector(uint64_t vector_idx,
-                                                   vector::indexing_vector_t& indexing_vector,
-                                                   uint64_t max_count) {
-        auto vinfo = version_info();
-        if (!vinfo) {
-            return max_count;
+            return nullptr;
         }
-        return vinfo->commited_indexing_vector(current_version_,
-                                               current_version_,
-                                               vector_idx,
-                                               indexing_vector,
-                                               max_count);
+        return vinfo->snapshot();
     }
 
     std::shared_ptr<row_version_manager_t> row_group_t::get_or_create_version_info_internal() {
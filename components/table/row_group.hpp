@@ -3,6 +3,8 @@
 #include "row_version_manager.hpp"
 #include "storage/data_pointer.hpp"
 
+#include <unordered_map>
+
 namespace components::vector {
     class data_chunk_t;
 }
@@ -52,7 +54,9 @@ namespace components::table {
 
         bool initialize_scan(collection_scan_state& state);
         bool initialize_scan_with_offset(collection_scan_state& state, uint64_t vector_offset);
-        bool check_zonemap_segments(collection_scan_state& state);
+        // Decides `filter` for the rows of one vector from per-segment statistics, walking AND / OR / NOT
+        filter_propagate_result_t
+        check_zonemap(const table_filter_t& filter, uint64_t vector_index, uint64_t max_count);
         void scan(collection_scan_state& state, vector::data_chunk_t& result);
         void scan_committed(collection_scan_state& state, vector::data_chunk_t& result, table_scan_type type);
 
@@ -89,6 +93,8 @@ namespace components::table {
                            const std::vector<uint64_t>& column_path);
 
         void get_column_segment_info(uint64_t row_group_index, std::vector<column_segment_info>& result);
+        void collect_unloaded_blocks(const std::vector<storage_index_t>& column_ids,
+                                     std::vector<std::shared_ptr<storage::block_handle_t>>& blocks);
 
         storage::row_group_pointer_t write_to_disk(storage::partial_block_manager_t& partial_block_manager);
         void create_from_pointer(const storage::row_group_pointer_t& pointer);
@@ -105,13 +111,8 @@ namespace components::table {
 
     private:
         uint64_t indexing_vector(uint64_t vector_idx, vector::indexing_vector_t& indexing_vector, uint64_t max_count);
-        uint64_t indexing_vector(transaction_data txn,
-                                 uint64_t vector_idx,
-                                 vector::indexing_vector_t& indexing_vector,
-                                 uint64_t max_count);
-        uint64_t
-        commited_indexing_vector(uint64_t vector_idx, vector::indexing_vector_t& indexing_vector, uint64_t max_count);
         std::shared_ptr<row_version_manager_t> get_or_create_version_info_internal();
+        std::shared_ptr<const row_version_snapshot_t> version_snapshot();
         row_version_manager_t* version_info();
         void set_version_info(std::shared_ptr<row_version_manager_t> version);
         column_data_t& get_column(uint64_t c);
@@ -119,11 +120,22 @@ namespace components::table {
         uint64_t get_column_count() const;
         std::vector<std::shared_ptr<column_data_t>>& columns();
 
-        void filter_indexing(std::pmr::memory_resource* resource,
-                             uint64_t vector_index,
+        // Vectors of the filter columns of one scanned vector, by column index
+        using filter_columns_t = std::unordered_map<uint64_t, vector::vector_t>;
+
+        // Narrows `indexing` to the rows of the vector passing `filter`. Every column the filter
+        // reads is scanned once into `filter_columns` and compared a vector at a time.
+        void filter_indexing(uint64_t vector_index,
+                             uint64_t max_count,
                              vector::indexing_vector_t& indexing,
                              const table_filter_t* filter,
-                             uint64_t& approved_tuple_count);
+                             uint64_t& approved_tuple_count,
+                             filter_columns_t& filter_columns);
+        vector::vector_t& filter_column(filter_columns_t& filter_columns, uint64_t column_index, uint64_t vector_index);
+        filter_propagate_result_t check_column_zonemap(const table_filter_t& filter,
+                                                       const std::pmr::vector<uint64_t>& table_indices,
+                                                       uint64_t vector_index,
+                                                       uint64_t max_count);
 
         template<table_scan_type TYPE>
         void templated_scan(collection_scan_state& state, vector::data_chunk_t& result);
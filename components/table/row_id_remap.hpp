@@ -0,0 +1,76 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace components::table {
+
+    // Where a vacuum moved the rows of a table, so that indexes can patch their row ids instead of
+    // being rebuilt. Rows before `first_moved` kept their ids; the surviving rows from there on are
+    // kept as runs of consecutive old ids that moved to consecutive new ids (a row group left as is
+    // is one run, a rewritten one a run per stretch of live rows). Rows in no run were dropped.
+    struct row_id_remap_t {
+        static constexpr int64_t NOT_MOVED = std::numeric_limits<int64_t>::max();
+        static constexpr int64_t DROPPED = -1;
+
+        struct run_t {
+            int64_t old_start;
+            uint64_t count;
+            int64_t new_start;
+        };
+
+        int64_t first_moved{NOT_MOVED};
+        std::vector<run_t> runs; // ascending old_start
+
+        bool empty() const noexcept { return first_moved == NOT_MOVED; }
+
+        // New id of `row`, or DROPPED
+        int64_t map(int64_t row) const noexcept {
+            if (row < first_moved) {
+                return row;
+            }
+            auto it = std::upper_bound(runs.begin(), runs.end(), row, [](int64_t value, const run_t& run) {
+                return value < run.old_start;
+            });
+            if (it == runs.begin()) {
+                return DROPPED;
+            }
+            --it;
+            auto offset = row - it->old_start;
+            return offset < static_cast<int64_t>(it->count) ? it->new_start + offset : DROPPED;
+        }
+
+        // Records that `count` rows from `old_start` moved to `new_start`; runs come in row order.
+        // Ids are dense, so until a row is dropped every survivor keeps its id
+        void keep(int64_t old_start, uint64_t count, int64_t new_start) {
+            if (count == 0) {
+                return;
+            }
+            if (empty()) {
+                if (old_start == new_start) {
+                    return;
+                }
+                first_moved = new_start;
+            }
+            if (!runs.empty()) {
+                auto& last = runs.back();
+                auto last_count = static_cast<int64_t>(last.count);
+                if (last.old_start + last_count == old_start && last.new_start + last_count == new_start) {
+                    last.count += count;
+                    return;
+                }
+            }
+            runs.push_back({old_start, count, new_start});
+        }
+
+        // Closes the remap of a table that had rows up to `old_end` and keeps rows up to `new_end`
+        void finish(int64_t old_end, int64_t new_end) noexcept {
+            if (empty() && old_end != new_end) {
+                first_moved = new_end;
+            }
+        }
+    };
+
+} // namespace components::table
@@ -1,5 +1,6 @@
 #include "row_version_manager.hpp"
 
+#include <atomic>
 #include <cassert>
 
 #include "collection.hpp"
@@ -55,7 +56,7 @@ namespace components::table {
 
     uint64_t chunk_constant_info::indexing_vector(transaction_data transaction,
                                                   vector::indexing_vector_t& indexing_vector,
-                                                  uint64_t max_count) {
+                                                  uint64_t max_count) const {
         return templated_indexing_vector<transaction_version_operator>(transaction.start_time,
                                                                        transaction.transaction_id,
                                                                        indexing_vector,
@@ -65,14 +66,14 @@ namespace components::table {
     uint64_t chunk_constant_info::commited_indexing_vector(uint64_t min_start_id,
                                                            uint64_t min_transaction_id,
                                                            vector::indexing_vector_t& indexing_vector,
-                                                           uint64_t max_count) {
+                                                           uint64_t max_count) const {
         return templated_indexing_vector<commited_version_operator>(min_start_id,
                                                                     min_transaction_id,
                                                                     indexing_vector,
                                                                     max_count);
     }
 
-    bool chunk_constant_info::fetch(transaction_data transaction, int64_t) {
+    bool chunk_constant_info::fetch(transaction_data transaction, int64_t) const {
         return use_version(transaction, insert_id) && !use_version(transaction, delete_id);
     }
 
@@ -88,7 +89,7 @@ namespace components::table {
         return is_deleted;
     }
 
-    uint64_t chunk_constant_info::commited_deleted_count(uint64_t max_count) {
+    uint64_t chunk_constant_info::commited_deleted_count(uint64_t max_count) const {
         return delete_id < TRANSACTION_ID_START ? max_count : 0;
     }
 
@@ -103,6 +104,10 @@ namespace components::table {
         return true;
     }
 
+    std::shared_ptr<chunk_info> chunk_constant_info::copy() const {
+        return std::make_shared<chunk_constant_info>(*this);
+    }
+
     chunk_vector_info::chunk_vector_info(int64_t start)
         : chunk_info(start, chunk_info_type::VECTOR_INFO)
         , insert_id(0)
@@ -165,7 +170,7 @@ namespace components::table {
     uint64_t chunk_vector_info::commited_indexing_vector(uint64_t min_start_id,
                                                          uint64_t min_transaction_id,
                                                          vector::indexing_vector_t& indexing_vector,
-                                                         uint64_t max_count) {
+                                                         uint64_t max_count) const {
         return templated_indexing_vector<commited_version_operator>(min_start_id,
                                                                     min_transaction_id,
                                                                     indexing_vector,
@@ -174,11 +179,11 @@ namespace components::table {
 
     uint64_t chunk_vector_info::indexing_vector(transaction_data transaction,
                                                 vector::indexing_vector_t& indx_vector,
-                                                uint64_t max_count) {
+                                                uint64_t max_count) const {
         return indexing_vector(transaction.start_time, transaction.transaction_id, indx_vector, max_count);
     }
 
-    bool chunk_vector_info::fetch(transaction_data transaction, int64_t row) {
+    bool chunk_vector_info::fetch(transaction_data transaction, int64_t row) const {
         return use_version(transaction, inserted[row]) && !use_version(transaction, deleted[row]);
     }
 
@@ -295,7 +300,9 @@ namespace components::table {
 
     bool chunk_vector_info::has_deletes() const { return any_deleted; }
 
-    uint64_t chunk_vector_info::commited_deleted_count(uint64_t max_count) {
+    std::shared_ptr<chunk_info> chunk_vector_info::copy() const { return std::make_shared<chunk_vector_info>(*this); }
+
+    uint64_t chunk_vector_info::commited_deleted_count(uint64_t max_count) const {
         if (!any_deleted) {
             return 0;
         }
@@ -308,17 +315,41 @@ namespace components::table {
         return delete_count;
     }
 
+    uint64_t row_version_snapshot_t::indexing_vector(transaction_data transaction,
+                                                     uint64_t vector_idx,
+                                                     vector::indexing_vector_t& indexing_vector,
+                                                     uint64_t max_count) const {
+        auto info = get_chunk_info(vector_idx);
+        if (!info) {
+            return max_count;
+        }
+        return info->indexing_vector(transaction, indexing_vector, max_count);
+    }
+
+    uint64_t row_version_snapshot_t::commited_indexing_vector(uint64_t start_time,
+                                                              uint64_t transaction_id,
+                                                              uint64_t vector_idx,
+                                                              vector::indexing_vector_t& indexing_vector,
+                                                              uint64_t max_count) const {
+        auto info = get_chunk_info(vector_idx);
+        if (!info) {
+            return max_count;
+        }
+        return info->commited_indexing_vector(start_time, transaction_id, indexing_vector, max_count);
+    }
+
     row_version_manager_t::row_version_manager_t(int64_t start) noexcept
         : start_(start)
         , has_changes_(false) {}
 
     void row_version_manager_t::set_start(int64_t new_start) {
         std::lock_guard l(version_lock_);
+        snapshot_.store(nullptr);
         this->start_ = new_start;
         int64_t current_start = start_;
-        for (auto& info : vector_info_) {
-            if (info) {
-                info->start = current_start;
+        for (uint64_t vector_idx = 0; vector_idx < vector_info_.size(); vector_idx++) {
+            if (vector_info_[vector_idx]) {
+                writable_chunk_info(vector_idx).start = current_start;
             }
             current_start += static_cast<int64_t>(vector::DEFAULT_VECTOR_CAPACITY);
         }
@@ -347,6 +378,34 @@ namespace components::table {
         return vector_info_[vector_idx].get();
     }
 
+    chunk_info& row_version_manager_t::writable_chunk_info(uint64_t vector_idx) {
+        // the caller dropped snapshot_ already, so any other owner is a scan
+        auto& info = vector_info_[vector_idx];
+        if (info.use_count() > 1) {
+            info = info->copy();
+        } else {
+            // use_count() is a relaxed load: pair it with the release of the last scan's reference,
+            // so that scan's reads happen before the writes below
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *info;
+    }
+
+    std::shared_ptr<const row_version_snapshot_t> row_version_manager_t::snapshot() {
+        // scans between two changes share one snapshot and never take the version lock
+        if (auto current = snapshot_.load()) {
+            return current;
+        }
+        std::lock_guard lock(version_lock_);
+        auto current = snapshot_.load();
+        if (!current) {
+            current = std::make_shared<const row_version_snapshot_t>(
+                std::vector<std::shared_ptr<const chunk_info>>(vector_info_.begin(), vector_info_.end()));
+            snapshot_.store(current);
+        }
+        return current;
+    }
+
     uint64_t row_version_manager_t::indexing_vector(transaction_data transaction,
                                                     uint64_t vector_idx,
                                                     vector::indexing_vector_t& indexing_vector,
@@ -397,6 +456,7 @@ namespace components::table {
                                                     uint64_t row_group_start,
                                                     uint64_t row_group_end) {
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         has_changes_ = true;
         uint64_t start_vector_idx = row_group_start / vector::DEFAULT_VECTOR_CAPACITY;
         uint64_t end_vector_idx = (row_group_end - 1) / vector::DEFAULT_VECTOR_CAPACITY;
@@ -423,7 +483,7 @@ namespace components::table {
                     new_info = insert_info.get();
                     vector_info_[vector_idx] = std::move(insert_info);
                 } else if (vector_info_[vector_idx]->type == chunk_info_type::VECTOR_INFO) {
-                    new_info = &vector_info_[vector_idx]->cast<chunk_vector_info>();
+                    new_info = &writable_chunk_info(vector_idx).cast<chunk_vector_info>();
                 } else {
                     throw std::logic_error("Error in row_version_manager_t::append_version_info - expected either a "
                                            "chunk_vector_info or no version info");
@@ -440,6 +500,7 @@ namespace components::table {
         uint64_t row_group_end = row_group_start + count;
 
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         uint64_t start_vector_idx = row_group_start / vector::DEFAULT_VECTOR_CAPACITY;
         uint64_t end_vector_idx = (row_group_end - 1) / vector::DEFAULT_VECTOR_CAPACITY;
         for (uint64_t vector_idx = start_vector_idx; vector_idx <= end_vector_idx; vector_idx++) {
@@ -449,8 +510,7 @@ namespace components::table {
             uint64_t vend = vector_idx == end_vector_idx
                                 ? row_group_end - end_vector_idx * vector::DEFAULT_VECTOR_CAPACITY
                                 : vector::DEFAULT_VECTOR_CAPACITY;
-            auto& info = *vector_info_[vector_idx];
-            info.commit_append(commit_id, vstart, vend);
+            writable_chunk_info(vector_idx).commit_append(commit_id, vstart, vend);
         }
     }
 
@@ -463,6 +523,7 @@ namespace components::table {
         uint64_t row_group_end = row_group_start + count;
 
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         uint64_t start_vector_idx = row_group_start / vector::DEFAULT_VECTOR_CAPACITY;
         uint64_t end_vector_idx = (row_group_end - 1) / vector::DEFAULT_VECTOR_CAPACITY;
         for (uint64_t vector_idx = start_vector_idx; vector_idx <= end_vector_idx; vector_idx++) {
@@ -486,6 +547,7 @@ namespace components::table {
 
     void row_version_manager_t::revert_append(uint64_t start_row) {
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         uint64_t start_vector_idx =
             (start_row + (vector::DEFAULT_VECTOR_CAPACITY - 1)) / vector::DEFAULT_VECTOR_CAPACITY;
         for (uint64_t vector_idx = start_vector_idx; vector_idx < vector_info_.size(); vector_idx++) {
@@ -510,27 +572,31 @@ namespace components::table {
             vector_info_[vector_idx] = std::move(new_info);
         }
         assert(vector_info_[vector_idx]->type == chunk_info_type::VECTOR_INFO);
-        return vector_info_[vector_idx]->cast<chunk_vector_info>();
+        return writable_chunk_info(vector_idx).cast<chunk_vector_info>();
     }
 
     uint64_t
     row_version_manager_t::delete_rows(uint64_t vector_idx, uint64_t transaction_id, int64_t rows[], uint64_t count) {
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         has_changes_ = true;
         return vector_info(vector_idx).delete_rows(transaction_id, rows, count);
     }
 
     void row_version_manager_t::commit_delete(uint64_t vector_idx, uint64_t commit_id, const delete_info& info) {
         std::lock_guard lock(version_lock_);
+        snapshot_.store(nullptr);
         has_changes_ = true;
         vector_info(vector_idx).commit_delete(commit_id, info);
     }
 
     void row_version_manager_t::commit_all_deletes(uint64_t txn_id, uint64_t commit_id) {
         std::lock_guard lock(version_lock_);
-        for (auto& info : vector_info_) {
-            if (info && info->type == chunk_info_type::VECTOR_INFO) {
-                info->cast<chunk_vector_info>().commit_all_deletes(txn_id, commit_id);
+        snapshot_.store(nullptr);
+        for (uint64_t vector_idx = 0; vector_idx < vector_info_.size(); vector_idx++) {
+            const auto& info = vector_info_[vector_idx];
+            if (info && info->type == chunk_info_type::VECTOR_INFO && info->cast<chunk_vector_info>().any_deleted) {
+                writable_chunk_info(vector_idx).cast<chunk_vector_info>().commit_all_deletes(txn_id, commit_id);
             }
         }
     }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <components/vector/indexing_vector.hpp>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -44,15 +47,16 @@ namespace components::table {
 
         virtual uint64_t indexing_vector(transaction_data transaction,
                                          vector::indexing_vector_t& indexing_vector,
-                                         uint64_t max_count) = 0;
+                                         uint64_t max_count) const = 0;
         virtual uint64_t commited_indexing_vector(uint64_t min_start_id,
                                                   uint64_t min_transaction_id,
                                                   vector::indexing_vector_t& indexing_vector,
-                                                  uint64_t max_count) = 0;
-        virtual bool fetch(transaction_data transaction, int64_t row) = 0;
+                                                  uint64_t max_count) const = 0;
+        virtual bool fetch(transaction_data transaction, int64_t row) const = 0;
         virtual void commit_append(uint64_t commit_id, uint64_t start, uint64_t end) = 0;
-        virtual uint64_t commited_deleted_count(uint64_t max_count) = 0;
+        virtual uint64_t commited_deleted_count(uint64_t max_count) const = 0;
         virtual bool cleanup(uint64_t lowest_transaction, std::unique_ptr<chunk_info>& result) const;
+        virtual std::shared_ptr<chunk_info> copy() const = 0;
 
         virtual bool has_deletes() const = 0;
 
@@ -78,15 +82,16 @@ namespace components::table {
 
         uint64_t indexing_vector(transaction_data transaction,
                                  vector::indexing_vector_t& indexing_vector,
-                                 uint64_t max_count) override;
+                                 uint64_t max_count) const override;
         uint64_t commited_indexing_vector(uint64_t min_start_id,
                                           uint64_t min_transaction_id,
                                           vector::indexing_vector_t& indexing_vector,
-                                          uint64_t max_count) override;
-        bool fetch(transaction_data transaction, int64_t row) override;
+                                          uint64_t max_count) const override;
+        bool fetch(transaction_data transaction, int64_t row) const override;
         void commit_append(uint64_t commit_id, uint64_t start, uint64_t end) override;
-        uint64_t commited_deleted_count(uint64_t max_count) override;
+        uint64_t commited_deleted_count(uint64_t max_count) const override;
         bool cleanup(uint64_t lowest_transaction, std::unique_ptr<chunk_info>& result) const override;
+        std::shared_ptr<chunk_info> copy() const override;
 
         bool has_deletes() const override;
 
@@ -116,15 +121,16 @@ namespace components::table {
                                  uint64_t max_count) const;
         uint64_t indexing_vector(transaction_data transaction,
                                  vector::indexing_vector_t& indexing_vector,
-                                 uint64_t max_count) override;
+                                 uint64_t max_count) const override;
         uint64_t commited_indexing_vector(uint64_t min_start_id,
                                           uint64_t min_transaction_id,
                                           vector::indexing_vector_t& indexing_vector,
-                                          uint64_t max_count) override;
-        bool fetch(transaction_data transaction, int64_t row) override;
+                                          uint64_t max_count) const override;
+        bool fetch(transaction_data transaction, int64_t row) const override;
         void commit_append(uint64_t commit_id, uint64_t start, uint64_t end) override;
         bool cleanup(uint64_t lowest_transaction, std::unique_ptr<chunk_info>& result) const override;
-        uint64_t commited_deleted_count(uint64_t max_count) override;
+        uint64_t commited_deleted_count(uint64_t max_count) const override;
+        std::shared_ptr<chunk_info> copy() const override;
 
         void append(uint64_t start, uint64_t end, uint64_t commit_id);
 
@@ -167,6 +173,32 @@ namespace components::table {
         uint16_t rows[1] = {};
     };
 
+    // Immutable view of the version info of a row group, taken once per scan. It shares the chunk
+    // infos with the manager; a writer that finds a chunk still held by a view copies it before
+    // changing it, so a scan reads its view without the version lock and never waits for writers.
+    class row_version_snapshot_t {
+    public:
+        explicit row_version_snapshot_t(std::vector<std::shared_ptr<const chunk_info>> vector_info)
+            : vector_info_(std::move(vector_info)) {}
+
+        uint64_t indexing_vector(transaction_data transaction,
+                                 uint64_t vector_idx,
+                                 vector::indexing_vector_t& indexing_vector,
+                                 uint64_t max_count) const;
+        uint64_t commited_indexing_vector(uint64_t start_time,
+                                          uint64_t transaction_id,
+                                          uint64_t vector_idx,
+                                          vector::indexing_vector_t& indexing_vector,
+                                          uint64_t max_count) const;
+
+    private:
+        const chunk_info* get_chunk_info(uint64_t vector_idx) const {
+            return vector_idx < vector_info_.size() ? vector_info_[vector_idx].get() : nullptr;
+        }
+
+        std::vector<std::shared_ptr<const chunk_info>> vector_info_;
+    };
+
     class row_version_manager_t {
     public:
         explicit row_version_manager_t(int64_t start) noexcept;
@@ -185,6 +217,8 @@ namespace components::table {
                                           vector::indexing_vector_t& indexing_vector,
                                           uint64_t max_count);
         bool fetch(transaction_data transaction, uint64_t row);
+        // Current version info for a scan; reused without locking until the next change
+        std::shared_ptr<const row_version_snapshot_t> snapshot();
 
         void append_version_info(transaction_data transaction,
                                  uint64_t count,
@@ -200,12 +234,16 @@ namespace components::table {
 
     private:
         chunk_info* get_chunk_info(uint64_t vector_idx);
+        // Chunk info that may be changed in place: copied first while a snapshot still holds it
+        chunk_info& writable_chunk_info(uint64_t vector_idx);
         chunk_vector_info& vector_info(uint64_t vector_idx);
         void fill_vector_info(uint64_t vector_idx);
 
         std::mutex version_lock_;
         int64_t start_;
-        std::vector<std::unique_ptr<chunk_info>> vector_info_;
+        std::vector<std::shared_ptr<chunk_info>> vector_info_;
+        // dropped by every change under version_lock_, loaded by scans without it
+        std::atomic<std::shared_ptr<const row_version_snapshot_t>> snapshot_;
         bool has_changes_;
         std::vector<storage::meta_block_pointer_t> storage_pointers_;
     };
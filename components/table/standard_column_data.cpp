@@ -72,6 +72,48 @@ namespace components::table {
         return scan_count;
     }
 
+    bool standard_column_data_t::filter_compressed(uint64_t vector_index,
+                                                   uint64_t count,
+                                                   const table_filter_t& filter,
+                                                   vector::indexing_vector_t& indexing,
+                                                   uint64_t& approved_tuple_count) {
+        if (validity.has_updates()) {
+            return false;
+        }
+        auto row = start_ + static_cast<int64_t>(vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+        if (!column_data_t::filter_compressed(vector_index, count, filter, indexing, approved_tuple_count)) {
+            return false;
+        }
+        const auto& stats = data_.get_segment(row)->segment_statistics();
+        if (approved_tuple_count == 0 || (stats.has_stats() && stats.null_count() == 0)) {
+            return true;
+        }
+        // NULL rows hold an arbitrary stored value: read the validity of the vector and drop them
+        column_scan_state state;
+        validity.initialize_scan_with_offset(state, row);
+        vector::vector_t nulls(resource_, type_, count);
+        validity.scan(vector_index, state, nulls, count);
+        const auto& mask = nulls.validity();
+        if (mask.all_valid()) {
+            return true;
+        }
+        vector::indexing_vector_t result(indexing.resource(), approved_tuple_count);
+        uint64_t result_count = 0;
+        for (uint64_t i = 0; i < approved_tuple_count; i++) {
+            auto idx = indexing.get_index(i);
+            result.set_index(result_count, idx);
+            result_count += mask.row_is_valid(idx);
+        }
+        indexing = result;
+        approved_tuple_count = result_count;
+        return true;
+    }
+
+    void standard_column_data_t::skip(column_scan_state& state, uint64_t count) {
+        column_data_t::skip(state, count);
+        validity.skip(state.child_states[0], count);
+    }
+
     void standard_column_data_t::initialize_append(column_append_state& state) {
         column_data_t::initialize_append(state);
         column_append_state child_append;
@@ -141,6 +183,12 @@ namespace components::table {
         validity.get_column_segment_info(row_group_index, std::move(col_path), result);
     }
 
+    void
+    standard_column_data_t::collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        column_data_t::collect_unloaded_blocks(blocks);
+        validity.collect_unloaded_blocks(blocks);
+    }
+
     void standard_column_data_t::initialize_column(const persistent_column_data_t& persistent_data) {
         column_data_t::initialize_column(persistent_data);
 
@@ -30,6 +30,12 @@ namespace components::table {
                                 bool allow_updates,
                                 uint64_t target_count) override;
         uint64_t scan_count(column_scan_state& state, vector::vector_t& result, uint64_t count) override;
+        bool filter_compressed(uint64_t vector_index,
+                               uint64_t count,
+                               const table_filter_t& filter,
+                               vector::indexing_vector_t& indexing,
+                               uint64_t& approved_tuple_count) override;
+        void skip(column_scan_state& state, uint64_t count = vector::DEFAULT_VECTOR_CAPACITY) override;
 
         void initialize_append(column_append_state& state) override;
         void append_data(column_append_state& state, vector::unified_vector_format& uvf, uint64_t count) override;
@@ -50,6 +56,7 @@ namespace components::table {
         void get_column_segment_info(uint64_t row_group_index,
                                      std::vector<uint64_t> col_path,
                                      std::vector<column_segment_info>& result) override;
+        void collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) override;
 
         void initialize_column(const persistent_column_data_t& persistent_data) override;
     };
@@ -163,8 +163,11 @@ namespace components::table::storage {
         }
 
         if (block_id_ < MAXIMUM_BLOCK) {
-            auto block = allocate_block(block_manager, std::move(reusable_buffer), block_id_);
-            block_manager.read(*block);
+            auto block = block_manager.map_block(block_id_);
+            if (!block) {
+                block = allocate_block(block_manager, std::move(reusable_buffer), block_id_);
+                block_manager.read(*block);
+            }
             buffer_ = std::move(block);
         } else {
             return {};
@@ -188,7 +191,11 @@ namespace components::table::storage {
 
     void block_handle_t::unload(std::unique_lock<std::mutex>& lock) {
         auto block = unload_and_take_block(lock);
+        bool mapped = block && block->is_external();
         block.reset();
+        if (mapped) {
+            block_manager.release_mapped(block_id_);
+        }
     }
 
     bool block_handle_t::can_unload() const {
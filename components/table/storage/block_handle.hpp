@@ -41,6 +41,13 @@ namespace components::table::storage {
         EVICTION = 1,
         UNPIN = 2
     };
+    // What a pin is for; lets the buffer pool keep blocks that only sequential scans read out of the
+    // way of blocks that are looked up again and again
+    enum class buffer_access_hint : uint8_t
+    {
+        NORMAL = 0,
+        SEQUENTIAL_SCAN = 1
+    };
 
     struct buffer_pool_reservation_t {
         memory_tag tag;
@@ -113,6 +120,18 @@ namespace components::table::storage {
 
         uint64_t eviction_queue_index() const { return eviction_queue_idx_; }
 
+        void record_access(buffer_access_hint hint) {
+            if (hint != buffer_access_hint::SEQUENTIAL_SCAN) {
+                scan_only_.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        // Whether only sequential scans pinned the block since the last call
+        bool take_scan_only_access() { return scan_only_.exchange(true, std::memory_order_relaxed); }
+
+        bool in_cold_eviction_queue() const { return in_cold_queue_.load(std::memory_order_relaxed); }
+        void set_in_cold_eviction_queue(bool cold) { in_cold_queue_.store(cold, std::memory_order_relaxed); }
+
         file_buffer_type buffer_type() const { return buffer_type_; }
 
         block_state state() const { return state_; }
@@ -158,6 +177,8 @@ namespace components::table::storage {
         buffer_pool_reservation_t memory_charge_;
         const char* unswizzled_;
         std::atomic<uint64_t> eviction_queue_idx_;
+        std::atomic<bool> scan_only_{true};
+        std::atomic<bool> in_cold_queue_{false};
     };
 
 } //namespace components::table::storage
\ No newline at end of file
@@ -31,6 +31,12 @@ namespace components::table::storage {
         virtual void increase_block_ref_count(uint64_t block_id) = 0;
         virtual uint64_t meta_block() = 0;
         virtual void read(block_t& block) = 0;
+        // The block served in place from a mapping of the database file, or nullptr when it has to
+        // be read into a buffer
+        virtual std::unique_ptr<block_t> map_block(uint64_t) { return nullptr; }
+        virtual bool is_mapped(uint64_t) const { return false; }
+        // Called once a block served by map_block() is unloaded, to give back the pages it used
+        virtual void release_mapped(uint64_t) {}
         virtual void read_blocks(file_buffer_t& buffer, uint64_t start_block, uint64_t block_count) = 0;
         virtual void write(file_buffer_t& block, uint64_t block_id) = 0;
         void write(block_t& block) { write(block, block.id); }
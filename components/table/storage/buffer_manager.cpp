@@ -1,9 +1,14 @@
 #include "buffer_manager.hpp"
 
+#include "buffer_handle.hpp"
 #include "buffer_pool.hpp"
 
 namespace components::table::storage {
 
+    buffer_handle_t buffer_manager_t::pin(std::shared_ptr<block_handle_t>& handle) {
+        return pin(handle, buffer_access_hint::NORMAL);
+    }
+
     std::shared_ptr<block_handle_t> buffer_manager_t::register_transient_memory(uint64_t, uint64_t) {
         throw std::logic_error(
             "Incorrect call: This type of buffer_manager_t can not create 'transient-memory' blocks");
@@ -40,7 +40,8 @@ namespace components::table::storage {
 
         virtual buffer_handle_t allocate(memory_tag tag, uint64_t block_size, bool can_destroy = true) = 0;
         virtual void reallocate(std::shared_ptr<block_handle_t>& handle, uint64_t block_size) = 0;
-        virtual buffer_handle_t pin(std::shared_ptr<block_handle_t>& handle) = 0;
+        virtual buffer_handle_t pin(std::shared_ptr<block_handle_t>& handle, buffer_access_hint hint) = 0;
+        buffer_handle_t pin(std::shared_ptr<block_handle_t>& handle);
         virtual void prefetch(std::vector<std::shared_ptr<block_handle_t>>& handles) = 0;
         virtual void unpin(block_handle_t* handle) = 0;
 
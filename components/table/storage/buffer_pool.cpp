@@ -30,18 +30,13 @@ namespace components::table::storage {
     }
 
     bool eviction_queue_t::add_to_eviction_queue(buffer_eviction_node_t&& node) {
-        q.push(std::move(node));
+        q.enqueue(std::move(node));
         return ++evict_queue_insertions_ % INSERT_INTERVAL == 0;
     }
 
     bool eviction_queue_t::try_dequeue_with_lock(buffer_eviction_node_t& node) {
         std::lock_guard lock(purge_lock_);
-        if (q.empty()) {
-            return false;
-        }
-        node = std::move(q.front());
-        q.pop();
-        return true;
+        return q.try_dequeue(node);
     }
 
     void eviction_queue_t::purge() {
@@ -51,7 +46,7 @@ namespace components::table::storage {
         std::lock_guard lock{purge_lock_, std::adopt_lock};
 
         uint64_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
-        uint64_t approx_q_size = q.size();
+        uint64_t approx_q_size = q.size_approx();
 
         if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
             return;
@@ -61,7 +56,7 @@ namespace components::table::storage {
         while (max_purges != 0) {
             purge_iteration(purge_size);
 
-            approx_q_size = q.size();
+            approx_q_size = q.size_approx();
 
             if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
                 break;
@@ -88,12 +83,10 @@ namespace components::table::storage {
         uint64_t actually_dequeued = purge_size;
         auto it = purge_nodes_.begin();
         for (size_t i = 0; i < purge_size; i++) {
-            if (q.empty()) {
+            if (!q.try_dequeue(*it)) {
                 actually_dequeued = i;
                 break;
             }
-            *it = std::move(q.front());
-            q.pop();
             ++it;
         }
 
@@ -102,7 +95,7 @@ namespace components::table::storage {
             auto& node = purge_nodes_[i];
             auto handle = node.try_get_block_handle();
             if (handle) {
-                q.push(std::move(node));
+                q.enqueue(std::move(node));
                 alive_nodes++;
             }
         }
@@ -114,13 +107,9 @@ namespace components::table::storage {
     void eviction_queue_t::iterate_unloadable_blocks(FN fn) {
         for (;;) {
             buffer_eviction_node_t node;
-            if (q.empty()) {
-                if (!try_dequeue_with_lock(node)) {
-                    return;
-                }
+            if (!q.try_dequeue(node) && !try_dequeue_with_lock(node)) {
+                return;
             }
-            node = std::move(q.front());
-            q.pop();
 
             auto handle = node.try_get_block_handle();
             if (!handle) {
@@ -143,12 +132,17 @@ namespace components::table::storage {
     buffer_pool_t::buffer_pool_t(std::pmr::memory_resource* resource,
                                  uint64_t maximum_memory,
                                  bool track_eviction_timestamps,
-                                 uint64_t allocator_bulk_deallocation_flush_threshold)
+                                 uint64_t allocator_bulk_deallocation_flush_threshold,
+                                 eviction_policy policy)
         : eviction_queue_sizes({BLOCK_QUEUE_SIZE, MANAGED_BUFFER_QUEUE_SIZE, TINY_BUFFER_QUEUE_SIZE})
         , resource(resource)
         , maximum_memory(maximum_memory)
         , allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold)
-        , track_eviction_timestamps(track_eviction_timestamps) {
+        , track_eviction_timestamps(track_eviction_timestamps)
+        , policy(policy) {
+        for (uint8_t type_idx = 0; type_idx < COLD_QUEUE_COUNT; type_idx++) {
+            queues.push_back(std::make_unique<eviction_queue_t>(static_cast<file_buffer_type>(type_idx + 1)));
+        }
         for (uint8_t type_idx = 0; type_idx < FILE_BUFFER_TYPE_COUNT; type_idx++) {
             const auto type = static_cast<file_buffer_type>(type_idx + 1);
             const auto& type_queue_size = eviction_queue_sizes[type_idx];
@@ -218,7 +212,8 @@ namespace components::table::storage {
         queue.iterate_unloadable_blocks([&](buffer_eviction_node_t&,
                                             const std::shared_ptr<block_handle_t>& handle,
                                             std::unique_lock<std::mutex>& lock) {
-            if (buffer && handle->get_buffer(lock)->allocation_size() == extra_memory) {
+            auto& file_buffer = handle->get_buffer(lock);
+            if (buffer && !file_buffer->is_external() && file_buffer->allocation_size() == extra_memory) {
                 *buffer = handle->unload_and_take_block(lock);
                 found = true;
                 return false;
@@ -270,9 +265,13 @@ namespace components::table::storage {
     void buffer_pool_t::purge_queue(const block_handle_t& handle) { eviction_queue_for_handle(handle).purge(); }
 
     bool buffer_pool_t::add_to_eviction_queue(std::shared_ptr<block_handle_t>& handle) {
-        auto& queue = eviction_queue_for_handle(*handle);
+        auto& previous_queue = eviction_queue_for_handle(*handle);
         assert(handle->readers() == 0);
         auto ts = handle->next_eviction_sequence_number();
+        auto scan_only = handle->take_scan_only_access();
+        if (policy == eviction_policy::TWO_QUEUE) {
+            handle->set_in_cold_eviction_queue(ts == 1 || scan_only);
+        }
         if (track_eviction_timestamps) {
             handle->set_LRU_timestamp(
                 std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now())
@@ -281,15 +280,21 @@ namespace components::table::storage {
         }
 
         if (ts != 1) {
-            queue.increment_dead_nodes();
+            previous_queue.increment_dead_nodes();
         }
 
+        auto& queue = eviction_queue_for_handle(*handle);
         return queue.add_to_eviction_queue(buffer_eviction_node_t(std::weak_ptr(handle), ts));
     }
 
     eviction_queue_t& buffer_pool_t::eviction_queue_for_handle(const block_handle_t& handle) {
         const auto& handle_buffer_type = handle.buffer_type();
-        uint64_t queue_index = 0;
+        if (handle.in_cold_eviction_queue()) {
+            auto queue_index = static_cast<uint64_t>(static_cast<uint8_t>(handle_buffer_type) - 1);
+            assert(queues[queue_index]->buffer_type == handle_buffer_type);
+            return *queues[queue_index];
+        }
+        uint64_t queue_index = COLD_QUEUE_COUNT;
         for (uint8_t type_idx = 0; type_idx < FILE_BUFFER_TYPE_COUNT; type_idx++) {
             const auto queue_buffer_type = static_cast<file_buffer_type>(type_idx + 1);
             if (handle_buffer_type == queue_buffer_type) {
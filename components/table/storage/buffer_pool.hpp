@@ -1,15 +1,26 @@
 #pragma once
 
 #include "block_handle.hpp"
+#include "concurrent_queue.hpp"
 
 #include <array>
-#include <queue>
 #include <thread>
 
 namespace components::table::storage {
 
     struct temp_buffer_pool_reservation_t;
 
+    // How buffer_pool_t picks the unpinned buffers to evict
+    enum class eviction_policy : uint8_t
+    {
+        // in order of the last unpin
+        LRU = 0,
+        // 2Q: buffers unpinned for the first time, or pinned only by sequential scans since they were
+        // last queued, wait in a cold queue that is evicted before the LRU queues. A large scan then
+        // cycles through the cold queue instead of flushing blocks that are read again and again.
+        TWO_QUEUE = 1
+    };
+
     struct buffer_eviction_node_t {
         buffer_eviction_node_t() = default;
         buffer_eviction_node_t(std::weak_ptr<block_handle_t> handle, uint64_t eviction_seq_num);
@@ -41,7 +52,7 @@ namespace components::table::storage {
 
     public:
         const file_buffer_type buffer_type;
-        std::queue<buffer_eviction_node_t> q;
+        concurrent_queue_t<buffer_eviction_node_t> q;
 
     private:
         constexpr static uint64_t INSERT_INTERVAL = 4096;
@@ -67,7 +78,8 @@ namespace components::table::storage {
         buffer_pool_t(std::pmr::memory_resource* resource,
                       uint64_t maximum_memory,
                       bool track_eviction_timestamps,
-                      uint64_t allocator_bulk_deallocation_flush_threshold);
+                      uint64_t allocator_bulk_deallocation_flush_threshold,
+                      eviction_policy policy = eviction_policy::TWO_QUEUE);
 
         void set_limit(uint64_t limit);
 
@@ -104,6 +116,8 @@ namespace components::table::storage {
         eviction_queue_t& eviction_queue_for_handle(const block_handle_t& handle);
         void increment_dead_nodes(const block_handle_t& handle);
 
+        // one cold queue per buffer type, ahead of all the LRU queues
+        static constexpr uint64_t COLD_QUEUE_COUNT = FILE_BUFFER_TYPE_COUNT;
         static constexpr uint64_t BLOCK_QUEUE_SIZE = 1;
         static constexpr uint64_t MANAGED_BUFFER_QUEUE_SIZE = 6;
         static constexpr uint64_t TINY_BUFFER_QUEUE_SIZE = 1;
@@ -154,6 +168,7 @@ namespace components::table::storage {
         std::atomic<uint64_t> maximum_memory;
         std::atomic<uint64_t> allocator_bulk_deallocation_flush_threshold;
         bool track_eviction_timestamps;
+        const eviction_policy policy;
         std::vector<std::unique_ptr<eviction_queue_t>> queues;
         mutable memory_usage_t memory_usage;
     };
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace components::table::storage {
+
+    // Unbounded multi-producer multi-consumer queue cut into stripes with a lock each. A producer
+    // appends to the stripe of its thread, so threads unpinning blocks at the same time rarely meet
+    // on a lock; consumers take from the stripes round-robin and skip empty ones without locking.
+    // Every stripe is FIFO and the queue as a whole only roughly so.
+    template<typename T>
+    class concurrent_queue_t {
+    public:
+        static constexpr size_t STRIPE_COUNT = 16;
+
+        void enqueue(T&& value) {
+            auto& stripe = stripes_[std::hash<std::thread::id>()(std::this_thread::get_id()) % STRIPE_COUNT];
+            std::lock_guard lock(stripe.lock);
+            // counted before the item shows up, so a consumer that takes it never drives size_ below zero
+            size_.fetch_add(1, std::memory_order_relaxed);
+            stripe.items.push_back(std::move(value));
+            stripe.size.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool try_dequeue(T& value) {
+            if (size_.load(std::memory_order_relaxed) == 0) {
+                return false;
+            }
+            auto start = next_stripe_.fetch_add(1, std::memory_order_relaxed);
+            for (size_t i = 0; i < STRIPE_COUNT; i++) {
+                auto& stripe = stripes_[(start + i) % STRIPE_COUNT];
+                if (stripe.size.load(std::memory_order_relaxed) == 0) {
+                    continue;
+                }
+                std::lock_guard lock(stripe.lock);
+                if (stripe.items.empty()) {
+                    continue;
+                }
+                value = std::move(stripe.items.front());
+                stripe.items.pop_front();
+                stripe.size.fetch_sub(1, std::memory_order_relaxed);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        // Exact only while no other thread touches the queue
+        size_t size_approx() const { return size_.load(std::memory_order_relaxed); }
+
+    private:
+        struct alignas(64) stripe_t {
+            std::mutex lock;
+            std::deque<T> items;
+            std::atomic<size_t> size{0};
+        };
+
+        std::array<stripe_t, STRIPE_COUNT> stripes_;
+        std::atomic<size_t> size_{0};
+        std::atomic<size_t> next_stripe_{0};
+    };
+
+} // namespace components::table::storage
@@ -20,15 +20,27 @@ namespace components::table::storage {
         , buffer_(source.buffer_)
         , size_(source.size_)
         , internal_buffer_(source.internal_buffer_)
-        , internal_size_(source.internal_size_) {
+        , internal_size_(source.internal_size_)
+        , external_(source.external_) {
         source.buffer_ = nullptr;
         source.internal_buffer_ = nullptr;
         source.size_ = 0;
         source.internal_size_ = 0;
     }
 
+    file_buffer_t::file_buffer_t(file_buffer_type type, std::byte* external, uint64_t size)
+        : resource_(nullptr)
+        , type_(type)
+        , internal_buffer_(external)
+        , internal_size_(size)
+        , external_(true) {
+        assert(type != file_buffer_type::TINY_BUFFER && size > DEFAULT_BLOCK_HEADER_SIZE);
+        buffer_ = internal_buffer_ + DEFAULT_BLOCK_HEADER_SIZE;
+        size_ = internal_size_ - DEFAULT_BLOCK_HEADER_SIZE;
+    }
+
     file_buffer_t::~file_buffer_t() {
-        if (!internal_buffer_) {
+        if (!internal_buffer_ || external_) {
             return;
         }
         resource_->deallocate(internal_buffer_, internal_size_);
@@ -45,6 +57,7 @@ namespace components::table::storage {
     }
 
     void file_buffer_t::reallocate_buffer(size_t new_size) {
+        assert(!external_);
         std::byte* new_buffer = static_cast<std::byte*>(resource_->allocate(new_size));
         if (internal_buffer_) {
             std::memcpy(new_buffer, internal_buffer_, std::min(new_size, size_));
@@ -97,6 +110,12 @@ namespace components::table::storage {
         assert((allocation_size() & (SECTOR_SIZE - 1)) == 0);
     }
 
+    block_t::block_t(uint64_t id, std::byte* external, uint64_t size)
+        : file_buffer_t(file_buffer_type::BLOCK, external, size)
+        , id(id) {
+        assert((allocation_size() & (SECTOR_SIZE - 1)) == 0);
+    }
+
     uint32_t meta_block_pointer_t::block_id() const { return static_cast<uint32_t>(block_pointer / 64); }
 
     uint32_t meta_block_pointer_t::GetBlockIndex() const { return static_cast<uint32_t>(block_pointer % 64); }
@@ -28,6 +28,8 @@ namespace components::table::storage {
 
         file_buffer_t(std::pmr::memory_resource* resource, file_buffer_type type, uint64_t user_size);
         file_buffer_t(file_buffer_t& source, file_buffer_type type);
+        // Wraps `size` bytes the buffer does not own, such as a block of a mapped database file
+        file_buffer_t(file_buffer_type type, std::byte* external, uint64_t size);
         virtual ~file_buffer_t();
 
         void read(core::filesystem::file_handle_t& handle, uint64_t location);
@@ -40,6 +42,8 @@ namespace components::table::storage {
         void resize(uint64_t user_size);
 
         uint64_t allocation_size() const { return internal_size_; }
+        // External memory is never freed nor handed out for reuse
+        bool is_external() const { return external_; }
         std::byte* internal_buffer() { return internal_buffer_; }
         std::byte* buffer() { return buffer_; }
 
@@ -63,6 +67,7 @@ namespace components::table::storage {
         size_t size_ = 0;
         std::byte* internal_buffer_ = nullptr;
         uint64_t internal_size_ = 0;
+        bool external_ = false;
     };
 
     class block_t : public file_buffer_t {
@@ -70,6 +75,7 @@ namespace components::table::storage {
         block_t(std::pmr::memory_resource* resource, uint64_t id, uint64_t block_size);
         block_t(std::pmr::memory_resource* resource, uint64_t id, uint32_t internal_size);
         block_t(file_buffer_t& source, uint64_t id);
+        block_t(uint64_t id, std::byte* external, uint64_t size);
 
         uint64_t id;
     };
@@ -11,17 +11,25 @@
 #include <core/file/file_handle.hpp>
 #include <core/file/local_file_system.hpp>
 
+#ifdef PLATFORM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace components::table::storage {
 
     single_file_block_manager_t::single_file_block_manager_t(buffer_manager_t& buffer_manager,
                                                              core::filesystem::local_file_system_t& fs,
                                                              const std::string& path,
-                                                             uint64_t block_alloc_size)
+                                                             uint64_t block_alloc_size,
+                                                             block_read_mode read_mode)
         : block_manager_t(buffer_manager, block_alloc_size)
         , fs_(fs)
-        , path_(path) {}
+        , path_(path)
+        , read_mode_(read_mode) {}
 
-    single_file_block_manager_t::~single_file_block_manager_t() = default;
+    single_file_block_manager_t::~single_file_block_manager_t() { unmap_file(); }
 
     uint64_t single_file_block_manager_t::block_location(uint64_t block_id) const {
         return BLOCK_START + block_id * block_allocation_size();
@@ -97,6 +105,10 @@ namespace components::table::storage {
         if (active.free_list != INVALID_INDEX) {
             deserialize_free_list(meta_block_pointer_t{active.free_list, 0});
         }
+
+        if (read_mode_ == block_read_mode::MMAP) {
+            map_file();
+        }
     }
 
     // --- Phase 1B: Block I/O ---
@@ -110,6 +122,77 @@ namespace components::table::storage {
         }
     }
 
+    std::unique_ptr<block_t> single_file_block_manager_t::map_block(uint64_t block_id) {
+        if (!is_mapped(block_id)) {
+            return nullptr;
+        }
+        auto* data = mapping_ + block_location(block_id);
+        auto block = std::make_unique<block_t>(block_id, data, block_allocation_size());
+        if (!verified_[block_id].load(std::memory_order_acquire)) {
+            if (!verify_checksum(*block)) {
+                throw std::runtime_error("Block checksum mismatch for block " + std::to_string(block_id));
+            }
+            verified_[block_id].store(true, std::memory_order_release);
+        } else {
+#ifdef PLATFORM_POSIX
+            // the kernel may have dropped the pages since: start reading them back
+            ::madvise(data, block_allocation_size(), MADV_WILLNEED);
+#endif
+        }
+        return block;
+    }
+
+    bool single_file_block_manager_t::is_mapped(uint64_t block_id) const {
+        return mapping_ && block_id < mapped_blocks_;
+    }
+
+    void single_file_block_manager_t::release_mapped(uint64_t block_id) {
+        if (!is_mapped(block_id)) {
+            return;
+        }
+#ifdef PLATFORM_POSIX
+        // pages written into the block are private copies the kernel cannot drop by itself; the next
+        // load faults the block back in from the file
+        ::madvise(mapping_ + block_location(block_id), block_allocation_size(), MADV_DONTNEED);
+#endif
+    }
+
+    void single_file_block_manager_t::map_file() {
+#ifdef PLATFORM_POSIX
+        auto size = block_location(max_block_);
+        if (max_block_ == 0 || handle_->file_size() < size) {
+            return;
+        }
+        int fd = ::open(path_.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        // private and writable: whatever is written into a loaded block stays in memory, as it does
+        // with a buffered read, and never reaches the file
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            return;
+        }
+        mapping_ = static_cast<std::byte*>(mapping);
+        mapping_size_ = size;
+        mapped_blocks_ = max_block_;
+        verified_ = std::make_unique<std::atomic<bool>[]>(mapped_blocks_);
+#endif
+    }
+
+    void single_file_block_manager_t::unmap_file() {
+#ifdef PLATFORM_POSIX
+        if (mapping_) {
+            ::munmap(mapping_, mapping_size_);
+        }
+#endif
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+        mapped_blocks_ = 0;
+        verified_.reset();
+    }
+
     void single_file_block_manager_t::read_blocks(file_buffer_t& buffer, uint64_t start_block, uint64_t /*count*/) {
         auto location = block_location(start_block);
         buffer.read(*handle_, location);
@@ -212,6 +295,14 @@ namespace components::table::storage {
 
         auto location = block_location(block_id);
         buffer.write(*handle_, location);
+
+        if (is_mapped(block_id)) {
+            // the id was reused: drop pages written into the old block so the mapping shows the file
+#ifdef PLATFORM_POSIX
+            ::madvise(mapping_ + location, block_allocation_size(), MADV_DONTNEED);
+#endif
+            verified_[block_id].store(false, std::memory_order_release);
+        }
     }
 
     bool single_file_block_manager_t::verify_checksum(file_buffer_t& buffer) {
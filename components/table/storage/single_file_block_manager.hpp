@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -59,12 +60,24 @@ namespace components::table::storage {
     };
     static_assert(sizeof(database_header_t) == SECTOR_SIZE, "database_header_t must be SECTOR_SIZE");
 
+    enum class block_read_mode : uint8_t
+    {
+        // blocks are read into buffers of the buffer pool
+        BUFFERED = 0,
+        // blocks that were in the file when it was opened are used in place from a private mapping of
+        // it, served by the OS page cache without a copy; their checksums are verified on first use.
+        // Blocks written later are read into buffers. Table files reopened at startup use it when
+        // config_disk::mmap_reads is set.
+        MMAP = 1
+    };
+
     class single_file_block_manager_t : public block_manager_t {
     public:
         single_file_block_manager_t(buffer_manager_t& buffer_manager,
                                     core::filesystem::local_file_system_t& fs,
                                     const std::string& path,
-                                    uint64_t block_alloc_size = DEFAULT_BLOCK_ALLOC_SIZE);
+                                    uint64_t block_alloc_size = DEFAULT_BLOCK_ALLOC_SIZE,
+                                    block_read_mode read_mode = block_read_mode::BUFFERED);
         ~single_file_block_manager_t() override;
 
         void create_new_database();
@@ -83,6 +96,9 @@ namespace components::table::storage {
         uint64_t meta_block() override;
         void set_meta_block(uint64_t block) { meta_block_ = block; }
         void read(block_t& block) override;
+        std::unique_ptr<block_t> map_block(uint64_t block_id) override;
+        bool is_mapped(uint64_t block_id) const override;
+        void release_mapped(uint64_t block_id) override;
         void read_blocks(file_buffer_t& buffer, uint64_t start_block, uint64_t block_count) override;
         void write(file_buffer_t& block, uint64_t block_id) override;
 
@@ -103,6 +119,8 @@ namespace components::table::storage {
         uint64_t block_location(uint64_t block_id) const;
         void checksum_and_write(file_buffer_t& buffer, uint64_t block_id);
         bool verify_checksum(file_buffer_t& buffer);
+        void map_file();
+        void unmap_file();
 
         core::filesystem::local_file_system_t& fs_;
         std::string path_;
@@ -115,6 +133,12 @@ namespace components::table::storage {
         uint64_t max_block_{0};
         uint64_t iteration_{0};
         uint64_t meta_block_{INVALID_INDEX};
+
+        block_read_mode read_mode_;
+        std::byte* mapping_{nullptr};
+        uint64_t mapping_size_{0};
+        uint64_t mapped_blocks_{0};
+        std::unique_ptr<std::atomic<bool>[]> verified_; // per mapped block
     };
 
 } // namespace components::table::storage
@@ -179,9 +179,15 @@ namespace components::table::storage {
         std::map<uint64_t, uint64_t> to_be_loaded;
         for (uint64_t block_idx = 0; block_idx < handles.size(); block_idx++) {
             auto& handle = handles[block_idx];
-            if (handle->state() != block_state::LOADED) {
-                to_be_loaded.insert(std::make_pair(handle->block_id(), block_idx));
+            if (handle->state() == block_state::LOADED) {
+                continue;
+            }
+            if (handle->block_manager.is_mapped(handle->block_id())) {
+                // nothing to copy: loading only points the handle at the mapping
+                pin(handle);
+                continue;
             }
+            to_be_loaded.insert(std::make_pair(handle->block_id(), block_idx));
         }
         if (to_be_loaded.empty()) {
             return;
@@ -203,8 +209,9 @@ namespace components::table::storage {
         batch_read(handles, to_be_loaded, first_block, previous_block_id);
     }
 
-    buffer_handle_t standard_buffer_manager_t::pin(std::shared_ptr<block_handle_t>& handle) {
+    buffer_handle_t standard_buffer_manager_t::pin(std::shared_ptr<block_handle_t>& handle, buffer_access_hint hint) {
         buffer_handle_t buf;
+        handle->record_access(hint);
 
         uint64_t required_memory;
         {
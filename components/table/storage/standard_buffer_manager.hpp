@@ -32,7 +32,8 @@ namespace components::table::storage {
 
         void reallocate(std::shared_ptr<block_handle_t>& handle, uint64_t block_size) final;
 
-        buffer_handle_t pin(std::shared_ptr<block_handle_t>& handle) final;
+        using buffer_manager_t::pin;
+        buffer_handle_t pin(std::shared_ptr<block_handle_t>& handle, buffer_access_hint hint) final;
         void prefetch(std::vector<std::shared_ptr<block_handle_t>>& handles) final;
         void unpin(block_handle_t* handle) final;
 
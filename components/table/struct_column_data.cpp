@@ -241,4 +241,11 @@ namespace components::table {
         }
     }
 
+    void struct_column_data_t::collect_unloaded_blocks(std::vector<std::shared_ptr<storage::block_handle_t>>& blocks) {
+        validity.collect_unloaded_blocks(blocks);
+        for (auto& sub_column : sub_columns) {
+            sub_column->collect_unloaded_blocks(blocks);
+        }
+    }
+
 } // namespace components::table
\ No newline at end of file
@@ -4,6 +4,10 @@
 
 #include "collection.hpp"
 #include "row_group.hpp"
+#include "storage/block_manager.hpp"
+#include "storage/buffer_manager.hpp"
+
+#include <unordered_set>
 
 namespace components::table {
     void scan_filter_info::initialize(table_filter_set_t& filters, const std::vector<storage_index_t>& column_ids) {
@@ -175,6 +179,43 @@ namespace components::table {
 
     const table_filter_t* collection_scan_state::filter() { return parent_.filter; }
 
+    void collection_scan_state::read_ahead() {
+        if (!row_group || !row_groups || row_group->start < read_ahead_end) {
+            return;
+        }
+        read_ahead_blocks = read_ahead_blocks == 0 ? READ_AHEAD_INITIAL_BLOCKS
+                                                   : std::min(read_ahead_blocks * 2, READ_AHEAD_MAX_BLOCKS);
+        // never keep more than an eighth of the buffer pool in flight
+        auto& block_manager = row_group->block_manager();
+        auto memory_blocks =
+            block_manager.buffer_manager.query_max_memory() / (8 * block_manager.block_allocation_size());
+        auto limit = std::max<uint64_t>(1, std::min(read_ahead_blocks, memory_blocks));
+
+        std::vector<std::shared_ptr<storage::block_handle_t>> blocks;
+        std::vector<std::shared_ptr<storage::block_handle_t>> row_group_blocks;
+        std::unordered_set<uint64_t> block_ids;
+        auto& ids = column_ids();
+        auto* group = row_group;
+        for (uint64_t i = 0; group && group->start < max_row && blocks.size() < limit && i < READ_AHEAD_MAX_ROW_GROUPS;
+             i++) {
+            row_group_blocks.clear();
+            group->collect_unloaded_blocks(ids, row_group_blocks);
+            for (auto& block : row_group_blocks) {
+                if (block_ids.insert(block->block_id()).second) {
+                    blocks.push_back(std::move(block));
+                }
+            }
+            read_ahead_end = group->start + static_cast<int64_t>(group->count.load());
+            group = row_groups->next_segment(group);
+        }
+        if (!group || group->start >= max_row) {
+            read_ahead_end = std::numeric_limits<int64_t>::max();
+        }
+        if (!blocks.empty()) {
+            block_manager.buffer_manager.prefetch(blocks);
+        }
+    }
+
     bool collection_scan_state::scan(vector::data_chunk_t& result) {
         while (row_group) {
             row_group->scan(*this, result);
@@ -191,6 +232,7 @@ namespace components::table {
                         }
                         bool scan_row_group = row_group->initialize_scan(*this);
                         if (scan_row_group) {
+                            read_ahead();
                             break;
                         }
                     }
@@ -167,12 +167,27 @@ namespace components::table {
         uint64_t batch_index;
         vector::indexing_vector_t valid_indexing;
         transaction_data txn{0, 0};
+        // Version info of row_group as of entering it; null while the row group has none
+        std::shared_ptr<const row_version_snapshot_t> versions;
+
+        // Read-ahead: row groups before read_ahead_end were already prefetched. The window starts
+        // small and doubles each time the scan uses it up, so short scans read little and long
+        // scans load their blocks in large coalesced reads. Row groups are small and their
+        // segments share blocks, so one read-ahead may look at many of them.
+        static constexpr uint64_t READ_AHEAD_INITIAL_BLOCKS = 2;
+        static constexpr uint64_t READ_AHEAD_MAX_BLOCKS = 64;
+        static constexpr uint64_t READ_AHEAD_MAX_ROW_GROUPS = 256;
+        int64_t read_ahead_end{0};
+        uint64_t read_ahead_blocks{0};
 
         std::random_device random;
 
         void initialize(const std::pmr::vector<types::complex_logical_type>& types);
         const std::vector<storage_index_t>& column_ids();
         const table_filter_t* filter();
+        // Prefetches the projected columns of the row groups ahead once the scan enters one past
+        // read_ahead_end
+        void read_ahead();
         bool scan(vector::data_chunk_t& result);
         bool scan_committed(vector::data_chunk_t& result, table_scan_type type);
         bool scan_committed(vector::data_chunk_t& result, std::unique_lock<std::mutex>& l, table_scan_type type);
@@ -1,4 +1,5 @@
 #include <catch2/catch.hpp>
+#include <components/table/storage/buffer_handle.hpp>
 #include <components/table/storage/buffer_pool.hpp>
 #include <components/table/storage/single_file_block_manager.hpp>
 #include <components/table/storage/standard_buffer_manager.hpp>
@@ -270,3 +271,86 @@ TEST_CASE("single_file_block_manager: empty free list persistence") {
 
     cleanup_test_file();
 }
+
+TEST_CASE("single_file_block_manager: mmap read mode") {
+    using namespace components::table::storage;
+    cleanup_test_file();
+
+    test_env_t env;
+    constexpr size_t NUM_BLOCKS = 3;
+
+    auto fill = [](block_t& blk, size_t seed) {
+        for (size_t j = 0; j < blk.size(); j++) {
+            blk.buffer()[j] = static_cast<std::byte>((seed * 37 + j * 13) & 0xFF);
+        }
+    };
+    auto matches = [](const std::byte* data, uint64_t size, size_t seed) {
+        for (size_t j = 0; j < size; j++) {
+            if (data[j] != static_cast<std::byte>((seed * 37 + j * 13) & 0xFF)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        bm.create_new_database();
+        for (size_t i = 0; i < NUM_BLOCKS; i++) {
+            uint64_t id = bm.free_block_id();
+            auto blk = std::make_unique<block_t>(env.resource.upstream_resource(),
+                                                 id,
+                                                 static_cast<uint64_t>(bm.block_size()));
+            fill(*blk, i);
+            bm.write(*blk, id);
+        }
+        database_header_t header;
+        header.initialize();
+        bm.write_header(header);
+    }
+
+    single_file_block_manager_t bm(env.buffer_manager,
+                                   env.fs,
+                                   test_db_path(),
+                                   DEFAULT_BLOCK_ALLOC_SIZE,
+                                   block_read_mode::MMAP);
+    bm.load_existing_database();
+    REQUIRE(bm.is_mapped(0));
+    REQUIRE(bm.is_mapped(NUM_BLOCKS - 1));
+    REQUIRE_FALSE(bm.is_mapped(NUM_BLOCKS));
+
+    for (size_t i = 0; i < NUM_BLOCKS; i++) {
+        auto handle = bm.register_block(i);
+        auto pinned = env.buffer_manager.pin(handle);
+        REQUIRE(pinned.file_buffer().is_external());
+        REQUIRE(matches(pinned.ptr(), bm.block_size(), i));
+    }
+
+    // rewriting a mapped block is seen by the next load of it
+    {
+        auto blk =
+            std::make_unique<block_t>(env.resource.upstream_resource(), 1, static_cast<uint64_t>(bm.block_size()));
+        fill(*blk, 7);
+        bm.write(*blk, 1);
+        auto mapped = bm.map_block(1);
+        REQUIRE(matches(mapped->buffer(), bm.block_size(), 7));
+    }
+
+    // pages written into a loaded block are dropped when it is unloaded: the next load sees the file
+    {
+        auto handle = bm.register_block(0);
+        {
+            auto pinned = env.buffer_manager.pin(handle);
+            std::memset(pinned.ptr(), 0, bm.block_size());
+        }
+        {
+            auto lock = handle->get_lock();
+            handle->unload(lock);
+        }
+        auto pinned = env.buffer_manager.pin(handle);
+        REQUIRE(pinned.file_buffer().is_external());
+        REQUIRE(matches(pinned.ptr(), bm.block_size(), 0));
+    }
+
+    cleanup_test_file();
+}
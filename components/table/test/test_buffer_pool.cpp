@@ -0,0 +1,70 @@
+#include <catch2/catch.hpp>
+#include <components/table/storage/block_manager.hpp>
+#include <components/table/storage/buffer_handle.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+using namespace components::table::storage;
+
+namespace {
+    constexpr uint64_t POOL_BLOCKS = 4;
+
+    struct test_env_t {
+        std::pmr::synchronized_pool_resource resource;
+        core::filesystem::local_file_system_t fs;
+        buffer_pool_t buffer_pool;
+        standard_buffer_manager_t buffer_manager;
+
+        explicit test_env_t(eviction_policy policy)
+            : buffer_pool(&resource, POOL_BLOCKS * DEFAULT_BLOCK_ALLOC_SIZE, false, uint64_t(1) << 24, policy)
+            , buffer_manager(&resource, fs, buffer_pool) {}
+
+        // allocates a block and leaves it unpinned
+        std::shared_ptr<block_handle_t> allocate() {
+            auto handle = buffer_manager.allocate(memory_tag::BASE_TABLE, buffer_manager.block_size());
+            return handle.block_handle()->shared_from_this();
+        }
+
+        void touch(std::shared_ptr<block_handle_t>& block, buffer_access_hint hint) {
+            auto handle = buffer_manager.pin(block, hint);
+            REQUIRE(handle.is_valid());
+        }
+    };
+} // namespace
+
+TEST_CASE("buffer_pool: scan keeps reused blocks loaded") {
+    test_env_t env(eviction_policy::TWO_QUEUE);
+
+    auto hot = env.allocate();
+    env.touch(hot, buffer_access_hint::NORMAL);
+
+    auto scanned = env.allocate();
+    env.touch(scanned, buffer_access_hint::SEQUENTIAL_SCAN);
+    env.touch(scanned, buffer_access_hint::SEQUENTIAL_SCAN);
+
+    std::vector<std::shared_ptr<block_handle_t>> scan;
+    for (uint64_t i = 0; i < 2 * POOL_BLOCKS; i++) {
+        scan.push_back(env.allocate());
+    }
+
+    REQUIRE(hot->state() == block_state::LOADED);
+    REQUIRE(scanned->state() == block_state::UNLOADED);
+    REQUIRE(scan.back()->state() == block_state::LOADED);
+    REQUIRE(scan.front()->state() == block_state::UNLOADED);
+}
+
+TEST_CASE("buffer_pool: lru evicts in unpin order") {
+    test_env_t env(eviction_policy::LRU);
+
+    auto hot = env.allocate();
+    env.touch(hot, buffer_access_hint::NORMAL);
+
+    std::vector<std::shared_ptr<block_handle_t>> scan;
+    for (uint64_t i = 0; i < 2 * POOL_BLOCKS; i++) {
+        scan.push_back(env.allocate());
+    }
+
+    REQUIRE(hot->state() == block_state::UNLOADED);
+    REQUIRE(scan.back()->state() == block_state::LOADED);
+}
@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <components/table/data_table.hpp>
+#include <components/table/row_group.hpp>
 #include <components/table/storage/buffer_pool.hpp>
 #include <components/table/storage/metadata_manager.hpp>
 #include <components/table/storage/metadata_reader.hpp>
@@ -542,6 +543,168 @@ TEST_CASE("checkpoint_load: DICTIONARY compression — low cardinality cycling")
     cleanup_test_file();
 }
 
+TEST_CASE("checkpoint_load: filters on RLE and DICTIONARY segments") {
+    using namespace components::table;
+    using namespace components::table::storage;
+    using namespace components::types;
+    using namespace components::vector;
+    using components::expressions::compare_type;
+    cleanup_test_file();
+
+    test_env_t env;
+    constexpr uint64_t NUM_ROWS = 500;
+    auto run = [](uint64_t idx) { return static_cast<int64_t>(idx / 100 + 1); };  // RLE
+    auto cycle = [](uint64_t idx) { return static_cast<int64_t>(idx % 5 + 1); }; // DICTIONARY
+    // the nullable copies keep the value under their NULLs, so only the validity tells them apart
+    auto is_null = [](uint64_t idx) { return idx % 7 == 3; };
+
+    meta_block_pointer_t table_pointer;
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        bm.create_new_database();
+
+        std::vector<column_definition_t> columns;
+        columns.emplace_back("run", logical_type::BIGINT);
+        columns.emplace_back("cycle", logical_type::BIGINT);
+        columns.emplace_back("run_nulls", logical_type::BIGINT);
+        columns.emplace_back("cycle_nulls", logical_type::BIGINT);
+        auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), "compressed_table");
+
+        auto types = table->copy_types();
+        data_chunk_t chunk(&env.resource, types, NUM_ROWS);
+        chunk.set_cardinality(NUM_ROWS);
+        for (uint64_t i = 0; i < NUM_ROWS; i++) {
+            chunk.set_value(0, i, logical_value_t{&env.resource, run(i)});
+            chunk.set_value(1, i, logical_value_t{&env.resource, cycle(i)});
+            chunk.set_value(2, i, logical_value_t{&env.resource, run(i)});
+            chunk.set_value(3, i, logical_value_t{&env.resource, cycle(i)});
+            if (is_null(i)) {
+                chunk.data[2].validity().set_invalid(i);
+                chunk.data[3].validity().set_invalid(i);
+            }
+        }
+        table_append_state state(&env.resource);
+        table->append_lock(state);
+        table->initialize_append(state);
+        table->append(chunk, state);
+        table->finalize_append(state, transaction_data{0, 0});
+
+        metadata_manager_t meta_mgr(bm);
+        metadata_writer_t writer(meta_mgr);
+        table->checkpoint(writer);
+        table_pointer = writer.get_block_pointer();
+
+        database_header_t header;
+        header.initialize();
+        bm.write_header(header);
+    }
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        bm.load_existing_database();
+
+        metadata_manager_t meta_mgr(bm);
+        metadata_reader_t reader(meta_mgr, table_pointer);
+        auto loaded = data_table_t::load_from_disk(&env.resource, bm, reader);
+
+        // the filters below only exercise the compressed domain if the checkpoint compressed the columns
+        for (const auto& info : loaded->get_column_segment_info()) {
+            if (info.column_path == "[0]" || info.column_path == "[2]") {
+                REQUIRE(info.compression == compression::compression_type::RLE);
+            } else if (info.column_path == "[1]" || info.column_path == "[3]") {
+                REQUIRE(info.compression == compression::compression_type::DICTIONARY);
+            }
+        }
+
+        auto column = [&](uint64_t index) { return std::pmr::vector<uint64_t>(1, index, &env.resource); };
+        auto scan = [&](const table_filter_t& filter) {
+            std::vector<storage_index_t> column_ids;
+            column_ids.emplace_back(int64_t{0});
+            column_ids.emplace_back(int64_t{1});
+            table_scan_state state(&env.resource);
+            std::pmr::vector<complex_logical_type> types(2, logical_type::BIGINT, &env.resource);
+            data_chunk_t result(&env.resource, types, NUM_ROWS);
+            loaded->initialize_scan(state, column_ids, &filter);
+            loaded->scan(result, state);
+            std::vector<std::pair<int64_t, int64_t>> rows;
+            for (uint64_t i = 0; i < result.size(); i++) {
+                rows.emplace_back(result.data[0].value(i).value<int64_t>(), result.data[1].value(i).value<int64_t>());
+            }
+            return rows;
+        };
+
+        SECTION("equality on the RLE column, INTEGER constant") {
+            constant_filter_t filter(compare_type::eq, logical_value_t{&env.resource, int32_t{3}}, column(0));
+            auto rows = scan(filter);
+            REQUIRE(rows.size() == 100);
+            for (uint64_t i = 0; i < rows.size(); i++) {
+                REQUIRE(rows[i].first == 3);
+                REQUIRE(rows[i].second == cycle(200 + i));
+            }
+        }
+
+        SECTION("range on the DICTIONARY column AND the RLE column") {
+            conjunction_and_filter_t filter;
+            filter.child_filters.emplace_back(
+                std::make_unique<constant_filter_t>(compare_type::gte,
+                                                    logical_value_t{&env.resource, int64_t{4}},
+                                                    column(1)));
+            filter.child_filters.emplace_back(
+                std::make_unique<constant_filter_t>(compare_type::lt,
+                                                    logical_value_t{&env.resource, int64_t{3}},
+                                                    column(0)));
+            std::vector<std::pair<int64_t, int64_t>> expected;
+            for (uint64_t i = 0; i < NUM_ROWS; i++) {
+                if (cycle(i) >= 4 && run(i) < 3) {
+                    expected.emplace_back(run(i), cycle(i));
+                }
+            }
+            REQUIRE(scan(filter) == expected);
+        }
+
+        SECTION("comparisons on nullable RLE and DICTIONARY columns") {
+            auto scan_nullable = [&](const table_filter_t& filter) {
+                std::vector<storage_index_t> column_ids;
+                column_ids.emplace_back(int64_t{2});
+                column_ids.emplace_back(int64_t{3});
+                std::pmr::vector<complex_logical_type> types(2, logical_type::BIGINT, &env.resource);
+                table_scan_state state(&env.resource);
+                data_chunk_t result(&env.resource, types, NUM_ROWS);
+                loaded->initialize_scan(state, column_ids, &filter);
+                loaded->scan(result, state);
+                std::vector<int64_t> row_ids;
+                for (uint64_t i = 0; i < result.size(); i++) {
+                    REQUIRE(!result.data[0].value(i).is_null());
+                    REQUIRE(!result.data[1].value(i).is_null());
+                    row_ids.push_back(result.row_ids.value(i).value<int64_t>());
+                }
+                return row_ids;
+            };
+            auto expect = [&](const std::function<bool(uint64_t)>& predicate) {
+                std::vector<int64_t> row_ids;
+                for (uint64_t i = 0; i < NUM_ROWS; i++) {
+                    if (!is_null(i) && predicate(i)) {
+                        row_ids.push_back(static_cast<int64_t>(i));
+                    }
+                }
+                return row_ids;
+            };
+
+            constant_filter_t run_eq(compare_type::eq, logical_value_t{&env.resource, int64_t{3}}, column(2));
+            REQUIRE(scan_nullable(run_eq) == expect([&](uint64_t i) { return run(i) == 3; }));
+
+            constant_filter_t cycle_lte(compare_type::lte, logical_value_t{&env.resource, int64_t{2}}, column(3));
+            REQUIRE(scan_nullable(cycle_lte) == expect([&](uint64_t i) { return cycle(i) <= 2; }));
+
+            constant_filter_t cycle_ne(compare_type::ne, logical_value_t{&env.resource, int64_t{4}}, column(3));
+            REQUIRE(scan_nullable(cycle_ne) == expect([&](uint64_t i) { return cycle(i) != 4; }));
+        }
+    }
+
+    cleanup_test_file();
+}
+
 TEST_CASE("checkpoint_load: UNCOMPRESSED fallback — high cardinality") {
     using namespace components::table;
     using namespace components::table::storage;
@@ -775,3 +938,67 @@ TEST_CASE("checkpoint_load: small segment — 2 rows edge case") {
 
     cleanup_test_file();
 }
+
+TEST_CASE("checkpoint_load: scan reads ahead into following row groups") {
+    using namespace components::table;
+    using namespace components::table::storage;
+    using namespace components::types;
+    using namespace components::vector;
+    cleanup_test_file();
+
+    test_env_t env;
+    // ~288KB of uncompressed INT64 segments: packed into two blocks
+    constexpr uint64_t ROW_GROUPS = 36;
+    constexpr uint64_t NUM_ROWS = DEFAULT_VECTOR_CAPACITY * ROW_GROUPS;
+
+    meta_block_pointer_t table_pointer;
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        bm.create_new_database();
+
+        std::vector<column_definition_t> columns;
+        columns.emplace_back("value", logical_type::BIGINT);
+        auto table = std::make_unique<data_table_t>(&env.resource, bm, std::move(columns), "read_ahead_table");
+
+        append_int64_data(*table, &env.resource, NUM_ROWS);
+
+        metadata_manager_t meta_mgr(bm);
+        metadata_writer_t writer(meta_mgr);
+        table->checkpoint(writer);
+        table_pointer = writer.get_block_pointer();
+
+        database_header_t header;
+        header.initialize();
+        bm.write_header(header);
+    }
+
+    {
+        single_file_block_manager_t bm(env.buffer_manager, env.fs, test_db_path());
+        bm.load_existing_database();
+
+        metadata_manager_t meta_mgr(bm);
+        metadata_reader_t reader(meta_mgr, table_pointer);
+        auto loaded = data_table_t::load_from_disk(&env.resource, bm, reader);
+
+        std::vector<storage_index_t> column_ids{storage_index_t(0)};
+        auto* last = loaded->row_group()->row_group(static_cast<int64_t>(ROW_GROUPS - 1));
+        std::vector<std::shared_ptr<block_handle_t>> blocks;
+        last->collect_unloaded_blocks(column_ids, blocks);
+        REQUIRE_FALSE(blocks.empty());
+
+        // only the first chunk is consumed
+        uint64_t scanned = 0;
+        loaded->row_group()->scan(column_ids, [&](data_chunk_t& chunk) {
+            scanned += chunk.size();
+            return false;
+        });
+        REQUIRE(scanned == DEFAULT_VECTOR_CAPACITY);
+
+        blocks.clear();
+        last->collect_unloaded_blocks(column_ids, blocks);
+        REQUIRE(blocks.empty());
+    }
+
+    cleanup_test_file();
+}
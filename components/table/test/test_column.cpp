@@ -808,4 +808,58 @@ TEST_CASE("components::table::column") {
         }
         */
     }
-}
\ No newline at end of file
+}
+TEST_CASE("components::table::column::skip_across_segments") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    // a segment of these blocks holds fewer than DEFAULT_VECTOR_CAPACITY values, so skipping one vector
+    // passes over segment boundaries of the data and lands mid-segment
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool = storage::buffer_pool_t(&resource, uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(&resource, fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, uint64_t(1) << 12);
+    auto column = column_data_t::create_column(&resource, block_manager, 0, 0, logical_type::BIGINT);
+
+    constexpr size_t test_size = 3 * DEFAULT_VECTOR_CAPACITY;
+    auto is_null = [](size_t i) { return i % 7 == 0; };
+    {
+        vector_t v(&resource, logical_type::BIGINT, test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            v.set_value(i, logical_value_t{&resource, static_cast<int64_t>(i)});
+            if (is_null(i)) {
+                v.validity().set_invalid(i);
+            }
+        }
+        column_append_state state;
+        column->initialize_append(state);
+        column->append(state, v, test_size);
+    }
+
+    column_scan_state state;
+    state.child_states.resize(1);
+    column->initialize_scan(state);
+    auto check = [&](vector_t& v, size_t first_row) {
+        for (size_t i = 0; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            auto value = v.value(i);
+            REQUIRE(value.is_null() == is_null(first_row + i));
+            if (!value.is_null()) {
+                REQUIRE(value.value<int64_t>() == static_cast<int64_t>(first_row + i));
+            }
+        }
+    };
+    {
+        vector_t v(&resource, logical_type::BIGINT, DEFAULT_VECTOR_CAPACITY);
+        column->scan(0, state, v);
+        check(v, 0);
+    }
+    column->skip(state);
+    {
+        vector_t v(&resource, logical_type::BIGINT, DEFAULT_VECTOR_CAPACITY);
+        column->scan(2, state, v);
+        check(v, 2 * DEFAULT_VECTOR_CAPACITY);
+    }
+}
@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 #include <components/table/data_table.hpp>
+#include <components/table/row_version_manager.hpp>
 #include <components/table/storage/buffer_pool.hpp>
 #include <components/table/storage/in_memory_block_manager.hpp>
 #include <components/table/storage/standard_buffer_manager.hpp>
@@ -371,6 +372,78 @@ TEST_CASE("components::table::mvcc::compact_after_delete") {
     REQUIRE(table->row_group()->total_rows() == 50);
 }
 
+TEST_CASE("components::table::mvcc::compact_row_groups_over_threshold") {
+    test_env env;
+    auto table = make_int_table(env);
+
+    // Three full row groups; the value of a row is its original row id
+    append_rows(*table, env, 0, 3 * DEFAULT_VECTOR_CAPACITY);
+
+    // 5 deleted rows in the first row group, 600 in the second, none in the third
+    std::vector<int64_t> deleted_ids = {3, 100, 200, 300, 1000};
+    for (int64_t i = 1024; i < 1624; i++) {
+        deleted_ids.push_back(i);
+    }
+    transaction_manager_t mgr;
+    auto session = components::session::session_id_t::generate_uid();
+    auto& txn = mgr.begin_transaction(session);
+    std::pmr::vector<complex_logical_type> id_type(&env.resource);
+    id_type.emplace_back(logical_type::BIGINT);
+    auto row_ids_chunk = data_chunk_t(&env.resource, id_type, deleted_ids.size());
+    for (uint64_t i = 0; i < deleted_ids.size(); i++) {
+        row_ids_chunk.data[0].set_value(i, logical_value_t(&env.resource, deleted_ids[i]));
+    }
+    row_ids_chunk.set_cardinality(deleted_ids.size());
+    auto txn_id = txn.data().transaction_id;
+    table_delete_state del_state(&env.resource);
+    table->delete_rows(del_state, row_ids_chunk.data[0], deleted_ids.size(), txn_id);
+    auto commit_id = mgr.commit(session);
+    table->commit_all_deletes(txn_id, commit_id);
+
+    auto remap = table->compact(0.1);
+
+    // only the second row group was rewritten: the first keeps its ids, the third shifts down
+    REQUIRE(table->row_group()->total_rows() == 3 * DEFAULT_VECTOR_CAPACITY - 600);
+    REQUIRE(remap.first_moved == 1024);
+    REQUIRE(remap.map(0) == 0);
+    REQUIRE(remap.map(1023) == 1023);
+    REQUIRE(remap.map(1024) == row_id_remap_t::DROPPED);
+    REQUIRE(remap.map(1623) == row_id_remap_t::DROPPED);
+    REQUIRE(remap.map(1624) == 1024);
+    REQUIRE(remap.map(2048) == 1448);
+    REQUIRE(remap.map(3071) == 2471);
+
+    // every visible row sits at the id the remap gives its original one
+    std::vector<storage_index_t> column_ids;
+    column_ids.emplace_back(0);
+    column_ids.emplace_back();
+    table_scan_state scan_state(&env.resource);
+    table->initialize_scan(scan_state, column_ids);
+    std::pmr::vector<complex_logical_type> scan_types(&env.resource);
+    scan_types.emplace_back(logical_type::BIGINT);
+    scan_types.emplace_back(logical_type::BIGINT);
+    auto result = data_chunk_t(&env.resource, scan_types, DEFAULT_VECTOR_CAPACITY);
+    uint64_t visible = 0;
+    while (true) {
+        result.reset();
+        table->scan(result, scan_state);
+        if (result.size() == 0) {
+            break;
+        }
+        for (uint64_t i = 0; i < result.size(); i++) {
+            auto value = result.data[0].value(i).value<int64_t>();
+            auto row_id = result.data[1].value(i).value<int64_t>();
+            REQUIRE(remap.map(value) == row_id);
+        }
+        visible += result.size();
+    }
+    REQUIRE(visible == 3 * DEFAULT_VECTOR_CAPACITY - deleted_ids.size());
+
+    // appends continue after the compacted rows
+    append_rows(*table, env, 5000, 10);
+    REQUIRE(table->row_group()->total_rows() == 3 * DEFAULT_VECTOR_CAPACITY - 600 + 10);
+}
+
 TEST_CASE("components::table::mvcc::uncommitted_rows_invisible_to_other_txn") {
     test_env env;
     auto table = make_int_table(env);
@@ -466,3 +539,104 @@ TEST_CASE("components::table::mvcc::txn_sees_own_writes") {
     table->revert_append(0, 5);
     mgr.abort(s2);
 }
+
+TEST_CASE("components::table::mvcc::version_snapshot_copy_on_write") {
+    std::pmr::synchronized_pool_resource resource;
+    row_version_manager_t versions(0);
+    constexpr uint64_t inserter = TRANSACTION_ID_START + 1;
+    constexpr uint64_t deleter = TRANSACTION_ID_START + 2;
+    versions.append_version_info({inserter, 1}, 10, 0, 10);
+    versions.commit_append(2, 0, 10);
+
+    // Scans between two changes share one snapshot
+    auto before = versions.snapshot();
+    REQUIRE(versions.snapshot() == before);
+
+    int64_t rows[] = {3};
+    REQUIRE(versions.delete_rows(0, deleter, rows, 1) == 1);
+    auto after = versions.snapshot();
+    REQUIRE(after != before);
+
+    // The delete went to a copy of the chunk: the snapshot held by a scan still has the row
+    indexing_vector_t indexing(&resource, DEFAULT_VECTOR_CAPACITY);
+    transaction_data deleter_txn{deleter, 3};
+    REQUIRE(before->indexing_vector(deleter_txn, 0, indexing, 10) == 10);
+    REQUIRE(after->indexing_vector(deleter_txn, 0, indexing, 10) == 9);
+    REQUIRE(versions.indexing_vector(deleter_txn, 0, indexing, 10) == 9);
+}
+
+TEST_CASE("components::table::mvcc::scan_keeps_snapshot_across_commit") {
+    test_env env;
+    auto table = make_int_table(env);
+
+    constexpr uint64_t row_count = 3 * DEFAULT_VECTOR_CAPACITY;
+    append_rows(*table, env, 0, row_count);
+
+    transaction_manager_t mgr;
+
+    // Reader enters the row group and scans the first vector
+    auto reader = components::session::session_id_t::generate_uid();
+    auto& reader_txn = mgr.begin_transaction(reader);
+
+    std::vector<storage_index_t> column_ids;
+    column_ids.emplace_back(0);
+    table_scan_state scan_state(&env.resource);
+    table->initialize_scan(scan_state, column_ids);
+    scan_state.table_state.txn = reader_txn.data();
+
+    auto types = table->copy_types();
+    auto result = data_chunk_t(&env.resource, types, DEFAULT_VECTOR_CAPACITY);
+    table->scan(result, scan_state);
+    uint64_t total = result.size();
+    REQUIRE(total == DEFAULT_VECTOR_CAPACITY);
+
+    // Writer deletes and commits rows of the last vector while the scan is in the middle
+    auto writer = components::session::session_id_t::generate_uid();
+    auto& writer_txn = mgr.begin_transaction(writer);
+
+    std::pmr::vector<complex_logical_type> id_type(&env.resource);
+    id_type.emplace_back(logical_type::BIGINT);
+    auto row_ids_chunk = data_chunk_t(&env.resource, id_type, 5);
+    for (uint64_t i = 0; i < 5; i++) {
+        row_ids_chunk.data[0].set_value(
+            i,
+            logical_value_t(&env.resource, static_cast<int64_t>(2 * DEFAULT_VECTOR_CAPACITY + i)));
+    }
+    row_ids_chunk.set_cardinality(5);
+
+    auto txn_id = writer_txn.data().transaction_id;
+    table_delete_state del_state(&env.resource);
+    table->delete_rows(del_state, row_ids_chunk.data[0], 5, txn_id);
+    auto commit_id = mgr.commit(writer);
+    table->commit_all_deletes(txn_id, commit_id);
+
+    // The scan finishes on the version info it started with
+    while (true) {
+        result.reset();
+        table->scan(result, scan_state);
+        if (result.size() == 0) {
+            break;
+        }
+        total += result.size();
+    }
+    REQUIRE(total == row_count);
+    mgr.abort(reader);
+
+    // A scan starting after the commit no longer sees the deleted rows
+    auto s3 = components::session::session_id_t::generate_uid();
+    auto& txn3 = mgr.begin_transaction(s3);
+    table_scan_state next_state(&env.resource);
+    table->initialize_scan(next_state, column_ids);
+    next_state.table_state.txn = txn3.data();
+    total = 0;
+    while (true) {
+        result.reset();
+        table->scan(result, next_state);
+        if (result.size() == 0) {
+            break;
+        }
+        total += result.size();
+    }
+    REQUIRE(total == row_count - 5);
+    mgr.abort(s3);
+}
@@ -291,3 +291,90 @@ TEST_CASE("per-segment statistics: populated during append") {
     CHECK(seg_stats.min_value().value<int64_t>() == 1);
     CHECK(seg_stats.max_value().value<int64_t>() == 100);
 }
+
+TEST_CASE("zonemap: check_zonemap_range over appended segments") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using namespace components::expressions;
+
+    std::pmr::synchronized_pool_resource resource;
+    core::filesystem::local_file_system_t fs;
+    storage::buffer_pool_t buffer_pool(&resource, uint64_t(1) << 32, false, uint64_t(1) << 24);
+    storage::standard_buffer_manager_t buffer_manager(&resource, fs, buffer_pool);
+    storage::in_memory_block_manager_t block_manager(buffer_manager, 262144);
+
+    auto col = column_data_t::create_column(&resource, block_manager, 0, 0, complex_logical_type{logical_type::BIGINT});
+
+    // Ascending values [0..40000) spill over into a second segment
+    constexpr int64_t total = 40000;
+    column_append_state append_state;
+    col->initialize_append(append_state);
+    for (int64_t row = 0; row < total; row += int64_t(DEFAULT_VECTOR_CAPACITY)) {
+        auto count = static_cast<uint64_t>(std::min(int64_t(DEFAULT_VECTOR_CAPACITY), total - row));
+        vector_t vec(&resource, logical_type::BIGINT, count);
+        auto data = vec.data<int64_t>();
+        for (uint64_t i = 0; i < count; i++) {
+            data[i] = row + static_cast<int64_t>(i);
+        }
+        col->append(append_state, vec, count);
+    }
+
+    SECTION("first vector: value < 1000 => NO_PRUNING") {
+        constant_filter_t f(compare_type::lt, logical_value_t{&resource, int64_t(1000)}, {0});
+        CHECK(col->check_zonemap_range(0, DEFAULT_VECTOR_CAPACITY, f) ==
+              filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+    }
+
+    SECTION("last vector: value < 1000 => ALWAYS_FALSE") {
+        constant_filter_t f(compare_type::lt, logical_value_t{&resource, int64_t(1000)}, {0});
+        CHECK(col->check_zonemap_range(total - 1000, 1000, f) == filter_propagate_result_t::ALWAYS_FALSE);
+    }
+
+    SECTION("every vector: value >= 0 => ALWAYS_TRUE") {
+        constant_filter_t f(compare_type::gte, logical_value_t{&resource, int64_t(0)}, {0});
+        CHECK(col->check_zonemap_range(0, DEFAULT_VECTOR_CAPACITY, f) == filter_propagate_result_t::ALWAYS_TRUE);
+        CHECK(col->check_zonemap_range(total - 1000, 1000, f) == filter_propagate_result_t::ALWAYS_TRUE);
+    }
+
+    SECTION("no NULLs: is_null => ALWAYS_FALSE, is_not_null => ALWAYS_TRUE") {
+        is_null_filter_t is_null(compare_type::is_null, {0});
+        is_null_filter_t is_not_null(compare_type::is_not_null, {0});
+        CHECK(col->check_zonemap_range(0, DEFAULT_VECTOR_CAPACITY, is_null) ==
+              filter_propagate_result_t::ALWAYS_FALSE);
+        CHECK(col->check_zonemap_range(0, DEFAULT_VECTOR_CAPACITY, is_not_null) ==
+              filter_propagate_result_t::ALWAYS_TRUE);
+    }
+}
+
+TEST_CASE("zonemap: check_statistics with NULLs") {
+    using namespace components::types;
+    using namespace components::table;
+    using namespace components::expressions;
+
+    std::pmr::synchronized_pool_resource resource;
+
+    base_statistics_t stats(&resource, logical_type::BIGINT);
+    stats.set_min(logical_value_t{&resource, int64_t(10)});
+    stats.set_max(logical_value_t{&resource, int64_t(10)});
+
+    SECTION("ne on a single-valued range => ALWAYS_FALSE") {
+        constant_filter_t f(compare_type::ne, logical_value_t{&resource, int64_t(10)}, {0});
+        CHECK(column_data_t::check_statistics(stats, f) == filter_propagate_result_t::ALWAYS_FALSE);
+    }
+
+    SECTION("eq on a single-valued range without NULLs => ALWAYS_TRUE") {
+        constant_filter_t f(compare_type::eq, logical_value_t{&resource, int64_t(10)}, {0});
+        CHECK(column_data_t::check_statistics(stats, f) == filter_propagate_result_t::ALWAYS_TRUE);
+    }
+
+    SECTION("NULL rows never pass a comparison") {
+        stats.set_null_count(3);
+        constant_filter_t eq(compare_type::eq, logical_value_t{&resource, int64_t(10)}, {0});
+        constant_filter_t gt(compare_type::gt, logical_value_t{&resource, int64_t(20)}, {0});
+        is_null_filter_t is_null(compare_type::is_null, {0});
+        CHECK(column_data_t::check_statistics(stats, eq) == filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+        CHECK(column_data_t::check_statistics(stats, gt) == filter_propagate_result_t::ALWAYS_FALSE);
+        CHECK(column_data_t::check_statistics(stats, is_null) == filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+    }
+}
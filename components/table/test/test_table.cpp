@@ -560,6 +560,77 @@ TEST_CASE("components::table::data_table") {
             }
         }
     }
+    INFO("Scan with OR / NOT predicates") {
+        std::vector<storage_index_t> column_indices;
+        column_indices.emplace_back(int64_t{0});
+        table_scan_state state(&resource);
+        // number < 100 OR number >= test_size - 100, but not 50; INTEGER constants on a UBIGINT column
+        constexpr size_t edge = 100;
+        auto first_column = [&resource] { return std::pmr::vector<uint64_t>(1, uint64_t{0}, &resource); };
+        auto conj_or = std::make_unique<conjunction_or_filter_t>();
+        conj_or->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(components::expressions::compare_type::lt,
+                                                logical_value_t{&resource, int32_t{edge}},
+                                                first_column()));
+        conj_or->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(components::expressions::compare_type::gte,
+                                                logical_value_t{&resource, static_cast<int32_t>(test_size - edge)},
+                                                first_column()));
+        auto conj_not = std::make_unique<conjunction_not_filter_t>();
+        conj_not->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(components::expressions::compare_type::eq,
+                                                logical_value_t{&resource, int32_t{50}},
+                                                first_column()));
+        auto conj_and = std::make_unique<conjunction_and_filter_t>();
+        conj_and->child_filters.emplace_back(std::move(conj_or));
+        conj_and->child_filters.emplace_back(std::move(conj_not));
+
+        std::pmr::vector<complex_logical_type> types(&resource);
+        types.emplace_back(logical_type::UBIGINT);
+        data_chunk_t result(&resource, types, 2 * edge);
+        data_table->initialize_scan(state, column_indices, conj_and.get());
+        data_table->scan(result, state);
+
+        std::vector<uint64_t> expected;
+        for (size_t i = 0; i < test_size; i++) {
+            if ((i < edge || i >= test_size - edge) && i != 50) {
+                expected.push_back(i);
+            }
+        }
+        REQUIRE(result.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            REQUIRE(result.data[0].value(i).value<uint64_t>() == expected[i]);
+        }
+    }
+    INFO("Scan with a negative constant on an unsigned column") {
+        // -1 does not convert to UBIGINT: UINT64_MAX would compare equal to it after the round trip. The
+        // comparison with 50 keeps the zone maps from deciding, so the rows are filtered.
+        std::vector<storage_index_t> column_indices;
+        column_indices.emplace_back(int64_t{0});
+        std::pmr::vector<complex_logical_type> types(&resource);
+        types.emplace_back(logical_type::UBIGINT);
+        auto first_column = [&resource] { return std::pmr::vector<uint64_t>(1, uint64_t{0}, &resource); };
+        auto count = [&](std::unique_ptr<conjunction_filter_t> conjunction,
+                         components::expressions::compare_type type,
+                         components::expressions::compare_type type_50) {
+            conjunction->child_filters.emplace_back(
+                std::make_unique<constant_filter_t>(type, logical_value_t{&resource, int32_t{-1}}, first_column()));
+            conjunction->child_filters.emplace_back(
+                std::make_unique<constant_filter_t>(type_50, logical_value_t{&resource, int32_t{50}}, first_column()));
+            table_scan_state state(&resource);
+            data_chunk_t result(&resource, types, test_size);
+            data_table->initialize_scan(state, column_indices, conjunction.get());
+            data_table->scan(result, state);
+            return result.size();
+        };
+        using components::expressions::compare_type;
+        for (auto type : {compare_type::gt, compare_type::gte, compare_type::ne}) {
+            REQUIRE(count(std::make_unique<conjunction_and_filter_t>(), type, compare_type::ne) == test_size - 1);
+        }
+        for (auto type : {compare_type::eq, compare_type::lt, compare_type::lte}) {
+            REQUIRE(count(std::make_unique<conjunction_or_filter_t>(), type, compare_type::eq) == 1);
+        }
+    }
     INFO("Delete") {
         vector_t v(&resource, logical_type::BIGINT, test_size / 2);
         for (size_t i = 0; i < test_size; i += 2) {
@@ -966,4 +1037,116 @@ TEST_CASE("components::table::data_table") {
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("components::table::data_table::late_materialization") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    // small blocks split every BIGINT vector over three segments, so the skips, fetches and selects
+    // below all cross segment boundaries inside a row group
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool = storage::buffer_pool_t(&resource, uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(&resource, fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, uint64_t(1) << 12);
+    REQUIRE(block_manager.block_size() / sizeof(int64_t) < DEFAULT_VECTOR_CAPACITY / 2);
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("id", logical_type::BIGINT);
+    columns.emplace_back("key", logical_type::BIGINT);
+    columns.emplace_back("payload", logical_type::BIGINT);
+    auto data_table = std::make_unique<data_table_t>(&resource, block_manager, std::move(columns));
+
+    // one row group per vector; even row groups hold even keys and odd ones odd keys, so the zone maps
+    // of every row group admit any key and the filter has to look at the rows
+    constexpr size_t row_group_count = 8;
+    constexpr size_t test_size = row_group_count * DEFAULT_VECTOR_CAPACITY;
+    auto key_of = [](size_t i) {
+        return static_cast<int64_t>(2 * (i % DEFAULT_VECTOR_CAPACITY) + (i / DEFAULT_VECTOR_CAPACITY) % 2);
+    };
+    auto payload_is_null = [](size_t i) { return i % 5 == 0; };
+    {
+        data_chunk_t chunk(&resource, data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            chunk.set_value(0, i, logical_value_t{&resource, static_cast<int64_t>(i)});
+            chunk.set_value(1, i, logical_value_t{&resource, key_of(i)});
+            chunk.set_value(2, i, logical_value_t{&resource, static_cast<int64_t>(i * 3)});
+            if (payload_is_null(i)) {
+                chunk.data[2].validity().set_invalid(i);
+            }
+        }
+        table_append_state state(&resource);
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state, transaction_data{0, 0});
+    }
+
+    // key = 14 matches row 7 of the even row groups: one row, fetched by itself. It matches nothing in
+    // the odd ones, whose payload is skipped, except row group 5, where the id range selects 800 rows.
+    constexpr int64_t dense_begin = 5 * DEFAULT_VECTOR_CAPACITY + 100;
+    constexpr int64_t dense_end = 5 * DEFAULT_VECTOR_CAPACITY + 900;
+    auto column = [&resource](uint64_t index) { return std::pmr::vector<uint64_t>(1, index, &resource); };
+    auto range = std::make_unique<conjunction_and_filter_t>();
+    range->child_filters.emplace_back(
+        std::make_unique<constant_filter_t>(components::expressions::compare_type::gte,
+                                            logical_value_t{&resource, dense_begin},
+                                            column(0)));
+    range->child_filters.emplace_back(
+        std::make_unique<constant_filter_t>(components::expressions::compare_type::lt,
+                                            logical_value_t{&resource, dense_end},
+                                            column(0)));
+    auto conj_or = std::make_unique<conjunction_or_filter_t>();
+    conj_or->child_filters.emplace_back(
+        std::make_unique<constant_filter_t>(components::expressions::compare_type::eq,
+                                            logical_value_t{&resource, int64_t{14}},
+                                            column(1)));
+    conj_or->child_filters.emplace_back(std::move(range));
+
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < test_size; i++) {
+        auto id = static_cast<int64_t>(i);
+        if (key_of(i) == 14 || (id >= dense_begin && id < dense_end)) {
+            expected.push_back(i);
+        }
+    }
+    REQUIRE(expected.size() == row_group_count / 2 + static_cast<size_t>(dense_end - dense_begin));
+
+    auto check = [&](const std::vector<storage_index_t>& column_indices) {
+        std::pmr::vector<complex_logical_type> types(column_indices.size(), logical_type::BIGINT, &resource);
+        table_scan_state state(&resource);
+        data_chunk_t result(&resource, types, test_size);
+        data_table->initialize_scan(state, column_indices, conj_or.get());
+        data_table->scan(result, state);
+
+        REQUIRE(result.size() == expected.size());
+        for (size_t row = 0; row < expected.size(); row++) {
+            auto i = expected[row];
+            for (size_t c = 0; c < column_indices.size(); c++) {
+                auto value = result.data[c].value(row);
+                switch (column_indices[c].primary_index()) {
+                    case 0:
+                        REQUIRE(value.value<int64_t>() == static_cast<int64_t>(i));
+                        break;
+                    case 1:
+                        REQUIRE(value.value<int64_t>() == key_of(i));
+                        break;
+                    default:
+                        REQUIRE(value.is_null() == payload_is_null(i));
+                        if (!payload_is_null(i)) {
+                            REQUIRE(value.value<int64_t>() == static_cast<int64_t>(i * 3));
+                        }
+                        break;
+                }
+            }
+        }
+    };
+
+    INFO("filter columns projected") {
+        check({storage_index_t(uint64_t{0}), storage_index_t(uint64_t{1}), storage_index_t(uint64_t{2})});
+    }
+    INFO("only unfiltered columns projected") { check({storage_index_t(uint64_t{2})}); }
+}
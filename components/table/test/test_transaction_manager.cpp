@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 #include <components/table/transaction_manager.hpp>
+#include <set>
+#include <thread>
 
 TEST_CASE("components::table::transaction_manager::begin_commit") {
     using namespace components::table;
@@ -133,3 +135,140 @@ TEST_CASE("components::table::transaction_manager::append_tracking") {
 
     mgr.commit(session);
 }
+
+TEST_CASE("components::table::transaction_manager::pending_commit_bounds_snapshots") {
+    using namespace components::table;
+    using namespace components::session;
+
+    transaction_manager_t mgr;
+
+    auto writer = session_id_t::generate_uid();
+    mgr.begin_transaction(writer);
+    auto commit_id = mgr.begin_commit(writer);
+    REQUIRE(commit_id > 0);
+    REQUIRE(!mgr.has_active_transaction(writer));
+
+    // a snapshot taken while the commit is pending does not include it
+    auto r1 = session_id_t::generate_uid();
+    auto r2 = session_id_t::generate_uid();
+    REQUIRE(mgr.begin_transaction(r1).start_time() <= commit_id);
+    REQUIRE(mgr.begin_transaction(r2).start_time() <= commit_id);
+    REQUIRE(mgr.lowest_active_start_time() <= commit_id);
+
+    mgr.publish(commit_id);
+    auto r3 = session_id_t::generate_uid();
+    REQUIRE(mgr.begin_transaction(r3).start_time() > commit_id);
+
+    mgr.abort(r1);
+    mgr.abort(r2);
+    mgr.abort(r3);
+    REQUIRE(!mgr.has_active_transactions());
+}
+
+TEST_CASE("components::table::transaction_manager::interleaved_publish") {
+    using namespace components::table;
+    using namespace components::session;
+
+    transaction_manager_t mgr;
+
+    auto first = session_id_t::generate_uid();
+    auto second = session_id_t::generate_uid();
+    mgr.begin_transaction(first);
+    mgr.begin_transaction(second);
+    auto first_id = mgr.begin_commit(first);
+    auto second_id = mgr.begin_commit(second);
+    REQUIRE(first_id < second_id);
+
+    // the later commit finishes stamping first: it stays hidden behind the earlier, pending one
+    mgr.publish(second_id);
+    auto reader = session_id_t::generate_uid();
+    REQUIRE(mgr.begin_transaction(reader).start_time() <= first_id);
+    mgr.abort(reader);
+    REQUIRE(mgr.lowest_active_start_time() <= first_id);
+
+    mgr.publish(first_id);
+    REQUIRE(mgr.begin_transaction(second).start_time() > second_id);
+    mgr.abort(second);
+    REQUIRE(!mgr.has_active_transactions());
+}
+
+TEST_CASE("components::table::transaction_manager::concurrent_begin_commit") {
+    using namespace components::table;
+    using namespace components::session;
+
+    constexpr size_t threads_count = 8;
+    constexpr size_t txn_per_thread = 500;
+
+    transaction_manager_t mgr;
+    std::vector<std::vector<uint64_t>> commit_ids(threads_count);
+    std::vector<std::thread> threads;
+    std::atomic<bool> snapshots_bounded{true}; // REQUIRE is not thread safe
+
+    for (size_t t = 0; t < threads_count; t++) {
+        threads.emplace_back([&mgr, &snapshots_bounded, &ids = commit_ids[t], t] {
+            for (size_t i = 0; i < txn_per_thread; i++) {
+                auto session = session_id_t::generate_uid();
+                auto& txn = mgr.begin_transaction(session);
+                if (mgr.lowest_active_start_time() > txn.start_time()) {
+                    snapshots_bounded = false;
+                }
+                if ((i + t) % 4 == 0) {
+                    mgr.abort(session);
+                } else {
+                    ids.push_back(mgr.commit(session));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(snapshots_bounded);
+
+    std::set<uint64_t> unique;
+    size_t total = 0;
+    for (const auto& ids : commit_ids) {
+        unique.insert(ids.begin(), ids.end());
+        total += ids.size();
+    }
+    REQUIRE(unique.size() == total);
+    REQUIRE(unique.count(0) == 0);
+    REQUIRE(!mgr.has_active_transactions());
+    REQUIRE(mgr.lowest_active_start_time() > *unique.rbegin());
+}
+
+TEST_CASE("components::table::transaction_manager::slot_overflow") {
+    using namespace components::table;
+    using namespace components::session;
+
+    transaction_manager_t mgr;
+
+    // more running transactions and pending commits than the slot arrays hold
+    std::vector<session_id_t> sessions;
+    for (size_t i = 0; i < transaction_manager_t::ACTIVE_SLOT_COUNT + 16; i++) {
+        sessions.push_back(session_id_t::generate_uid());
+        mgr.begin_transaction(sessions.back());
+    }
+    auto first_start = mgr.find_transaction(sessions.front())->start_time();
+    REQUIRE(mgr.lowest_active_start_time() == first_start);
+
+    std::vector<uint64_t> commit_ids;
+    for (size_t i = 0; i < transaction_manager_t::PENDING_SLOT_COUNT + 16; i++) {
+        commit_ids.push_back(mgr.begin_commit(sessions[i]));
+    }
+    for (size_t i = commit_ids.size(); i < sessions.size(); i++) {
+        mgr.abort(sessions[i]);
+    }
+    REQUIRE(!mgr.has_active_transactions());
+    REQUIRE(mgr.lowest_active_start_time() == commit_ids.front());
+
+    auto reader = session_id_t::generate_uid();
+    REQUIRE(mgr.begin_transaction(reader).start_time() <= commit_ids.front());
+    mgr.abort(reader);
+
+    for (auto commit_id : commit_ids) {
+        mgr.publish(commit_id);
+    }
+    REQUIRE(mgr.lowest_active_start_time() > commit_ids.back());
+}
@@ -1,78 +1,201 @@
 #include "transaction_manager.hpp"
 
-#include <stdexcept>
+#include <algorithm>
+#include <components/vector/vector_hash.hpp>
 
 namespace components::table {
 
-    transaction_manager_t::transaction_manager_t() = default;
+    template<size_t N>
+    size_t transaction_manager_t::slot_array_t<N>::acquire(uint64_t bound, uint64_t hint) {
+        // counted and in scan range before the slot is taken, so a scan never skips a held slot
+        used_.fetch_add(1);
+        for (size_t i = 0; i < N; i++) {
+            auto index = (hint + i) % N;
+            if (slots_[index].value.load(std::memory_order_relaxed) != 0) {
+                continue;
+            }
+            auto high_water = high_water_.load();
+            while (high_water <= index && !high_water_.compare_exchange_weak(high_water, index + 1)) {
+            }
+            uint64_t expected = 0;
+            if (slots_[index].value.compare_exchange_strong(expected, bound)) {
+                return index;
+            }
+        }
+        // every slot is held: take an overflow entry rather than wait for a transaction to finish
+        std::lock_guard guard(overflow_lock_);
+        auto it = std::find(overflow_.begin(), overflow_.end(), uint64_t{0});
+        if (it == overflow_.end()) {
+            it = overflow_.insert(it, bound);
+        } else {
+            *it = bound;
+        }
+        overflow_used_.fetch_add(1);
+        return N + static_cast<size_t>(it - overflow_.begin());
+    }
+
+    template<size_t N>
+    void transaction_manager_t::slot_array_t<N>::set(size_t slot, uint64_t value) {
+        if (slot < N) {
+            slots_[slot].value.store(value);
+            return;
+        }
+        std::lock_guard guard(overflow_lock_);
+        overflow_[slot - N] = value;
+    }
+
+    template<size_t N>
+    void transaction_manager_t::slot_array_t<N>::release(size_t slot) {
+        if (slot < N) {
+            slots_[slot].value.store(0);
+        } else {
+            std::lock_guard guard(overflow_lock_);
+            overflow_[slot - N] = 0;
+            overflow_used_.fetch_sub(1);
+        }
+        used_.fetch_sub(1);
+    }
+
+    template<size_t N>
+    void transaction_manager_t::slot_array_t<N>::release_value(uint64_t value) {
+        auto end = high_water_.load();
+        for (size_t i = 0; i < end; i++) {
+            auto expected = value;
+            if (slots_[i].value.compare_exchange_strong(expected, 0)) {
+                used_.fetch_sub(1);
+                return;
+            }
+        }
+        if (overflow_used_.load() == 0) {
+            return;
+        }
+        std::lock_guard guard(overflow_lock_);
+        if (auto it = std::find(overflow_.begin(), overflow_.end(), value); it != overflow_.end()) {
+            *it = 0;
+            overflow_used_.fetch_sub(1);
+            used_.fetch_sub(1);
+        }
+    }
+
+    template<size_t N>
+    uint64_t transaction_manager_t::slot_array_t<N>::min(uint64_t bound) const {
+        if (used_.load() == 0) {
+            return bound;
+        }
+        auto end = high_water_.load();
+        for (size_t i = 0; i < end; i++) {
+            auto value = slots_[i].value.load();
+            if (value != 0 && value < bound) {
+                bound = value;
+            }
+        }
+        if (overflow_used_.load() != 0) {
+            std::lock_guard guard(overflow_lock_);
+            for (auto value : overflow_) {
+                if (value != 0 && value < bound) {
+                    bound = value;
+                }
+            }
+        }
+        return bound;
+    }
+
+    uint64_t transaction_manager_t::session_hash(session::session_id_t session) {
+        return vector::hash_mix(session.hash());
+    }
+
+    transaction_manager_t::transaction_manager_t()
+        : active_slots_(std::make_unique<slot_array_t<ACTIVE_SLOT_COUNT>>())
+        , pending_slots_(std::make_unique<slot_array_t<PENDING_SLOT_COUNT>>()) {}
 
     transaction_t& transaction_manager_t::begin_transaction(session::session_id_t session) {
-        std::lock_guard guard(lock_);
-        auto key = session.data();
-        if (active_.find(key) != active_.end()) {
-            return *active_[key];
+        auto hash = session_hash(session);
+        auto& s = shard(hash);
+        std::lock_guard guard(s.lock);
+        if (auto it = s.active.find(session); it != s.active.end()) {
+            return *it->second.txn;
         }
         auto txn_id = next_transaction_id_.fetch_add(1);
-        auto start_time = current_timestamp_.fetch_add(1);
+        // The bound covers pending commits too: the start time below may fall back to one of them, and
+        // it may be published before the slot holds that start time
+        auto slot = active_slots_->acquire(pending_slots_->min(current_timestamp_.load()), hash);
+        // A commit that drew its id before this start time holds its pending slot already
+        auto start_time = pending_slots_->min(current_timestamp_.fetch_add(1));
+        active_slots_->set(slot, start_time);
+
         auto txn = std::make_unique<transaction_t>(txn_id, start_time, session);
         auto& ref = *txn;
-        active_[key] = std::move(txn);
-        active_start_times_.insert(start_time);
+        s.active.emplace(session, active_entry_t{std::move(txn), slot});
         return ref;
     }
 
     uint64_t transaction_manager_t::commit(session::session_id_t session) {
-        std::lock_guard guard(lock_);
-        auto key = session.data();
-        auto it = active_.find(key);
-        if (it == active_.end()) {
+        auto commit_id = begin_commit(session);
+        if (commit_id != 0) {
+            publish(commit_id);
+        }
+        return commit_id;
+    }
+
+    uint64_t transaction_manager_t::begin_commit(session::session_id_t session) {
+        auto hash = session_hash(session);
+        auto& s = shard(hash);
+        std::lock_guard guard(s.lock);
+        auto it = s.active.find(session);
+        if (it == s.active.end()) {
             return 0;
         }
-        auto commit_id = current_timestamp_.fetch_add(1);
-        it->second->set_commit_id(commit_id);
-        it->second->mark_committed();
-        active_start_times_.erase(it->second->start_time());
-        active_.erase(it);
+        // The slot holds exactly the id it reserves: a counter that moved meanwhile raises the slot and retries
+        auto commit_id = current_timestamp_.load();
+        auto pending = pending_slots_->acquire(commit_id, hash);
+        while (!current_timestamp_.compare_exchange_weak(commit_id, commit_id + 1)) {
+            pending_slots_->set(pending, commit_id);
+        }
+
+        it->second.txn->set_commit_id(commit_id);
+        it->second.txn->mark_committed();
+        active_slots_->release(it->second.slot);
+        s.active.erase(it);
         return commit_id;
     }
 
+    void transaction_manager_t::publish(uint64_t commit_id) { pending_slots_->release_value(commit_id); }
+
     void transaction_manager_t::abort(session::session_id_t session) {
-        std::lock_guard guard(lock_);
-        auto key = session.data();
-        auto it = active_.find(key);
-        if (it == active_.end()) {
+        auto& s = shard(session_hash(session));
+        std::lock_guard guard(s.lock);
+        auto it = s.active.find(session);
+        if (it == s.active.end()) {
             return;
         }
-        it->second->mark_aborted();
-        active_start_times_.erase(it->second->start_time());
-        active_.erase(it);
+        it->second.txn->mark_aborted();
+        active_slots_->release(it->second.slot);
+        s.active.erase(it);
     }
 
     transaction_t* transaction_manager_t::find_transaction(session::session_id_t session) {
-        std::lock_guard guard(lock_);
-        auto it = active_.find(session.data());
-        if (it == active_.end()) {
+        auto& s = shard(session_hash(session));
+        std::lock_guard guard(s.lock);
+        auto it = s.active.find(session);
+        if (it == s.active.end()) {
             return nullptr;
         }
-        return it->second.get();
+        return it->second.txn.get();
     }
 
     bool transaction_manager_t::has_active_transaction(session::session_id_t session) const {
-        std::lock_guard guard(lock_);
-        return active_.find(session.data()) != active_.end();
+        const auto& s = shard(session_hash(session));
+        std::lock_guard guard(s.lock);
+        return s.active.find(session) != s.active.end();
     }
 
     uint64_t transaction_manager_t::lowest_active_start_time() const {
-        std::lock_guard guard(lock_);
-        if (active_start_times_.empty()) {
-            return current_timestamp_.load();
-        }
-        return *active_start_times_.begin();
+        // read the counter first: whatever takes a slot after the scan passed it starts later
+        auto lowest = current_timestamp_.load();
+        lowest = active_slots_->min(lowest);
+        return pending_slots_->min(lowest);
     }
 
-    bool transaction_manager_t::has_active_transactions() const {
-        std::lock_guard guard(lock_);
-        return !active_.empty();
-    }
+    bool transaction_manager_t::has_active_transactions() const { return active_slots_->used() > 0; }
 
 } // namespace components::table
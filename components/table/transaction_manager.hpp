@@ -1,23 +1,42 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <components/session/session.hpp>
 #include <components/table/transaction.hpp>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <unordered_map>
+#include <vector>
 
 namespace components::table {
 
+    // Start times and commit ids come from one atomic counter. Sessions find their transaction in one of
+    // SHARD_COUNT independently locked maps, picked by a mixed session hash, so sessions rarely contend.
+    // Every running transaction holds its start time in a slot of a fixed array of atomics, and every
+    // pending commit holds its id in another. The lowest active start time and the snapshot of a new
+    // transaction are computed by scanning those slots, without a lock while the arrays have room.
+    // Beyond them, timestamps go to a mutex-guarded overflow list, so taking a slot never waits.
     class transaction_manager_t {
     public:
+        static constexpr size_t SHARD_COUNT = 64;
+        static constexpr size_t ACTIVE_SLOT_COUNT = 1024;
+        static constexpr size_t PENDING_SLOT_COUNT = 256;
+
         transaction_manager_t();
 
         transaction_t& begin_transaction(session::session_id_t session);
         uint64_t commit(session::session_id_t session);
         void abort(session::session_id_t session);
 
+        // Two-phase commit for callers that stamp the commit id on storage and indexes afterwards.
+        // begin_commit() ends the transaction and hands out its commit id, which stays pending until
+        // publish(). Transactions that begin meanwhile take their snapshot just below the oldest pending
+        // commit, so commits become visible in id order and never half-stamped. publish() never waits:
+        // while a lower commit is still pending, `commit_id` stays hidden behind it.
+        uint64_t begin_commit(session::session_id_t session);
+        void publish(uint64_t commit_id);
+
         transaction_t* find_transaction(session::session_id_t session);
         bool has_active_transaction(session::session_id_t session) const;
 
@@ -25,11 +44,56 @@ namespace components::table {
         bool has_active_transactions() const;
 
     private:
+        // Timestamps held by running transactions or pending commits; 0 marks a free slot. A holder
+        // takes its slot with a lower bound of its timestamp before drawing the timestamp, so a scan
+        // that starts by reading the counter never returns more than a timestamp drawn after it. A
+        // pending commit draws its id by compare-and-swap from the value in its slot, so from the
+        // moment the id is drawn the slot holds exactly that id and no lower stand-in.
+        template<size_t N>
+        class slot_array_t {
+        public:
+            // Never waits: a slot index of N or more refers to the overflow list
+            size_t acquire(uint64_t bound, uint64_t hint);
+            void set(size_t slot, uint64_t value);
+            void release(size_t slot);
+            // Releases the slot holding `value`, if any
+            void release_value(uint64_t value);
+            // Smallest held timestamp below `bound`, or `bound`
+            uint64_t min(uint64_t bound) const;
+            size_t used() const { return used_.load(); }
+
+        private:
+            struct alignas(64) slot_t {
+                std::atomic<uint64_t> value{0};
+            };
+
+            std::array<slot_t, N> slots_;
+            std::atomic<size_t> used_{0};
+            std::atomic<size_t> high_water_{0}; // no slot from here on was ever taken
+            mutable std::mutex overflow_lock_;
+            std::vector<uint64_t> overflow_;       // 0 marks a free entry
+            std::atomic<size_t> overflow_used_{0}; // lets scans skip the lock while nothing overflowed
+        };
+
+        struct active_entry_t {
+            std::unique_ptr<transaction_t> txn;
+            size_t slot;
+        };
+
+        struct alignas(64) shard_t {
+            mutable std::mutex lock;
+            std::unordered_map<session::session_id_t, active_entry_t> active;
+        };
+
+        static uint64_t session_hash(session::session_id_t session);
+        shard_t& shard(uint64_t hash) { return shards_[hash % SHARD_COUNT]; }
+        const shard_t& shard(uint64_t hash) const { return shards_[hash % SHARD_COUNT]; }
+
         std::atomic<uint64_t> next_transaction_id_{TRANSACTION_ID_START};
         std::atomic<uint64_t> current_timestamp_{1};
-        mutable std::mutex lock_;
-        std::unordered_map<uint64_t, std::unique_ptr<transaction_t>> active_;
-        std::set<uint64_t> active_start_times_;
+        std::array<shard_t, SHARD_COUNT> shards_;
+        std::unique_ptr<slot_array_t<ACTIVE_SLOT_COUNT>> active_slots_;
+        std::unique_ptr<slot_array_t<PENDING_SLOT_COUNT>> pending_slots_;
     };
 
 } // namespace components::table
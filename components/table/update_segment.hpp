@@ -312,7 +312,10 @@ namespace components::table {
     };
 
     template<>
-    inline std::string_view update_select_element_t::operation(update_segment_t* segment, std::string_view element) {
+    inline types::string_t update_select_element_t::operation(update_segment_t* segment, types::string_t element) {
+        if (element.is_inlined()) {
+            return element;
+        }
         return {static_cast<char*>(segment->heap().insert(element)), element.size()};
     }
 
@@ -363,7 +366,7 @@ namespace components::table {
                 //initialize_update_data<interval_t>(std::forward<Args>(args)...);
                 //break;
             case types::physical_type::STRING:
-                initialize_update_data<std::string_view>(std::forward<Args>(args)...);
+                initialize_update_data<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::runtime_error("unhandled physical types");
@@ -417,7 +420,7 @@ namespace components::table {
             // update_merge_fetch<interval_t>(std::forward<Args>(args)...);
             // break;
             case types::physical_type::STRING:
-                update_merge_fetch<std::string_view>(std::forward<Args>(args)...);
+                update_merge_fetch<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::logic_error("Unimplemented type for update segment");
@@ -471,7 +474,7 @@ namespace components::table {
             // templated_fetch_committed<interval_t>(std::forward<Args>(args)...);
             // break;
             case types::physical_type::STRING:
-                templated_fetch_committed<std::string_view>(std::forward<Args>(args)...);
+                templated_fetch_committed<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::logic_error("Unimplemented type for update segment");
@@ -525,7 +528,7 @@ namespace components::table {
                 //merge_update_loop<interval_t>(std::forward<Args>(args)...);
                 //break;
             case types::physical_type::STRING:
-                merge_update_loop<std::string_view>(std::forward<Args>(args)...);
+                merge_update_loop<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::runtime_error("unhandled physical types");
@@ -579,7 +582,7 @@ namespace components::table {
                 // templated_fetch_row<interval_t>(std::forward<Args>(args)...);
                 // break;
             case types::physical_type::STRING:
-                templated_fetch_row<std::string_view>(std::forward<Args>(args)...);
+                templated_fetch_row<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::runtime_error("unhandled physical types");
@@ -617,7 +620,7 @@ namespace components::table {
                 // case types::physical_type::INTERVAL:
                 // return templated_check_row<interval_t>(std::forward<Args>(args)...);
             case types::physical_type::STRING:
-                return templated_check_row<std::string_view>(std::forward<Args>(args)...);
+                return templated_check_row<types::string_t>(std::forward<Args>(args)...);
             default:
                 throw std::runtime_error("unhandled physical types");
         }
@@ -670,7 +673,7 @@ namespace components::table {
             //	templated_fetch_commited_range<interval_t>(std::forward<Args>(args)...);
             //	break;
             case types::physical_type::STRING:
-                templated_fetch_commited_range<std::string_view>(std::forward<Args>(args)...);
+                templated_fetch_commited_range<types::string_t>(std::forward<Args>(args)...);
                 break;
             default:
                 throw std::runtime_error("unhandled physical types");
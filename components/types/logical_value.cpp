@@ -421,6 +421,30 @@ namespace components::types {
         return h;
     }
 
+    namespace {
+
+        uint8_t decimal_scale(const complex_logical_type& type) {
+            auto* extension = static_cast<const decimal_logical_type_extension*>(type.extension());
+            return extension ? extension->scale() : 0;
+        }
+
+        // Unscaled values of two decimals, brought to the larger of their scales
+        std::pair<int128_t, int128_t> aligned_decimals(const logical_value_t& lhs, const logical_value_t& rhs) {
+            int128_t left = lhs.value<int64_t>();
+            int128_t right = rhs.value<int64_t>();
+            auto left_scale = decimal_scale(lhs.type());
+            auto right_scale = decimal_scale(rhs.type());
+            for (; left_scale < right_scale; ++left_scale) {
+                left *= 10;
+            }
+            for (; right_scale < left_scale; ++right_scale) {
+                right *= 10;
+            }
+            return {left, right};
+        }
+
+    } // namespace
+
     bool logical_value_t::operator==(const logical_value_t& rhs) const {
         if (type_.type() != rhs.type_.type()) {
             if ((is_numeric(type_.type()) && is_numeric(rhs.type_.type())) ||
@@ -452,7 +476,19 @@ namespace components::types {
                 case logical_type::UINTEGER:
                 case logical_type::UBIGINT:
                 case logical_type::POINTER:
+                case logical_type::TIMESTAMP_SEC:
+                case logical_type::TIMESTAMP_MS:
+                case logical_type::TIMESTAMP_US:
+                case logical_type::TIMESTAMP_NS:
                     return data_ == rhs.data_;
+                case logical_type::HUGEINT:
+                case logical_type::UHUGEINT:
+                case logical_type::UUID:
+                    return udata128_ == rhs.udata128_;
+                case logical_type::DECIMAL: {
+                    auto [left, right] = aligned_decimals(*this, rhs);
+                    return left == right;
+                }
                 case logical_type::FLOAT:
                     return core::is_equals(value<float>(), rhs.value<float>());
                 case logical_type::DOUBLE:
@@ -515,6 +551,20 @@ namespace components::types {
                     return static_cast<uint32_t>(data_) < static_cast<uint32_t>(rhs.data_);
                 case logical_type::UBIGINT:
                     return data_ < rhs.data_;
+                case logical_type::TIMESTAMP_SEC:
+                case logical_type::TIMESTAMP_MS:
+                case logical_type::TIMESTAMP_US:
+                case logical_type::TIMESTAMP_NS:
+                    return static_cast<int64_t>(data_) < static_cast<int64_t>(rhs.data_);
+                case logical_type::HUGEINT:
+                    return data128_ < rhs.data128_;
+                case logical_type::UHUGEINT:
+                case logical_type::UUID:
+                    return udata128_ < rhs.udata128_;
+                case logical_type::DECIMAL: {
+                    auto [left, right] = aligned_decimals(*this, rhs);
+                    return left < right;
+                }
                 case logical_type::STRING_LITERAL:
                     return *str_ptr() < *rhs.str_ptr();
                 case logical_type::STRUCT:
@@ -968,6 +1018,16 @@ namespace components::types {
             return value1;
         }
 
+        // Modulus by zero: return 0 of the appropriate type, as divide does
+        if (!value2.is_null()) {
+            auto* r = value1.resource() ? value1.resource() : value2.resource();
+            auto zero = logical_value_t{r, value2.type()};
+            if (value2 == zero) {
+                auto result_type = value1.is_null() ? value2.type() : value1.type();
+                return logical_value_t{r, result_type};
+            }
+        }
+
         if (!value1.is_null() && !value2.is_null() && value1.type().type() != value2.type().type() &&
             is_numeric(value1.type().type()) && is_numeric(value2.type().type())) {
             auto promoted = promote_type(value1.type().type(), value2.type().type());
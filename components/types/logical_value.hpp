@@ -6,6 +6,7 @@
 #include <memory>
 #include <memory_resource>
 
+#include "string_t.hpp"
 #include "types.hpp"
 
 namespace components::types {
@@ -215,6 +216,12 @@ namespace components::types {
         , resource_(r)
         , data_(reinterpret_cast<uint64_t>(heap_new<std::string>(value))) {}
 
+    template<>
+    inline logical_value_t::logical_value_t(std::pmr::memory_resource* r, string_t value)
+        : type_(logical_type::STRING_LITERAL)
+        , resource_(r)
+        , data_(reinterpret_cast<uint64_t>(heap_new<std::string>(value.view()))) {}
+
     template<>
     inline logical_value_t::logical_value_t(std::pmr::memory_resource* r, char* value)
         : type_(logical_type::STRING_LITERAL)
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace components::types {
+
+    // Entry of a STRING vector: 16 bytes in the Umbra / Arrow StringView layout. The length and the
+    // first four bytes are always stored in place; strings of up to 12 bytes are kept whole inside
+    // the entry, longer ones point into a string heap or a storage block. Equality and ordering
+    // decide most pairs on those first bytes without touching the character data.
+    //
+    // For an inlined string data() points into the entry itself, so views must not outlive it:
+    // converting a temporary into std::string_view does not compile.
+    class string_t {
+    public:
+        static constexpr uint32_t prefix_length = 4;
+        static constexpr uint32_t inline_length = 12;
+
+        string_t() noexcept
+            : value_{} {}
+
+        string_t(const char* data, uint32_t length) noexcept
+            : value_{} {
+            value_.inlined.length = length;
+            if (length <= inline_length) {
+                if (length > 0) {
+                    std::memcpy(value_.inlined.data, data, length);
+                }
+            } else {
+                std::memcpy(value_.pointer.prefix, data, prefix_length);
+                value_.pointer.ptr = data;
+            }
+        }
+
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        string_t(std::string_view str) noexcept
+            : string_t(str.data(), static_cast<uint32_t>(str.size())) {}
+
+        uint32_t size() const noexcept { return value_.inlined.length; }
+        bool empty() const noexcept { return size() == 0; }
+        bool is_inlined() const noexcept { return size() <= inline_length; }
+
+        const char* data() const& noexcept { return is_inlined() ? value_.inlined.data : value_.pointer.ptr; }
+        const char* data() const&& = delete;
+        const char* prefix() const noexcept { return value_.pointer.prefix; }
+
+        std::string_view view() const& noexcept { return {data(), size()}; }
+        std::string_view view() const&& = delete;
+
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        operator std::string_view() const& noexcept { return view(); }
+        operator std::string_view() const&& = delete;
+
+        friend bool operator==(const string_t& a, const string_t& b) noexcept {
+            // length and prefix in one load
+            if (a.head() != b.head()) {
+                return false;
+            }
+            if (a.is_inlined()) {
+                return a.tail() == b.tail();
+            }
+            return a.value_.pointer.ptr == b.value_.pointer.ptr ||
+                   std::memcmp(a.value_.pointer.ptr + prefix_length,
+                               b.value_.pointer.ptr + prefix_length,
+                               a.size() - prefix_length) == 0;
+        }
+
+        friend std::strong_ordering operator<=>(const string_t& a, const string_t& b) noexcept {
+            auto prefix_a = a.prefix_key();
+            auto prefix_b = b.prefix_key();
+            if (prefix_a != prefix_b) {
+                return prefix_a <=> prefix_b;
+            }
+            auto length = std::min(a.size(), b.size());
+            if (length > prefix_length) {
+                auto cmp = std::memcmp(a.data() + prefix_length, b.data() + prefix_length, length - prefix_length);
+                if (cmp != 0) {
+                    return cmp <=> 0;
+                }
+            }
+            return a.size() <=> b.size();
+        }
+
+    private:
+        struct pointer_t {
+            uint32_t length;
+            char prefix[prefix_length];
+            const char* ptr;
+        };
+
+        struct inlined_t {
+            uint32_t length;
+            char data[inline_length]; // zero-padded past the length
+        };
+
+        uint64_t head() const noexcept {
+            uint64_t result;
+            std::memcpy(&result, &value_, sizeof(result));
+            return result;
+        }
+
+        uint64_t tail() const noexcept {
+            uint64_t result;
+            std::memcpy(&result, reinterpret_cast<const char*>(&value_) + sizeof(uint64_t), sizeof(result));
+            return result;
+        }
+
+        // Prefix bytes as a big-endian number, so integer order is byte order; zero padding keeps
+        // shorter strings first
+        uint32_t prefix_key() const noexcept {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(value_.pointer.prefix);
+            return static_cast<uint32_t>(bytes[0]) << 24 | static_cast<uint32_t>(bytes[1]) << 16 |
+                   static_cast<uint32_t>(bytes[2]) << 8 | static_cast<uint32_t>(bytes[3]);
+        }
+
+        union {
+            pointer_t pointer;
+            inlined_t inlined;
+        } value_;
+    };
+
+    static_assert(sizeof(string_t) == 16);
+
+    // Type a vector stores for the C++ type a physical type switch hands out: strings are string_t
+    template<typename T>
+    using physical_storage_t = std::conditional_t<std::is_same_v<T, std::string_view>, string_t, T>;
+
+} // namespace components::types
+
+template<>
+struct std::hash<components::types::string_t> {
+    std::size_t operator()(const components::types::string_t& str) const noexcept {
+        return std::hash<std::string_view>{}(str.view());
+    }
+};
@@ -2,7 +2,9 @@
 
 #include <catch2/catch.hpp>
 
+#include <components/types/logical_value.hpp>
 #include <components/types/physical_value.hpp>
+#include <components/types/string_t.hpp>
 
 using namespace components::types;
 
@@ -69,4 +71,71 @@ TEST_CASE("components::types::physical_value") {
         REQUIRE(values[13].value<physical_type::STRING>() == str1);
         REQUIRE(values[14].type() == physical_type::NA);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("components::types::string_t") {
+    std::string short_str = "short string";                  // 12 bytes: inlined
+    std::string long_str = "long string, kept out of line";  // pointer + prefix
+    std::string long_copy = long_str;
+
+    INFO("layout") {
+        string_t inlined(short_str);
+        string_t pointer(long_str);
+        REQUIRE(inlined.is_inlined());
+        REQUIRE(inlined.data() != short_str.data());
+        REQUIRE(inlined.view() == short_str);
+        REQUIRE_FALSE(pointer.is_inlined());
+        REQUIRE(pointer.data() == long_str.data());
+        REQUIRE(pointer.view() == long_str);
+        REQUIRE(string_t().empty());
+    }
+
+    INFO("equality") {
+        REQUIRE(string_t(long_str) == string_t(long_copy));
+        REQUIRE(string_t(short_str) == string_t(std::string_view("short string")));
+        REQUIRE_FALSE(string_t(std::string_view("short strinG")) == string_t(short_str));
+        REQUIRE_FALSE(string_t(std::string_view("long string, kept out of lin")) == string_t(long_str));
+        REQUIRE(std::hash<string_t>{}(string_t(long_str)) == std::hash<string_t>{}(string_t(long_copy)));
+    }
+
+    INFO("ordering") {
+        std::vector<std::string> strings{"", "a", "ab", "abcd", "abcde", "abce", "b", "\xff", short_str, long_str};
+        for (const auto& a : strings) {
+            for (const auto& b : strings) {
+                REQUIRE((string_t(a) <=> string_t(b)) == (std::string_view(a) <=> std::string_view(b)));
+            }
+        }
+    }
+}
+
+TEST_CASE("components::types::logical_value_t::modulus") {
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    INFO("non-zero divisors") {
+        auto result = logical_value_t::modulus(logical_value_t{&resource, int32_t(7)},
+                                               logical_value_t{&resource, int32_t(3)});
+        REQUIRE(result.type().type() == logical_type::INTEGER);
+        REQUIRE(result.value<int32_t>() == 1);
+        result = logical_value_t::modulus(logical_value_t{&resource, int32_t(-7)},
+                                          logical_value_t{&resource, int32_t(3)});
+        REQUIRE(result.value<int32_t>() == -1);
+    }
+
+    INFO("zero divisor gives 0 of the dividend type") {
+        auto result = logical_value_t::modulus(logical_value_t{&resource, int32_t(7)},
+                                               logical_value_t{&resource, int32_t(0)});
+        REQUIRE(!result.is_null());
+        REQUIRE(result.type().type() == logical_type::INTEGER);
+        REQUIRE(result.value<int32_t>() == 0);
+
+        result = logical_value_t::modulus(logical_value_t{&resource, int64_t(-9)},
+                                          logical_value_t{&resource, uint8_t(0)});
+        REQUIRE(!result.is_null());
+        REQUIRE(result.type().type() == logical_type::BIGINT);
+        REQUIRE(result.value<int64_t>() == 0);
+    }
+
+    INFO("NULL operands") {
+        auto null_value = logical_value_t{&resource, complex_logical_type{logical_type::NA}};
+        REQUIRE(logical_value_t::modulus(null_value, null_value).is_null());
+    }
+}
@@ -1,5 +1,6 @@
 #include "types.hpp"
 #include "logical_value.hpp"
+#include "string_t.hpp"
 #include <components/serialization/deserializer.hpp>
 
 #include <cassert>
@@ -206,7 +207,7 @@ namespace components::types {
             case logical_type::UBIGINT:
                 return sizeof(uint64_t);
             case logical_type::STRING_LITERAL:
-                return sizeof(std::string_view);
+                return sizeof(string_t);
             case logical_type::POINTER:
                 return sizeof(void*);
             case logical_type::LIST:
@@ -255,7 +256,7 @@ namespace components::types {
             case logical_type::VALIDITY:
                 return alignof(uint64_t);
             case logical_type::STRING_LITERAL:
-                return alignof(std::string_view);
+                return alignof(string_t);
             case logical_type::POINTER:
                 return alignof(void*);
             case logical_type::LIST:
@@ -7,7 +7,7 @@
 
 namespace components::vector::arrow::appender {
 
-    template<class SRC = std::string_view, class BUFTYPE = int64_t>
+    template<class SRC = types::string_t, class BUFTYPE = int64_t>
     struct arrow_string_data_t {
         static void initialize(arrow_append_data_t& result, const types::complex_logical_type&, uint64_t capacity) {
             result.main_buffer().reserve((capacity + 1) * sizeof(BUFTYPE));
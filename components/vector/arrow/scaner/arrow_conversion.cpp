@@ -219,11 +219,11 @@ namespace components::vector::arrow::scaner {
                 break;
             case types::physical_type::STRING: {
                 result.set_auxiliary(values.auxiliary());
-                flatten_run_ends<RUN_END_TYPE, std::string_view>(result,
-                                                                 run_end_encoding,
-                                                                 compressed_size,
-                                                                 scan_offset,
-                                                                 size);
+                flatten_run_ends<RUN_END_TYPE, types::string_t>(result,
+                                                                run_end_encoding,
+                                                                compressed_size,
+                                                                scan_offset,
+                                                                size);
                 break;
             }
             default:
@@ -320,7 +320,7 @@ namespace components::vector::arrow::scaner {
     }
     template<class T>
     static void set_vector_string(vector_t& vector, size_t size, char* cdata, T* offsets) {
-        auto strings = vector.data<std::string_view>();
+        auto strings = vector.data<types::string_t>();
         for (size_t row_idx = 0; row_idx < size; row_idx++) {
             if (vector.is_null(row_idx)) {
                 continue;
@@ -330,12 +330,14 @@ namespace components::vector::arrow::scaner {
             if (str_len > std::numeric_limits<uint32_t>::max()) {
                 throw std::logic_error("OtterBrix does not support strings over 4 GB");
             }
-            strings[row_idx] = std::string_view(cptr, static_cast<uint32_t>(str_len));
+            strings[row_idx] = types::string_t(cptr, static_cast<uint32_t>(str_len));
         }
     }
 
     static void set_vector_string_view(vector_t& vector, size_t size, ArrowArray& array, size_t current_pos) {
-        auto strings = vector.data<std::string_view>();
+        // Arrow's StringView has the layout of types::string_t except that long strings are addressed
+        // by (buffer, offset) instead of a pointer
+        auto strings = vector.data<types::string_t>();
         auto arrow_string = arrow_buffer_data<arrow_string_view_t>(array, 1) + current_pos;
 
         for (size_t row_idx = 0; row_idx < size; row_idx++) {
@@ -344,13 +346,13 @@ namespace components::vector::arrow::scaner {
             }
             auto length = static_cast<uint32_t>(arrow_string[row_idx].length());
             if (arrow_string[row_idx].is_inlined()) {
-                strings[row_idx] = std::string_view(arrow_string[row_idx].inlined_data(), length);
+                strings[row_idx] = types::string_t(arrow_string[row_idx].inlined_data(), length);
             } else {
                 auto buffer_index = static_cast<uint32_t>(arrow_string[row_idx].buffer_index());
                 int32_t offset = arrow_string[row_idx].get_offset();
                 assert(array.n_buffers > 2 + buffer_index);
                 auto c_data = arrow_buffer_data<char>(array, 2 + buffer_index);
-                strings[row_idx] = std::string_view(&c_data[offset], length);
+                strings[row_idx] = types::string_t(&c_data[offset], length);
             }
         }
     }
@@ -803,18 +805,24 @@ namespace components::vector::arrow::scaner {
                                         fixed_size;
                         auto cdata = arrow_buffer_data<char>(array, 1);
                         auto blob_len = fixed_size;
-                        auto result = vector.data<std::string_view>();
+                        auto result = vector.data<types::string_t>();
                         for (size_t row_idx = 0; row_idx < size; row_idx++) {
                             if (vector.is_null(row_idx)) {
                                 offset += blob_len;
                                 continue;
                             }
+                            if (blob_len <= types::string_t::inline_length) {
+                                result[row_idx] = types::string_t(cdata + offset, static_cast<uint32_t>(blob_len));
+                                offset += blob_len;
+                                continue;
+                            }
                             if (!vector.auxiliary()) {
                                 vector.set_auxiliary(std::make_shared<string_vector_buffer_t>(vector.resource()));
                             }
                             auto auxiliary = static_cast<string_vector_buffer_t*>(vector.auxiliary().get());
                             result[row_idx] =
-                                std::string_view(static_cast<char*>(auxiliary->insert(cdata + offset, blob_len)));
+                                types::string_t(static_cast<char*>(auxiliary->insert(cdata + offset, blob_len)),
+                                                static_cast<uint32_t>(blob_len));
                             offset += blob_len;
                         }
                     }
@@ -1,6 +1,10 @@
 #include <catch2/catch.hpp>
 
 #include <components/vector/vector.hpp>
+#include <components/vector/vector_hash.hpp>
+#include <components/vector/vector_operations.hpp>
+
+#include <unordered_set>
 
 TEST_CASE("components::vector::vector") {
     auto resource = std::pmr::synchronized_pool_resource();
@@ -330,4 +334,41 @@ TEST_CASE("components::vector::vector") {
             }
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("components::vector::hash") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    constexpr size_t test_size = components::vector::DEFAULT_VECTOR_CAPACITY;
+    using components::vector::hash_value;
+
+    INFO("sequential integers") {
+        components::vector::vector_t v(&resource, components::types::logical_type::BIGINT, test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            v.data<int64_t>()[i] = static_cast<int64_t>(i);
+        }
+        v.set_null(7, true);
+        components::vector::vector_t hashes(&resource, components::types::logical_type::UBIGINT, test_size);
+        components::vector::vector_ops::hash(v, hashes, test_size);
+
+        // low bits pick the bucket: sequential keys must not pile up in a few of them
+        std::unordered_set<uint64_t> buckets;
+        for (size_t i = 0; i < test_size; i++) {
+            if (i != 7) {
+                REQUIRE(hashes.data<uint64_t>()[i] == hash_value(static_cast<int64_t>(i)));
+                buckets.insert(hashes.data<uint64_t>()[i] & (test_size - 1));
+            }
+        }
+        REQUIRE(hashes.data<uint64_t>()[7] == components::vector::NULL_HASH);
+        REQUIRE(buckets.size() > test_size / 2);
+    }
+
+    INFO("equal values hash alike") {
+        REQUIRE(hash_value(0.0) == hash_value(-0.0));
+        REQUIRE(hash_value(std::nan("1")) == hash_value(std::nan("2")));
+        std::string long_str = "long enough to live out of line";
+        std::string long_copy = long_str;
+        REQUIRE(hash_value(components::types::string_t(long_str)) ==
+                hash_value(components::types::string_t(long_copy)));
+        REQUIRE(hash_value(std::string_view("inlined")) == hash_value(components::types::string_t("inlined", 7)));
+        REQUIRE(hash_value(std::string_view("inlined")) != hash_value(std::string_view("inlinee")));
+    }
+}
@@ -477,14 +477,19 @@ namespace components::vector {
             case types::physical_type::STRING: {
                 if (!val.is_null()) {
                     assert(type_.type() == types::logical_type::STRING_LITERAL);
+                    const auto& str = *(val.value<std::string*>());
+                    // short strings live inside the entry and never reach the heap
+                    if (str.size() <= types::string_t::inline_length) {
+                        reinterpret_cast<types::string_t*>(data_)[index] = types::string_t(std::string_view(str));
+                        break;
+                    }
                     if (!auxiliary_) {
                         auxiliary_ = std::make_unique<string_vector_buffer_t>(resource());
                     }
                     assert(auxiliary_->type() == vector_buffer_type::STRING);
-                    reinterpret_cast<std::string_view*>(data_)[index] =
-                        std::string_view(reinterpret_cast<char*>(static_cast<string_vector_buffer_t*>(auxiliary_.get())
-                                                                     ->insert(*(val.value<std::string*>()))),
-                                         val.value<std::string*>()->size());
+                    reinterpret_cast<types::string_t*>(data_)[index] = types::string_t(
+                        reinterpret_cast<char*>(static_cast<string_vector_buffer_t*>(auxiliary_.get())->insert(str)),
+                        static_cast<uint32_t>(str.size()));
                 }
                 break;
             }
@@ -659,8 +664,9 @@ namespace components::vector {
             case types::logical_type::DOUBLE:
                 return types::logical_value_t(vector->resource(), reinterpret_cast<double*>(vector->data_)[index]);
             case types::logical_type::STRING_LITERAL: {
-                return types::logical_value_t(vector->resource(),
-                                              std::string(reinterpret_cast<std::string_view*>(vector->data_)[index]));
+                return types::logical_value_t(
+                    vector->resource(),
+                    std::string(reinterpret_cast<types::string_t*>(vector->data_)[index].view()));
             }
             case types::logical_type::MAP: {
                 auto offlen = reinterpret_cast<types::list_entry_t*>(vector->data_)[index];
@@ -940,7 +946,7 @@ namespace components::vector {
                         templated_flatten_constant_vector<double>(data_, old_data, count);
                         break;
                     case types::physical_type::STRING:
-                        templated_flatten_constant_vector<std::string_view>(data_, old_data, count);
+                        templated_flatten_constant_vector<types::string_t>(data_, old_data, count);
                         break;
                     case types::physical_type::LIST: {
                         templated_flatten_constant_vector<types::list_entry_t>(data_, old_data, count);
@@ -1094,7 +1100,7 @@ namespace components::vector {
                         //     flatten_const_vector<interval_t>(data_, old_data, count);
                         //     break;
                     case types::physical_type::STRING:
-                        flatten_const_vector<std::string_view>(data_, old_data, count);
+                        flatten_const_vector<types::string_t>(data_, old_data, count);
                         break;
                     case types::physical_type::LIST: {
                         flatten_const_vector<types::list_entry_t>(data_, old_data, count);
@@ -34,10 +34,12 @@ namespace components::vector {
 
         template<typename T>
         const T* get_data() const {
+            static_assert(!std::is_same_v<T, std::string_view>, "STRING vectors hold types::string_t");
             return reinterpret_cast<const T*>(data);
         }
         template<typename T>
         T* get_data() {
+            static_assert(!std::is_same_v<T, std::string_view>, "STRING vectors hold types::string_t");
             return reinterpret_cast<T*>(data);
         }
 
@@ -110,10 +112,12 @@ namespace components::vector {
         void set_data(std::byte* data) noexcept { data_ = data; }
         template<typename T>
         T* data() noexcept {
+            static_assert(!std::is_same_v<T, std::string_view>, "STRING vectors hold types::string_t");
             return reinterpret_cast<T*>(data_);
         }
         template<typename T>
         const T* data() const noexcept {
+            static_assert(!std::is_same_v<T, std::string_view>, "STRING vectors hold types::string_t");
             return reinterpret_cast<const T*>(data_);
         }
         std::shared_ptr<vector_buffer_t> auxiliary() { return auxiliary_; }
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <components/types/string_t.hpp>
+#include <components/types/types.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace components::vector {
+
+    // Hash primitives shared by vector_ops::hash, GROUP BY, DISTINCT, hash joins and the sketches.
+    // Every value goes through a full-avalanche finalizer, so sequential integers and strings that
+    // differ in one byte spread over all 64 bits and both the low bits (bucket index) and the high
+    // bits (HyperLogLog register, radix partition) can be used directly. Hashes are not stable
+    // across builds and must not be persisted.
+
+    // Hash of a NULL in any column
+    constexpr uint64_t NULL_HASH = 0xbf58476d1ce4e5b9ULL;
+
+    // murmur3 fmix64
+    inline uint64_t hash_mix(uint64_t h) noexcept {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Folds the hash of the next column into the hash of a row. Not commutative: (a, b) and (b, a)
+    // rows land apart.
+    inline uint64_t hash_combine(uint64_t a, uint64_t b) noexcept { return (a * 0x9e3779b97f4a7c15ULL) ^ b; }
+
+    // MurmurHash64A over 8-byte words, then the finalizer
+    inline uint64_t hash_bytes(const char* data, size_t size) noexcept {
+        constexpr uint64_t m = 0xc6a4a7935bd1e995ULL;
+        uint64_t h = 0x2545f4914f6cdd1dULL ^ (size * m);
+        const char* end = data + (size & ~size_t{7});
+        for (; data != end; data += sizeof(uint64_t)) {
+            uint64_t k;
+            std::memcpy(&k, data, sizeof(k));
+            k *= m;
+            k ^= k >> 47;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+        if (auto rest = size & 7; rest != 0) {
+            uint64_t k = 0;
+            std::memcpy(&k, data, rest);
+            h ^= k;
+            h *= m;
+        }
+        return hash_mix(h);
+    }
+
+    // Inlined strings are hashed from the two words of the entry itself (length, then zero-padded
+    // bytes) without following a pointer; longer ones hash their bytes.
+    inline uint64_t hash_string(const types::string_t& str) noexcept {
+        if (str.is_inlined()) {
+            static_assert(std::is_trivially_copyable_v<types::string_t>);
+            uint64_t words[2];
+            std::memcpy(words, &str, sizeof(words));
+            return hash_mix(hash_mix(words[0]) ^ words[1]);
+        }
+        return hash_bytes(str.data(), str.size());
+    }
+
+    template<typename T>
+    uint64_t hash_value(T value) noexcept {
+        if constexpr (std::is_same_v<T, types::string_t>) {
+            return hash_string(value);
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            return hash_string(types::string_t(value));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            // equal values hash alike: -0.0 == 0.0, and every NaN is one group
+            if (value == T(0)) {
+                value = T(0);
+            } else if (std::isnan(value)) {
+                value = std::numeric_limits<T>::quiet_NaN();
+            }
+            if constexpr (sizeof(T) == sizeof(uint32_t)) {
+                return hash_mix(std::bit_cast<uint32_t>(value));
+            } else {
+                return hash_mix(std::bit_cast<uint64_t>(value));
+            }
+        } else if constexpr (std::is_same_v<T, types::int128_t> || std::is_same_v<T, types::uint128_t>) {
+            return hash_mix(hash_mix(static_cast<uint64_t>(value >> 64)) ^ static_cast<uint64_t>(value));
+        } else {
+            static_assert(std::is_integral_v<T>, "no hash for this type");
+            return hash_mix(static_cast<uint64_t>(value));
+        }
+    }
+
+    template<typename T>
+    uint64_t hash_value(const T& value, bool is_null) noexcept {
+        return is_null ? NULL_HASH : hash_value(value);
+    }
+
+} // namespace components::vector
@@ -1,4 +1,6 @@
 #include "vector_operations.hpp"
+#include "vector_hash.hpp"
+
 #include <stdexcept>
 
 namespace components::vector::vector_ops {
@@ -57,17 +59,6 @@ namespace components::vector::vector_ops {
             }
         }
 
-        struct hasher_t {
-            static constexpr uint64_t NULL_HASH = 0xbf58476d1ce4e5b9;
-
-            template<class T>
-            static uint64_t operation(T input, bool is_null) {
-                return is_null ? NULL_HASH : std::hash<T>{}(input);
-            }
-        };
-
-        static uint64_t combine_hash_scalar(uint64_t a, uint64_t b) { return (a * UINT64_C(0xbf58476d1ce4e5b9)) ^ b; }
-
         template<bool HAS_RINDEXING, class T>
         static void tight_loop_hash(const T* ldata,
                                     uint64_t* result_data,
@@ -79,13 +70,18 @@ namespace components::vector::vector_ops {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    result_data[ridx] = hasher_t::operation(ldata[idx], !mask.row_is_valid(idx));
+                    result_data[ridx] = hash_value(ldata[idx], !mask.row_is_valid(idx));
+                }
+            } else if (!HAS_RINDEXING && !indexing_vector->is_set()) {
+                // flat input: a straight loop the compiler can unroll and vectorize
+                for (uint64_t i = 0; i < count; i++) {
+                    result_data[i] = hash_value(ldata[i]);
                 }
             } else {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    result_data[ridx] = std::hash<T>{}(ldata[idx]);
+                    result_data[ridx] = hash_value(ldata[idx]);
                 }
             }
         }
@@ -98,7 +94,7 @@ namespace components::vector::vector_ops {
 
                 auto ldata = input.data<T>();
                 auto result_data = result.data<uint64_t>();
-                *result_data = hasher_t::operation(*ldata, input.is_null());
+                *result_data = hash_value(*ldata, input.is_null());
             } else {
                 result.set_vector_type(vector_type::FLAT);
 
@@ -173,7 +169,7 @@ namespace components::vector::vector_ops {
                     unprocessed.set_index(remaining++, ridx);
                     cursor.set_index(ridx, entry.offset);
                 } else if (FIRST_HASH) {
-                    hdata[ridx] = hasher_t::NULL_HASH;
+                    hdata[ridx] = NULL_HASH;
                 }
             }
 
@@ -209,7 +205,7 @@ namespace components::vector::vector_ops {
                 for (uint64_t i = 0; i < count; ++i) {
                     const auto ridx = unprocessed.get_index(i);
                     const auto cidx = cursor.get_index(ridx);
-                    hdata[ridx] = combine_hash_scalar(hdata[ridx], chdata[cidx]);
+                    hdata[ridx] = hash_combine(hdata[ridx], chdata[cidx]);
 
                     const auto lidx = idata.referenced_indexing->get_index(ridx);
                     const auto& entry = ldata[lidx];
@@ -257,10 +253,10 @@ namespace components::vector::vector_ops {
                         }
                         for (uint64_t j = 0; j < array_size; j++) {
                             auto offset = lidx * array_size + j;
-                            hdata[i] = combine_hash_scalar(hdata[i], chdata[offset]);
+                            hdata[i] = hash_combine(hdata[i], chdata[offset]);
                         }
                     } else if (FIRST_HASH) {
-                        hdata[i] = hasher_t::NULL_HASH;
+                        hdata[i] = NULL_HASH;
                     }
                 }
             } else {
@@ -283,11 +279,11 @@ namespace components::vector::vector_ops {
                             hdata[ridx] = 0;
                         }
                         for (uint64_t j = 0; j < array_size; j++) {
-                            hdata[ridx] = combine_hash_scalar(hdata[ridx], ahdata[j]);
+                            hdata[ridx] = hash_combine(hdata[ridx], ahdata[j]);
                             ahdata[j] = 0;
                         }
                     } else if (FIRST_HASH) {
-                        hdata[ridx] = hasher_t::NULL_HASH;
+                        hdata[ridx] = NULL_HASH;
                     }
                 }
             }
@@ -323,12 +319,12 @@ namespace components::vector::vector_ops {
                 case types::physical_type::UINT64:
                     templated_loop_hash<HAS_RINDEXING, uint64_t>(input, result, rindexing, count);
                     break;
-                // case types::physical_type::INT128:
-                // templated_loop_hash<HAS_RINDEXING, int128_t>(input, result, rindexing, count);
-                // break;
-                // case types::physical_type::UINT128:
-                // templated_loop_hash<HAS_RINDEXING, uint128_t>(input, result, rindexing, count);
-                // break;
+                case types::physical_type::INT128:
+                    templated_loop_hash<HAS_RINDEXING, types::int128_t>(input, result, rindexing, count);
+                    break;
+                case types::physical_type::UINT128:
+                    templated_loop_hash<HAS_RINDEXING, types::uint128_t>(input, result, rindexing, count);
+                    break;
                 case types::physical_type::FLOAT:
                     templated_loop_hash<HAS_RINDEXING, float>(input, result, rindexing, count);
                     break;
@@ -339,7 +335,7 @@ namespace components::vector::vector_ops {
                 // templated_loop_hash<HAS_RINDEXING, interval_t>(input, result, rindexing, count);
                 // break;
                 case types::physical_type::STRING:
-                    templated_loop_hash<HAS_RINDEXING, std::string_view>(input, result, rindexing, count);
+                    templated_loop_hash<HAS_RINDEXING, types::string_t>(input, result, rindexing, count);
                     break;
                 case types::physical_type::STRUCT:
                     struct_loop_hash<HAS_RINDEXING, true>(input, result, rindexing, count);
@@ -367,15 +363,15 @@ namespace components::vector::vector_ops {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    auto other_hash = hasher_t::operation(ldata[idx], !mask.row_is_valid(idx));
-                    hash_data[ridx] = combine_hash_scalar(constant_hash, other_hash);
+                    auto other_hash = hash_value(ldata[idx], !mask.row_is_valid(idx));
+                    hash_data[ridx] = hash_combine(constant_hash, other_hash);
                 }
             } else {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    auto other_hash = std::hash<T>{}(ldata[idx]);
-                    hash_data[ridx] = combine_hash_scalar(constant_hash, other_hash);
+                    auto other_hash = hash_value(ldata[idx]);
+                    hash_data[ridx] = hash_combine(constant_hash, other_hash);
                 }
             }
         }
@@ -391,15 +387,15 @@ namespace components::vector::vector_ops {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    auto other_hash = hasher_t::operation(ldata[idx], !mask.row_is_valid(idx));
-                    hash_data[ridx] = combine_hash_scalar(hash_data[ridx], other_hash);
+                    auto other_hash = hash_value(ldata[idx], !mask.row_is_valid(idx));
+                    hash_data[ridx] = hash_combine(hash_data[ridx], other_hash);
                 }
             } else {
                 for (uint64_t i = 0; i < count; i++) {
                     auto ridx = HAS_RINDEXING ? rindexing->get_index(i) : i;
                     auto idx = indexing_vector->get_index(ridx);
-                    auto other_hash = std::hash<T>{}(ldata[idx]);
-                    hash_data[ridx] = combine_hash_scalar(hash_data[ridx], other_hash);
+                    auto other_hash = hash_value(ldata[idx]);
+                    hash_data[ridx] = hash_combine(hash_data[ridx], other_hash);
                 }
             }
         }
@@ -413,8 +409,8 @@ namespace components::vector::vector_ops {
                 auto ldata = input.data<T>();
                 auto hash_data = hashes.data<uint64_t>();
 
-                auto other_hash = hasher_t::operation(*ldata, input.is_null());
-                *hash_data = combine_hash_scalar(*hash_data, other_hash);
+                auto other_hash = hash_value(*ldata, input.is_null());
+                *hash_data = hash_combine(*hash_data, other_hash);
             } else {
                 unified_vector_format idata(input.resource(), count);
                 input.to_unified_format(count, idata);
@@ -472,12 +468,12 @@ namespace components::vector::vector_ops {
                 case types::physical_type::UINT64:
                     templated_loop_combine_hash<HAS_RINDEXING, uint64_t>(input, hashes, rindexing, count);
                     break;
-                // case types::physical_type::INT128:
-                // templated_loop_combine_hash<HAS_RINDEXING, int128_t>(input, hashes, rindexing, count);
-                // break;
-                // case types::physical_type::UINT128:
-                // templated_loop_combine_hash<HAS_RINDEXING, uint128_t>(input, hashes, rindexing, count);
-                // break;
+                case types::physical_type::INT128:
+                    templated_loop_combine_hash<HAS_RINDEXING, types::int128_t>(input, hashes, rindexing, count);
+                    break;
+                case types::physical_type::UINT128:
+                    templated_loop_combine_hash<HAS_RINDEXING, types::uint128_t>(input, hashes, rindexing, count);
+                    break;
                 case types::physical_type::FLOAT:
                     templated_loop_combine_hash<HAS_RINDEXING, float>(input, hashes, rindexing, count);
                     break;
@@ -488,7 +484,7 @@ namespace components::vector::vector_ops {
                 // templated_loop_combine_hash<HAS_RINDEXING, interval_t>(input, hashes, rindexing, count);
                 // break;
                 case types::physical_type::STRING:
-                    templated_loop_combine_hash<HAS_RINDEXING, std::string_view>(input, hashes, rindexing, count);
+                    templated_loop_combine_hash<HAS_RINDEXING, types::string_t>(input, hashes, rindexing, count);
                     break;
                 case types::physical_type::STRUCT:
                     struct_loop_hash<HAS_RINDEXING, false>(input, hashes, rindexing, count);
@@ -716,8 +712,8 @@ namespace components::vector::vector_ops {
                                              copy_count);
                 break;
             case types::physical_type::STRING: {
-                auto ldata = source_ptr->data<std::string_view>();
-                auto tdata = target.data<std::string_view>();
+                auto ldata = source_ptr->data<types::string_t>();
+                auto tdata = target.data<types::string_t>();
                 for (uint64_t i = 0; i < copy_count; i++) {
                     auto source_idx = indexing_ptr->get_index(source_offset + i);
                     if (source_idx == std::numeric_limits<uint64_t>::max()) {
@@ -725,11 +721,17 @@ namespace components::vector::vector_ops {
                         continue;
                     }
                     auto target_idx = target_offset + i;
-                    if (tmask.row_is_valid(target_idx)) {
-                        tdata[target_idx] = std::string_view(
-                            reinterpret_cast<char*>(static_cast<string_vector_buffer_t*>(target.auxiliary().get())
-                                                        ->insert(ldata[source_idx])),
-                            ldata[source_idx].size());
+                    if (!tmask.row_is_valid(target_idx)) {
+                        continue;
+                    }
+                    const auto& source = ldata[source_idx];
+                    if (source.is_inlined()) {
+                        tdata[target_idx] = source;
+                    } else {
+                        tdata[target_idx] = types::string_t(
+                            reinterpret_cast<char*>(
+                                static_cast<string_vector_buffer_t*>(target.auxiliary().get())->insert(source)),
+                            source.size());
                     }
                 }
                 break;
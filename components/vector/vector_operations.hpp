@@ -405,7 +405,7 @@ namespace components::vector::vector_ops {
             case types::physical_type::DOUBLE:
                 return index<double, COMP>(left, right, count, true_indexing, false_indexing);
             case types::physical_type::STRING:
-                return index<std::string_view, COMP>(left, right, count, true_indexing, false_indexing);
+                return index<types::string_t, COMP>(left, right, count, true_indexing, false_indexing);
             default:
                 throw std::runtime_error("Invalid type for comparison");
         }
@@ -0,0 +1,173 @@
+#include "scheduler_pool.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+namespace core::scheduler {
+
+    namespace {
+
+        std::set<int64_t> process_thread_ids() {
+            std::set<int64_t> ids;
+#if defined(__linux__)
+            std::error_code ec;
+            for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+                try {
+                    ids.insert(std::stoll(entry.path().filename().string()));
+                } catch (const std::exception&) {
+                }
+            }
+#endif
+            return ids;
+        }
+
+        std::string read_thread_name(int64_t tid) {
+            std::string name;
+#if defined(__linux__)
+            std::ifstream in("/proc/self/task/" + std::to_string(tid) + "/comm");
+            std::getline(in, name);
+#else
+            (void) tid;
+#endif
+            return name;
+        }
+
+        // utime + stime of a single thread, /proc/self/task/<tid>/stat fields 14 and 15.
+        std::chrono::nanoseconds read_thread_cpu_time(int64_t tid) {
+#if defined(__linux__)
+            std::ifstream in("/proc/self/task/" + std::to_string(tid) + "/stat");
+            std::string line;
+            if (!std::getline(in, line)) {
+                return std::chrono::nanoseconds{0};
+            }
+            // comm (field 2) may contain spaces, skip past its closing parenthesis
+            auto pos = line.rfind(')');
+            if (pos == std::string::npos) {
+                return std::chrono::nanoseconds{0};
+            }
+            std::istringstream fields(line.substr(pos + 2));
+            std::string field;
+            uint64_t utime = 0;
+            uint64_t stime = 0;
+            // field 3 is the first one after comm
+            for (int index = 3; index <= 15 && fields >> field; ++index) {
+                if (index == 14) {
+                    utime = std::stoull(field);
+                } else if (index == 15) {
+                    stime = std::stoull(field);
+                }
+            }
+            static const auto ticks_per_second = sysconf(_SC_CLK_TCK);
+            if (ticks_per_second <= 0) {
+                return std::chrono::nanoseconds{0};
+            }
+            auto ticks = static_cast<double>(utime + stime);
+            return std::chrono::nanoseconds{
+                static_cast<int64_t>(ticks * 1e9 / static_cast<double>(ticks_per_second))};
+#else
+            (void) tid;
+            return std::chrono::nanoseconds{0};
+#endif
+        }
+
+    } // namespace
+
+    scheduler_pool_t::scheduler_pool_t(pool_spec_t spec)
+        : spec_(std::move(spec))
+        , scheduler_(new actor_zeta::shared_work(std::max<std::size_t>(1, spec_.threads), spec_.max_throughput)) {}
+
+    void scheduler_pool_t::start() {
+        auto before = process_thread_ids();
+#if defined(__linux__)
+        // Threads take the name of the thread that creates them, so the workers are told apart from
+        // threads other code starts meanwhile by a name only this pool uses while it starts
+        char saved_name[16] = {};
+        auto tag = ("pool:" + spec_.name).substr(0, sizeof(saved_name) - 1);
+        bool named = pthread_getname_np(pthread_self(), saved_name, sizeof(saved_name)) == 0 &&
+                     pthread_setname_np(pthread_self(), tag.c_str()) == 0;
+        cpu_set_t saved;
+        CPU_ZERO(&saved);
+        bool pinned = false;
+        if (!spec_.cpus.empty() && pthread_getaffinity_np(pthread_self(), sizeof(saved), &saved) == 0) {
+            cpu_set_t target;
+            CPU_ZERO(&target);
+            for (auto cpu : spec_.cpus) {
+                if (cpu < static_cast<uint32_t>(CPU_SETSIZE)) {
+                    CPU_SET(cpu, &target);
+                }
+            }
+            pinned = pthread_setaffinity_np(pthread_self(), sizeof(target), &target) == 0;
+        }
+#endif
+        scheduler_->start();
+#if defined(__linux__)
+        if (pinned) {
+            pthread_setaffinity_np(pthread_self(), sizeof(saved), &saved);
+        }
+        if (named) {
+            pthread_setname_np(pthread_self(), saved_name);
+        }
+#endif
+        auto after = process_thread_ids();
+        std::vector<int64_t> started;
+        std::set_difference(after.begin(),
+                            after.end(),
+                            before.begin(),
+                            before.end(),
+                            std::back_inserter(started));
+#if defined(__linux__)
+        if (named) {
+            std::erase_if(started, [&tag](int64_t tid) { return read_thread_name(tid) != tag; });
+        }
+#endif
+        thread_ids_ = std::move(started);
+
+        std::lock_guard guard(stats_mutex_);
+        last_sample_time_ = std::chrono::steady_clock::now();
+        last_sample_cpu_ = thread_cpu_time();
+    }
+
+    void scheduler_pool_t::stop() {
+        scheduler_->stop();
+        thread_ids_.clear();
+    }
+
+    std::chrono::nanoseconds scheduler_pool_t::thread_cpu_time() const {
+        std::chrono::nanoseconds total{0};
+        for (auto tid : thread_ids_) {
+            total += read_thread_cpu_time(tid);
+        }
+        return total;
+    }
+
+    pool_stats_t scheduler_pool_t::stats() {
+        pool_stats_t result;
+        result.name = spec_.name;
+        result.threads = spec_.threads;
+        result.cpus = to_string(spec_.cpus);
+
+        std::lock_guard guard(stats_mutex_);
+        auto now = std::chrono::steady_clock::now();
+        result.cpu_time = thread_cpu_time();
+        auto wall = std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_sample_time_);
+        if (wall.count() > 0 && !thread_ids_.empty()) {
+            auto busy = static_cast<double>((result.cpu_time - last_sample_cpu_).count());
+            auto capacity = static_cast<double>(wall.count()) * static_cast<double>(thread_ids_.size());
+            result.utilization = std::clamp(busy / capacity, 0.0, 1.0);
+        }
+        last_sample_time_ = now;
+        last_sample_cpu_ = result.cpu_time;
+        return result;
+    }
+
+} // namespace core::scheduler
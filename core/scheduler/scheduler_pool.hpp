@@ -0,0 +1,55 @@
+#pragma once
+
+#include "topology.hpp"
+
+#include <core/executor.hpp>
+
+#include <chrono>
+#include <mutex>
+
+namespace core::scheduler {
+
+    struct pool_stats_t final {
+        std::string name;
+        std::size_t threads{0};
+        std::string cpus;
+        // Total CPU time consumed by the pool threads since start().
+        std::chrono::nanoseconds cpu_time{0};
+        // Fraction of the pool capacity (threads * wall time) that was busy since the previous sample.
+        double utilization{0.0};
+        // Only reported by the work-stealing task pool.
+        std::size_t tasks_executed{0};
+        std::size_t tasks_stolen{0};
+    };
+
+    // Owns one actor_zeta sharing scheduler sized and placed according to a pool_spec_t.
+    // Worker threads inherit the CPU affinity of the thread that starts them, so start()
+    // temporarily narrows the caller's affinity to the pool CPUs and restores it afterwards.
+    // They inherit its name as well, which is how start() finds them for the CPU time stats.
+    class scheduler_pool_t final {
+    public:
+        explicit scheduler_pool_t(pool_spec_t spec);
+        scheduler_pool_t(const scheduler_pool_t&) = delete;
+        scheduler_pool_t& operator=(const scheduler_pool_t&) = delete;
+
+        actor_zeta::scheduler_raw get() const noexcept { return scheduler_.get(); }
+        const pool_spec_t& spec() const noexcept { return spec_; }
+
+        void start();
+        void stop();
+
+        pool_stats_t stats();
+
+    private:
+        std::chrono::nanoseconds thread_cpu_time() const;
+
+        pool_spec_t spec_;
+        actor_zeta::scheduler_ptr scheduler_;
+        std::vector<int64_t> thread_ids_;
+
+        std::mutex stats_mutex_;
+        std::chrono::steady_clock::time_point last_sample_time_{};
+        std::chrono::nanoseconds last_sample_cpu_{0};
+    };
+
+} // namespace core::scheduler
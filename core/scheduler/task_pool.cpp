@@ -0,0 +1,208 @@
+#include "task_pool.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace core::scheduler {
+
+    namespace {
+
+        // Pool and deque index of the current thread when it is a pool worker.
+        thread_local const task_pool_t* current_pool = nullptr;
+        thread_local std::size_t current_index = 0;
+
+        void pin_thread(std::thread& thread, uint32_t cpu) {
+#if defined(__linux__)
+            if (cpu >= static_cast<uint32_t>(CPU_SETSIZE)) {
+                return;
+            }
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+            (void) thread;
+            (void) cpu;
+#endif
+        }
+
+    } // namespace
+
+    task_pool_t::task_pool_t(pool_spec_t spec)
+        : spec_(std::move(spec)) {
+        auto threads = std::max<std::size_t>(1, spec_.threads);
+        queues_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            queues_.push_back(std::make_unique<worker_queue_t>());
+        }
+        threads_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            threads_.emplace_back([this, i] { worker_loop(i); });
+            if (!spec_.cpus.empty()) {
+                pin_thread(threads_.back(), spec_.cpus[i % spec_.cpus.size()]);
+            }
+        }
+    }
+
+    task_pool_t::~task_pool_t() {
+        {
+            std::lock_guard guard(sleep_mutex_);
+            stop_.store(true, std::memory_order_release);
+        }
+        sleep_cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    void task_pool_t::submit(task_t task) {
+        auto index = current_pool == this ? current_index
+                                          : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        // counted before it can be taken, so a thief never brings queued_ below zero
+        queued_.fetch_add(1, std::memory_order_release);
+        {
+            auto& queue = *queues_[index];
+            std::lock_guard guard(queue.lock);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard guard(sleep_mutex_);
+        }
+        sleep_cv_.notify_one();
+    }
+
+    bool task_pool_t::run_one() {
+        task_t task;
+        auto index = current_pool == this ? current_index : next_queue_.load(std::memory_order_relaxed);
+        if ((current_pool == this && try_pop(index, task)) || try_steal(index, task)) {
+            execute(task);
+            return true;
+        }
+        return false;
+    }
+
+    void task_pool_t::worker_loop(std::size_t index) {
+        current_pool = this;
+        current_index = index;
+        task_t task;
+        while (true) {
+            if (try_pop(index, task) || try_steal(index, task)) {
+                execute(task);
+                continue;
+            }
+            std::unique_lock guard(sleep_mutex_);
+            sleep_cv_.wait(guard, [this] {
+                return stop_.load(std::memory_order_acquire) || queued_.load(std::memory_order_acquire) > 0;
+            });
+            if (stop_.load(std::memory_order_acquire) && queued_.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+        }
+        current_pool = nullptr;
+    }
+
+    bool task_pool_t::try_pop(std::size_t index, task_t& task) {
+        auto& queue = *queues_[index];
+        std::lock_guard guard(queue.lock);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queued_.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    bool task_pool_t::try_steal(std::size_t thief, task_t& task) {
+        if (queued_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        for (std::size_t offset = 1; offset <= queues_.size(); ++offset) {
+            auto& queue = *queues_[(thief + offset) % queues_.size()];
+            std::unique_lock guard(queue.lock, std::try_to_lock);
+            if (!guard.owns_lock() || queue.tasks.empty()) {
+                continue;
+            }
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            queued_.fetch_sub(1, std::memory_order_acq_rel);
+            stolen_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void task_pool_t::execute(task_t& task) {
+        task();
+        task = nullptr;
+        executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    task_group_t::~task_group_t() {
+        try {
+            wait();
+        } catch (...) {
+            // errors are reported by an explicit wait()
+        }
+    }
+
+    void task_group_t::run(task_pool_t::task_t task) {
+        if (!pool_) {
+            try {
+                task();
+            } catch (...) {
+                store_error(std::current_exception());
+            }
+            return;
+        }
+        outstanding_.fetch_add(1, std::memory_order_acq_rel);
+        pool_->submit([this, task = std::move(task)] {
+            try {
+                task();
+            } catch (...) {
+                store_error(std::current_exception());
+            }
+            // under the lock, so wait() cannot return and destroy the group before the notify
+            std::lock_guard guard(wait_mutex_);
+            if (outstanding_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                done_cv_.notify_all();
+            }
+        });
+    }
+
+    void task_group_t::wait() {
+        if (pool_) {
+            std::unique_lock guard(wait_mutex_);
+            while (outstanding_.load(std::memory_order_acquire) > 0) {
+                guard.unlock();
+                auto helped = pool_->run_one();
+                guard.lock();
+                if (!helped) {
+                    // the tasks left are running elsewhere; wake up now and then to help with tasks
+                    // they submit, which a waiting pool worker would otherwise leave queued
+                    done_cv_.wait_for(guard, HELP_INTERVAL, [this] {
+                        return outstanding_.load(std::memory_order_acquire) == 0;
+                    });
+                }
+            }
+        }
+        std::exception_ptr error;
+        {
+            std::lock_guard guard(error_mutex_);
+            std::swap(error, error_);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void task_group_t::store_error(std::exception_ptr error) {
+        std::lock_guard guard(error_mutex_);
+        if (!error_) {
+            error_ = std::move(error);
+        }
+    }
+
+} // namespace core::scheduler
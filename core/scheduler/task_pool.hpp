@@ -0,0 +1,166 @@
+#pragma once
+
+#include "topology.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core::scheduler {
+
+    // Work-stealing pool for CPU-bound pieces of a query (morsels of a scan, partitions of a
+    // hash build, runs of a sort). Unlike the actor schedulers, the unit of parallelism is a
+    // task rather than an actor mailbox: every worker owns a deque, pops its own tasks LIFO
+    // and steals FIFO from the others when it runs dry.
+    class task_pool_t final {
+    public:
+        using task_t = std::function<void()>;
+
+        explicit task_pool_t(pool_spec_t spec);
+        task_pool_t(const task_pool_t&) = delete;
+        task_pool_t& operator=(const task_pool_t&) = delete;
+        ~task_pool_t();
+
+        std::size_t size() const noexcept { return threads_.size(); }
+        const pool_spec_t& spec() const noexcept { return spec_; }
+
+        void submit(task_t task);
+
+        // Runs one queued task on the calling thread: its own deque first when it is a pool
+        // worker, otherwise steals. Threads that wait for a task group use this to help out
+        // instead of blocking, so waiting from inside a task never deadlocks.
+        bool run_one();
+
+        std::size_t tasks_executed() const noexcept { return executed_.load(std::memory_order_relaxed); }
+        std::size_t tasks_stolen() const noexcept { return stolen_.load(std::memory_order_relaxed); }
+
+    private:
+        struct worker_queue_t {
+            std::mutex lock;
+            std::deque<task_t> tasks;
+        };
+
+        void worker_loop(std::size_t index);
+        bool try_pop(std::size_t index, task_t& task);
+        bool try_steal(std::size_t thief, task_t& task);
+        void execute(task_t& task);
+
+        pool_spec_t spec_;
+        std::vector<std::unique_ptr<worker_queue_t>> queues_;
+        std::vector<std::thread> threads_;
+
+        std::atomic<std::size_t> next_queue_{0};
+        std::atomic<std::size_t> queued_{0};
+        std::atomic<std::size_t> executed_{0};
+        std::atomic<std::size_t> stolen_{0};
+        std::atomic<bool> stop_{false};
+
+        std::mutex sleep_mutex_;
+        std::condition_variable sleep_cv_;
+    };
+
+    // Set of tasks that are waited on together. Without a pool every task runs inline.
+    class task_group_t final {
+    public:
+        explicit task_group_t(task_pool_t* pool) noexcept
+            : pool_(pool) {}
+        task_group_t(const task_group_t&) = delete;
+        task_group_t& operator=(const task_group_t&) = delete;
+        ~task_group_t();
+
+        void run(task_pool_t::task_t task);
+
+        // Blocks until every task of the group finished, running queued tasks meanwhile; rethrows
+        // the first task exception.
+        void wait();
+
+    private:
+        static constexpr std::chrono::milliseconds HELP_INTERVAL{1};
+
+        void store_error(std::exception_ptr error);
+
+        task_pool_t* pool_;
+        std::atomic<std::size_t> outstanding_{0};
+        std::mutex wait_mutex_;
+        std::condition_variable done_cv_;
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+    };
+
+    // Calls fn(begin, end) for consecutive morsels of at most `grain` items covering [0, count).
+    template<typename Fn>
+    void parallel_for(task_pool_t* pool, std::size_t count, std::size_t grain, Fn&& fn) {
+        grain = std::max<std::size_t>(1, grain);
+        if (!pool || pool->size() == 0 || count <= grain) {
+            if (count > 0) {
+                fn(std::size_t{0}, count);
+            }
+            return;
+        }
+        task_group_t group(pool);
+        for (std::size_t begin = grain; begin < count; begin += grain) {
+            auto end = std::min(count, begin + grain);
+            group.run([&fn, begin, end] { fn(begin, end); });
+        }
+        fn(std::size_t{0}, grain);
+        group.wait();
+    }
+
+    // Sorts runs of at least `min_run` items in parallel, then merges neighbouring runs
+    // pairwise (also in parallel) until one sorted range is left. `comp` must be safe to
+    // call concurrently.
+    template<typename It, typename Compare>
+    void parallel_sort(task_pool_t* pool, It first, It last, Compare comp, std::size_t min_run) {
+        auto count = static_cast<std::size_t>(std::distance(first, last));
+        min_run = std::max<std::size_t>(2, min_run);
+        if (!pool || pool->size() == 0 || count < 2 * min_run) {
+            std::sort(first, last, comp);
+            return;
+        }
+        auto runs = std::min(pool->size() + 1, count / min_run);
+        auto run_size = (count + runs - 1) / runs;
+
+        std::vector<std::size_t> bounds;
+        for (std::size_t begin = 0; begin < count; begin += run_size) {
+            bounds.push_back(begin);
+        }
+        bounds.push_back(count);
+
+        parallel_for(pool, bounds.size() - 1, 1, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                std::sort(first + static_cast<std::ptrdiff_t>(bounds[i]),
+                          first + static_cast<std::ptrdiff_t>(bounds[i + 1]),
+                          comp);
+            }
+        });
+
+        while (bounds.size() > 2) {
+            auto merges = (bounds.size() - 1) / 2;
+            parallel_for(pool, merges, 1, [&](std::size_t begin, std::size_t end) {
+                for (auto i = begin; i < end; ++i) {
+                    std::inplace_merge(first + static_cast<std::ptrdiff_t>(bounds[2 * i]),
+                                       first + static_cast<std::ptrdiff_t>(bounds[2 * i + 1]),
+                                       first + static_cast<std::ptrdiff_t>(bounds[2 * i + 2]),
+                                       comp);
+                }
+            });
+            std::vector<std::size_t> merged;
+            for (std::size_t i = 0; i < bounds.size(); i += 2) {
+                merged.push_back(bounds[i]);
+            }
+            if (merged.back() != count) {
+                merged.push_back(count);
+            }
+            bounds = std::move(merged);
+        }
+    }
+
+} // namespace core::scheduler
@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+
+#include <core/scheduler/task_pool.hpp>
+
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+using namespace core::scheduler;
+
+namespace {
+    pool_spec_t make_spec(std::size_t threads) {
+        pool_spec_t spec;
+        spec.name = "task";
+        spec.threads = threads;
+        return spec;
+    }
+} // namespace
+
+TEST_CASE("core::scheduler::task_pool::task_group") {
+    task_pool_t pool(make_spec(4));
+    REQUIRE(pool.size() == 4);
+
+    std::atomic<std::size_t> sum{0};
+    task_group_t group(&pool);
+    for (std::size_t i = 1; i <= 1000; ++i) {
+        group.run([&sum, i] { sum.fetch_add(i); });
+    }
+    group.wait();
+    REQUIRE(sum.load() == 500500);
+    REQUIRE(pool.tasks_executed() >= 1000);
+}
+
+TEST_CASE("core::scheduler::task_pool::nested groups") {
+    task_pool_t pool(make_spec(2));
+    std::atomic<std::size_t> count{0};
+    task_group_t outer(&pool);
+    for (std::size_t i = 0; i < 8; ++i) {
+        outer.run([&pool, &count] {
+            task_group_t inner(&pool);
+            for (std::size_t j = 0; j < 8; ++j) {
+                inner.run([&count] { count.fetch_add(1); });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+    REQUIRE(count.load() == 64);
+}
+
+TEST_CASE("core::scheduler::task_pool::exceptions") {
+    task_pool_t pool(make_spec(2));
+    task_group_t group(&pool);
+    group.run([] { throw std::runtime_error("task failed"); });
+    group.run([] {});
+    REQUIRE_THROWS_AS(group.wait(), std::runtime_error);
+}
+
+TEST_CASE("core::scheduler::task_pool::parallel_for") {
+    task_pool_t pool(make_spec(3));
+    std::vector<int> values(10007, 0);
+    parallel_for(&pool, values.size(), 100, [&values](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            values[i] += 1;
+        }
+    });
+    REQUIRE(std::all_of(values.begin(), values.end(), [](int v) { return v == 1; }));
+
+    std::size_t inline_calls = 0;
+    parallel_for(nullptr, 50, 10, [&inline_calls](std::size_t begin, std::size_t end) {
+        REQUIRE(begin == 0);
+        REQUIRE(end == 50);
+        ++inline_calls;
+    });
+    REQUIRE(inline_calls == 1);
+}
+
+TEST_CASE("core::scheduler::task_pool::parallel_sort") {
+    task_pool_t pool(make_spec(4));
+    for (std::size_t count : {0ul, 1ul, 100ul, 4099ul, 100000ul}) {
+        std::vector<uint64_t> values(count);
+        std::mt19937_64 rng(count);
+        for (auto& value : values) {
+            value = rng() % 1000;
+        }
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        parallel_sort(&pool, values.begin(), values.end(), std::less<>{}, 512);
+        REQUIRE(values == expected);
+    }
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch.hpp>
+
+#include <core/scheduler/topology.hpp>
+
+using namespace core::scheduler;
+
+namespace {
+    cpu_list_t make_cpus(uint32_t count) {
+        cpu_list_t cpus;
+        for (uint32_t i = 0; i < count; ++i) {
+            cpus.push_back(i);
+        }
+        return cpus;
+    }
+} // namespace
+
+TEST_CASE("core::scheduler::topology::available_cpus") {
+    auto cpus = available_cpus();
+    REQUIRE_FALSE(cpus.empty());
+    REQUIRE(physical_core_count(cpus) >= 1);
+    REQUIRE(physical_core_count(cpus) <= cpus.size());
+}
+
+TEST_CASE("core::scheduler::topology::derived sizes") {
+    SECTION("single cpu") {
+        auto topology = plan_topology(topology_options_t{}, make_cpus(1));
+        REQUIRE(topology.dispatcher.threads == 1);
+        REQUIRE(topology.worker.threads == 1);
+        REQUIRE(topology.io.threads == 2);
+        REQUIRE(topology.task.threads == 1);
+    }
+    SECTION("64 cpus") {
+        auto topology = plan_topology(topology_options_t{}, make_cpus(64));
+        REQUIRE(topology.dispatcher.threads == 4);
+        REQUIRE(topology.worker.threads == 60);
+        REQUIRE(topology.io.threads == 8);
+        REQUIRE(topology.task.threads == 30);
+        REQUIRE(topology.worker.cpus.empty());
+        REQUIRE(topology.dispatcher.cpus.empty());
+    }
+    SECTION("explicit sizes win") {
+        topology_options_t options;
+        options.worker_threads = 5;
+        options.dispatcher_threads = 2;
+        options.io_threads = 3;
+        options.task_threads = 7;
+        options.max_throughput = 10;
+        auto topology = plan_topology(options, make_cpus(64));
+        REQUIRE(topology.worker.threads == 5);
+        REQUIRE(topology.dispatcher.threads == 2);
+        REQUIRE(topology.io.threads == 3);
+        REQUIRE(topology.task.threads == 7);
+        REQUIRE(topology.worker.max_throughput == 10);
+    }
+}
+
+TEST_CASE("core::scheduler::topology::pinning") {
+    topology_options_t options;
+    options.pin_threads = true;
+
+    SECTION("worker and dispatcher cpus are disjoint") {
+        auto topology = plan_topology(options, make_cpus(32));
+        REQUIRE(topology.dispatcher.cpus.size() == topology.dispatcher.threads);
+        REQUIRE(topology.worker.cpus.size() == 32 - topology.dispatcher.threads);
+        REQUIRE(topology.io.cpus.empty());
+        REQUIRE(topology.task.cpus == topology.worker.cpus);
+        REQUIRE(to_string(topology.worker.cpus) == "0-29");
+        REQUIRE(to_string(topology.dispatcher.cpus) == "30-31");
+    }
+    SECTION("pools share cpus on a tiny machine") {
+        auto topology = plan_topology(options, make_cpus(1));
+        REQUIRE(topology.worker.cpus == make_cpus(1));
+        REQUIRE(topology.dispatcher.cpus == make_cpus(1));
+    }
+}
+
+TEST_CASE("core::scheduler::topology::to_string") {
+    REQUIRE(to_string({}) == "any");
+    REQUIRE(to_string({3, 0, 1, 2, 7, 9, 10}) == "0-3,7,9-10");
+}
@@ -0,0 +1,165 @@
+#include "topology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <set>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace core::scheduler {
+
+    namespace {
+
+        using core_key_t = std::pair<int64_t, int64_t>; // (package id, core id)
+
+        std::optional<int64_t> read_topology_value(uint32_t cpu, const char* name) {
+#if defined(__linux__)
+            std::ifstream in("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+            int64_t value = 0;
+            if (in >> value) {
+                return value;
+            }
+#else
+            (void) cpu;
+            (void) name;
+#endif
+            return std::nullopt;
+        }
+
+        std::optional<core_key_t> core_key(uint32_t cpu) {
+            auto core_id = read_topology_value(cpu, "core_id");
+            if (!core_id) {
+                return std::nullopt;
+            }
+            return core_key_t{read_topology_value(cpu, "physical_package_id").value_or(0), *core_id};
+        }
+
+        std::size_t derive_or(std::size_t configured, std::size_t derived) {
+            return configured != 0 ? configured : derived;
+        }
+
+    } // namespace
+
+    cpu_list_t available_cpus() {
+        cpu_list_t cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (uint32_t cpu = 0; cpu < static_cast<uint32_t>(CPU_SETSIZE); ++cpu) {
+                if (CPU_ISSET(cpu, &set)) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+#endif
+        if (cpus.empty()) {
+            auto count = std::max(1u, std::thread::hardware_concurrency());
+            for (uint32_t cpu = 0; cpu < count; ++cpu) {
+                cpus.push_back(cpu);
+            }
+            return cpus;
+        }
+
+        // Rank every CPU by its position among the SMT siblings of its physical core,
+        // so that a stable sort puts one hardware thread of each core first.
+        std::map<core_key_t, uint32_t> seen;
+        std::vector<std::pair<uint32_t, uint32_t>> ranked; // (sibling rank, cpu)
+        ranked.reserve(cpus.size());
+        for (auto cpu : cpus) {
+            auto key = core_key(cpu);
+            uint32_t rank = key ? seen[*key]++ : 0;
+            ranked.emplace_back(rank, cpu);
+        }
+        std::stable_sort(ranked.begin(), ranked.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+        for (std::size_t i = 0; i < ranked.size(); ++i) {
+            cpus[i] = ranked[i].second;
+        }
+        return cpus;
+    }
+
+    std::size_t physical_core_count(const cpu_list_t& cpus) {
+        std::set<core_key_t> cores;
+        for (auto cpu : cpus) {
+            auto key = core_key(cpu);
+            if (!key) {
+                return cpus.size();
+            }
+            cores.insert(*key);
+        }
+        return cores.size();
+    }
+
+    topology_t plan_topology(const topology_options_t& options, const cpu_list_t& cpus) {
+        const std::size_t cpu_count = std::max<std::size_t>(1, cpus.size());
+
+        topology_t topology;
+        topology.dispatcher.name = "dispatcher";
+        topology.dispatcher.threads =
+            derive_or(options.dispatcher_threads, std::clamp<std::size_t>(cpu_count / 16, 1, 4));
+        topology.worker.name = "worker";
+        topology.worker.threads = derive_or(options.worker_threads,
+                                            cpu_count > topology.dispatcher.threads
+                                                ? cpu_count - topology.dispatcher.threads
+                                                : 1);
+        topology.io.name = "io";
+        topology.io.threads = derive_or(options.io_threads, std::clamp<std::size_t>(cpu_count / 8, 2, 8));
+
+        topology.task.name = "task";
+        topology.task.threads = derive_or(options.task_threads, std::max<std::size_t>(1, topology.worker.threads / 2));
+
+        for (auto* pool : {&topology.dispatcher, &topology.worker, &topology.io, &topology.task}) {
+            pool->max_throughput = options.max_throughput;
+        }
+
+        if (options.pin_threads && !cpus.empty()) {
+            // Workers take the head of the list (one thread per physical core first),
+            // the dispatcher takes the tail. I/O threads stay unpinned: they mostly block.
+            if (cpus.size() > topology.dispatcher.threads) {
+                auto split = cpus.begin() + static_cast<std::ptrdiff_t>(cpus.size() - topology.dispatcher.threads);
+                topology.worker.cpus.assign(cpus.begin(), split);
+                topology.dispatcher.cpus.assign(split, cpus.end());
+            } else {
+                topology.worker.cpus = cpus;
+                topology.dispatcher.cpus = cpus;
+            }
+            topology.task.cpus = topology.worker.cpus;
+        }
+        return topology;
+    }
+
+    std::string to_string(const cpu_list_t& cpus) {
+        if (cpus.empty()) {
+            return "any";
+        }
+        auto sorted = cpus;
+        std::sort(sorted.begin(), sorted.end());
+        std::string result;
+        std::size_t i = 0;
+        while (i < sorted.size()) {
+            auto j = i;
+            while (j + 1 < sorted.size() && sorted[j + 1] == sorted[j] + 1) {
+                ++j;
+            }
+            if (!result.empty()) {
+                result += ',';
+            }
+            result += std::to_string(sorted[i]);
+            if (j > i) {
+                result += '-';
+                result += std::to_string(sorted[j]);
+            }
+            i = j + 1;
+        }
+        return result;
+    }
+
+} // namespace core::scheduler
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace core::scheduler {
+
+    using cpu_list_t = std::vector<uint32_t>;
+
+    // Logical CPUs the process is allowed to run on (honours taskset / cgroup cpusets).
+    // CPUs are ordered so that the first hardware thread of every physical core comes
+    // before any SMT sibling: taking a prefix of the list spreads work over cores first.
+    cpu_list_t available_cpus();
+
+    // Number of distinct physical cores among `cpus` (falls back to cpus.size()).
+    std::size_t physical_core_count(const cpu_list_t& cpus);
+
+    struct topology_options_t final {
+        std::size_t worker_threads{0};     // 0 - derive from the available cores
+        std::size_t dispatcher_threads{0}; // 0 - derive from the available cores
+        std::size_t io_threads{0};         // 0 - derive from the available cores
+        std::size_t task_threads{0};       // 0 - half the worker pool
+        std::size_t max_throughput{1000};
+        bool pin_threads{false};
+    };
+
+    struct pool_spec_t final {
+        std::string name;
+        std::size_t threads{1};
+        std::size_t max_throughput{1000};
+        // CPUs the pool threads are pinned to; empty means "no affinity".
+        cpu_list_t cpus;
+    };
+
+    struct topology_t final {
+        pool_spec_t dispatcher;
+        pool_spec_t worker;
+        pool_spec_t io;
+        pool_spec_t task;
+    };
+
+    // Sizes the dispatcher, query worker and disk I/O pools for the given CPU set.
+    //  * dispatcher: planning/bookkeeping only, a small slice of the machine;
+    //  * worker: the remaining cores, runs collection executors and query operators;
+    //  * io: blocking disk work, sized independently and never pinned to the worker
+    //    cores so that a thread waiting on a read does not hold a query core;
+    //  * task: work-stealing pool for intra-query parallelism. It shares the worker cores,
+    //    so by default it gets half as many threads as the workers to keep them from being
+    //    oversubscribed when both pools are busy.
+    topology_t plan_topology(const topology_options_t& options, const cpu_list_t& cpus);
+
+    inline topology_t plan_topology(const topology_options_t& options) {
+        return plan_topology(options, available_cpus());
+    }
+
+    std::string to_string(const cpu_list_t& cpus);
+
+} // namespace core::scheduler
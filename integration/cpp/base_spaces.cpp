@@ -10,13 +10,13 @@
 #include <core/executor.hpp>
 #include <core/file/file_handle.hpp>
 #include <core/file/local_file_system.hpp>
+#include <map>
 #include <memory>
 #include <services/disk/manager_disk.hpp>
 #include <services/dispatcher/dispatcher.hpp>
 #include <services/index/manager_index.hpp>
 #include <services/wal/manager_wal_replicate.hpp>
 #include <services/wal/wal_reader.hpp>
-#include <thread>
 
 namespace otterbrix {
 
@@ -30,6 +30,17 @@ namespace otterbrix {
             std::vector<services::disk::catalog_column_entry_t> columns;
         };
 
+        core::scheduler::topology_options_t topology_options(const configuration::config_scheduler& config) {
+            core::scheduler::topology_options_t options;
+            options.worker_threads = config.worker_threads;
+            options.dispatcher_threads = config.dispatcher_threads;
+            options.io_threads = config.io_threads;
+            options.task_threads = config.task_threads;
+            options.max_throughput = config.max_throughput;
+            options.pin_threads = config.pin_threads;
+            return options;
+        }
+
         bool is_index_valid(const std::filesystem::path& index_path) {
             if (!std::filesystem::exists(index_path) || !std::filesystem::is_directory(index_path)) {
                 return false;
@@ -109,22 +120,134 @@ namespace otterbrix {
             return defs;
         }
 
+        // Part of a physical delete or update record that falls into one row group; `rows` are the
+        // positions of `row_ids` in the record
+        struct replay_piece_t {
+            services::wal::record_t* record;
+            std::pmr::vector<int64_t> row_ids;
+            std::vector<uint64_t> rows;
+        };
+
+        // Pieces by the start of their row group, in record order within a row group
+        using replay_partitions_t = std::map<int64_t, std::vector<replay_piece_t>>;
+
+        void partition_by_row_group(services::disk::manager_disk_t* disk,
+                                    const collection_full_name_t& name,
+                                    services::wal::record_t* record,
+                                    replay_partitions_t& partitions) {
+            const auto& ids = record->physical_row_ids;
+            uint64_t count = ids.size();
+            if (record->record_type == services::wal::wal_record_type::PHYSICAL_DELETE) {
+                count = std::min(count, record->physical_row_count);
+            } else if (record->record_type == services::wal::wal_record_type::PHYSICAL_UPDATE &&
+                       record->physical_data) {
+                count = std::min(count, record->physical_data->size());
+            } else {
+                return;
+            }
+
+            std::map<int64_t, replay_piece_t> pieces;
+            int64_t group_start = 0;
+            uint64_t group_count = 0;
+            for (uint64_t i = 0; i < count; i++) {
+                if (ids[i] < group_start || static_cast<uint64_t>(ids[i] - group_start) >= group_count) {
+                    std::tie(group_start, group_count) = disk->row_group_range_sync(name, ids[i]);
+                }
+                auto it = pieces.find(group_start);
+                if (it == pieces.end()) {
+                    replay_piece_t piece{record, std::pmr::vector<int64_t>(ids.get_allocator()), {}};
+                    it = pieces.emplace(group_start, std::move(piece)).first;
+                }
+                it->second.row_ids.push_back(ids[i]);
+                it->second.rows.push_back(i);
+            }
+            for (auto& [start, piece] : pieces) {
+                partitions[start].push_back(std::move(piece));
+            }
+        }
+
+        void
+        apply_piece(services::disk::manager_disk_t* disk, const collection_full_name_t& name, replay_piece_t& piece) {
+            if (piece.record->record_type == services::wal::wal_record_type::PHYSICAL_DELETE) {
+                disk->direct_delete_sync(name, piece.row_ids, piece.row_ids.size());
+                return;
+            }
+            auto& data = *piece.record->physical_data;
+            auto count = static_cast<uint64_t>(piece.rows.size());
+            if (count == data.size()) {
+                disk->direct_update_sync(name, piece.row_ids, data);
+                return;
+            }
+            components::vector::indexing_vector_t indexing(disk->resource(), count);
+            for (uint64_t i = 0; i < count; i++) {
+                indexing.set_index(i, piece.rows[i]);
+            }
+            components::vector::data_chunk_t part(disk->resource(), data.types(), count);
+            part.slice(data, indexing, count);
+            part.flatten();
+            disk->direct_update_sync(name, piece.row_ids, part);
+        }
+
+        // Inserts append in record order. The deletes and updates between two inserts only touch rows
+        // that exist already, so they are split by row group and the row groups replay in parallel.
+        void replay_collection(services::disk::manager_disk_t* disk,
+                               const collection_full_name_t& name,
+                               const std::vector<services::wal::record_t*>& records,
+                               core::scheduler::task_pool_t* pool) {
+            size_t pos = 0;
+            while (pos < records.size()) {
+                auto* record = records[pos];
+                if (record->record_type == services::wal::wal_record_type::PHYSICAL_INSERT) {
+                    if (record->physical_data) {
+                        disk->direct_append_sync(name, *record->physical_data);
+                    }
+                    ++pos;
+                    continue;
+                }
+
+                replay_partitions_t partitions;
+                for (; pos < records.size() &&
+                       records[pos]->record_type != services::wal::wal_record_type::PHYSICAL_INSERT;
+                     ++pos) {
+                    partition_by_row_group(disk, name, records[pos], partitions);
+                }
+                core::scheduler::task_group_t group(partitions.size() > 1 ? pool : nullptr);
+                for (auto& [start, pieces] : partitions) {
+                    group.run([disk, &name, &pieces] {
+                        for (auto& piece : pieces) {
+                            apply_piece(disk, name, piece);
+                        }
+                    });
+                }
+                group.wait();
+            }
+        }
+
     } // anonymous namespace
 
     base_otterbrix_t::base_otterbrix_t(const configuration::config& config)
         : main_path_(config.main_path)
         , resource()
-        , scheduler_(new actor_zeta::shared_work(3, 1000))
-        , scheduler_dispatcher_(new actor_zeta::shared_work(3, 1000))
+        , topology_(core::scheduler::plan_topology(topology_options(config.scheduler)))
+        , scheduler_(topology_.worker)
+        , scheduler_dispatcher_(topology_.dispatcher)
+        , task_pool_(topology_.task)
         , manager_dispatcher_(nullptr, actor_zeta::pmr::deleter_t(&resource))
         , manager_disk_()
         , manager_wal_()
         , manager_index_(nullptr, actor_zeta::pmr::deleter_t(&resource))
         , wrapper_dispatcher_(nullptr, actor_zeta::pmr::deleter_t(&resource))
-        , scheduler_disk_(new actor_zeta::shared_work(3, 1000)) {
+        , scheduler_disk_(topology_.io) {
         log_ = initialization_logger("python", config.log.path.c_str());
         log_.set_level(config.log.level);
         trace(log_, "spaces::spaces()");
+        for (const auto* pool : {&topology_.worker, &topology_.dispatcher, &topology_.io, &topology_.task}) {
+            debug(log_,
+                  "spaces::scheduler {}: {} threads, cpus: {}",
+                  pool->name,
+                  pool->threads,
+                  core::scheduler::to_string(pool->cpus));
+        }
         {
             std::lock_guard lock(m_);
             if (paths_.find(main_path_) == paths_.end()) {
@@ -241,6 +364,8 @@ namespace otterbrix {
             actor_zeta::spawn<services::dispatcher::manager_dispatcher_t>(&resource, scheduler_dispatcher_.get(), log_);
         trace(log_, "spaces::manager_dispatcher finish");
 
+        manager_dispatcher_->set_task_pool(&task_pool_);
+
         wrapper_dispatcher_ = actor_zeta::spawn<wrapper_dispatcher_t>(&resource, manager_dispatcher_->address(), log_);
         trace(log_, "spaces::manager_dispatcher create dispatcher");
 
@@ -397,7 +522,7 @@ namespace otterbrix {
         manager_dispatcher_->init_from_state(std::move(databases), std::move(collections));
 
         // Replay physical WAL records directly to storage (before schedulers start)
-        // Group by collection and replay per-collection in parallel for faster recovery
+        // Group by collection and replay collections, and row groups within them, on the task pool
         if (disk_ptr && !wal_records.empty()) {
             std::unordered_map<collection_full_name_t, std::vector<services::wal::record_t*>, collection_name_hash>
                 by_collection;
@@ -407,34 +532,13 @@ namespace otterbrix {
                 by_collection[record.collection_name].push_back(&record);
             }
 
-            std::vector<std::thread> workers;
-            workers.reserve(by_collection.size());
+            core::scheduler::task_group_t replay(&task_pool_);
             for (auto& [name, records] : by_collection) {
-                workers.emplace_back([disk_ptr, &name, &records] {
-                    for (auto* r : records) {
-                        switch (r->record_type) {
-                            case services::wal::wal_record_type::PHYSICAL_INSERT:
-                                if (r->physical_data) {
-                                    disk_ptr->direct_append_sync(name, *r->physical_data);
-                                }
-                                break;
-                            case services::wal::wal_record_type::PHYSICAL_DELETE:
-                                disk_ptr->direct_delete_sync(name, r->physical_row_ids, r->physical_row_count);
-                                break;
-                            case services::wal::wal_record_type::PHYSICAL_UPDATE:
-                                if (r->physical_data) {
-                                    disk_ptr->direct_update_sync(name, r->physical_row_ids, *r->physical_data);
-                                }
-                                break;
-                            default:
-                                break;
-                        }
-                    }
+                replay.run([this, disk_ptr, &name, &records] {
+                    replay_collection(disk_ptr, name, records, &task_pool_);
                 });
             }
-            for (auto& w : workers) {
-                w.join();
-            }
+            replay.wait();
 
             uint64_t physical_count = 0;
             for (auto& [name, records] : by_collection) {
@@ -448,9 +552,9 @@ namespace otterbrix {
             }
         }
 
-        scheduler_dispatcher_->start();
-        scheduler_->start();
-        scheduler_disk_->start();
+        scheduler_dispatcher_.start();
+        scheduler_.start();
+        scheduler_disk_.start();
 
         // Overlay NOT NULL constraints from catalog onto storage column definitions.
         if (disk_ptr) {
@@ -490,6 +594,16 @@ namespace otterbrix {
 
     wrapper_dispatcher_t* base_otterbrix_t::dispatcher() { return wrapper_dispatcher_.get(); }
 
+    std::vector<core::scheduler::pool_stats_t> base_otterbrix_t::scheduler_stats() {
+        core::scheduler::pool_stats_t task_stats;
+        task_stats.name = task_pool_.spec().name;
+        task_stats.threads = task_pool_.size();
+        task_stats.cpus = core::scheduler::to_string(task_pool_.spec().cpus);
+        task_stats.tasks_executed = task_pool_.tasks_executed();
+        task_stats.tasks_stolen = task_pool_.tasks_stolen();
+        return {scheduler_.stats(), scheduler_dispatcher_.stats(), scheduler_disk_.stats(), std::move(task_stats)};
+    }
+
     base_otterbrix_t::~base_otterbrix_t() {
         trace(log_, "delete spaces");
         // Checkpoint all disk tables before shutdown
@@ -503,9 +617,9 @@ namespace otterbrix {
                 // Best-effort: don't throw from destructor
             }
         }
-        scheduler_->stop();
-        scheduler_dispatcher_->stop();
-        scheduler_disk_->stop();
+        scheduler_.stop();
+        scheduler_dispatcher_.stop();
+        scheduler_disk_.stop();
         std::lock_guard lock(m_);
         paths_.erase(main_path_);
     }
@@ -8,6 +8,8 @@
 
 #include <core/config.hpp>
 #include <core/file/file_system.hpp>
+#include <core/scheduler/scheduler_pool.hpp>
+#include <core/scheduler/task_pool.hpp>
 
 #include <memory>
 
@@ -48,6 +50,7 @@ namespace otterbrix {
 
         log_t& get_log();
         otterbrix::wrapper_dispatcher_t* dispatcher();
+        std::vector<core::scheduler::pool_stats_t> scheduler_stats();
         ~base_otterbrix_t();
 
     protected:
@@ -71,15 +74,17 @@ namespace otterbrix {
         std::pmr::synchronized_pool_resource resource;
 #endif
         log_t log_;
-        actor_zeta::scheduler_ptr scheduler_;
-        actor_zeta::scheduler_ptr scheduler_dispatcher_;
+        core::scheduler::topology_t topology_;
+        core::scheduler::scheduler_pool_t scheduler_;
+        core::scheduler::scheduler_pool_t scheduler_dispatcher_;
+        core::scheduler::task_pool_t task_pool_;
         services::dispatcher::manager_dispatcher_ptr manager_dispatcher_;
         std::variant<std::monostate, services::disk::manager_disk_empty_ptr, services::disk::manager_disk_ptr>
             manager_disk_;
         std::variant<std::monostate, services::wal::manager_wal_empty_ptr, services::wal::manager_wal_ptr> manager_wal_;
         services::index::manager_index_ptr manager_index_;
         std::unique_ptr<otterbrix::wrapper_dispatcher_t, actor_zeta::pmr::deleter_t> wrapper_dispatcher_;
-        actor_zeta::scheduler_ptr scheduler_disk_;
+        core::scheduler::scheduler_pool_t scheduler_disk_;
 
     private:
         inline static std::unordered_set<std::filesystem::path, core::filesystem::path_hash> paths_ = {};
@@ -247,6 +247,32 @@ TEST_CASE("integration::cpp::test_arithmetic") {
         }
     }
 
+    INFO("A9. fused shapes and folded constants") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(
+            session,
+            R"_(SELECT count_double * (1 - 0.05) * (1 + 0.08) AS charge, )_"
+            R"_(  count - (count + 2 * 3) AS minus_six, )_"
+            R"_(  100 / (count - 50) AS ratio, )_"
+            R"_(  count * 2 - count_double AS mixed )_"
+            R"_(FROM TestDatabase.TestCollection )_"
+            R"_(ORDER BY count ASC;)_");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == kNumInserts);
+        for (size_t i = 0; i < cur->size(); i++) {
+            auto v = static_cast<int64_t>(i + 1);
+            double d = static_cast<double>(v) + 0.1;
+            REQUIRE(core::is_equals(cur->chunk_data().data[0].data<double>()[i], d * (1 - 0.05) * (1 + 0.08)));
+            REQUIRE(cur->chunk_data().data[1].data<int64_t>()[i] == -6);
+            if (v == 50) {
+                REQUIRE(cur->chunk_data().value(2, i).is_null());
+            } else {
+                REQUIRE(cur->chunk_data().data[2].data<int64_t>()[i] == 100 / (v - 50));
+            }
+            REQUIRE(core::is_equals(cur->chunk_data().data[3].data<double>()[i], static_cast<double>(v * 2) - d));
+        }
+    }
+
     // ================================================================
     // B. WHERE — arithmetic in filter predicates
     // ================================================================
@@ -904,7 +930,7 @@ TEST_CASE("integration::cpp::test_arithmetic::case_when") {
             auto v = static_cast<int64_t>(i + 1);
             REQUIRE(cur->chunk_data().data[0].data<int64_t>()[i] == v);
             std::string_view expected = v * 2 > 100 ? "high" : "low";
-            REQUIRE(cur->chunk_data().data[1].data<std::string_view>()[i] == expected);
+            REQUIRE(cur->chunk_data().data[1].data<types::string_t>()[i].view() == expected);
         }
     }
 
@@ -931,7 +957,7 @@ TEST_CASE("integration::cpp::test_arithmetic::case_when") {
                 expected = "tier2";
             else
                 expected = "tier1";
-            REQUIRE(cur->chunk_data().data[1].data<std::string_view>()[i] == expected);
+            REQUIRE(cur->chunk_data().data[1].data<types::string_t>()[i].view() == expected);
         }
     }
 }
@@ -1007,3 +1033,58 @@ TEST_CASE("integration::cpp::test_arithmetic::edge_cases") {
         REQUIRE(cur->chunk_data().data[0].data<int64_t>()[0] == 10200);
     }
 }
+
+TEST_CASE("integration::cpp::test_arithmetic::update_division_by_zero") {
+    auto config = test_create_config("/tmp/test_arithmetic/update_division_by_zero");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        dispatcher->execute_sql(session,
+                                "CREATE TABLE TestDatabase.TestCollection "
+                                "(id bigint, a bigint, b bigint, q bigint, r bigint);");
+        auto cur = dispatcher->execute_sql(session,
+                                           "INSERT INTO TestDatabase.TestCollection (id, a, b) VALUES "
+                                           "(1, 10, 2), (2, 10, 0), (3, 7, 3), (4, 7, 0);");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 4);
+        cur = dispatcher->execute_sql(session, "INSERT INTO TestDatabase.TestCollection (id, a) VALUES (5, 9);");
+        REQUIRE(cur->is_success());
+    }
+
+    INFO("zero divisors give 0, NULL divisors give NULL") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "UPDATE TestDatabase.TestCollection SET q = a / b;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 5);
+        cur = dispatcher->execute_sql(session, "UPDATE TestDatabase.TestCollection SET r = a % b;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 5);
+
+        cur = dispatcher->execute_sql(session, "SELECT id, q, r FROM TestDatabase.TestCollection ORDER BY id ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 5);
+        const std::vector<int64_t> quotients{5, 0, 2, 0};
+        const std::vector<int64_t> remainders{0, 0, 1, 0};
+        for (size_t row = 0; row < 4; ++row) {
+            REQUIRE(cur->chunk_data().value(1, row).value<int64_t>() == quotients[row]);
+            REQUIRE(cur->chunk_data().value(2, row).value<int64_t>() == remainders[row]);
+        }
+        REQUIRE(cur->chunk_data().value(1, 4).is_null());
+        REQUIRE(cur->chunk_data().value(2, 4).is_null());
+    }
+
+    INFO("computed zero divisor") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "UPDATE TestDatabase.TestCollection SET q = a / (b - b);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(session, "SELECT q FROM TestDatabase.TestCollection WHERE q = 0;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 4);
+    }
+}
@@ -350,6 +350,102 @@ TEST_CASE("integration::cpp::test_collection::sql::base") {
     }
 }
 
+TEST_CASE("integration::cpp::test_collection::sql::update_from_delete_using") {
+    auto config = test_create_config("/tmp/test_collection_sql/update_from");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, database_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, collection_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, "staging");
+        }
+    }
+
+    INFO("insert") {
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (name, count) VALUES ";
+            for (int num = 0; num < 100; ++num) {
+                query << "('Name " << num << "', " << num << ")" << (num == 99 ? ";" : ", ");
+            }
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 100);
+        }
+        {
+            // 'Name 4' appears twice: the target row is still updated and deleted once
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.Staging (name, bonus) VALUES ";
+            for (int num = 0; num < 10; ++num) {
+                query << "('Name " << num * 2 << "', " << (num + 1) * 1000 << "), ";
+            }
+            query << "('Name 4', 1000);";
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 11);
+        }
+    }
+
+    INFO("update from") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "UPDATE TestDatabase.TestCollection "
+                                               "SET count = TestCollection.count + Staging.bonus "
+                                               "FROM TestDatabase.Staging "
+                                               "WHERE TestCollection.name = Staging.name;");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 10);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "SELECT * FROM TestDatabase.TestCollection "
+                                               "WHERE count >= 1000;");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 10);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "SELECT * FROM TestDatabase.TestCollection "
+                                               "WHERE count = 10018;");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+        }
+    }
+
+    INFO("delete using") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "DELETE FROM TestDatabase.TestCollection "
+                                               "USING TestDatabase.Staging "
+                                               "WHERE TestCollection.name = Staging.name;");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 10);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->size(session, database_name, collection_name) == 90);
+        }
+    }
+}
+
 TEST_CASE("integration::cpp::test_collection::sql::group_by") {
     auto config = test_create_config("/tmp/test_collection_sql/group_by");
     test_clear_directory(config);
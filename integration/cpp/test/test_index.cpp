@@ -162,6 +162,70 @@ TEST_CASE("integration::cpp::test_index::base") {
     }
 }
 
+TEST_CASE("integration::cpp::test_index::access paths") {
+    auto config = test_create_config("/tmp/otterbrix/integration/test_index/access_paths");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        INIT_COLLECTION();
+        CREATE_INDEX("ncount", "count");
+        FILL_COLLECTION();
+    }
+
+    INFO("two-sided range") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.testcollection "
+                                           "WHERE count >= 10 AND count < 20;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 10);
+    }
+
+    INFO("in list") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.testcollection "
+                                           "WHERE count IN (3, 5, 5, 200);");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 2);
+    }
+
+    INFO("residual filter") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.testcollection "
+                                           "WHERE count > 90 AND count <> 95 LIMIT 5;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 5);
+    }
+
+    INFO("order by index key") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.testcollection "
+                                           "WHERE count > 50 ORDER BY count LIMIT 3;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        REQUIRE(cur->chunk_data().value(0, 0).value<int64_t>() == 51);
+        REQUIRE(cur->chunk_data().value(0, 1).value<int64_t>() == 52);
+        REQUIRE(cur->chunk_data().value(0, 2).value<int64_t>() == 53);
+    }
+
+    INFO("index-only aggregate") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT COUNT(count) AS cnt FROM testdatabase.testcollection "
+                                           "WHERE count > 90;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        REQUIRE(cur->chunk_data().value(0, 0).value<uint64_t>() == 10);
+    }
+}
+
 TEST_CASE("integration::cpp::test_index::save_load") {
     auto config = test_create_config("/tmp/otterbrix/integration/test_index/save_load");
     test_clear_directory(config);
@@ -421,3 +485,194 @@ TEST_CASE("integration::cpp::test_index::delete_and_update") {
         CHECK_FIND_COUNT(compare_type::eq, side_t::left, logical_value_t(dispatcher->resource(), 999), 1);
     }
 }
+
+TEST_CASE("integration::cpp::test_index::hash index access paths") {
+    auto config = test_create_config("/tmp/otterbrix/integration/test_index/hash_access_paths");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "CREATE DATABASE testdatabase;")->is_success());
+        auto cur = dispatcher->execute_sql(session, "CREATE TABLE testdatabase.customers (id bigint, name string);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(session, "CREATE TABLE testdatabase.orders (order_id bigint, customer bigint);");
+        REQUIRE(cur->is_success());
+        std::string customers = "INSERT INTO testdatabase.customers (id, name) VALUES ";
+        for (int num = 0; num < 50; ++num) {
+            customers += "(" + std::to_string(num) + ", 'Name " + std::to_string(num) + "')" + (num == 49 ? ";" : ", ");
+        }
+        REQUIRE(dispatcher->execute_sql(session, customers)->size() == 50);
+        cur = dispatcher->execute_sql(session, "CREATE INDEX cid ON testdatabase.customers USING hash (id);");
+        REQUIRE(cur->is_success());
+        // rows appended after the index was built must be found through it as well
+        customers = "INSERT INTO testdatabase.customers (id, name) VALUES ";
+        for (int num = 50; num < 100; ++num) {
+            customers += "(" + std::to_string(num) + ", 'Name " + std::to_string(num) + "')" + (num == 99 ? ";" : ", ");
+        }
+        REQUIRE(dispatcher->execute_sql(session, customers)->size() == 50);
+        std::string orders = "INSERT INTO testdatabase.orders (order_id, customer) VALUES ";
+        for (int num = 0; num < 30; ++num) {
+            orders += "(" + std::to_string(num) + ", " + std::to_string(num * 4) + ")" + (num == 29 ? ";" : ", ");
+        }
+        REQUIRE(dispatcher->execute_sql(session, orders)->size() == 30);
+    }
+
+    INFO("point lookup") {
+        auto session = otterbrix::session_id_t();
+        for (int id : {7, 42, 77}) {
+            auto cur = dispatcher->execute_sql(session,
+                                               "SELECT * FROM testdatabase.customers WHERE id = " +
+                                                   std::to_string(id) + ";");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+            REQUIRE(cur->chunk_data().value(0, 0).value<int64_t>() == id);
+            REQUIRE(cur->chunk_data().value(1, 0).value<std::string_view>() == "Name " + std::to_string(id));
+        }
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.customers WHERE id = 500;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 0);
+    }
+
+    INFO("in list") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.customers "
+                                           "WHERE id IN (3, 55, 55, 200) ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 2);
+        REQUIRE(cur->chunk_data().value(0, 0).value<int64_t>() == 3);
+        REQUIRE(cur->chunk_data().value(0, 1).value<int64_t>() == 55);
+    }
+
+    INFO("range is not answered by key order") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.customers WHERE id > 90;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 9);
+        cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.customers WHERE id <> 10;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 99);
+    }
+
+    INFO("index nested-loop join") {
+        auto session = otterbrix::session_id_t();
+        // customers 0, 4, ..., 96 exist; orders of customers 100..116 find no match
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.orders INNER JOIN testdatabase.customers "
+                                           "ON orders.customer = customers.id ORDER BY order_id ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 25);
+        for (size_t num = 0; num < 25; ++num) {
+            auto customer = static_cast<int64_t>(num) * 4;
+            REQUIRE(cur->chunk_data().value(0, num).value<int64_t>() == static_cast<int64_t>(num));
+            REQUIRE(cur->chunk_data().value(1, num).value<int64_t>() == customer);
+            REQUIRE(cur->chunk_data().value(2, num).value<int64_t>() == customer);
+            REQUIRE(cur->chunk_data().value(3, num).value<std::string_view>() == "Name " + std::to_string(customer));
+        }
+    }
+
+    INFO("delete is seen by lookups") {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "DELETE FROM testdatabase.customers WHERE id = 42;")->size() == 1);
+        REQUIRE(dispatcher->execute_sql(session, "SELECT * FROM testdatabase.customers WHERE id = 42;")->size() == 0);
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.orders INNER JOIN testdatabase.customers "
+                                           "ON orders.customer = customers.id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 25);
+        cur = dispatcher->execute_sql(session, "DELETE FROM testdatabase.customers WHERE id = 44;");
+        REQUIRE(cur->size() == 1);
+        cur = dispatcher->execute_sql(session,
+                                      "SELECT * FROM testdatabase.orders INNER JOIN testdatabase.customers "
+                                      "ON orders.customer = customers.id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 24);
+    }
+}
+
+TEST_CASE("integration::cpp::test_index::art index access paths") {
+    auto config = test_create_config("/tmp/otterbrix/integration/test_index/art_access_paths");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->execute_sql(session, "CREATE DATABASE testdatabase;")->is_success());
+        auto cur = dispatcher->execute_sql(session,
+                                           "CREATE TABLE testdatabase.items (id bigint, name string, tags int[4]);");
+        REQUIRE(cur->is_success());
+        // negative keys check that the encoding keeps signed order
+        std::string items = "INSERT INTO testdatabase.items (id, name) VALUES ";
+        for (int num = -50; num < 50; ++num) {
+            items += "(" + std::to_string(num) + ", 'Name " + std::to_string(num + 50) + "')";
+            items += num == 49 ? ";" : ", ";
+        }
+        REQUIRE(dispatcher->execute_sql(session, items)->size() == 100);
+        cur = dispatcher->execute_sql(session, "CREATE INDEX iid ON testdatabase.items USING ART (id);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(session, "CREATE INDEX iname ON testdatabase.items USING ART (name);");
+        REQUIRE(cur->is_success());
+    }
+
+    INFO("unsupported key type") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "CREATE INDEX itags ON testdatabase.items USING ART (tags);");
+        REQUIRE(cur->is_error());
+    }
+
+    INFO("point lookup") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE id = -7;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        REQUIRE(cur->chunk_data().value(1, 0).value<std::string_view>() == "Name 43");
+        cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE name = 'Name 43';");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        REQUIRE(cur->chunk_data().value(0, 0).value<int64_t>() == -7);
+    }
+
+    INFO("range across zero") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT * FROM testdatabase.items WHERE id >= -5 AND id < 5 ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 10);
+        for (size_t num = 0; num < 10; ++num) {
+            REQUIRE(cur->chunk_data().value(0, num).value<int64_t>() == static_cast<int64_t>(num) - 5);
+        }
+        cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE id < -40;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 10);
+        cur = dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE name >= 'Name 90';");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 10);
+    }
+
+    INFO("order by index key") {
+        auto session = otterbrix::session_id_t();
+        auto cur =
+            dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE id > -3 ORDER BY id LIMIT 3;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        REQUIRE(cur->chunk_data().value(0, 0).value<int64_t>() == -2);
+        REQUIRE(cur->chunk_data().value(0, 1).value<int64_t>() == -1);
+        REQUIRE(cur->chunk_data().value(0, 2).value<int64_t>() == 0);
+    }
+
+    INFO("update moves the key") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "UPDATE testdatabase.items SET id = 1000 WHERE id = -50;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        REQUIRE(dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE id = -50;")->size() == 0);
+        REQUIRE(dispatcher->execute_sql(session, "SELECT * FROM testdatabase.items WHERE id >= 1000;")->size() == 1);
+    }
+}
@@ -49,3 +49,28 @@ TEST_CASE("integration::cpp::test_instances") {
         }
     }
 }
+
+TEST_CASE("integration::cpp::test_instances::scheduler_topology") {
+    auto config = test_create_config("/tmp/test_instances/scheduler");
+    test_clear_directory(config);
+    config.scheduler.worker_threads = 2;
+    config.scheduler.dispatcher_threads = 1;
+    config.scheduler.io_threads = 1;
+    config.scheduler.pin_threads = true;
+
+    test_spaces space(config);
+    auto stats = space.scheduler_stats();
+    REQUIRE(stats.size() == 4);
+    REQUIRE(stats[0].name == "worker");
+    REQUIRE(stats[0].threads == 2);
+    REQUIRE(stats[1].name == "dispatcher");
+    REQUIRE(stats[1].threads == 1);
+    REQUIRE(stats[2].name == "io");
+    REQUIRE(stats[2].threads == 1);
+    REQUIRE(stats[3].name == "task");
+    REQUIRE(stats[3].threads == 2);
+    for (const auto& pool : stats) {
+        REQUIRE(pool.utilization >= 0.0);
+        REQUIRE(pool.utilization <= 1.0);
+    }
+}
@@ -278,6 +278,109 @@ TEST_CASE("integration::cpp::test_persistence::wal_recovery_dml_full_cycle") {
     }
 }
 
+TEST_CASE("integration::cpp::test_persistence::wal_recovery_across_row_groups") {
+    // Recovery replays the deletes and updates between two inserts per row group, in parallel. The
+    // statements below touch several row groups of 1024 rows each, and two of them split one WAL record
+    // over a row group boundary. The test checks the recovered rows only: a serial replay passes it
+    // too, so it guards the split of records by row group, not that the row groups ran in parallel.
+    auto config = test_create_config("/tmp/otterbrix/integration/test_persistence/wal_row_groups");
+    test_clear_directory(config);
+
+    constexpr int64_t first_batch = 5000;
+    constexpr int64_t total = 5100;
+    auto exists = [](int64_t id) {
+        return id >= 10 && !(id >= 1000 && id < 1100) && !(id >= 2090 && id < 2100) && id < total;
+    };
+    auto expected_val = [](int64_t id) {
+        if (id >= 5050) {
+            return int64_t{0};
+        }
+        if (id < 20 || id >= 4990) {
+            return int64_t{7};
+        }
+        return id * 10 + (id >= 2000 && id < 2100 ? 1 : 0);
+    };
+
+    INFO("phase 1: insert, then delete and update across row groups (no checkpoint)") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, database_name);
+        }
+
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur =
+                dispatcher->execute_sql(session, "CREATE TABLE TestDatabase.TestCollection (id bigint, val bigint);");
+            REQUIRE(cur->is_success());
+        }
+
+        auto insert = [&](int64_t begin, int64_t end) {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (id, val) VALUES ";
+            for (int64_t i = begin; i < end; ++i) {
+                query << "(" << i << ", " << i * 10 << ")" << (i == end - 1 ? ";" : ", ");
+            }
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == static_cast<size_t>(end - begin));
+        };
+        auto execute = [&](const std::string& query, size_t count) {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, query);
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == count);
+        };
+
+        for (int64_t begin = 0; begin < first_batch; begin += 1000) {
+            insert(begin, begin + 1000);
+        }
+        execute("DELETE FROM TestDatabase.TestCollection WHERE id < 10;", 10);
+        // rows 1000..1099 straddle the row groups starting at 0 and 1024
+        execute("DELETE FROM TestDatabase.TestCollection WHERE id >= 1000 AND id < 1100;", 100);
+        // rows 2000..2099 straddle the row groups starting at 1024 and 2048
+        execute("UPDATE TestDatabase.TestCollection SET val = val + 1 WHERE id >= 2000 AND id < 2100;", 100);
+        // the first and the last row group, nothing in between
+        execute("UPDATE TestDatabase.TestCollection SET val = 7 WHERE id < 20 OR id >= 4990;", 20);
+        // rows updated above, in the same replay batch
+        execute("DELETE FROM TestDatabase.TestCollection WHERE id >= 2090 AND id < 2100;", 10);
+        insert(first_batch, total);
+        execute("UPDATE TestDatabase.TestCollection SET val = 0 WHERE id >= 5050;", 50);
+
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection;", 4980);
+    }
+
+    INFO("phase 2: restart and compare the rows around every boundary touched") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection;", 4980);
+        const std::pair<int64_t, int64_t> windows[] = {{0, 40}, {1000, 1130}, {2000, 2110}, {4980, total}};
+        for (auto [begin, end] : windows) {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "SELECT id, val FROM TestDatabase.TestCollection WHERE id >= " << begin << " AND id < " << end
+                  << " ORDER BY id ASC;";
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            size_t row = 0;
+            for (int64_t id = begin; id < end; ++id) {
+                if (!exists(id)) {
+                    continue;
+                }
+                REQUIRE(row < cur->size());
+                REQUIRE(cur->chunk_data().value(0, row).value<int64_t>() == id);
+                REQUIRE(cur->chunk_data().value(1, row).value<int64_t>() == expected_val(id));
+                ++row;
+            }
+            REQUIRE(cur->size() == row);
+        }
+    }
+}
+
 TEST_CASE("integration::cpp::test_persistence::default_application_in_session") {
     auto config = test_create_config("/tmp/otterbrix/integration/test_persistence/default_application");
     test_clear_directory(config);
@@ -663,6 +766,69 @@ TEST_CASE("integration::cpp::test_persistence::disk_checkpoint_basic") {
     }
 }
 
+TEST_CASE("integration::cpp::test_persistence::disk_checkpoint_mmap_reads") {
+    auto config = test_create_config("/tmp/otterbrix/integration/test_persistence/disk_mmap_reads");
+    test_clear_directory(config);
+    config.disk.mmap_reads = true;
+
+    auto insert_rows = [](auto* dispatcher, int from, int to) {
+        auto session = otterbrix::session_id_t();
+        std::stringstream query;
+        query << "INSERT INTO TestDatabase.TestCollection (name, count) VALUES ";
+        for (int i = from; i < to; ++i) {
+            query << "('row_" << i << "', " << i << ")" << (i == to - 1 ? ";" : ", ");
+        }
+        auto cur = dispatcher->execute_sql(session, query.str());
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == static_cast<size_t>(to - from));
+    };
+    auto checkpoint = [](auto* dispatcher) {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "CHECKPOINT;");
+        REQUIRE(cur->is_success());
+    };
+
+    INFO("phase 1: create DISK table, insert 50 rows, checkpoint") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, database_name);
+        }
+
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "CREATE TABLE TestDatabase.TestCollection (name string, count bigint) "
+                                               "WITH (storage = 'disk');");
+            REQUIRE(cur->is_success());
+        }
+
+        insert_rows(dispatcher, 0, 50);
+        checkpoint(dispatcher);
+    }
+
+    INFO("phase 2: restart reading table.otbx through a mapping, append and checkpoint again") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection;", 50);
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection WHERE count = 25;", 1);
+        insert_rows(dispatcher, 50, 60);
+        checkpoint(dispatcher);
+    }
+
+    INFO("phase 3: restart and verify all 60 rows") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection;", 60);
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection WHERE count = 0;", 1);
+        CHECK_FIND_SQL("SELECT * FROM TestDatabase.TestCollection WHERE count = 59;", 1);
+    }
+}
+
 TEST_CASE("integration::cpp::test_persistence::disk_checkpoint_after_update") {
     auto config = test_create_config("/tmp/otterbrix/integration/test_persistence/disk_update");
     test_clear_directory(config);
@@ -1,6 +1,11 @@
 #include "test_config.hpp"
 
 #include <catch2/catch.hpp>
+#include <components/logical_plan/node_insert.hpp>
+
+#include <cmath>
+#include <map>
+#include <numeric>
 
 static const database_name_t database_name = "testdatabase";
 static const collection_name_t collection_name = "testcollection";
@@ -325,6 +330,58 @@ TEST_CASE("integration::cpp::test_sql_features::distinct") {
     }
 }
 
+TEST_CASE("integration::cpp::test_sql_features::distinct_floating_point") {
+    auto config = test_create_config("/tmp/test_sql_features/distinct_floating_point");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+    auto* resource = dispatcher->resource();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        dispatcher->execute_sql(session, "CREATE TABLE TestDatabase.TestCollection (name string, value double);");
+
+        // NaN, 0.0 and -0.0 can not be written as SQL literals
+        const std::vector<double> values{std::nan(""), 1.5, -std::nan(""), 0.0, -0.0, 1.5, std::nan("")};
+        std::pmr::vector<components::types::complex_logical_type> types(resource);
+        types.emplace_back(components::types::logical_type::STRING_LITERAL, "name");
+        types.emplace_back(components::types::logical_type::DOUBLE, "value");
+        components::vector::data_chunk_t chunk(resource, types, values.size());
+        chunk.set_cardinality(values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+            chunk.set_value(0, i, components::types::logical_value_t(resource, std::string{"same"}));
+            chunk.set_value(1, i, components::types::logical_value_t(resource, values[i]));
+        }
+        auto ins = components::logical_plan::make_node_insert(resource,
+                                                              {database_name, collection_name},
+                                                              std::move(chunk));
+        auto cur = dispatcher->execute_plan(session, ins);
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == values.size());
+    }
+
+    INFO("every NaN is one value and -0.0 equals 0.0") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "SELECT DISTINCT value FROM TestDatabase.TestCollection;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        size_t nans = 0;
+        for (size_t i = 0; i < cur->size(); i++) {
+            if (std::isnan(cur->chunk_data().value(0, i).value<double>())) {
+                ++nans;
+            }
+        }
+        REQUIRE(nans == 1);
+
+        cur = dispatcher->execute_sql(session, "SELECT DISTINCT name, value FROM TestDatabase.TestCollection;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+    }
+}
+
 TEST_CASE("integration::cpp::test_sql_features::count_distinct") {
     auto config = test_create_config("/tmp/test_sql_features/count_distinct");
     test_clear_directory(config);
@@ -656,6 +713,36 @@ TEST_CASE("integration::cpp::test_sql_features::coalesce") {
         REQUIRE(cur->is_success());
         REQUIRE(cur->size() == 4);
     }
+
+    INFO("COALESCE over columns of different numeric types") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(
+                session,
+                "CREATE TABLE TestDatabase.Measures (name string, whole bigint, fraction double);");
+            REQUIRE(cur->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "INSERT INTO TestDatabase.Measures (name, whole, fraction) VALUES "
+                                               "('a', 3, 1.5);");
+            REQUIRE(cur->is_success());
+            cur = dispatcher->execute_sql(session,
+                                          "INSERT INTO TestDatabase.Measures (name, fraction) VALUES ('b', 2.5);");
+            REQUIRE(cur->is_success());
+        }
+        // The result is DOUBLE whichever argument comes first, so the fraction is not truncated
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT name, COALESCE(whole, fraction) AS amount "
+                                           "FROM TestDatabase.Measures ORDER BY name ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 2);
+        REQUIRE(cur->chunk_data().data[1].type().type() == components::types::logical_type::DOUBLE);
+        REQUIRE(cur->chunk_data().value(1, 0).value<double>() == Approx(3.0));
+        REQUIRE(cur->chunk_data().value(1, 1).value<double>() == Approx(2.5));
+    }
 }
 
 TEST_CASE("integration::cpp::test_sql_features::case_when") {
@@ -717,6 +804,133 @@ TEST_CASE("integration::cpp::test_sql_features::case_when") {
         REQUIRE(cur->is_success());
         REQUIRE(cur->size() == 5);
     }
+
+    INFO("CASE WHEN branches over NULLs and unmatched rows") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session,
+                                               "INSERT INTO TestDatabase.TestCollection (name) VALUES ('Frank');");
+            REQUIRE(cur->is_success());
+        }
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT name, CASE WHEN score >= 90 THEN 'A' "
+                                           "WHEN score >= 70 THEN 'B' END AS grade, "
+                                           "CASE WHEN score < 50 THEN score + 100 ELSE score END AS adjusted "
+                                           "FROM TestDatabase.TestCollection ORDER BY name ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 6);
+        // Alice 95, Bob 72, Charlie 45, Dave 88, Eve 30, Frank NULL
+        std::vector<std::string_view> grades = {"A", "B", "", "B", "", ""};
+        std::vector<int64_t> adjusted = {95, 72, 145, 88, 130, 0};
+        for (size_t i = 0; i < cur->size(); i++) {
+            auto grade = cur->chunk_data().value(1, i);
+            if (grades[i].empty()) {
+                REQUIRE(grade.is_null());
+            } else {
+                REQUIRE(grade.value<std::string_view>() == grades[i]);
+            }
+            auto value = cur->chunk_data().value(2, i);
+            if (i == 5) {
+                REQUIRE(value.is_null());
+            } else {
+                REQUIRE(value.value<int64_t>() == adjusted[i]);
+            }
+        }
+    }
+
+    INFO("CASE WHEN NOT over a NULL operand") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT name, CASE WHEN NOT (score >= 70) THEN 'low' "
+                                           "ELSE 'other' END AS level "
+                                           "FROM TestDatabase.TestCollection ORDER BY name ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 6);
+        // Frank's NULL score leaves NOT (score >= 70) NULL, so the row falls through to ELSE
+        std::vector<std::string_view> levels = {"other", "other", "low", "other", "low", "other"};
+        for (size_t i = 0; i < cur->size(); i++) {
+            REQUIRE(cur->chunk_data().value(1, i).value<std::string_view>() == levels[i]);
+        }
+    }
+}
+
+TEST_CASE("integration::cpp::test_sql_features::group_by_case_coalesce") {
+    auto config = test_create_config("/tmp/test_sql_features/group_by_case_coalesce");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        dispatcher->execute_sql(
+            session,
+            "CREATE TABLE TestDatabase.TestCollection (name string, nickname string, value bigint);");
+        auto cur = dispatcher->execute_sql(session,
+                                           "INSERT INTO TestDatabase.TestCollection (name, nickname, value) VALUES "
+                                           "('Alice', 'Ali', 10), ('Bob', 'Bobby', 20), ('Eve', 'Ali', 50);");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        cur = dispatcher->execute_sql(session,
+                                      "INSERT INTO TestDatabase.TestCollection (name, value) VALUES ('Charlie', 30);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(session, "INSERT INTO TestDatabase.TestCollection (name) VALUES ('Dave');");
+        REQUIRE(cur->is_success());
+    }
+
+    // group keys are counted into a map: the order of the NULL group is not part of the test
+    auto count_groups = [](const components::cursor::cursor_t_ptr& cur) {
+        std::map<std::string, uint64_t> groups;
+        for (size_t i = 0; i < cur->size(); i++) {
+            auto key = cur->chunk_data().value(0, i);
+            auto name = key.is_null() ? std::string{"<null>"} : std::string{key.value<std::string_view>()};
+            REQUIRE(groups.count(name) == 0);
+            groups[name] = cur->chunk_data().value(1, i).value<uint64_t>();
+        }
+        return groups;
+    };
+
+    INFO("GROUP BY COALESCE") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT COALESCE(nickname, 'none') AS nick, COUNT(*) AS cnt "
+                                           "FROM TestDatabase.TestCollection GROUP BY nick;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        auto groups = count_groups(cur);
+        REQUIRE(groups["Ali"] == 2);
+        REQUIRE(groups["Bobby"] == 1);
+        REQUIRE(groups["none"] == 2);
+    }
+
+    INFO("GROUP BY CASE with a NULL result") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT CASE WHEN value >= 20 THEN 'high' "
+                                           "WHEN value < 20 THEN 'low' END AS level, COUNT(*) AS cnt "
+                                           "FROM TestDatabase.TestCollection GROUP BY level;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        auto groups = count_groups(cur);
+        REQUIRE(groups["high"] == 3);
+        REQUIRE(groups["low"] == 1);
+        REQUIRE(groups["<null>"] == 1);
+    }
+
+    INFO("GROUP BY CASE over a filtered input") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT CASE WHEN value >= 20 THEN 'high' "
+                                           "WHEN value < 20 THEN 'low' END AS level, COUNT(*) AS cnt "
+                                           "FROM TestDatabase.TestCollection WHERE value > 15 GROUP BY level;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        auto groups = count_groups(cur);
+        REQUIRE(groups["high"] == 3);
+    }
 }
 
 TEST_CASE("integration::cpp::test_sql_features::update_with_is_null") {
@@ -776,3 +990,273 @@ TEST_CASE("integration::cpp::test_sql_features::update_with_is_null") {
         }
     }
 }
+
+TEST_CASE("integration::cpp::test_sql_features::window_functions") {
+    auto config = test_create_config("/tmp/test_sql_features/window_functions");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, collection_name);
+        }
+        {
+            // ids 0..19, grp = id % 2, amount = id / 2 (pairs of equal amounts inside a group)
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (id, grp, amount) VALUES ";
+            for (int num = 19; num >= 0; --num) {
+                query << "(" << num << ", " << (num % 2) << ", " << (num / 4) << ")" << (num == 0 ? ";" : ", ");
+            }
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 20);
+        }
+    }
+
+    INFO("ranking") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, "
+                                           "ROW_NUMBER() OVER (PARTITION BY grp ORDER BY id) AS rn, "
+                                           "RANK() OVER (PARTITION BY grp ORDER BY amount) AS rk, "
+                                           "DENSE_RANK() OVER (PARTITION BY grp ORDER BY amount) AS drk "
+                                           "FROM TestDatabase.TestCollection ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 20);
+        for (size_t i = 0; i < 20; ++i) {
+            auto id = static_cast<int64_t>(i);
+            REQUIRE(cur->chunk_data().value(0, i).value<int64_t>() == id);
+            REQUIRE(cur->chunk_data().value(1, i).value<int64_t>() == id / 2 + 1);
+            // every amount appears twice per group
+            REQUIRE(cur->chunk_data().value(2, i).value<int64_t>() == (id / 4) * 2 + 1);
+            REQUIRE(cur->chunk_data().value(3, i).value<int64_t>() == id / 4 + 1);
+        }
+    }
+
+    INFO("lag and lead") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, "
+                                           "LAG(id) OVER (PARTITION BY grp ORDER BY id) AS prev, "
+                                           "LEAD(id, 2, -1) OVER (PARTITION BY grp ORDER BY id) AS next "
+                                           "FROM TestDatabase.TestCollection ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 20);
+        for (size_t i = 0; i < 20; ++i) {
+            auto id = static_cast<int64_t>(i);
+            auto prev = cur->chunk_data().value(1, i);
+            if (id < 2) {
+                REQUIRE(prev.is_null());
+            } else {
+                REQUIRE(prev.value<int64_t>() == id - 2);
+            }
+            auto next = cur->chunk_data().value(2, i).value<int64_t>();
+            REQUIRE(next == (id + 4 < 20 ? id + 4 : -1));
+        }
+    }
+
+    INFO("sliding frames") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, "
+                                           "SUM(id) OVER (ORDER BY id ROWS BETWEEN 2 PRECEDING AND CURRENT ROW) AS s, "
+                                           "MIN(id) OVER (ORDER BY id ROWS BETWEEN 1 FOLLOWING AND 3 FOLLOWING) AS mn, "
+                                           "MAX(id) OVER (PARTITION BY grp) AS mx, "
+                                           "AVG(amount) OVER (ORDER BY amount) AS av, "
+                                           "COUNT(*) OVER (ORDER BY id) AS c "
+                                           "FROM TestDatabase.TestCollection ORDER BY id;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 20);
+        for (size_t i = 0; i < 20; ++i) {
+            auto id = static_cast<int64_t>(i);
+            int64_t sum = 0;
+            for (auto k = std::max<int64_t>(0, id - 2); k <= id; ++k) {
+                sum += k;
+            }
+            REQUIRE(cur->chunk_data().value(1, i).value<int64_t>() == sum);
+            auto min = cur->chunk_data().value(2, i);
+            if (id == 19) {
+                REQUIRE(min.is_null());
+            } else {
+                REQUIRE(min.value<int64_t>() == id + 1);
+            }
+            REQUIRE(cur->chunk_data().value(3, i).value<int64_t>() == (id % 2 == 0 ? 18 : 19));
+            // RANGE frame up to the last peer: amounts 0..amount(id), four rows each
+            auto amount = id / 4;
+            REQUIRE(cur->chunk_data().value(4, i).value<double>() == Approx(static_cast<double>(amount) / 2.0));
+            REQUIRE(cur->chunk_data().value(5, i).value<int64_t>() == id + 1);
+        }
+    }
+
+    INFO("limit after window") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, COUNT(*) OVER () AS total "
+                                           "FROM TestDatabase.TestCollection WHERE grp = 1 LIMIT 3;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 3);
+        for (size_t i = 0; i < 3; ++i) {
+            REQUIRE(cur->chunk_data().value(1, i).value<int64_t>() == 10);
+        }
+    }
+}
+
+TEST_CASE("integration::cpp::test_sql_features::order_by_normalized_keys") {
+    auto config = test_create_config("/tmp/test_sql_features/order_by_normalized_keys");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    // names share a prefix longer than the normalized string prefix, so their order is decided
+    // past it; every fifth row has no score
+    constexpr int rows = 200;
+    auto name_of = [](int num) {
+        return "customer_account_" + std::string(static_cast<size_t>(num % 3), 'z') + "_" + std::to_string(num % 4);
+    };
+    auto score_of = [](int num) { return (num * 7) % 11 - 5; };
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql(session,
+                                    "CREATE TABLE TestDatabase.TestCollection (id bigint, name string, score bigint);");
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (id, name, score) VALUES ";
+            bool is_first = true;
+            for (int num = 0; num < rows; ++num) {
+                if (num % 5 == 0) {
+                    continue;
+                }
+                query << (is_first ? "" : ", ") << "(" << num << ", '" << name_of(num) << "', " << score_of(num) << ")";
+                is_first = false;
+            }
+            query << ";";
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (id, name) VALUES ";
+            for (int num = 0; num < rows; num += 5) {
+                query << (num == 0 ? "" : ", ") << "(" << num << ", '" << name_of(num) << "')";
+            }
+            query << ";";
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+        }
+    }
+
+    INFO("string DESC, nullable ASC, id DESC") {
+        std::vector<int> expected(rows);
+        std::iota(expected.begin(), expected.end(), 0);
+        std::sort(expected.begin(), expected.end(), [&](int a, int b) {
+            if (name_of(a) != name_of(b)) {
+                return name_of(a) > name_of(b);
+            }
+            // NULL sorts last when ascending
+            bool null_a = a % 5 == 0;
+            bool null_b = b % 5 == 0;
+            if (null_a != null_b) {
+                return null_b;
+            }
+            if (!null_a && score_of(a) != score_of(b)) {
+                return score_of(a) < score_of(b);
+            }
+            return a > b;
+        });
+
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, name, score FROM TestDatabase.TestCollection "
+                                           "ORDER BY name DESC, score ASC, id DESC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == static_cast<size_t>(rows));
+        for (size_t i = 0; i < static_cast<size_t>(rows); ++i) {
+            REQUIRE(cur->chunk_data().value(0, i).value<int64_t>() == expected[i]);
+        }
+    }
+
+    INFO("nullable DESC puts NULL first") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT id, score FROM TestDatabase.TestCollection "
+                                           "ORDER BY score DESC, id ASC;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == static_cast<size_t>(rows));
+        for (size_t i = 0; i < static_cast<size_t>(rows / 5); ++i) {
+            REQUIRE(cur->chunk_data().value(1, i).is_null());
+            REQUIRE(cur->chunk_data().value(0, i).value<int64_t>() == static_cast<int64_t>(i * 5));
+        }
+        for (size_t i = rows / 5 + 1; i < static_cast<size_t>(rows); ++i) {
+            auto previous = cur->chunk_data().value(1, i - 1).value<int64_t>();
+            REQUIRE(previous >= cur->chunk_data().value(1, i).value<int64_t>());
+        }
+    }
+}
+
+TEST_CASE("integration::cpp::test_sql_features::approximate_aggregates_empty_input") {
+    auto config = test_create_config("/tmp/test_sql_features/approximate_empty");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        dispatcher->execute_sql(session, "CREATE DATABASE TestDatabase;");
+        dispatcher->execute_sql(session, "CREATE TABLE TestDatabase.TestCollection (name string, value bigint);");
+    }
+
+    INFO("empty table") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "SELECT approx_quantile(value, 0.5) AS q, approx_top_k(value, 3) AS top "
+                                           "FROM TestDatabase.TestCollection;");
+        REQUIRE(cur->is_success());
+        for (size_t i = 0; i < cur->size(); i++) {
+            REQUIRE(cur->chunk_data().value(0, i).is_null());
+            REQUIRE(cur->chunk_data().value(1, i).children().empty());
+        }
+    }
+
+    INFO("fully filtered input") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session,
+                                           "INSERT INTO TestDatabase.TestCollection (name, value) VALUES "
+                                           "('Alice', 10), ('Bob', 20), ('Charlie', 30);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(session,
+                                      "SELECT approx_quantile(value, 0.5) AS q, approx_top_k(value, 3) AS top "
+                                      "FROM TestDatabase.TestCollection WHERE value > 100;");
+        REQUIRE(cur->is_success());
+        for (size_t i = 0; i < cur->size(); i++) {
+            REQUIRE(cur->chunk_data().value(0, i).is_null());
+            REQUIRE(cur->chunk_data().value(1, i).children().empty());
+        }
+        cur = dispatcher->execute_sql(session,
+                                      "SELECT name, approx_quantile(value, 0.5) AS q FROM TestDatabase.TestCollection "
+                                      "WHERE value > 100 GROUP BY name;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 0);
+    }
+}
@@ -34,7 +34,7 @@ static compute_result<kernel_state_ptr> concat_init(kernel_context&, kernel_init
 static compute_status concat_consume(kernel_context& ctx, const vector::data_chunk_t& in, size_t exec_length) {
     auto* acc = static_cast<concat_kernel_state*>(ctx.state());
     for (size_t i = 0; i < exec_length; i++) {
-        acc->value += *in.data[0].data<std::string_view>();
+        acc->value += in.data[0].data<types::string_t>()->view();
     }
     return compute_status::ok();
 }
@@ -237,7 +237,7 @@ TEST_CASE("integration::cpp::test_udfs") {
             REQUIRE(chunk.column_count() == 2);
             for (size_t i = 0; i < chunk.size(); i++) {
                 REQUIRE(chunk.data[0].data<int64_t>()[i] == static_cast<int64_t>(kNumInserts - i));
-                REQUIRE(chunk.data[1].data<std::string_view>()[i] ==
+                REQUIRE(chunk.data[1].data<types::string_t>()[i].view() ==
                         std::to_string(kNumInserts - i) + std::to_string(kNumInserts - i));
             }
         }
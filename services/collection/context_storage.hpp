@@ -2,20 +2,41 @@
 
 #include <components/base/collection_full_name.hpp>
 #include <components/log/log.hpp>
+#include <components/logical_plan/node_create_index.hpp>
+#include <components/types/types.hpp>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace services {
 
+    struct index_definition_t {
+        std::string name;
+        components::logical_plan::index_type type;
+        components::logical_plan::keys_base_storage_t keys;
+        // Type of the leading key column; NA when the table has no fixed schema
+        components::types::complex_logical_type key_type;
+    };
+
+    using index_definitions_t = std::vector<index_definition_t>;
+
     struct context_storage_t {
         std::pmr::memory_resource* resource;
         log_t log;
         std::unordered_set<collection_full_name_t, collection_name_hash> known_collections;
+        // Indexes of the known collections, used by the planner to pick index access paths
+        std::unordered_map<collection_full_name_t, index_definitions_t, collection_name_hash> indexes;
 
         context_storage_t(std::pmr::memory_resource* resource, log_t log)
             : resource(resource)
             , log(std::move(log)) {}
 
         bool has_collection(const collection_full_name_t& name) const { return known_collections.count(name) > 0; }
+
+        const index_definitions_t* indexes_of(const collection_full_name_t& name) const {
+            auto it = indexes.find(name);
+            return it == indexes.end() ? nullptr : &it->second;
+        }
     };
 
 } //namespace services
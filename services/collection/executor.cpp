@@ -15,10 +15,39 @@
 #include <components/physical_plan_generator/create_plan.hpp>
 #include <core/executor.hpp>
 
+#include <optional>
+
 using namespace components::cursor;
 
 namespace services::collection::executor {
 
+    namespace {
+
+        // Publishes a commit id on scope exit unless publish() was called already. A pending commit
+        // that is never published would hold every later snapshot below it.
+        class publish_guard_t {
+        public:
+            publish_guard_t(components::table::transaction_manager_t* txn_manager, uint64_t commit_id)
+                : txn_manager_(txn_manager)
+                , commit_id_(commit_id) {}
+            publish_guard_t(const publish_guard_t&) = delete;
+            publish_guard_t& operator=(const publish_guard_t&) = delete;
+            ~publish_guard_t() { publish(); }
+
+            void publish() {
+                if (commit_id_ != 0) {
+                    txn_manager_->publish(commit_id_);
+                    commit_id_ = 0;
+                }
+            }
+
+        private:
+            components::table::transaction_manager_t* txn_manager_;
+            uint64_t commit_id_;
+        };
+
+    } // namespace
+
     plan_t::plan_t(std::stack<components::operators::operator_ptr>&& sub_plans,
                    components::logical_plan::storage_parameters parameters,
                    services::context_storage_t&& context_storage)
@@ -32,13 +61,15 @@ namespace services::collection::executor {
                            actor_zeta::address_t disk_address,
                            actor_zeta::address_t index_address,
                            components::table::transaction_manager_t* txn_manager,
-                           log_t&& log)
+                           log_t&& log,
+                           core::scheduler::task_pool_t* task_pool)
         : actor_zeta::basic_actor<executor_t>{resource}
         , parent_address_(std::move(parent_address))
         , wal_address_(std::move(wal_address))
         , disk_address_(std::move(disk_address))
         , index_address_(std::move(index_address))
         , txn_manager_(txn_manager)
+        , task_pool_(task_pool)
         , log_(log)
         , pending_void_(resource)
         , pending_execute_(resource) {
@@ -262,51 +293,59 @@ namespace services::collection::executor {
                 }
             }
 
-            // Step 4: Commit transaction
-            uint64_t commit_id = txn_manager_->commit(session);
+            // Step 4: Commit transaction. The commit id stays pending (new snapshots stop below it) until
+            // storage and indexes carry it, so no snapshot sees it half-stamped.
+            uint64_t commit_id = txn_manager_->begin_commit(session);
+            publish_guard_t publish_guard{txn_manager_, commit_id};
             trace(log_, "executor::execute_plan: committed txn {}, commit_id {}", txn_data.transaction_id, commit_id);
 
-            // Step 5: Commit side-effects on storage and index
+            // Step 5: WAL COMMIT marker and the commit on storage and index, one message each. The WAL
+            // manager writes the marker as the message is sent, so it is not overlapped with the rest
+            std::optional<unique_future<services::wal::id_t>> wal_commit;
+            if (wal_address_ != actor_zeta::address_t::empty_address()) {
+                auto [_wc, wcf] = actor_zeta::send(wal_address_,
+                                                   &wal::manager_wal_replicate_t::commit_txn,
+                                                   session,
+                                                   txn_data.transaction_id);
+                wal_commit.emplace(std::move(wcf));
+            }
+
             auto coll_name = logical_plan->collection_full_name();
-            if (result.append_row_count > 0 && commit_id > 0) {
+            bool has_appends = result.append_row_count > 0;
+            bool has_deletes = result.delete_txn_id != 0;
+            if ((has_appends || has_deletes) && commit_id > 0) {
                 components::execution_context_t ctx{session, txn_data, coll_name};
-                auto [_ca, caf] = actor_zeta::send(disk_address_,
-                                                   &disk::manager_disk_t::storage_commit_append,
+                auto [_cs, csf] = actor_zeta::send(disk_address_,
+                                                   &disk::manager_disk_t::storage_commit,
                                                    ctx,
                                                    commit_id,
                                                    result.append_row_start,
-                                                   result.append_row_count);
-                co_await std::move(caf);
+                                                   result.append_row_count,
+                                                   has_deletes);
                 if (index_address_ != actor_zeta::address_t::empty_address()) {
-                    auto [_ci, cif] =
-                        actor_zeta::send(index_address_, &index::manager_index_t::commit_insert, ctx, commit_id);
+                    auto [_ci, cif] = actor_zeta::send(index_address_,
+                                                       &index::manager_index_t::commit_txn,
+                                                       ctx,
+                                                       commit_id,
+                                                       has_appends,
+                                                       has_deletes);
                     co_await std::move(cif);
                 }
+                co_await std::move(csf);
             }
-            if (result.delete_txn_id != 0 && commit_id > 0) {
-                components::execution_context_t del_ctx{session, txn_data, coll_name};
-                auto [_cd, cdf] =
-                    actor_zeta::send(disk_address_, &disk::manager_disk_t::storage_commit_delete, del_ctx, commit_id);
-                co_await std::move(cdf);
-                if (index_address_ != actor_zeta::address_t::empty_address()) {
-                    auto [_cdi, cdif] =
-                        actor_zeta::send(index_address_, &index::manager_index_t::commit_delete, del_ctx, commit_id);
-                    co_await std::move(cdif);
-                }
+            publish_guard.publish();
+
+            if (has_deletes && commit_id > 0) {
                 // Fire-and-forget auto-GC check
+                components::execution_context_t del_ctx{session, txn_data, coll_name};
                 auto lowest = txn_manager_->lowest_active_start_time();
                 auto [gc_sched, gc_fut] =
                     actor_zeta::send(disk_address_, &disk::manager_disk_t::maybe_cleanup, del_ctx, lowest);
                 pending_void_.push_back(std::move(gc_fut));
             }
 
-            // Step 6: WAL COMMIT marker
-            if (wal_address_ != actor_zeta::address_t::empty_address()) {
-                auto [_wc, wcf] = actor_zeta::send(wal_address_,
-                                                   &wal::manager_wal_replicate_t::commit_txn,
-                                                   session,
-                                                   txn_data.transaction_id);
-                co_await std::move(wcf);
+            if (wal_commit) {
+                co_await std::move(*wal_commit);
             }
 
             co_return execute_result_t{std::move(result.cursor), std::move(result.updates)};
@@ -398,6 +437,7 @@ namespace services::collection::executor {
                                                              plan_data.parameters};
             pipeline_context.disk_address = disk_address_;
             pipeline_context.index_address = index_address_;
+            pipeline_context.task_pool = task_pool_;
             pipeline_context.txn = txn;
 
             // Prepare the operator tree (connects children in aggregation, etc.)
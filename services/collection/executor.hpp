@@ -21,6 +21,10 @@ namespace components::table {
     class transaction_manager_t;
 }
 
+namespace core::scheduler {
+    class task_pool_t;
+}
+
 namespace services::collection::executor {
 
     struct execute_result_t {
@@ -68,7 +72,8 @@ namespace services::collection::executor {
                    actor_zeta::address_t disk_address,
                    actor_zeta::address_t index_address,
                    components::table::transaction_manager_t* txn_manager,
-                   log_t&& log);
+                   log_t&& log,
+                   core::scheduler::task_pool_t* task_pool = nullptr);
         ~executor_t() = default;
 
         unique_future<execute_result_t> execute_plan(components::session::session_id_t session,
@@ -103,6 +108,7 @@ namespace services::collection::executor {
         actor_zeta::address_t disk_address_ = actor_zeta::address_t::empty_address();
         actor_zeta::address_t index_address_ = actor_zeta::address_t::empty_address();
         components::table::transaction_manager_t* txn_manager_{nullptr};
+        core::scheduler::task_pool_t* task_pool_{nullptr};
         log_t log_;
         components::compute::function_registry_t function_registry_;
 
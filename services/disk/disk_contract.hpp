@@ -44,7 +44,7 @@ namespace services::disk {
 
         actor_zeta::unique_future<services::wal::id_t> checkpoint_all(session_id_t session,
                                                                       services::wal::id_t current_wal_id);
-        actor_zeta::unique_future<void> vacuum_all(session_id_t session, uint64_t lowest_active_start_time);
+        actor_zeta::unique_future<result_vacuum_t> vacuum_all(session_id_t session, uint64_t lowest_active_start_time);
         actor_zeta::unique_future<void> maybe_cleanup(execution_context_t ctx, uint64_t lowest_active_start_time);
 
         // Catalog DDL (sequences, views, macros)
@@ -113,11 +113,13 @@ namespace services::disk {
         actor_zeta::unique_future<uint64_t> storage_parallel_scan(session_id_t session, collection_full_name_t name);
 
         // MVCC commit/revert
-        actor_zeta::unique_future<void>
-        storage_commit_append(execution_context_t ctx, uint64_t commit_id, int64_t row_start, uint64_t count);
+        actor_zeta::unique_future<void> storage_commit(execution_context_t ctx,
+                                                       uint64_t commit_id,
+                                                       int64_t row_start,
+                                                       uint64_t count,
+                                                       bool commit_deletes);
         actor_zeta::unique_future<void>
         storage_revert_append(execution_context_t ctx, int64_t row_start, uint64_t count);
-        actor_zeta::unique_future<void> storage_commit_delete(execution_context_t ctx, uint64_t commit_id);
 
         using dispatch_traits = actor_zeta::dispatch_traits<&disk_contract::load,
                                                             &disk_contract::load_indexes,
@@ -157,9 +159,8 @@ namespace services::disk {
                                                             &disk_contract::storage_delete_rows,
                                                             &disk_contract::storage_parallel_scan,
                                                             // MVCC commit/revert
-                                                            &disk_contract::storage_commit_append,
-                                                            &disk_contract::storage_revert_append,
-                                                            &disk_contract::storage_commit_delete>;
+                                                            &disk_contract::storage_commit,
+                                                            &disk_contract::storage_revert_append>;
 
         disk_contract() = delete;
     };
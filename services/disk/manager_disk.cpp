@@ -55,13 +55,18 @@ namespace services::disk {
         table_ = std::make_unique<components::table::data_table_t>(resource, *block_manager_, std::move(columns));
     }
 
-    table_storage_t::table_storage_t(std::pmr::memory_resource* resource, const std::filesystem::path& otbx_path)
+    table_storage_t::table_storage_t(std::pmr::memory_resource* resource,
+                                     const std::filesystem::path& otbx_path,
+                                     components::table::storage::block_read_mode read_mode)
         : mode_(storage_mode_t::DISK)
         , buffer_pool_(resource, uint64_t(1) << 32, false, uint64_t(1) << 24)
         , buffer_manager_(resource, fs_, buffer_pool_) {
-        auto bm = std::make_unique<components::table::storage::single_file_block_manager_t>(buffer_manager_,
-                                                                                            fs_,
-                                                                                            otbx_path.string());
+        auto bm = std::make_unique<components::table::storage::single_file_block_manager_t>(
+            buffer_manager_,
+            fs_,
+            otbx_path.string(),
+            components::table::storage::DEFAULT_BLOCK_ALLOC_SIZE,
+            read_mode);
         bm->load_existing_database();
         block_manager_ = std::move(bm);
 
@@ -332,18 +337,14 @@ namespace services::disk {
                 break;
             }
             // MVCC commit/revert
-            case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_commit_append>: {
-                co_await actor_zeta::dispatch(this, &manager_disk_t::storage_commit_append, msg);
+            case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_commit>: {
+                co_await actor_zeta::dispatch(this, &manager_disk_t::storage_commit, msg);
                 break;
             }
             case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_revert_append>: {
                 co_await actor_zeta::dispatch(this, &manager_disk_t::storage_revert_append, msg);
                 break;
             }
-            case actor_zeta::msg_id<manager_disk_t, &manager_disk_t::storage_commit_delete>: {
-                co_await actor_zeta::dispatch(this, &manager_disk_t::storage_commit_delete, msg);
-                break;
-            }
             default:
                 break;
         }
@@ -565,19 +566,25 @@ namespace services::disk {
         co_return wal::id_t{0};
     }
 
-    manager_disk_t::unique_future<void> manager_disk_t::vacuum_all(session_id_t session,
-                                                                   uint64_t lowest_active_start_time) {
+    manager_disk_t::unique_future<result_vacuum_t> manager_disk_t::vacuum_all(session_id_t session,
+                                                                              uint64_t lowest_active_start_time) {
         trace(log_, "manager_disk_t::vacuum_all , session : {}", session.data());
 
+        // Only row groups with more than this share of deleted rows are rewritten
+        static constexpr double vacuum_threshold = 0.1;
+        result_vacuum_t result;
         for (auto& [name, entry] : storages_) {
             trace(log_, "manager_disk_t::vacuum_all cleaning : {}", name.to_string());
             auto& table = entry->table_storage.table();
             table.cleanup_versions(lowest_active_start_time);
-            table.compact();
+            auto remap = table.compact(vacuum_threshold);
+            if (!remap.empty()) {
+                result.emplace_back(name, std::move(remap));
+            }
         }
 
-        trace(log_, "manager_disk_t::vacuum_all complete");
-        co_return;
+        trace(log_, "manager_disk_t::vacuum_all complete, {} collections moved rows", result.size());
+        co_return result;
     }
 
     manager_disk_t::unique_future<void> manager_disk_t::maybe_cleanup(execution_context_t ctx,
@@ -731,7 +738,9 @@ namespace services::disk {
               "manager_disk_t::load_storage_disk_sync , name : {} , path : {}",
               name.to_string(),
               otbx_path.string());
-        storages_.emplace(name, std::make_unique<collection_storage_entry_t>(resource(), otbx_path));
+        auto read_mode = config_.mmap_reads ? components::table::storage::block_read_mode::MMAP
+                                            : components::table::storage::block_read_mode::BUFFERED;
+        storages_.emplace(name, std::make_unique<collection_storage_entry_t>(resource(), otbx_path, read_mode));
     }
 
     void manager_disk_t::overlay_column_not_null_sync(const collection_full_name_t& name, const std::string& col_name) {
@@ -898,6 +907,15 @@ namespace services::disk {
         s->update(ids_vec, local);
     }
 
+    std::pair<int64_t, uint64_t> manager_disk_t::row_group_range_sync(const collection_full_name_t& name,
+                                                                      int64_t row_id) {
+        auto* s = get_storage(name);
+        if (!s) {
+            return {0, std::numeric_limits<uint64_t>::max()};
+        }
+        return s->row_group_range(row_id);
+    }
+
     // --- Storage management ---
 
     components::storage::storage_t* manager_disk_t::get_storage(const collection_full_name_t& name) {
@@ -1255,13 +1273,18 @@ namespace services::disk {
 
     // MVCC commit/revert methods
 
-    manager_disk_t::unique_future<void> manager_disk_t::storage_commit_append(execution_context_t ctx,
-                                                                              uint64_t commit_id,
-                                                                              int64_t row_start,
-                                                                              uint64_t count) {
+    manager_disk_t::unique_future<void> manager_disk_t::storage_commit(execution_context_t ctx,
+                                                                       uint64_t commit_id,
+                                                                       int64_t row_start,
+                                                                       uint64_t count,
+                                                                       bool commit_deletes) {
         auto* s = get_storage(ctx.name);
-        if (s)
-            s->commit_append(commit_id, row_start, count);
+        if (s) {
+            if (count > 0)
+                s->commit_append(commit_id, row_start, count);
+            if (commit_deletes)
+                s->commit_all_deletes(ctx.txn.transaction_id, commit_id);
+        }
         co_return;
     }
 
@@ -1273,14 +1296,6 @@ namespace services::disk {
         co_return;
     }
 
-    manager_disk_t::unique_future<void> manager_disk_t::storage_commit_delete(execution_context_t ctx,
-                                                                              uint64_t commit_id) {
-        auto* s = get_storage(ctx.name);
-        if (s)
-            s->commit_all_deletes(ctx.txn.transaction_id, commit_id);
-        co_return;
-    }
-
     auto manager_disk_t::agent() -> actor_zeta::address_t { return agents_[0]->address(); }
 
     manager_disk_empty_t::manager_disk_empty_t(std::pmr::memory_resource* resource,
@@ -1408,18 +1423,14 @@ namespace services::disk {
                 break;
             }
             // MVCC commit/revert
-            case actor_zeta::msg_id<manager_disk_empty_t, &manager_disk_empty_t::storage_commit_append>: {
-                co_await actor_zeta::dispatch(this, &manager_disk_empty_t::storage_commit_append, msg);
+            case actor_zeta::msg_id<manager_disk_empty_t, &manager_disk_empty_t::storage_commit>: {
+                co_await actor_zeta::dispatch(this, &manager_disk_empty_t::storage_commit, msg);
                 break;
             }
             case actor_zeta::msg_id<manager_disk_empty_t, &manager_disk_empty_t::storage_revert_append>: {
                 co_await actor_zeta::dispatch(this, &manager_disk_empty_t::storage_revert_append, msg);
                 break;
             }
-            case actor_zeta::msg_id<manager_disk_empty_t, &manager_disk_empty_t::storage_commit_delete>: {
-                co_await actor_zeta::dispatch(this, &manager_disk_empty_t::storage_commit_delete, msg);
-                break;
-            }
             // GC / vacuum
             case actor_zeta::msg_id<manager_disk_empty_t, &manager_disk_empty_t::vacuum_all>: {
                 co_await actor_zeta::dispatch(this, &manager_disk_empty_t::vacuum_all, msg);
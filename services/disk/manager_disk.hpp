@@ -58,7 +58,10 @@ namespace services::disk {
                         const std::filesystem::path& otbx_path);
 
         /// Disk mode: load existing table.otbx
-        table_storage_t(std::pmr::memory_resource* resource, const std::filesystem::path& otbx_path);
+        table_storage_t(std::pmr::memory_resource* resource,
+                        const std::filesystem::path& otbx_path,
+                        components::table::storage::block_read_mode read_mode =
+                            components::table::storage::block_read_mode::BUFFERED);
 
         components::table::data_table_t& table() { return *table_; }
         storage_mode_t mode() const { return mode_; }
@@ -116,6 +119,8 @@ namespace services::disk {
         void direct_update_sync(const collection_full_name_t& name,
                                 const std::pmr::vector<int64_t>& row_ids,
                                 components::vector::data_chunk_t& new_data);
+        // Row group holding `row_id`: replay applies deletes and updates of different row groups in parallel
+        std::pair<int64_t, uint64_t> row_group_range_sync(const collection_full_name_t& name, int64_t row_id);
 
         std::pmr::memory_resource* resource() const noexcept { return resource_; }
         auto make_type() const noexcept -> const char* { return "manager_disk"; }
@@ -145,7 +150,7 @@ namespace services::disk {
         unique_future<void> flush(session_id_t session, wal::id_t wal_id);
 
         unique_future<wal::id_t> checkpoint_all(session_id_t session, wal::id_t current_wal_id);
-        unique_future<void> vacuum_all(session_id_t session, uint64_t lowest_active_start_time);
+        unique_future<result_vacuum_t> vacuum_all(session_id_t session, uint64_t lowest_active_start_time);
         unique_future<void> maybe_cleanup(execution_context_t ctx, uint64_t lowest_active_start_time);
 
         // Catalog DDL (sequences, views, macros)
@@ -205,11 +210,14 @@ namespace services::disk {
         storage_delete_rows(execution_context_t ctx, components::vector::vector_t row_ids, uint64_t count);
         unique_future<uint64_t> storage_parallel_scan(session_id_t session, collection_full_name_t name);
 
-        // MVCC commit/revert
-        unique_future<void>
-        storage_commit_append(execution_context_t ctx, uint64_t commit_id, int64_t row_start, uint64_t count);
+        // MVCC commit/revert. One message publishes every storage version of a transaction: the rows it
+        // appended and, with `commit_deletes`, the rows it deleted.
+        unique_future<void> storage_commit(execution_context_t ctx,
+                                           uint64_t commit_id,
+                                           int64_t row_start,
+                                           uint64_t count,
+                                           bool commit_deletes);
         unique_future<void> storage_revert_append(execution_context_t ctx, int64_t row_start, uint64_t count);
-        unique_future<void> storage_commit_delete(execution_context_t ctx, uint64_t commit_id);
 
         using dispatch_traits = actor_zeta::implements<disk_contract,
                                                        &manager_disk_t::load,
@@ -250,9 +258,8 @@ namespace services::disk {
                                                        &manager_disk_t::storage_delete_rows,
                                                        &manager_disk_t::storage_parallel_scan,
                                                        // MVCC commit/revert
-                                                       &manager_disk_t::storage_commit_append,
-                                                       &manager_disk_t::storage_revert_append,
-                                                       &manager_disk_t::storage_commit_delete>;
+                                                       &manager_disk_t::storage_commit,
+                                                       &manager_disk_t::storage_revert_append>;
 
     private:
         std::pmr::memory_resource* resource_;
@@ -297,8 +304,10 @@ namespace services::disk {
                                                                                          resource)) {}
 
             /// Disk: load existing table.otbx
-            collection_storage_entry_t(std::pmr::memory_resource* resource, const std::filesystem::path& otbx_path)
-                : table_storage(resource, otbx_path)
+            collection_storage_entry_t(std::pmr::memory_resource* resource,
+                                       const std::filesystem::path& otbx_path,
+                                       components::table::storage::block_read_mode read_mode)
+                : table_storage(resource, otbx_path, read_mode)
                 , storage(std::make_unique<components::storage::table_storage_adapter_t>(table_storage.table(),
                                                                                          resource)) {}
         };
@@ -381,7 +390,9 @@ namespace services::disk {
         unique_future<wal::id_t> checkpoint_all(session_id_t /*session*/, wal::id_t /*current_wal_id*/) {
             co_return wal::id_t{0};
         }
-        unique_future<void> vacuum_all(session_id_t /*session*/, uint64_t /*lowest_active_start_time*/) { co_return; }
+        unique_future<result_vacuum_t> vacuum_all(session_id_t /*session*/, uint64_t /*lowest_active_start_time*/) {
+            co_return result_vacuum_t{};
+        }
         unique_future<void> maybe_cleanup(execution_context_t /*ctx*/, uint64_t /*lowest_active_start_time*/) {
             co_return;
         }
@@ -464,11 +475,18 @@ namespace services::disk {
         }
 
         // MVCC commit/revert
-        unique_future<void>
-        storage_commit_append(execution_context_t ctx, uint64_t commit_id, int64_t row_start, uint64_t count) {
+        unique_future<void> storage_commit(execution_context_t ctx,
+                                           uint64_t commit_id,
+                                           int64_t row_start,
+                                           uint64_t count,
+                                           bool commit_deletes) {
             auto* s = get_storage(ctx.name);
-            if (s)
-                s->commit_append(commit_id, row_start, count);
+            if (s) {
+                if (count > 0)
+                    s->commit_append(commit_id, row_start, count);
+                if (commit_deletes)
+                    s->commit_all_deletes(ctx.txn.transaction_id, commit_id);
+            }
             co_return;
         }
         unique_future<void> storage_revert_append(execution_context_t ctx, int64_t row_start, uint64_t count) {
@@ -477,12 +495,6 @@ namespace services::disk {
                 s->revert_append(row_start, count);
             co_return;
         }
-        unique_future<void> storage_commit_delete(execution_context_t ctx, uint64_t commit_id) {
-            auto* s = get_storage(ctx.name);
-            if (s)
-                s->commit_all_deletes(ctx.txn.transaction_id, commit_id);
-            co_return;
-        }
 
         using dispatch_traits = actor_zeta::implements<disk_contract,
                                                        &manager_disk_empty_t::load,
@@ -523,9 +535,8 @@ namespace services::disk {
                                                        &manager_disk_empty_t::storage_delete_rows,
                                                        &manager_disk_empty_t::storage_parallel_scan,
                                                        // MVCC commit/revert
-                                                       &manager_disk_empty_t::storage_commit_append,
-                                                       &manager_disk_empty_t::storage_revert_append,
-                                                       &manager_disk_empty_t::storage_commit_delete>;
+                                                       &manager_disk_empty_t::storage_commit,
+                                                       &manager_disk_empty_t::storage_revert_append>;
 
     private:
         void create_agent(int count_agents);
@@ -2,8 +2,10 @@
 
 #include "catalog_storage.hpp"
 #include <components/base/collection_full_name.hpp>
+#include <components/table/row_id_remap.hpp>
 #include <memory_resource>
 #include <services/wal/base.hpp>
+#include <utility>
 #include <vector>
 
 namespace services::disk {
@@ -56,4 +58,7 @@ namespace services::disk {
         wal::id_t wal_id_{0};
     };
 
+    // Row ids moved by a vacuum, per collection; collections where no row moved are left out
+    using result_vacuum_t = std::vector<std::pair<collection_full_name_t, components::table::row_id_remap_t>>;
+
 } // namespace services::disk
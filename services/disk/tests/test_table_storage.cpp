@@ -319,3 +319,27 @@ TEST_CASE("services::disk::table_storage::parallel_scan_via_storage_adapter") {
     REQUIRE(total == 4 * DEFAULT_VECTOR_CAPACITY);
     REQUIRE(chunks_seen == 4);
 }
+
+TEST_CASE("services::disk::table_storage::row_group_range_via_storage_adapter") {
+    std::pmr::synchronized_pool_resource resource;
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("value", logical_type::BIGINT);
+    table_storage_t ts(&resource, std::move(columns));
+
+    append_int64_data(ts.table(), &resource, 2 * DEFAULT_VECTOR_CAPACITY + 10);
+    components::storage::table_storage_adapter_t adapter(ts.table(), &resource);
+
+    auto first = adapter.row_group_range(5);
+    REQUIRE(first.first == 0);
+    REQUIRE(first.second == DEFAULT_VECTOR_CAPACITY);
+
+    auto last = adapter.row_group_range(static_cast<int64_t>(2 * DEFAULT_VECTOR_CAPACITY + 3));
+    REQUIRE(last.first == static_cast<int64_t>(2 * DEFAULT_VECTOR_CAPACITY));
+    REQUIRE(last.second == 10);
+
+    // rows past the end fall back to one range over the whole table
+    auto past = adapter.row_group_range(static_cast<int64_t>(3 * DEFAULT_VECTOR_CAPACITY));
+    REQUIRE(past.first == 0);
+    REQUIRE(past.second == std::numeric_limits<uint64_t>::max());
+}
@@ -3,12 +3,14 @@
 
 #include <components/logical_plan/node_checkpoint.hpp>
 #include <components/logical_plan/node_create_collection.hpp>
+#include <components/logical_plan/node_create_index.hpp>
 #include <components/logical_plan/node_create_macro.hpp>
 #include <components/logical_plan/node_create_sequence.hpp>
 #include <components/logical_plan/node_create_type.hpp>
 #include <components/logical_plan/node_create_view.hpp>
 #include <components/logical_plan/node_data.hpp>
 #include <components/logical_plan/node_drop_database.hpp>
+#include <components/logical_plan/node_drop_index.hpp>
 #include <components/logical_plan/node_drop_macro.hpp>
 #include <components/logical_plan/node_drop_sequence.hpp>
 #include <components/logical_plan/node_drop_view.hpp>
@@ -189,7 +191,8 @@ namespace services::dispatcher {
                                                                             disk_address_,
                                                                             index_address_,
                                                                             &txn_manager_,
-                                                                            log_.clone());
+                                                                            log_.clone(),
+                                                                            task_pool_);
             executor_addresses_.push_back(exec->address());
             executors_.push_back(std::move(exec));
         }
@@ -374,43 +377,21 @@ namespace services::dispatcher {
                 trace(log_, "manager_dispatcher_t::execute_plan: {}", to_string(logic_plan->type()));
                 auto lowest = txn_manager_.lowest_active_start_time();
                 auto [_v, vf] = actor_zeta::send(disk_address_, &disk::manager_disk_t::vacuum_all, session, lowest);
-                co_await std::move(vf);
-                // Cleanup old index versions + rebuild (compact changes row positions)
+                auto moved = co_await std::move(vf);
+                // Cleanup old index versions, then move index entries after the rows vacuum moved
                 if (index_address_ != actor_zeta::address_t::empty_address()) {
                     auto [_cv, cvf] = actor_zeta::send(index_address_,
                                                        &index::manager_index_t::cleanup_all_versions,
                                                        session,
                                                        lowest);
                     co_await std::move(cvf);
-                    // Rebuild indexes for each collection (compact invalidates row positions)
-                    for (const auto& coll : collections_) {
-                        auto [_rb, rbf] =
-                            actor_zeta::send(index_address_, &index::manager_index_t::rebuild_indexes, session, coll);
-                        co_await std::move(rbf);
-                        // Re-populate indexes from storage
-                        auto [_tr, trf] =
-                            actor_zeta::send(disk_address_, &disk::manager_disk_t::storage_total_rows, session, coll);
-                        auto total = co_await std::move(trf);
-                        if (total > 0) {
-                            auto [_ss, ssf] = actor_zeta::send(disk_address_,
-                                                               &disk::manager_disk_t::storage_scan_segment,
-                                                               session,
-                                                               coll,
-                                                               int64_t{0},
-                                                               total);
-                            auto scan_data = co_await std::move(ssf);
-                            if (scan_data) {
-                                auto count = scan_data->size();
-                                auto [_ir, irf] = actor_zeta::send(index_address_,
-                                                                   &index::manager_index_t::insert_rows,
-                                                                   session,
-                                                                   coll,
-                                                                   std::move(scan_data),
-                                                                   uint64_t{0},
-                                                                   count);
-                                co_await std::move(irf);
-                            }
-                        }
+                    for (auto& [coll, remap] : moved) {
+                        auto [_rm, rmf] = actor_zeta::send(index_address_,
+                                                           &index::manager_index_t::remap_rows,
+                                                           session,
+                                                           coll,
+                                                           std::move(remap));
+                        co_await std::move(rmf);
                     }
                 }
                 co_return make_cursor(resource(), operation_status_t::success);
@@ -606,11 +587,13 @@ namespace services::dispatcher {
 
                 case node_type::create_index_t: {
                     trace(log_, "manager_dispatcher_t::execute_plan: {}", to_string(logic_plan->type()));
+                    update_catalog(logic_plan);
                     co_return result;
                 }
 
                 case node_type::drop_index_t: {
                     trace(log_, "manager_dispatcher_t::execute_plan: {}", to_string(logic_plan->type()));
+                    update_catalog(logic_plan);
                     co_return result;
                 }
 
@@ -864,6 +847,9 @@ namespace services::dispatcher {
         for (auto& name : dependency_tree_collections_names) {
             if (!name.empty() && collections_.count(name) > 0) {
                 collections_context_storage.known_collections.insert(name);
+                if (auto it = index_definitions_.find(name); it != index_definitions_.end()) {
+                    collections_context_storage.indexes.emplace(name, it->second);
+                }
             }
         }
 
@@ -926,6 +912,8 @@ namespace services::dispatcher {
                 break;
             case node_type::drop_database_t:
                 catalog_.drop_namespace(id.get_namespace());
+                std::erase_if(index_definitions_,
+                              [&node](const auto& entry) { return entry.first.database == node->database_name(); });
                 break;
             case node_type::create_collection_t: {
                 auto node_info = boost::polymorphic_pointer_downcast<node_create_collection_t>(node);
@@ -951,7 +939,38 @@ namespace services::dispatcher {
                 } else {
                     catalog_.drop_computing_table(id);
                 }
+                index_definitions_.erase(node->collection_full_name());
+                break;
+            case node_type::create_index_t: {
+                // Without an index service create_index is a no-op, so there is nothing to plan against
+                if (index_address_ == actor_zeta::address_t::empty_address()) {
+                    break;
+                }
+                auto node_info = boost::polymorphic_pointer_downcast<node_create_index_t>(node);
+                // the planner converts probes to the key type, or leaves the index out when it can not
+                components::types::complex_logical_type key_type;
+                if (catalog_.table_exists(id) && !node_info->keys().empty()) {
+                    auto column = node_info->keys().front().as_string();
+                    for (const auto& definition : catalog_.get_table_schema(id).columns()) {
+                        if (definition.name() == column) {
+                            key_type = definition.type();
+                            break;
+                        }
+                    }
+                }
+                index_definitions_[node->collection_full_name()].push_back(
+                    {node_info->name(), node_info->type(), node_info->keys(), std::move(key_type)});
                 break;
+            }
+            case node_type::drop_index_t: {
+                auto node_info = boost::polymorphic_pointer_downcast<node_drop_index_t>(node);
+                if (auto it = index_definitions_.find(node->collection_full_name()); it != index_definitions_.end()) {
+                    std::erase_if(it->second, [&node_info](const services::index_definition_t& index) {
+                        return index.name == node_info->name();
+                    });
+                }
+                break;
+            }
             case node_type::insert_t: {
                 if (catalog_.table_computes(id)) {
                     // try to replace computed_schema with a fixed one
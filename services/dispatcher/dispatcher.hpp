@@ -54,6 +54,8 @@ namespace services::dispatcher {
         ~manager_dispatcher_t();
 
         void set_run_fn(run_fn_t fn) { run_fn_ = std::move(fn); }
+        // Must be called before sync(): executors capture the pool when they are spawned.
+        void set_task_pool(core::scheduler::task_pool_t* pool) { task_pool_ = pool; }
 
         std::pmr::memory_resource* resource() const noexcept { return resource_; }
         auto make_type() const noexcept -> const char*;
@@ -109,12 +111,15 @@ namespace services::dispatcher {
         actor_zeta::scheduler_raw scheduler_;
         log_t log_;
         run_fn_t run_fn_; // Yield function for cooperative scheduling
+        core::scheduler::task_pool_t* task_pool_{nullptr};
         components::catalog::catalog catalog_;
 
         static constexpr std::size_t executor_pool_size_ = 4;
 
         database_storage_t databases_;
         collection_storage_t collections_;
+        std::unordered_map<collection_full_name_t, services::index_definitions_t, collection_name_hash>
+            index_definitions_;
         std::pmr::vector<services::collection::executor::executor_ptr> executors_;
         std::pmr::vector<actor_zeta::address_t> executor_addresses_;
 
@@ -7,6 +7,7 @@
 #include "logical_plan/node_update.hpp"
 
 #include <components/catalog/table_id.hpp>
+#include <components/index/art_index.hpp>
 #include <components/expressions/aggregate_expression.hpp>
 #include <components/expressions/scalar_expression.hpp>
 #include <components/expressions/sort_expression.hpp>
@@ -17,6 +18,7 @@
 #include <components/logical_plan/node_join.hpp>
 #include <components/logical_plan/node_match.hpp>
 #include <components/logical_plan/node_sort.hpp>
+#include <components/logical_plan/node_window.hpp>
 #include <list>
 #include <queue>
 
@@ -699,6 +701,116 @@ namespace services::dispatcher {
             return schema_result{named_schema{resource}};
         }
 
+        // Expands `*` into the incoming columns, resolves every key of the projection and of the
+        // window specifications and returns the projected schema
+        schema_result<named_schema> validate_schema(std::pmr::memory_resource* resource,
+                                                    node_window_t* node,
+                                                    const named_schema& schema,
+                                                    const std::string& result_alias) {
+            named_schema result(resource);
+            std::pmr::vector<expression_ptr> projection(resource);
+            size_t window = 0;
+            for (auto& expr : node->expressions()) {
+                if (expr->group() == expression_group::scalar) {
+                    auto* column = static_cast<scalar_expression_t*>(expr.get());
+                    auto& key = column->params().empty()
+                                    ? column->key()
+                                    : std::get<components::expressions::key_t>(column->params().front());
+                    if (key.storage().size() == 1 && key.storage().front() == "*") {
+                        for (size_t i = 0; i < schema.size(); i++) {
+                            components::expressions::key_t field_key(resource, schema[i].type.alias());
+                            field_key.set_path(column_path{{i}, resource});
+                            projection.emplace_back(
+                                make_scalar_expression(resource, scalar_type::get_field, field_key));
+                            result.emplace_back(schema[i]);
+                        }
+                        continue;
+                    }
+                    auto field = find_types(resource, key, schema);
+                    if (field.is_error()) {
+                        return schema_result<named_schema>{resource, field.error()};
+                    }
+                    auto type = field.value().front().type;
+                    if (!column->params().empty()) {
+                        type.set_alias(column->key().as_string());
+                    }
+                    result.emplace_back(type_from_t{result_alias, std::move(type)});
+                    projection.emplace_back(expr);
+                    continue;
+                }
+
+                auto* function = static_cast<aggregate_expression_t*>(expr.get());
+                auto& spec = node->windows().at(window++);
+                auto type = window_function_from_name(function->function_name());
+                if (!type) {
+                    return schema_result<named_schema>{
+                        resource,
+                        components::cursor::error_t{error_code_t::unrecognized_function,
+                                                    "function: \'" + function->function_name() +
+                                                        "(...)\' can not be used as a window function"}};
+                }
+                complex_logical_type argument_type(logical_type::NA);
+                bool has_argument = false;
+                for (auto& param : function->params()) {
+                    if (!std::holds_alternative<components::expressions::key_t>(param)) {
+                        continue;
+                    }
+                    auto field = find_types(resource, std::get<components::expressions::key_t>(param), schema);
+                    if (field.is_error()) {
+                        return schema_result<named_schema>{resource, field.error()};
+                    }
+                    if (!has_argument) {
+                        argument_type = field.value().front().type;
+                        has_argument = true;
+                    }
+                }
+                bool arguments_ok = true;
+                switch (*type) {
+                    case window_function_type::row_number:
+                    case window_function_type::rank:
+                    case window_function_type::dense_rank:
+                        arguments_ok = function->params().empty();
+                        break;
+                    case window_function_type::lag:
+                    case window_function_type::lead:
+                        arguments_ok = has_argument && function->params().size() <= 3;
+                        break;
+                    case window_function_type::count:
+                        arguments_ok = function->params().size() <= 1;
+                        break;
+                    default:
+                        arguments_ok = has_argument && function->params().size() == 1 &&
+                                       is_numeric(argument_type.type());
+                        break;
+                }
+                if (!arguments_ok) {
+                    return schema_result<named_schema>{
+                        resource,
+                        components::cursor::error_t{error_code_t::incorrect_function_argument,
+                                                    "function: \'" + function->function_name() +
+                                                        "(...)\' does not accept given set of arguments"}};
+                }
+                for (auto& key : spec.partition_by) {
+                    auto field = find_types(resource, key, schema);
+                    if (field.is_error()) {
+                        return schema_result<named_schema>{resource, field.error()};
+                    }
+                }
+                for (auto& order : spec.order_by) {
+                    auto field = find_types(resource, order->key(), schema);
+                    if (field.is_error()) {
+                        return schema_result<named_schema>{resource, field.error()};
+                    }
+                }
+                auto result_type = window_result_type(*type, argument_type);
+                result_type.set_alias(function->key().as_string());
+                result.emplace_back(type_from_t{result_alias, std::move(result_type)});
+                projection.emplace_back(expr);
+            }
+            node->expressions() = std::move(projection);
+            return schema_result{std::move(result)};
+        }
+
     } // namespace impl
 
     cursor_t_ptr
@@ -787,7 +899,7 @@ namespace services::dispatcher {
                         } else if (it->type() == logical_type::ENUM) {
                             components::vector::vector_t new_column(resource, *it, data_node->data_chunk().capacity());
                             for (size_t i = 0; i < data_node->data_chunk().size(); i++) {
-                                auto val = column.data<std::string_view>()[i];
+                                std::string_view val = column.data<components::types::string_t>()[i];
                                 auto enum_val = logical_value_t::create_enum(resource, *it, val);
                                 if (enum_val.type().type() == logical_type::NA) {
                                     result = make_cursor(resource,
@@ -839,6 +951,7 @@ namespace services::dispatcher {
                 node_group_t* node_group = nullptr;
                 node_match_t* node_match = nullptr;
                 node_sort_t* node_sort = nullptr;
+                node_window_t* node_window = nullptr;
                 node_t* node_data = nullptr;
                 node_t* node_having = nullptr;
                 named_schema table_schema(resource);
@@ -861,6 +974,9 @@ namespace services::dispatcher {
                         case node_type::having_t:
                             node_having = child.get();
                             break;
+                        case node_type::window_t:
+                            node_window = reinterpret_cast<node_window_t*>(child.get());
+                            break;
                         default:
                             node_data = child.get();
                             break;
@@ -918,6 +1034,20 @@ namespace services::dispatcher {
                     }
                 }
 
+                if (node_window) {
+                    auto res = impl::validate_schema(resource, node_window, incoming_schema, node->result_alias());
+                    if (res.is_error()) {
+                        return res;
+                    }
+                    if (node_sort) {
+                        auto sort_res = impl::validate_schema(resource, node_sort, res.value());
+                        if (sort_res.is_error()) {
+                            return sort_res;
+                        }
+                    }
+                    return res;
+                }
+
                 if (!node_group) {
                     if (node_sort) {
                         auto res = impl::validate_schema(resource, node_sort, incoming_schema);
@@ -1525,12 +1655,29 @@ namespace services::dispatcher {
                         table_schema.emplace_back(type_from_t{node->collection_name(), column.type()});
                     }
                 }
-                auto& keys = reinterpret_cast<node_create_index_t*>(node)->keys();
-                for (auto& key : keys) {
+                auto* node_index = reinterpret_cast<node_create_index_t*>(node);
+                // both index over binary-comparable keys, which not every type has
+                bool is_art = node_index->type() == components::logical_plan::index_type::art;
+                bool needs_comparable_keys =
+                    is_art || node_index->type() == components::logical_plan::index_type::hashed;
+                for (auto& key : node_index->keys()) {
                     auto key_res = impl::validate_key(resource, key, table_schema, table_schema, true);
                     if (key_res.is_error()) {
                         return schema_result<named_schema>(resource, key_res.error());
                     }
+                    if (!needs_comparable_keys) {
+                        continue;
+                    }
+                    for (const auto& field : key_res.value()) {
+                        if (!components::index::art_supports_key_type(field.type.type())) {
+                            return schema_result<named_schema>(
+                                resource,
+                                components::cursor::error_t(error_code_t::schema_error,
+                                                            "path: \'" + key.as_string() +
+                                                                "\' has a type that can not be indexed with " +
+                                                                (is_art ? "ART" : "HASH")));
+                        }
+                    }
                 }
                 return schema_result{named_schema{resource}};
             }
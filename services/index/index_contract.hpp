@@ -8,8 +8,10 @@
 #include <components/context/execution_context.hpp>
 #include <components/expressions/compare_expression.hpp>
 #include <components/index/forward.hpp>
+#include <components/index/index.hpp>
 #include <components/logical_plan/node_create_index.hpp>
 #include <components/session/session.hpp>
+#include <components/table/row_id_remap.hpp>
 #include <components/table/row_version_manager.hpp>
 #include <components/types/logical_value.hpp>
 #include <components/vector/data_chunk.hpp>
@@ -59,11 +61,12 @@ namespace services::index {
                                             std::pmr::vector<size_t> row_ids);
 
         // MVCC commit/revert/cleanup
-        unique_future<void> commit_insert(execution_context_t ctx, uint64_t commit_id);
-        unique_future<void> commit_delete(execution_context_t ctx, uint64_t commit_id);
+        unique_future<void> commit_txn(execution_context_t ctx, uint64_t commit_id, bool inserts, bool deletes);
         unique_future<void> revert_insert(execution_context_t ctx);
         unique_future<void> cleanup_all_versions(session_id_t session, uint64_t lowest_active);
         unique_future<void> rebuild_indexes(session_id_t session, collection_full_name_t name);
+        unique_future<void>
+        remap_rows(session_id_t session, collection_full_name_t name, components::table::row_id_remap_t remap);
 
         // DDL: index management
         unique_future<uint32_t> create_index(session_id_t session,
@@ -89,6 +92,16 @@ namespace services::index {
                                                             uint64_t start_time,
                                                             uint64_t txn_id);
 
+        // Ordered range/point lookups for index scans (txn_id == 0 sees committed rows only)
+        unique_future<components::index::index_search_result_t>
+        search_ranges(session_id_t session,
+                      collection_full_name_t name,
+                      components::index::keys_base_storage_t keys,
+                      std::pmr::vector<components::index::index_range_t> ranges,
+                      bool with_keys,
+                      uint64_t start_time,
+                      uint64_t txn_id);
+
         unique_future<bool> has_index(session_id_t session, collection_full_name_t name, index_name_t index_name);
 
         unique_future<void> flush_all_indexes(session_id_t session);
@@ -101,15 +114,16 @@ namespace services::index {
                                                             &index_contract::insert_rows_txn,
                                                             &index_contract::delete_rows_txn,
                                                             &index_contract::update_rows_txn,
-                                                            &index_contract::commit_insert,
-                                                            &index_contract::commit_delete,
+                                                            &index_contract::commit_txn,
                                                             &index_contract::revert_insert,
                                                             &index_contract::cleanup_all_versions,
                                                             &index_contract::rebuild_indexes,
+                                                            &index_contract::remap_rows,
                                                             &index_contract::create_index,
                                                             &index_contract::drop_index,
                                                             &index_contract::search,
                                                             &index_contract::search_txn,
+                                                            &index_contract::search_ranges,
                                                             &index_contract::has_index,
                                                             &index_contract::flush_all_indexes>;
 
@@ -1,6 +1,8 @@
 #include "manager_index.hpp"
 
 #include <actor-zeta/spawn.hpp>
+#include <components/index/art_index.hpp>
+#include <components/index/hash_index.hpp>
 #include <components/index/index_engine.hpp>
 #include <components/index/single_field_index.hpp>
 #include <components/serialization/deserializer.hpp>
@@ -172,12 +174,8 @@ namespace services::index {
                 co_await actor_zeta::dispatch(this, &manager_index_t::update_rows_txn, msg);
                 break;
             }
-            case actor_zeta::msg_id<manager_index_t, &manager_index_t::commit_insert>: {
-                co_await actor_zeta::dispatch(this, &manager_index_t::commit_insert, msg);
-                break;
-            }
-            case actor_zeta::msg_id<manager_index_t, &manager_index_t::commit_delete>: {
-                co_await actor_zeta::dispatch(this, &manager_index_t::commit_delete, msg);
+            case actor_zeta::msg_id<manager_index_t, &manager_index_t::commit_txn>: {
+                co_await actor_zeta::dispatch(this, &manager_index_t::commit_txn, msg);
                 break;
             }
             case actor_zeta::msg_id<manager_index_t, &manager_index_t::revert_insert>: {
@@ -192,10 +190,18 @@ namespace services::index {
                 co_await actor_zeta::dispatch(this, &manager_index_t::rebuild_indexes, msg);
                 break;
             }
+            case actor_zeta::msg_id<manager_index_t, &manager_index_t::remap_rows>: {
+                co_await actor_zeta::dispatch(this, &manager_index_t::remap_rows, msg);
+                break;
+            }
             case actor_zeta::msg_id<manager_index_t, &manager_index_t::search_txn>: {
                 co_await actor_zeta::dispatch(this, &manager_index_t::search_txn, msg);
                 break;
             }
+            case actor_zeta::msg_id<manager_index_t, &manager_index_t::search_ranges>: {
+                co_await actor_zeta::dispatch(this, &manager_index_t::search_ranges, msg);
+                break;
+            }
             case actor_zeta::msg_id<manager_index_t, &manager_index_t::flush_all_indexes>: {
                 co_await actor_zeta::dispatch(this, &manager_index_t::flush_all_indexes, msg);
                 break;
@@ -411,6 +417,14 @@ namespace services::index {
                     components::index::make_index<components::index::single_field_index_t>(engine, index_name, keys);
                 break;
             }
+            case components::logical_plan::index_type::art: {
+                id_index = components::index::make_index<components::index::art_index_t>(engine, index_name, keys);
+                break;
+            }
+            case components::logical_plan::index_type::hashed: {
+                id_index = components::index::make_index<components::index::hash_index_t>(engine, index_name, keys);
+                break;
+            }
             default:
                 trace(log_, "manager_index_t::create_index: unsupported index type");
                 co_return components::index::INDEX_ID_UNDEFINED;
@@ -456,7 +470,9 @@ namespace services::index {
                 }
             }
 
-            // Create disk agent for persistent storage
+            // Create disk agent for persistent storage. It keeps key/row pairs in an index_disk_t whatever
+            // the in-memory engine, so a hash index persists and reloads like the ordered ones; the
+            // metafile records the index type to rebuild on restart.
             if (!path_db_.empty()) {
                 try {
                     auto agent =
@@ -629,19 +645,29 @@ namespace services::index {
 
     // --- MVCC commit/revert/cleanup ---
 
-    manager_index_t::unique_future<void> manager_index_t::commit_insert(execution_context_t ctx, uint64_t commit_id) {
-        auto session = ctx.session;
-        auto txn_id = ctx.txn.transaction_id;
+    manager_index_t::unique_future<void>
+    manager_index_t::commit_txn(execution_context_t ctx, uint64_t commit_id, bool inserts, bool deletes) {
         auto it = engines_.find(ctx.name);
         if (it == engines_.end())
             co_return;
 
-        auto& engine = it->second;
+        if (inserts) {
+            commit_insert(ctx.session, *it->second, ctx.txn.transaction_id, commit_id);
+        }
+        if (deletes) {
+            commit_delete(ctx.session, *it->second, ctx.txn.transaction_id, commit_id);
+        }
+        co_return;
+    }
 
+    void manager_index_t::commit_insert(session_id_t session,
+                                        components::index::index_engine_t& engine,
+                                        uint64_t txn_id,
+                                        uint64_t commit_id) {
         // Mirror committed inserts to disk agents BEFORE commit clears pending maps
         agent_batch_map_t insert_batches;
         agent_addr_map_t insert_addrs;
-        engine->for_each_pending_disk_insert(
+        engine.for_each_pending_disk_insert(
             txn_id,
             [&](const actor_zeta::address_t& agent_addr, const components::index::value_t& key, int64_t row_index) {
                 auto id = reinterpret_cast<uintptr_t>(agent_addr.get());
@@ -656,24 +682,17 @@ namespace services::index {
             pending_void_.emplace_back(std::move(f));
         }
 
-        engine->commit_insert(txn_id, commit_id);
-
-        co_return;
+        engine.commit_insert(txn_id, commit_id);
     }
 
-    manager_index_t::unique_future<void> manager_index_t::commit_delete(execution_context_t ctx, uint64_t commit_id) {
-        auto session = ctx.session;
-        auto txn_id = ctx.txn.transaction_id;
-        auto it = engines_.find(ctx.name);
-        if (it == engines_.end())
-            co_return;
-
-        auto& engine = it->second;
-
+    void manager_index_t::commit_delete(session_id_t session,
+                                        components::index::index_engine_t& engine,
+                                        uint64_t txn_id,
+                                        uint64_t commit_id) {
         // Mirror committed deletes to disk agents BEFORE commit clears pending maps
         agent_batch_map_t remove_batches;
         agent_addr_map_t remove_addrs;
-        engine->for_each_pending_disk_delete(
+        engine.for_each_pending_disk_delete(
             txn_id,
             [&](const actor_zeta::address_t& agent_addr, const components::index::value_t& key, int64_t row_index) {
                 auto id = reinterpret_cast<uintptr_t>(agent_addr.get());
@@ -688,9 +707,7 @@ namespace services::index {
             pending_void_.emplace_back(std::move(f));
         }
 
-        engine->commit_delete(txn_id, commit_id);
-
-        co_return;
+        engine.commit_delete(txn_id, commit_id);
     }
 
     manager_index_t::unique_future<void> manager_index_t::revert_insert(execution_context_t ctx) {
@@ -737,6 +754,55 @@ namespace services::index {
         co_return;
     }
 
+    manager_index_t::unique_future<void> manager_index_t::remap_rows(session_id_t session,
+                                                                     collection_full_name_t name,
+                                                                     components::table::row_id_remap_t remap) {
+        auto it = engines_.find(name);
+        if (it == engines_.end() || remap.empty())
+            co_return;
+
+        auto& engine = it->second;
+
+        // Disk agents get the moved entries as remove + insert; removals go first so that an entry
+        // moving onto a row another one just left is not removed again
+        agent_batch_map_t remove_batches;
+        agent_batch_map_t insert_batches;
+        agent_addr_map_t addrs;
+        engine->for_each_disk_move(remap,
+                                   [&](const actor_zeta::address_t& agent_addr,
+                                       const components::index::value_t& key,
+                                       int64_t old_row,
+                                       int64_t new_row) {
+                                       auto id = reinterpret_cast<uintptr_t>(agent_addr.get());
+                                       addrs.try_emplace(id, agent_addr);
+                                       remove_batches[id].emplace_back(value_t(resource_, key),
+                                                                       static_cast<size_t>(old_row));
+                                       if (new_row != components::table::row_id_remap_t::DROPPED) {
+                                           insert_batches[id].emplace_back(value_t(resource_, key),
+                                                                           static_cast<size_t>(new_row));
+                                       }
+                                   });
+        for (auto& [id, batch] : remove_batches) {
+            auto& addr = addrs.at(id);
+            auto [ns, f] =
+                actor_zeta::otterbrix::send(addr, &index_agent_disk_t::remove_many, session, std::move(batch));
+            schedule_agent(addr, ns);
+            pending_void_.emplace_back(std::move(f));
+        }
+        for (auto& [id, batch] : insert_batches) {
+            auto& addr = addrs.at(id);
+            auto [ns, f] =
+                actor_zeta::otterbrix::send(addr, &index_agent_disk_t::insert_many, session, std::move(batch));
+            schedule_agent(addr, ns);
+            pending_void_.emplace_back(std::move(f));
+        }
+
+        engine->remap_rows(remap);
+        trace(log_, "manager_index_t::remap_rows: patched indexes for {}", name.to_string());
+
+        co_return;
+    }
+
     // --- Txn-aware Query ---
 
     manager_index_t::unique_future<std::pmr::vector<int64_t>>
@@ -760,6 +826,35 @@ namespace services::index {
         co_return index->search(compare, value, start_time, txn_id);
     }
 
+    manager_index_t::unique_future<components::index::index_search_result_t>
+    manager_index_t::search_ranges(session_id_t /*session*/,
+                                   collection_full_name_t name,
+                                   components::index::keys_base_storage_t keys,
+                                   std::pmr::vector<components::index::index_range_t> ranges,
+                                   bool with_keys,
+                                   uint64_t start_time,
+                                   uint64_t txn_id) {
+        components::index::index_search_result_t result(resource_);
+
+        auto it = engines_.find(name);
+        if (it == engines_.end())
+            co_return result;
+
+        auto* index = components::index::search_index(it->second, keys);
+        if (!index)
+            co_return result;
+
+        for (const auto& range : ranges) {
+            index->scan_range(range, start_time, txn_id, [&](const components::index::value_t& key, int64_t row) {
+                result.row_ids.push_back(row);
+                if (with_keys) {
+                    result.keys.emplace_back(resource_, key);
+                }
+            });
+        }
+        co_return result;
+    }
+
     // --- Index metafile persistence ---
 
     void manager_index_t::write_index_to_metafile(const components::logical_plan::node_create_index_ptr& index) {
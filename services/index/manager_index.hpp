@@ -83,12 +83,13 @@ namespace services::index {
                                             std::unique_ptr<components::vector::data_chunk_t> new_data,
                                             std::pmr::vector<size_t> row_ids);
 
-        // MVCC commit/revert/cleanup
-        unique_future<void> commit_insert(execution_context_t ctx, uint64_t commit_id);
-        unique_future<void> commit_delete(execution_context_t ctx, uint64_t commit_id);
+        // MVCC commit/revert/cleanup. A transaction's inserted and deleted entries commit in one message.
+        unique_future<void> commit_txn(execution_context_t ctx, uint64_t commit_id, bool inserts, bool deletes);
         unique_future<void> revert_insert(execution_context_t ctx);
         unique_future<void> cleanup_all_versions(session_id_t session, uint64_t lowest_active);
         unique_future<void> rebuild_indexes(session_id_t session, collection_full_name_t name);
+        unique_future<void>
+        remap_rows(session_id_t session, collection_full_name_t name, components::table::row_id_remap_t remap);
 
         // DDL: index management
         unique_future<uint32_t> create_index(session_id_t session,
@@ -114,6 +115,16 @@ namespace services::index {
                                                             uint64_t start_time,
                                                             uint64_t txn_id);
 
+        // Ordered range/point lookups for index scans (txn_id == 0 sees committed rows only)
+        unique_future<components::index::index_search_result_t>
+        search_ranges(session_id_t session,
+                      collection_full_name_t name,
+                      components::index::keys_base_storage_t keys,
+                      std::pmr::vector<components::index::index_range_t> ranges,
+                      bool with_keys,
+                      uint64_t start_time,
+                      uint64_t txn_id);
+
         unique_future<bool> has_index(session_id_t session, collection_full_name_t name, index_name_t index_name);
 
         unique_future<void> flush_all_indexes(session_id_t session);
@@ -127,15 +138,16 @@ namespace services::index {
                                                        &manager_index_t::insert_rows_txn,
                                                        &manager_index_t::delete_rows_txn,
                                                        &manager_index_t::update_rows_txn,
-                                                       &manager_index_t::commit_insert,
-                                                       &manager_index_t::commit_delete,
+                                                       &manager_index_t::commit_txn,
                                                        &manager_index_t::revert_insert,
                                                        &manager_index_t::cleanup_all_versions,
                                                        &manager_index_t::rebuild_indexes,
+                                                       &manager_index_t::remap_rows,
                                                        &manager_index_t::create_index,
                                                        &manager_index_t::drop_index,
                                                        &manager_index_t::search,
                                                        &manager_index_t::search_txn,
+                                                       &manager_index_t::search_ranges,
                                                        &manager_index_t::has_index,
                                                        &manager_index_t::flush_all_indexes>;
 
@@ -170,6 +182,15 @@ namespace services::index {
         // Find disk agent by address and schedule it if needed
         void schedule_agent(const actor_zeta::address_t& addr, bool needs_sched);
 
+        void commit_insert(session_id_t session,
+                           components::index::index_engine_t& engine,
+                           uint64_t txn_id,
+                           uint64_t commit_id);
+        void commit_delete(session_id_t session,
+                           components::index::index_engine_t& engine,
+                           uint64_t txn_id,
+                           uint64_t commit_id);
+
         // Pending futures
         std::pmr::vector<unique_future<void>> pending_void_;
         void poll_pending();